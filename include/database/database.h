@@ -24,6 +24,12 @@ typedef struct regislex_db_stmt regislex_db_stmt_t;
 typedef struct regislex_db_result regislex_db_result_t;
 typedef struct regislex_db_transaction regislex_db_transaction_t;
 
+/**
+ * @brief Work deferred until a transaction commits
+ * @param data Block passed to regislex_db_after_commit()
+ */
+typedef void (*regislex_db_commit_hook_t)(void* data);
+
 /**
  * @brief Database column type
  */
@@ -97,6 +103,13 @@ bool regislex_db_is_connected(regislex_db_context_t* ctx);
  */
 const char* regislex_db_error(regislex_db_context_t* ctx);
 
+/**
+ * @brief Get the database connection owned by a RegisLex context
+ * @param ctx RegisLex context
+ * @return Database context, or NULL if not initialized
+ */
+regislex_db_context_t* regislex_get_db(regislex_context_t* ctx);
+
 /* ============================================================================
  * Migration Functions
  * ============================================================================ */
@@ -123,6 +136,12 @@ regislex_error_t regislex_db_migration_version(regislex_db_context_t* ctx,
 
 /**
  * @brief Begin a transaction
+ *
+ * Waits while another thread has a transaction open; prepare, step and
+ * exec wait the same way, so other threads' statements never run inside
+ * it. Called again on the owning thread, it opens a savepoint nested in
+ * the current transaction.
+ *
  * @param ctx Database context
  * @param tx Output transaction handle
  * @return Error code
@@ -144,6 +163,32 @@ regislex_error_t regislex_db_commit(regislex_db_transaction_t* tx);
  */
 regislex_error_t regislex_db_rollback(regislex_db_transaction_t* tx);
 
+/**
+ * @brief Check whether the calling thread has a transaction open
+ * @param ctx Database context
+ * @return true inside regislex_db_begin() ... commit/rollback on this thread
+ */
+bool regislex_db_in_transaction(regislex_db_context_t* ctx);
+
+/**
+ * @brief Run work once the calling thread's changes are committed
+ *
+ * With no transaction open on the calling thread the hook runs at once.
+ * Otherwise it is queued and runs after the outermost commit, in the
+ * order queued; rolling back the transaction, or the savepoint it was
+ * queued in, drops it. Use it for in-memory indexes and event publishing
+ * that must not see changes that may still roll back.
+ *
+ * @param ctx Database context
+ * @param hook Work to run
+ * @param data Heap block passed to hook, freed with platform_free()
+ *             afterwards or when dropped; also freed on failure
+ * @return Error code
+ */
+regislex_error_t regislex_db_after_commit(regislex_db_context_t* ctx,
+                                          regislex_db_commit_hook_t hook,
+                                          void* data);
+
 /* ============================================================================
  * Query Execution Functions
  * ============================================================================ */
@@ -248,6 +293,21 @@ regislex_error_t regislex_db_bind_blob(regislex_db_stmt_t* stmt, int index,
 regislex_error_t regislex_db_bind_uuid(regislex_db_stmt_t* stmt, int index,
                                        const regislex_uuid_t* uuid);
 
+/**
+ * @brief Bind an optional foreign key
+ *
+ * For writing reference columns only: an unset UUID is stored as SQL
+ * NULL so the foreign key is satisfied. Comparisons use
+ * regislex_db_bind_uuid().
+ *
+ * @param stmt Statement handle
+ * @param index Parameter index (1-based)
+ * @param uuid UUID value (NULL or empty binds SQL NULL)
+ * @return Error code
+ */
+regislex_error_t regislex_db_bind_uuid_ref(regislex_db_stmt_t* stmt, int index,
+                                           const regislex_uuid_t* uuid);
+
 /**
  * @brief Bind datetime parameter
  * @param stmt Statement handle
@@ -374,19 +434,167 @@ regislex_error_t regislex_db_column_money(regislex_db_stmt_t* stmt, int index,
                                           regislex_money_t* money);
 
 /**
- * @brief Get last inserted row ID
+ * @brief Get the row ID of the calling thread's last insert
  * @param ctx Database context
  * @return Row ID
  */
 int64_t regislex_db_last_insert_id(regislex_db_context_t* ctx);
 
 /**
- * @brief Get number of rows affected by last statement
+ * @brief Get number of rows affected by the calling thread's last statement
  * @param ctx Database context
  * @return Row count
  */
 int regislex_db_changes(regislex_db_context_t* ctx);
 
+/* ============================================================================
+ * Row Decoders
+ *
+ * Shared by modules that load another module's records in bulk. Each
+ * decoder expects its columns in the order of the matching *_COLUMNS list.
+ * ============================================================================ */
+
+#define REGISLEX_DEADLINE_COLUMNS \
+    "id, case_id, matter_id, title, description, type, status, priority," \
+    "  due_date, start_date, is_all_day, duration_minutes, recurrence," \
+    "  assigned_to_id, rule_reference, days_from_trigger, count_business_days," \
+    "  completed_at, completed_by, completion_notes, location, tags," \
+    "  created_at, updated_at, created_by, rrule"
+
+#define REGISLEX_TASK_COLUMNS \
+    "id, case_id, matter_id, workflow_run_id, parent_task_id," \
+    "  title, description, status, priority," \
+    "  assigned_to_id, assigned_by, due_date," \
+    "  estimated_minutes, actual_minutes, percent_complete," \
+    "  completion_notes, requires_approval, approver_id, approved_at," \
+    "  started_at, completed_at, created_at, updated_at, created_by"
+
+#define REGISLEX_DOCUMENT_SUMMARY_COLUMNS \
+    "id, case_id, matter_id, folder_id, name, display_name, description," \
+    "  type, status, access_level, current_version, file_name, mime_type," \
+    "  file_size, storage_path, checksum, tags, bates_number, exhibit_number," \
+    "  filed_date, is_locked, locked_by, locked_at, is_encrypted, ocr_processed," \
+    "  created_at, updated_at, created_by, updated_by"
+
+/**
+ * @brief Decode a deadline row selected with REGISLEX_DEADLINE_COLUMNS
+ * @param stmt Statement positioned on a row
+ * @param deadline Output deadline
+ * @return Error code
+ */
+regislex_error_t regislex_deadline_from_row(regislex_db_stmt_t* stmt,
+                                            regislex_deadline_t* deadline);
+
+/**
+ * @brief Decode a task row selected with REGISLEX_TASK_COLUMNS
+ * @param stmt Statement positioned on a row
+ * @param task Output task
+ * @return Error code
+ */
+regislex_error_t regislex_task_from_row(regislex_db_stmt_t* stmt,
+                                        regislex_task_t* task);
+
+/**
+ * @brief Decode a document row selected with REGISLEX_DOCUMENT_SUMMARY_COLUMNS
+ *
+ * Extracted text and version history are not loaded.
+ *
+ * @param stmt Statement positioned on a row
+ * @param document Output document
+ * @return Error code
+ */
+regislex_error_t regislex_document_from_row(regislex_db_stmt_t* stmt,
+                                            regislex_document_t* document);
+
+/* ============================================================================
+ * Metadata Store
+ *
+ * Typed key/value metadata lives in one table per owner (case_metadata,
+ * deadline_metadata) indexed by (key, value), so filters resolve with an
+ * index range scan per predicate.
+ * ============================================================================ */
+
+/**
+ * @brief Set one metadata value, replacing any previous value for the key
+ * @param ctx Database context
+ * @param table Metadata table
+ * @param owner_column Owner ID column in that table
+ * @param owner_id Owner ID
+ * @param item Key, value and type
+ * @return Error code (REGISLEX_ERROR_VALIDATION if the value does not convert)
+ */
+regislex_error_t regislex_db_metadata_set(regislex_db_context_t* ctx,
+                                          const char* table,
+                                          const char* owner_column,
+                                          const regislex_uuid_t* owner_id,
+                                          const regislex_metadata_t* item);
+
+/**
+ * @brief Delete metadata for an owner
+ * @param ctx Database context
+ * @param table Metadata table
+ * @param owner_column Owner ID column in that table
+ * @param owner_id Owner ID
+ * @param key Key to delete, or NULL for all keys
+ * @return Error code
+ */
+regislex_error_t regislex_db_metadata_delete(regislex_db_context_t* ctx,
+                                             const char* table,
+                                             const char* owner_column,
+                                             const regislex_uuid_t* owner_id,
+                                             const char* key);
+
+/**
+ * @brief Load all metadata for an owner, ordered by key
+ * @param ctx Database context
+ * @param table Metadata table
+ * @param owner_column Owner ID column in that table
+ * @param owner_id Owner ID
+ * @param out_items Output array (free with regislex_metadata_free)
+ * @param out_count Output count
+ * @return Error code
+ */
+regislex_error_t regislex_db_metadata_load(regislex_db_context_t* ctx,
+                                           const char* table,
+                                           const char* owner_column,
+                                           const regislex_uuid_t* owner_id,
+                                           regislex_metadata_t** out_items,
+                                           int* out_count);
+
+/**
+ * @brief Append metadata predicates to a WHERE clause
+ *
+ * Each filter becomes "<id_column> IN (SELECT owner FROM table WHERE ...)".
+ *
+ * @param where WHERE clause being built (starts empty)
+ * @param size Buffer size
+ * @param table Metadata table
+ * @param owner_column Owner ID column in that table
+ * @param id_column Column of the outer query matched against the owner
+ * @param filters Filters
+ * @param count Number of filters
+ * @return Error code
+ */
+regislex_error_t regislex_db_metadata_filter_sql(char* where, size_t size,
+                                                 const char* table,
+                                                 const char* owner_column,
+                                                 const char* id_column,
+                                                 const regislex_metadata_filter_t* filters,
+                                                 int count);
+
+/**
+ * @brief Bind the parameters added by regislex_db_metadata_filter_sql
+ * @param stmt Statement
+ * @param index In/out next parameter index
+ * @param filters Filters
+ * @param count Number of filters
+ * @return Error code
+ */
+regislex_error_t regislex_db_metadata_filter_bind(regislex_db_stmt_t* stmt,
+                                                  int* index,
+                                                  const regislex_metadata_filter_t* filters,
+                                                  int count);
+
 /* ============================================================================
  * Query Builder Functions
  * ============================================================================ */
@@ -99,6 +99,15 @@ typedef enum {
     REGISLEX_OUTCOME_OTHER
 } regislex_case_outcome_t;
 
+/**
+ * @brief Party field a conflict match was found on
+ */
+typedef enum {
+    REGISLEX_CONFLICT_FIELD_NAME = 0,
+    REGISLEX_CONFLICT_FIELD_ATTORNEY_NAME,
+    REGISLEX_CONFLICT_FIELD_ATTORNEY_FIRM
+} regislex_conflict_field_t;
+
 /* ============================================================================
  * Structures
  * ============================================================================ */
@@ -198,6 +207,14 @@ struct regislex_case {
     int party_count;
     regislex_party_t** parties;
 
+    /* Related records (populated by regislex_case_get_full) */
+    int deadline_count;
+    regislex_deadline_t** deadlines;
+    int task_count;
+    regislex_task_t** tasks;
+    int document_count;
+    regislex_document_t** documents;
+
     /* Metadata */
     int metadata_count;
     regislex_metadata_t* metadata;
@@ -208,6 +225,9 @@ struct regislex_case {
     regislex_datetime_t updated_at;
     regislex_uuid_t created_by;
     regislex_uuid_t updated_by;
+
+    /* Owns this case and all related records when loaded by regislex_case_get_full */
+    void* arena;
 };
 
 /**
@@ -248,6 +268,8 @@ typedef struct {
     int limit;
     const char* order_by;
     bool order_desc;
+    const regislex_metadata_filter_t* metadata;    /* All must match */
+    int metadata_count;
 } regislex_case_filter_t;
 
 /**
@@ -261,6 +283,126 @@ typedef struct {
     int limit;
 } regislex_case_list_t;
 
+/**
+ * @brief Streaming cursor over a case query
+ */
+typedef struct regislex_case_cursor regislex_case_cursor_t;
+
+/**
+ * @brief Per-row callback for streaming case queries
+ * @return false to stop iteration
+ */
+typedef bool (*regislex_case_visitor_t)(const regislex_case_t* case_item, void* user_data);
+
+/**
+ * @brief Aggregates over a case and all of its descendants
+ */
+typedef struct {
+    int case_count;
+    int open_case_count;
+    int max_depth;
+    int deadline_count;
+    int open_deadline_count;
+    int overdue_deadline_count;
+    regislex_money_t total_invoiced;
+    regislex_money_t total_paid;
+} regislex_case_subtree_stats_t;
+
+/**
+ * @brief Counter dimensions tracked for a single case
+ */
+typedef struct {
+    regislex_status_t status;
+    regislex_case_type_t type;
+    regislex_uuid_t assigned_to_id;     /* Empty when unassigned */
+} regislex_caseload_key_t;
+
+#define REGISLEX_CASELOAD_STATUS_COUNT  (REGISLEX_STATUS_CANCELLED + 1)
+#define REGISLEX_CASELOAD_TYPE_COUNT    (REGISLEX_CASE_TYPE_OTHER + 1)
+
+/**
+ * @brief Caseload totals by status and type
+ */
+typedef struct {
+    int total;
+    int open;                   /* Status before COMPLETED */
+    int unassigned;
+    int by_status[REGISLEX_CASELOAD_STATUS_COUNT];
+    int by_type[REGISLEX_CASELOAD_TYPE_COUNT];
+} regislex_caseload_summary_t;
+
+/**
+ * @brief Number of cases assigned to one user
+ */
+typedef struct {
+    regislex_uuid_t user_id;
+    int count;
+} regislex_caseload_assignee_t;
+
+/**
+ * @brief How reassigned work is spread across the receiving users
+ */
+typedef enum {
+    REGISLEX_REASSIGN_ROUND_ROBIN = 0,
+    REGISLEX_REASSIGN_WEIGHTED
+} regislex_reassign_strategy_t;
+
+/**
+ * @brief User receiving reassigned work
+ */
+typedef struct {
+    regislex_uuid_t user_id;
+    int weight;                 /* Relative share for WEIGHTED; ignored otherwise */
+} regislex_reassign_target_t;
+
+/**
+ * @brief Progress callback for bulk reassignment
+ * @param done Items reassigned so far
+ * @param total Items found to reassign
+ * @param user_data User data from the options
+ * @return false to stop after the current batch
+ */
+typedef bool (*regislex_reassign_progress_t)(int done, int total, void* user_data);
+
+/**
+ * @brief Bulk reassignment options
+ */
+typedef struct {
+    regislex_reassign_strategy_t strategy;
+    int batch_size;             /* Rows per transaction, 0 for the default */
+    bool follow_case;           /* Tasks and deadlines go to their case's new assignee */
+    regislex_reassign_progress_t progress;
+    void* user_data;
+} regislex_reassign_options_t;
+
+/**
+ * @brief Bulk reassignment outcome
+ */
+typedef struct {
+    int cases;
+    int tasks;
+    int deadlines;
+    int reminders;
+    bool stopped;               /* Progress callback asked to stop */
+} regislex_reassign_result_t;
+
+/**
+ * @brief Potential conflict of interest found by a party name search
+ */
+typedef struct {
+    regislex_uuid_t party_id;
+    regislex_uuid_t case_id;
+    char party_name[REGISLEX_MAX_NAME_LENGTH];
+    regislex_conflict_field_t field;
+    char matched_name[REGISLEX_MAX_NAME_LENGTH];    /* Party, attorney or firm name that matched */
+    regislex_party_role_t role;
+    char case_number[64];
+    char case_title[REGISLEX_MAX_NAME_LENGTH];
+    regislex_status_t case_status;
+    double score;               /* 0.0 - 1.0, 1.0 for an exact normalized match */
+    bool phonetic_match;
+} regislex_conflict_match_t;
+
 /* ============================================================================
  * Case Management Functions
  * ============================================================================ */
@@ -291,6 +433,24 @@ REGISLEX_API regislex_error_t regislex_case_get(
     regislex_case_t** out_case
 );
 
+/**
+ * @brief Get a case with its parties, deadlines, tasks and documents
+ *
+ * Issues one query per collection regardless of how many related
+ * records exist. Everything is allocated from a single arena that
+ * regislex_case_free() releases at once.
+ *
+ * @param ctx Context
+ * @param id Case ID
+ * @param out_case Output case
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_case_get_full(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* id,
+    regislex_case_t** out_case
+);
+
 /**
  * @brief Get a case by case number
  * @param ctx Context
@@ -306,6 +466,9 @@ REGISLEX_API regislex_error_t regislex_case_get_by_number(
 
 /**
  * @brief Update a case
+ *
+ * A non-NULL metadata array replaces the case's stored metadata.
+ *
  * @param ctx Context
  * @param case_data Updated case data
  * @return Error code
@@ -339,6 +502,56 @@ REGISLEX_API regislex_error_t regislex_case_list(
     regislex_case_list_t** out_list
 );
 
+/**
+ * @brief Open a cursor over cases matching a filter
+ *
+ * Unlike regislex_case_list(), no default page size is applied; the
+ * filter's limit and offset are honoured when set. Rows are decoded one
+ * at a time into a buffer owned by the cursor.
+ *
+ * @param ctx Context
+ * @param filter Filter criteria (NULL for all)
+ * @param out_cursor Output cursor (close with regislex_case_cursor_close)
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_case_cursor_open(
+    regislex_context_t* ctx,
+    const regislex_case_filter_t* filter,
+    regislex_case_cursor_t** out_cursor
+);
+
+/**
+ * @brief Advance a case cursor
+ * @param cursor Cursor
+ * @param out_case Output row, valid until the next call or close
+ * @return REGISLEX_OK for a row, REGISLEX_ERROR_NOT_FOUND at the end
+ */
+REGISLEX_API regislex_error_t regislex_case_cursor_next(
+    regislex_case_cursor_t* cursor,
+    const regislex_case_t** out_case
+);
+
+/**
+ * @brief Close a case cursor
+ * @param cursor Cursor to close
+ */
+REGISLEX_API void regislex_case_cursor_close(regislex_case_cursor_t* cursor);
+
+/**
+ * @brief Visit cases matching a filter without building a list
+ * @param ctx Context
+ * @param filter Filter criteria (NULL for all)
+ * @param visitor Called per case; return false to stop early
+ * @param user_data Passed to visitor
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_case_foreach(
+    regislex_context_t* ctx,
+    const regislex_case_filter_t* filter,
+    regislex_case_visitor_t visitor,
+    void* user_data
+);
+
 /**
  * @brief Free a case structure
  * @param case_ptr Case to free
@@ -377,6 +590,104 @@ REGISLEX_API regislex_error_t regislex_case_assign(
     const regislex_uuid_t* user_id
 );
 
+/* ============================================================================
+ * Case Hierarchy Functions
+ *
+ * Parent/child links (parent_case_id) are mirrored into a closure table
+ * by regislex_case_create() and regislex_case_update(), so these queries
+ * are index range scans rather than recursive walks.
+ * ============================================================================ */
+
+/**
+ * @brief List all descendants of a case
+ * @param ctx Context
+ * @param root_id Root case ID
+ * @param max_depth Maximum levels below the root (0 for unlimited)
+ * @param out_list Output case list, ordered by depth then case number
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_case_subtree(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* root_id,
+    int max_depth,
+    regislex_case_list_t** out_list
+);
+
+/**
+ * @brief Get the ancestor path of a case
+ * @param ctx Context
+ * @param id Case ID
+ * @param out_list Output case list, from the top-level case down to the parent
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_case_ancestors(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* id,
+    regislex_case_list_t** out_list
+);
+
+/**
+ * @brief Compute deadline and spend aggregates for a case subtree
+ * @param ctx Context
+ * @param root_id Root case ID (included in the aggregates)
+ * @param stats Output statistics
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_case_subtree_stats(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* root_id,
+    regislex_case_subtree_stats_t* stats
+);
+
+/* ============================================================================
+ * Case Metadata Functions
+ * ============================================================================ */
+
+/**
+ * @brief Set a typed metadata value on a case
+ * @param ctx Context
+ * @param case_id Case ID
+ * @param key Metadata key
+ * @param type Value type
+ * @param value Value text, converted according to type
+ * @return Error code (REGISLEX_ERROR_VALIDATION if the value does not convert)
+ */
+REGISLEX_API regislex_error_t regislex_case_metadata_set(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* case_id,
+    const char* key,
+    regislex_metadata_type_t type,
+    const char* value
+);
+
+/**
+ * @brief Get all metadata of a case
+ * @param ctx Context
+ * @param case_id Case ID
+ * @param out_metadata Output array (free with regislex_metadata_free)
+ * @param out_count Output count
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_case_metadata_get(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* case_id,
+    regislex_metadata_t** out_metadata,
+    int* out_count
+);
+
+/**
+ * @brief Remove a metadata key from a case
+ * @param ctx Context
+ * @param case_id Case ID
+ * @param key Metadata key
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_case_metadata_delete(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* case_id,
+    const char* key
+);
+
 /* ============================================================================
  * Party Management Functions
  * ============================================================================ */
@@ -441,6 +752,219 @@ REGISLEX_API regislex_error_t regislex_party_list(
  */
 REGISLEX_API void regislex_party_free(regislex_party_t* party);
 
+/* ============================================================================
+ * Conflict Check Functions
+ * ============================================================================ */
+
+/**
+ * @brief Normalize a party name for conflict matching
+ *
+ * Case-folds, strips punctuation, collapses whitespace and removes
+ * trailing corporate suffixes (Inc, LLC, Corp, Ltd, ...).
+ *
+ * @param name Party name
+ * @param out Output buffer
+ * @param out_size Output buffer size
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_conflict_normalize_name(
+    const char* name,
+    char* out,
+    size_t out_size
+);
+
+/**
+ * @brief Initialize the conflict index and load all parties
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_conflict_index_init(regislex_context_t* ctx);
+
+/**
+ * @brief Release the conflict index
+ */
+REGISLEX_API void regislex_conflict_index_shutdown(void);
+
+/**
+ * @brief Rebuild the conflict index from the parties table
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_conflict_index_rebuild(regislex_context_t* ctx);
+
+/**
+ * @brief Add a party to the conflict index
+ *
+ * Called by regislex_party_add(); persists the party's match keys.
+ *
+ * @param ctx Context
+ * @param case_id Case the party belongs to
+ * @param party Party to index
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_conflict_index_add(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* case_id,
+    const regislex_party_t* party
+);
+
+/**
+ * @brief Remove a case's parties from the conflict index
+ *
+ * Called by regislex_case_delete(). Inside a transaction the parties leave
+ * the index once it commits.
+ *
+ * @param ctx Context
+ * @param case_id Deleted case
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_conflict_index_remove_case(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* case_id
+);
+
+/**
+ * @brief Search all parties for potential conflicts with a name
+ *
+ * A party's name, its attorney's name and its attorney's firm are indexed
+ * separately; a party may be returned once for each that matches, with
+ * the matching one in field and matched_name. Candidates are names
+ * sharing trigrams or the phonetic key of the query. A name with the same
+ * phonetic key scores at least 0.5.
+ *
+ * @param ctx Context
+ * @param name Name to check
+ * @param max_results Maximum matches to return
+ * @param min_score Minimum similarity score (0.0 - 1.0)
+ * @param matches Output match array, best match first
+ * @param count Output count
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_conflict_check(
+    regislex_context_t* ctx,
+    const char* name,
+    int max_results,
+    double min_score,
+    regislex_conflict_match_t** matches,
+    int* count
+);
+
+/**
+ * @brief Free conflict matches
+ * @param matches Matches to free
+ */
+REGISLEX_API void regislex_conflict_matches_free(regislex_conflict_match_t* matches);
+
+/* ============================================================================
+ * Caseload Counter Functions
+ * ============================================================================ */
+
+/**
+ * @brief Load the caseload counter mirror from the database
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_caseload_init(regislex_context_t* ctx);
+
+/**
+ * @brief Release the caseload counter mirror
+ */
+REGISLEX_API void regislex_caseload_shutdown(void);
+
+/**
+ * @brief Reload the counter mirror from the case_counters table
+ *
+ * The table is maintained by triggers on every write to cases; call this
+ * after changing cases outside the case management API.
+ *
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_caseload_refresh(regislex_context_t* ctx);
+
+/**
+ * @brief Apply a committed case change to the counter mirror
+ * @param removed Key the case was counted under before, or NULL
+ * @param added Key the case is counted under now, or NULL
+ */
+REGISLEX_API void regislex_caseload_apply(
+    const regislex_caseload_key_t* removed,
+    const regislex_caseload_key_t* added
+);
+
+/**
+ * @brief Get caseload totals by status and type
+ * @param ctx Context
+ * @param summary Output summary
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_caseload_summary(
+    regislex_context_t* ctx,
+    regislex_caseload_summary_t* summary
+);
+
+/**
+ * @brief Get the number of cases assigned to a user
+ * @param ctx Context
+ * @param user_id User ID
+ * @param count Output count
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_caseload_assignee_count(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* user_id,
+    int* count
+);
+
+/**
+ * @brief Get case counts for every assignee with at least one case
+ * @param ctx Context
+ * @param assignees Output array (caller frees with regislex_caseload_assignees_free)
+ * @param count Output count
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_caseload_by_assignee(
+    regislex_context_t* ctx,
+    regislex_caseload_assignee_t** assignees,
+    int* count
+);
+
+/**
+ * @brief Free an assignee count array
+ * @param assignees Array to free
+ */
+REGISLEX_API void regislex_caseload_assignees_free(regislex_caseload_assignee_t* assignees);
+
+/* ============================================================================
+ * Bulk Reassignment Functions
+ * ============================================================================ */
+
+/**
+ * @brief Move all open work from one user to one or more users
+ *
+ * Reassigns open cases, open tasks, open deadlines and unsent reminders.
+ * Rows are updated in batched transactions; batches already committed stay
+ * committed if a later batch fails or the progress callback stops the run.
+ * Each batch of cases moves the caseload counters when it commits; the
+ * schedules and agendas are rebuilt once after the last batch.
+ *
+ * @param ctx Context
+ * @param from_user_id User whose work is moved
+ * @param targets Receiving users
+ * @param target_count Number of receiving users
+ * @param options Options (NULL for round-robin with defaults)
+ * @param result Output counts (may be NULL)
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_reassign_open_work(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* from_user_id,
+    const regislex_reassign_target_t* targets,
+    int target_count,
+    const regislex_reassign_options_t* options,
+    regislex_reassign_result_t* result
+);
+
 /* ============================================================================
  * Matter Management Functions
  * ============================================================================ */
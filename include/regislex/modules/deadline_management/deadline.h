@@ -108,6 +108,8 @@ struct regislex_deadline {
     regislex_recurrence_t recurrence;
     int recurrence_interval;
     regislex_datetime_t recurrence_end;
+    char rrule[256];                        /* Series rule; empty for one-off deadlines */
+    regislex_datetime_t occurrence_date;    /* Original date of an expanded occurrence */
 
     /* Assignment */
     regislex_uuid_t assigned_to_id;
@@ -135,6 +137,76 @@ struct regislex_deadline {
     regislex_datetime_t updated_at;
 };
 
+/**
+ * @brief Recurrence frequency
+ */
+typedef enum {
+    REGISLEX_RRULE_DAILY = 0,
+    REGISLEX_RRULE_WEEKLY,
+    REGISLEX_RRULE_MONTHLY,
+    REGISLEX_RRULE_YEARLY
+} regislex_rrule_freq_t;
+
+/**
+ * @brief Parsed recurrence rule (RFC 5545 RRULE subset)
+ *
+ * Supports FREQ, INTERVAL, COUNT, UNTIL, BYDAY (weekdays for weekly rules,
+ * or one ordinal weekday such as 2TU or -1FR for monthly rules) and
+ * BYMONTHDAY (monthly; negative counts back from the month end).
+ */
+typedef struct {
+    regislex_rrule_freq_t freq;
+    int interval;
+    int count;                      /* 0 = unbounded */
+    regislex_datetime_t until;      /* Inclusive; zero = no end */
+    uint8_t weekdays;               /* BYDAY bits, bit 0 = Sunday */
+    int weekday_ordinal;            /* Monthly BYDAY ordinal, 0 = none */
+    int month_day;                  /* BYMONTHDAY, 0 = none */
+} regislex_rrule_t;
+
+/**
+ * @brief Lazy occurrence iterator over a recurrence rule
+ */
+typedef struct {
+    regislex_rrule_t rule;
+    regislex_datetime_t dtstart;
+    regislex_datetime_t window_start;
+    int64_t period;
+    int64_t emitted;
+    int64_t candidates[7];
+    int candidate_count;
+    int candidate_pos;
+    bool done;
+} regislex_rrule_iter_t;
+
+/**
+ * @brief Override of one occurrence of a recurring deadline
+ */
+typedef struct {
+    regislex_datetime_t occurrence_date;    /* Original date of the occurrence */
+    bool is_cancelled;
+    bool is_completed;
+    regislex_datetime_t due_date;           /* Moved date; zero keeps the original */
+    char title[REGISLEX_MAX_NAME_LENGTH];   /* Empty keeps the series title */
+} regislex_deadline_exception_t;
+
+/**
+ * @brief Rendered iCalendar feed for one user
+ *
+ * A feed requested with a sync token holds only the deadlines changed
+ * since that token; removed ones appear as cancelled events.
+ */
+typedef struct {
+    char* data;                 /* VCALENDAR text; NULL when not modified */
+    size_t length;
+    char etag[32];              /* Quoted entity tag for the feed */
+    char sync_token[32];        /* Pass back to receive the next delta */
+    bool not_modified;          /* Nothing changed; answer 304 */
+    bool is_delta;
+    int event_count;
+    int removed_count;
+} regislex_calendar_feed_t;
+
 /**
  * @brief Reminder configuration
  */
@@ -152,17 +224,55 @@ struct regislex_reminder {
     regislex_datetime_t created_at;
 };
 
+/**
+ * @brief Reminder delivery callback
+ *
+ * Called from the dispatcher thread, outside any transaction. Returning
+ * anything but REGISLEX_OK leaves the reminder unsent and retries it later.
+ */
+typedef regislex_error_t (*regislex_reminder_handler_t)(
+    regislex_context_t* ctx,
+    const regislex_reminder_t* reminder,
+    void* user_data
+);
+
+/**
+ * @brief Reminder dispatcher options (zero fields take defaults)
+ */
+typedef struct {
+    int horizon_minutes;    /* How far ahead reminders are loaded (default 60) */
+    int batch_size;         /* Reminders delivered per wake-up (default 100) */
+    int retry_seconds;      /* Delay before a failed delivery is retried (default 60) */
+} regislex_reminder_dispatcher_options_t;
+
+/**
+ * @brief When a limitation period starts to run
+ */
+typedef enum {
+    REGISLEX_ACCRUAL_INCIDENT = 0,  /* From the accrual date */
+    REGISLEX_ACCRUAL_DISCOVERY      /* From discovery of the injury when known */
+} regislex_accrual_rule_t;
+
 /**
  * @brief Statute of limitations rule
+ *
+ * Rules are keyed by (claim_type, jurisdiction); a key may carry a
+ * standard and a discovery-rule variant. The period is limitation_months
+ * plus limitation_days from accrual.
  */
 typedef struct {
     regislex_uuid_t id;
     char name[REGISLEX_MAX_NAME_LENGTH];
     char description[REGISLEX_MAX_DESCRIPTION_LENGTH];
     char jurisdiction[128];
+    char claim_type[128];
     regislex_case_type_t case_type;
+    int limitation_months;
     int limitation_days;
+    regislex_accrual_rule_t accrual;
+    int repose_months;          /* Outer limit from accrual for discovery claims, 0 = none */
     bool tolling_allowed;
+    int max_tolling_days;       /* 0 = tolling is not capped */
     char tolling_conditions[REGISLEX_MAX_DESCRIPTION_LENGTH];
     char statute_reference[256];
     char notes[REGISLEX_MAX_DESCRIPTION_LENGTH];
@@ -173,6 +283,71 @@ typedef struct {
     regislex_datetime_t updated_at;
 } regislex_statute_rule_t;
 
+/**
+ * @brief Limitation-relevant facts of one claim in a case
+ */
+typedef struct {
+    regislex_uuid_t case_id;
+    char claim_type[128];
+    char jurisdiction[128];
+    regislex_datetime_t accrual_date;
+    regislex_datetime_t discovery_date;     /* Zero when not known */
+    int tolled_days;
+} regislex_statute_claim_t;
+
+/**
+ * @brief Claim reported by a limitation sweep
+ */
+typedef struct {
+    regislex_uuid_t case_id;
+    char claim_type[128];
+    regislex_uuid_t rule_id;
+    regislex_datetime_t expiration;
+    int days_remaining;         /* Negative once expired */
+} regislex_statute_exposure_t;
+
+/**
+ * @brief Booked time slot of an assignee
+ */
+typedef struct {
+    regislex_uuid_t deadline_id;
+    regislex_datetime_t start;
+    regislex_datetime_t end;            /* Exclusive */
+} regislex_schedule_slot_t;
+
+/**
+ * @brief Pair of overlapping bookings found by a portfolio scan
+ */
+typedef struct {
+    regislex_uuid_t assigned_to_id;
+    regislex_uuid_t first_id;           /* Starts no later than second_id */
+    regislex_uuid_t second_id;
+    regislex_datetime_t overlap_start;
+    regislex_datetime_t overlap_end;
+} regislex_schedule_conflict_t;
+
+/**
+ * @brief Kind of agenda item
+ */
+typedef enum {
+    REGISLEX_AGENDA_DEADLINE = 0,
+    REGISLEX_AGENDA_TASK,
+    REGISLEX_AGENDA_REMINDER
+} regislex_agenda_kind_t;
+
+/**
+ * @brief Entry of a user's agenda
+ */
+typedef struct {
+    regislex_agenda_kind_t kind;
+    regislex_uuid_t id;                 /* Deadline, task or reminder ID */
+    regislex_uuid_t case_id;
+    regislex_uuid_t deadline_id;        /* Deadline a reminder belongs to */
+    char title[REGISLEX_MAX_NAME_LENGTH];   /* Reminder message for reminders */
+    regislex_datetime_t due;            /* Send time for reminders; occurrence date for series */
+    regislex_priority_t priority;
+} regislex_agenda_item_t;
+
 /**
  * @brief Calendar entry
  */
@@ -217,8 +392,23 @@ struct regislex_calendar {
     regislex_datetime_t updated_at;
 };
 
+/**
+ * @brief How a holiday falling on a weekend is observed
+ */
+typedef enum {
+    REGISLEX_OBSERVED_NONE = 0,         /* Observed on the date itself */
+    REGISLEX_OBSERVED_NEAREST_WEEKDAY,  /* Saturday -> Friday, Sunday -> Monday */
+    REGISLEX_OBSERVED_NEXT_MONDAY,      /* Saturday or Sunday -> Monday */
+    REGISLEX_OBSERVED_SUNDAY_TO_MONDAY  /* Sunday -> Monday, Saturday unchanged */
+} regislex_holiday_observed_t;
+
 /**
  * @brief Holiday definition
+ *
+ * A non-recurring holiday uses date. A recurring holiday falls either on
+ * recurrence_month/recurrence_day, or, when recurrence_week is non-zero,
+ * on the Nth recurrence_weekday of recurrence_month (-1 for the last).
+ * An empty jurisdiction applies to every jurisdiction.
  */
 typedef struct {
     regislex_uuid_t id;
@@ -231,10 +421,16 @@ typedef struct {
     int recurrence_month;
     int recurrence_day;
     int recurrence_week;      /* For floating holidays (e.g., 4th Thursday) */
-    int recurrence_weekday;
+    int recurrence_weekday;   /* 0 = Sunday */
+    regislex_holiday_observed_t observed;
     regislex_datetime_t created_at;
 } regislex_holiday_t;
 
+/**
+ * @brief Court-day calendar compiled from one set of holiday rules (opaque)
+ */
+typedef struct regislex_court_calendar regislex_court_calendar_t;
+
 /**
  * @brief Deadline filter criteria
  */
@@ -254,6 +450,8 @@ typedef struct {
     int limit;
     const char* order_by;
     bool order_desc;
+    const regislex_metadata_filter_t* metadata;    /* All must match */
+    int metadata_count;
 } regislex_deadline_filter_t;
 
 /**
@@ -267,6 +465,80 @@ typedef struct {
     int limit;
 } regislex_deadline_list_t;
 
+/**
+ * @brief Streaming cursor over a deadline query
+ */
+typedef struct regislex_deadline_cursor regislex_deadline_cursor_t;
+
+/**
+ * @brief Per-row callback for streaming deadline queries
+ * @return false to stop iteration
+ */
+typedef bool (*regislex_deadline_visitor_t)(const regislex_deadline_t* deadline, void* user_data);
+
+/**
+ * @brief Court rule set (e.g., FRCP or a local rule chain)
+ */
+typedef struct {
+    regislex_uuid_t id;
+    char name[REGISLEX_MAX_NAME_LENGTH];
+    char jurisdiction[128];
+    char description[REGISLEX_MAX_DESCRIPTION_LENGTH];
+    regislex_datetime_t created_at;
+} regislex_court_rule_set_t;
+
+/**
+ * @brief One deadline rule within a rule set
+ *
+ * A rule is anchored either on a trigger event (e.g., "service") or on
+ * the computed date of another rule in the same set, named by code.
+ * Exactly one of trigger_event and depends_on must be set.
+ */
+typedef struct {
+    regislex_uuid_t id;
+    char code[64];
+    char title[REGISLEX_MAX_NAME_LENGTH];
+    char trigger_event[64];
+    char depends_on[64];
+    int days;                     /* Negative counts backwards from the anchor */
+    bool count_business_days;
+    bool roll_forward;            /* Move off non-court days, away from the anchor */
+    regislex_deadline_type_t deadline_type;
+    regislex_priority_t priority;
+    char rule_reference[256];
+} regislex_court_rule_t;
+
+/**
+ * @brief Outcome of recording a trigger event
+ */
+typedef struct {
+    int created;
+    int updated;
+    int unchanged;
+} regislex_court_trigger_result_t;
+
+/**
+ * @brief A recorded trigger event that rule deadlines were computed from
+ */
+typedef struct {
+    regislex_uuid_t case_id;
+    regislex_uuid_t rule_set_id;
+    char event[64];
+} regislex_court_trigger_ref_t;
+
+/**
+ * @brief One automatic move of a rule deadline's due date
+ */
+typedef struct {
+    regislex_uuid_t deadline_id;
+    regislex_uuid_t case_id;
+    regislex_datetime_t previous_due_date;
+    regislex_datetime_t new_due_date;
+    char reason[64];
+    regislex_uuid_t holiday_id;     /* Empty unless a holiday change moved the date */
+    regislex_datetime_t shifted_at;
+} regislex_deadline_shift_t;
+
 /**
  * @brief Calendar filter criteria
  */
@@ -313,6 +585,9 @@ REGISLEX_API regislex_error_t regislex_deadline_get(
 
 /**
  * @brief Update a deadline
+ *
+ * A non-NULL metadata array replaces the deadline's stored metadata.
+ *
  * @param ctx Context
  * @param deadline Updated deadline data
  * @return Error code
@@ -333,6 +608,22 @@ REGISLEX_API regislex_error_t regislex_deadline_delete(
     const regislex_uuid_t* id
 );
 
+/**
+ * @brief Drop a case's deadlines and reminders from the in-memory indexes
+ *
+ * Called by regislex_case_delete() before the delete, while the deadlines
+ * that cascade with the case are still stored. The schedule, agendas, rule
+ * windows and reminder dispatcher drop them once the delete commits.
+ *
+ * @param ctx Context
+ * @param case_id Case being deleted
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_deadline_evict_case(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* case_id
+);
+
 /**
  * @brief List deadlines with filtering
  * @param ctx Context
@@ -361,6 +652,10 @@ REGISLEX_API regislex_error_t regislex_deadline_complete(
 
 /**
  * @brief Get upcoming deadlines
+ *
+ * Recurring series are expanded over the window and merged with one-off
+ * deadlines in due-date order.
+ *
  * @param ctx Context
  * @param days_ahead Number of days to look ahead
  * @param out_list Output deadline list
@@ -372,6 +667,56 @@ REGISLEX_API regislex_error_t regislex_deadline_upcoming(
     regislex_deadline_list_t** out_list
 );
 
+/**
+ * @brief Open a cursor over upcoming deadlines
+ *
+ * Rows are decoded one at a time into a buffer owned by the cursor, so
+ * memory use does not grow with the size of the result. Occurrences of
+ * recurring series in the window are merged in due-date order.
+ *
+ * @param ctx Context
+ * @param days_ahead Number of days to look ahead
+ * @param out_cursor Output cursor (close with regislex_deadline_cursor_close)
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_deadline_upcoming_cursor(
+    regislex_context_t* ctx,
+    int days_ahead,
+    regislex_deadline_cursor_t** out_cursor
+);
+
+/**
+ * @brief Advance a deadline cursor
+ * @param cursor Cursor
+ * @param out_deadline Output row, valid until the next call or close
+ * @return REGISLEX_OK for a row, REGISLEX_ERROR_NOT_FOUND at the end
+ */
+REGISLEX_API regislex_error_t regislex_deadline_cursor_next(
+    regislex_deadline_cursor_t* cursor,
+    const regislex_deadline_t** out_deadline
+);
+
+/**
+ * @brief Close a deadline cursor
+ * @param cursor Cursor to close
+ */
+REGISLEX_API void regislex_deadline_cursor_close(regislex_deadline_cursor_t* cursor);
+
+/**
+ * @brief Visit upcoming deadlines without building a list
+ * @param ctx Context
+ * @param days_ahead Number of days to look ahead
+ * @param visitor Called per deadline; return false to stop early
+ * @param user_data Passed to visitor
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_deadline_upcoming_foreach(
+    regislex_context_t* ctx,
+    int days_ahead,
+    regislex_deadline_visitor_t visitor,
+    void* user_data
+);
+
 /**
  * @brief Get overdue deadlines
  * @param ctx Context
@@ -383,8 +728,34 @@ REGISLEX_API regislex_error_t regislex_deadline_overdue(
     regislex_deadline_list_t** out_list
 );
 
+/**
+ * @brief Publish the deadline events due since the previous sweep
+ *
+ * Publishes DEADLINE_APPROACHING for each open deadline or series
+ * occurrence that came within a day of falling due, and DEADLINE_PASSED
+ * for each one that fell due, since the previous sweep. The sweep position
+ * is stored in the database and only advanced past events the bus has
+ * queued, so a sweep stopped part way (QUOTA_EXCEEDED when the queue is
+ * full) is resumed by the next one. The first sweep only records the
+ * position. The cron scheduler runs a sweep every minute.
+ *
+ * @param ctx Context
+ * @param out_published Output number of events published (may be NULL)
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_deadline_sweep(
+    regislex_context_t* ctx,
+    int* out_published
+);
+
 /**
  * @brief Calculate deadline date from rules
+ *
+ * As regislex_court_calendar_deadline() on the shared calendar, without
+ * rolling forward: when the jurisdiction has a court time zone, days are
+ * counted from the court's date of the trigger instant, and the result
+ * carries the court's UTC offset on the date it lands on.
+ *
  * @param ctx Context
  * @param trigger_date Trigger date (e.g., filing date)
  * @param days Days from trigger
@@ -414,6 +785,153 @@ REGISLEX_API void regislex_deadline_free(regislex_deadline_t* deadline);
  */
 REGISLEX_API void regislex_deadline_list_free(regislex_deadline_list_t* list);
 
+/* ============================================================================
+ * Recurrence Functions
+ * ============================================================================ */
+
+/**
+ * @brief Parse an RRULE string (an optional "RRULE:" prefix is accepted)
+ * @param text Rule text, e.g. "FREQ=WEEKLY;INTERVAL=2;BYDAY=MO,WE"
+ * @param rule Output rule
+ * @return Error code (REGISLEX_ERROR_VALIDATION for unsupported parts)
+ */
+REGISLEX_API regislex_error_t regislex_rrule_parse(const char* text, regislex_rrule_t* rule);
+
+/**
+ * @brief Format a rule as RRULE text
+ * @param rule Rule
+ * @param buffer Output buffer
+ * @param size Buffer size
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_rrule_format(const regislex_rrule_t* rule,
+                                                   char* buffer, size_t size);
+
+/**
+ * @brief Start expanding a rule at a window start
+ * @param iter Iterator to initialize
+ * @param rule Rule
+ * @param dtstart First occurrence of the series; its time of day is kept
+ * @param window_start Earliest occurrence to return (NULL = series start)
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_rrule_iter_init(
+    regislex_rrule_iter_t* iter,
+    const regislex_rrule_t* rule,
+    const regislex_datetime_t* dtstart,
+    const regislex_datetime_t* window_start
+);
+
+/**
+ * @brief Get the next occurrence up to a window end
+ * @param iter Iterator
+ * @param window_end Latest occurrence to return (NULL = unbounded)
+ * @param out_occurrence Output occurrence
+ * @return REGISLEX_OK, or REGISLEX_ERROR_NOT_FOUND when the window or series is exhausted
+ */
+REGISLEX_API regislex_error_t regislex_rrule_iter_next(
+    regislex_rrule_iter_t* iter,
+    const regislex_datetime_t* window_end,
+    regislex_datetime_t* out_occurrence
+);
+
+/**
+ * @brief Expand a recurring deadline over a window
+ *
+ * Each occurrence is a copy of the series with due_date and
+ * occurrence_date set and its override, if any, applied. Cancelled
+ * occurrences are omitted.
+ *
+ * @param ctx Context
+ * @param series_id Recurring deadline ID
+ * @param window_start Window start
+ * @param window_end Window end
+ * @param out_list Output deadline list, in due-date order
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_deadline_occurrences(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* series_id,
+    const regislex_datetime_t* window_start,
+    const regislex_datetime_t* window_end,
+    regislex_deadline_list_t** out_list
+);
+
+/**
+ * @brief Override one occurrence of a recurring deadline
+ * @param ctx Context
+ * @param series_id Recurring deadline ID
+ * @param exception Override; occurrence_date selects the occurrence
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_deadline_exception_set(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* series_id,
+    const regislex_deadline_exception_t* exception
+);
+
+/**
+ * @brief Remove an occurrence override
+ * @param ctx Context
+ * @param series_id Recurring deadline ID
+ * @param occurrence_date Original date of the occurrence
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_deadline_exception_delete(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* series_id,
+    const regislex_datetime_t* occurrence_date
+);
+
+/* ============================================================================
+ * Deadline Metadata Functions
+ * ============================================================================ */
+
+/**
+ * @brief Set a typed metadata value on a deadline
+ * @param ctx Context
+ * @param deadline_id Deadline ID
+ * @param key Metadata key
+ * @param type Value type
+ * @param value Value text, converted according to type
+ * @return Error code (REGISLEX_ERROR_VALIDATION if the value does not convert)
+ */
+REGISLEX_API regislex_error_t regislex_deadline_metadata_set(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* deadline_id,
+    const char* key,
+    regislex_metadata_type_t type,
+    const char* value
+);
+
+/**
+ * @brief Get all metadata of a deadline
+ * @param ctx Context
+ * @param deadline_id Deadline ID
+ * @param out_metadata Output array (free with regislex_metadata_free)
+ * @param out_count Output count
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_deadline_metadata_get(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* deadline_id,
+    regislex_metadata_t** out_metadata,
+    int* out_count
+);
+
+/**
+ * @brief Remove a metadata key from a deadline
+ * @param ctx Context
+ * @param deadline_id Deadline ID
+ * @param key Metadata key
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_deadline_metadata_delete(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* deadline_id,
+    const char* key
+);
+
 /* ============================================================================
  * Reminder Functions
  * ============================================================================ */
@@ -444,6 +962,21 @@ REGISLEX_API regislex_error_t regislex_reminder_remove(
     const regislex_uuid_t* id
 );
 
+/**
+ * @brief Drop a case's reminders from the agendas and the dispatcher
+ *
+ * Called by regislex_deadline_evict_case(); takes effect once the case
+ * delete commits.
+ *
+ * @param ctx Context
+ * @param case_id Case being deleted
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_reminder_evict_case(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* case_id
+);
+
 /**
  * @brief List reminders for deadline
  * @param ctx Context
@@ -484,15 +1017,256 @@ REGISLEX_API regislex_error_t regislex_reminder_mark_sent(
 );
 
 /**
- * @brief Free reminder structure
- * @param reminder Reminder to free
+ * @brief Update a reminder's type, timing, message or active flag
+ * @param ctx Context
+ * @param reminder Reminder data (id selects the row)
+ * @return Error code
  */
-REGISLEX_API void regislex_reminder_free(regislex_reminder_t* reminder);
+REGISLEX_API regislex_error_t regislex_reminder_update(
+    regislex_context_t* ctx,
+    const regislex_reminder_t* reminder
+);
+
+/**
+ * @brief Free reminder structure
+ * @param reminder Reminder to free
+ */
+REGISLEX_API void regislex_reminder_free(regislex_reminder_t* reminder);
+
+/**
+ * @brief Free reminder array
+ * @param reminders Array to free
+ * @param count Number of entries
+ */
+REGISLEX_API void regislex_reminder_list_free(regislex_reminder_t** reminders, int count);
+
+/* ============================================================================
+ * Reminder Dispatcher Functions
+ * ============================================================================ */
+
+/**
+ * @brief Start the reminder dispatcher thread
+ *
+ * The dispatcher keeps the reminders due within the horizon in a min-heap
+ * and sleeps until the earliest one fires. Reminders added, updated or
+ * removed through this API are rescheduled immediately.
+ *
+ * @param ctx Context
+ * @param handler Delivery callback
+ * @param user_data Passed to handler
+ * @param options Options, or NULL for defaults
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_reminder_dispatcher_start(
+    regislex_context_t* ctx,
+    regislex_reminder_handler_t handler,
+    void* user_data,
+    const regislex_reminder_dispatcher_options_t* options
+);
+
+/**
+ * @brief Stop the reminder dispatcher and wait for its thread to exit
+ */
+REGISLEX_API void regislex_reminder_dispatcher_stop(void);
+
+/* ============================================================================
+ * Schedule Conflict Functions
+ * ============================================================================ */
+
+/**
+ * @brief Load booked slots into the per-assignee interval trees
+ *
+ * Open, timed deadlines with an assignee and a positive duration are
+ * booked from start_date (or due_date when unset) for duration_minutes.
+ *
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_schedule_init(regislex_context_t* ctx);
+
+/**
+ * @brief Release the interval trees
+ */
+REGISLEX_API void regislex_schedule_shutdown(void);
+
+/**
+ * @brief Rebuild the interval trees from the database
+ *
+ * Call after changing deadlines outside the deadline API.
+ *
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_schedule_rebuild(regislex_context_t* ctx);
+
+/**
+ * @brief Apply a committed deadline to the interval trees
+ * @param deadline Deadline as stored; replaces any earlier booking
+ */
+REGISLEX_API void regislex_schedule_apply(const regislex_deadline_t* deadline);
+
+/**
+ * @brief Drop a deadline's booking
+ * @param deadline_id Deadline ID
+ */
+REGISLEX_API void regislex_schedule_remove(const regislex_uuid_t* deadline_id);
+
+/**
+ * @brief Find bookings overlapping a proposed slot
+ * @param ctx Context
+ * @param assigned_to_id Assignee
+ * @param start Proposed start
+ * @param duration_minutes Proposed length
+ * @param exclude_id Deadline to ignore, e.g. the one being moved (NULL = none)
+ * @param out_slots Output overlapping slots, in start order
+ * @param out_count Output count
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_schedule_conflicts(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* assigned_to_id,
+    const regislex_datetime_t* start,
+    int duration_minutes,
+    const regislex_uuid_t* exclude_id,
+    regislex_schedule_slot_t** out_slots,
+    int* out_count
+);
+
+/**
+ * @brief Find every overlapping pair of bookings across all assignees
+ * @param ctx Context
+ * @param out_conflicts Output conflicts, grouped by assignee in start order
+ * @param out_count Output count
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_schedule_scan(
+    regislex_context_t* ctx,
+    regislex_schedule_conflict_t** out_conflicts,
+    int* out_count
+);
+
+/**
+ * @brief Free conflict query results
+ * @param slots Array to free
+ */
+REGISLEX_API void regislex_schedule_slots_free(regislex_schedule_slot_t* slots);
+
+/**
+ * @brief Free portfolio scan results
+ * @param conflicts Array to free
+ */
+REGISLEX_API void regislex_schedule_conflicts_free(regislex_schedule_conflict_t* conflicts);
+
+/* ============================================================================
+ * Agenda Functions
+ * ============================================================================ */
+
+/**
+ * @brief Build the per-user agendas from the database
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_agenda_init(regislex_context_t* ctx);
+
+/**
+ * @brief Release all agendas
+ */
+REGISLEX_API void regislex_agenda_shutdown(void);
+
+/**
+ * @brief Rebuild all agendas, rolling recurring series forward
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_agenda_rebuild(regislex_context_t* ctx);
+
+/**
+ * @brief Replace a deadline's agenda entries after it changed
+ * @param ctx Context (used to expand recurring series)
+ * @param deadline Stored deadline
+ */
+REGISLEX_API void regislex_agenda_apply_deadline(
+    regislex_context_t* ctx,
+    const regislex_deadline_t* deadline
+);
+
+/**
+ * @brief Replace a task's agenda entry after it changed
+ * @param task Stored task
+ */
+REGISLEX_API void regislex_agenda_apply_task(const regislex_task_t* task);
+
+/**
+ * @brief Replace a reminder's agenda entry after it changed
+ * @param reminder Stored reminder
+ */
+REGISLEX_API void regislex_agenda_apply_reminder(const regislex_reminder_t* reminder);
+
+/**
+ * @brief Drop the agenda entries of a deadline, task or reminder
+ * @param id Item ID
+ */
+REGISLEX_API void regislex_agenda_remove(const regislex_uuid_t* id);
+
+/**
+ * @brief Drop the reminders of a deleted deadline from all agendas
+ * @param deadline_id Deadline ID
+ */
+REGISLEX_API void regislex_agenda_remove_reminders(const regislex_uuid_t* deadline_id);
+
+/**
+ * @brief Get a user's next agenda items in due order, without database access
+ * @param ctx Context
+ * @param user_id User ID
+ * @param from Earliest due time (NULL for now)
+ * @param items Output buffer
+ * @param max_items Buffer capacity
+ * @param count Output number of items written
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_agenda_next(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* user_id,
+    const regislex_datetime_t* from,
+    regislex_agenda_item_t* items,
+    int max_items,
+    int* count
+);
+
+/**
+ * @brief Re-expand recurring series from now once half their horizon is gone
+ *
+ * Does nothing until then. The cron scheduler calls this every minute;
+ * without the scheduler, the application calls it periodically.
+ *
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_agenda_roll(regislex_context_t* ctx);
 
 /* ============================================================================
  * Statute of Limitations Functions
  * ============================================================================ */
 
+/**
+ * @brief Load the statute rule index
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_statute_init(regislex_context_t* ctx);
+
+/**
+ * @brief Release the statute rule index
+ */
+REGISLEX_API void regislex_statute_shutdown(void);
+
+/**
+ * @brief Rebuild the statute rule index from the database
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_statute_reload(regislex_context_t* ctx);
+
 /**
  * @brief Create statute rule
  * @param ctx Context
@@ -538,12 +1312,98 @@ REGISLEX_API regislex_error_t regislex_statute_calculate(
     regislex_datetime_t* out_expiration
 );
 
+/**
+ * @brief Delete statute rule
+ * @param ctx Context
+ * @param rule_id Rule ID
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_statute_rule_delete(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* rule_id
+);
+
+/**
+ * @brief Record or replace the limitation facts of a claim
+ * @param ctx Context
+ * @param claim Claim data (case_id and claim_type select the row)
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_statute_claim_set(
+    regislex_context_t* ctx,
+    const regislex_statute_claim_t* claim
+);
+
+/**
+ * @brief Remove a claim from a case
+ * @param ctx Context
+ * @param case_id Case ID
+ * @param claim_type Claim type
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_statute_claim_delete(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* case_id,
+    const char* claim_type
+);
+
+/**
+ * @brief Compute when a claim's limitation period expires
+ *
+ * Uses the rule for the claim's jurisdiction, falling back to "federal".
+ * The discovery-rule variant applies when the claim has a discovery date.
+ *
+ * @param ctx Context
+ * @param claim Claim facts
+ * @param out_expiration Output expiration date
+ * @param out_rule_id Output rule applied (may be NULL)
+ * @return Error code (REGISLEX_ERROR_NOT_FOUND if no rule applies)
+ */
+REGISLEX_API regislex_error_t regislex_statute_evaluate(
+    regislex_context_t* ctx,
+    const regislex_statute_claim_t* claim,
+    regislex_datetime_t* out_expiration,
+    regislex_uuid_t* out_rule_id
+);
+
+/**
+ * @brief Find claims in open, unfiled cases whose limitation period ends soon
+ *
+ * Evaluates every claim in one pass. Claims that have already expired are
+ * included. Results are ordered by expiration.
+ *
+ * @param ctx Context
+ * @param days_ahead Report claims expiring within this many days
+ * @param exposures Output array
+ * @param count Output count
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_statute_sweep(
+    regislex_context_t* ctx,
+    int days_ahead,
+    regislex_statute_exposure_t** exposures,
+    int* count
+);
+
 /**
  * @brief Free statute rule
  * @param rule Rule to free
  */
 REGISLEX_API void regislex_statute_rule_free(regislex_statute_rule_t* rule);
 
+/**
+ * @brief Free statute rule array
+ * @param rules Array to free
+ * @param count Number of entries
+ */
+REGISLEX_API void regislex_statute_rule_list_free(regislex_statute_rule_t** rules, int count);
+
+/**
+ * @brief Free sweep results
+ * @param exposures Array to free
+ */
+REGISLEX_API void regislex_statute_exposures_free(regislex_statute_exposure_t* exposures);
+
 /* ============================================================================
  * Calendar Functions
  * ============================================================================ */
@@ -600,11 +1460,15 @@ REGISLEX_API regislex_error_t regislex_calendar_delete(
 
 /**
  * @brief Sync with external calendar
+ *
+ * For "ical" the credentials name the .ics file to publish; it is rewritten
+ * only when the user's feed has changed since the last sync.
+ *
  * @param ctx Context
  * @param user_id User ID
  * @param calendar_type Calendar type ("google", "outlook", "ical")
  * @param credentials Calendar credentials
- * @return Error code
+ * @return Error code (REGISLEX_ERROR_UNSUPPORTED for remote calendars)
  */
 REGISLEX_API regislex_error_t regislex_calendar_sync(
     regislex_context_t* ctx,
@@ -613,18 +1477,497 @@ REGISLEX_API regislex_error_t regislex_calendar_sync(
     const char* credentials
 );
 
+/**
+ * @brief Initialize the rendered event cache
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_calendar_feed_init(regislex_context_t* ctx);
+
+/**
+ * @brief Release the rendered event cache
+ */
+REGISLEX_API void regislex_calendar_feed_shutdown(void);
+
+/**
+ * @brief Render the iCalendar feed of deadlines assigned to a user
+ *
+ * With an empty sync token the whole feed is rendered; otherwise only the
+ * changes since the token. When if_none_match equals the current ETag, or
+ * the token is already current, the feed is returned with not_modified set
+ * and no data.
+ *
+ * @param ctx Context
+ * @param user_id User ID
+ * @param sync_token Token from an earlier feed (NULL or empty = full feed)
+ * @param if_none_match ETag held by the client (NULL = none)
+ * @param out_feed Output feed
+ * @return Error code (REGISLEX_ERROR_VALIDATION for an unknown token)
+ */
+REGISLEX_API regislex_error_t regislex_calendar_feed(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* user_id,
+    const char* sync_token,
+    const char* if_none_match,
+    regislex_calendar_feed_t** out_feed
+);
+
+/**
+ * @brief Free a rendered feed
+ * @param feed Feed to free
+ */
+REGISLEX_API void regislex_calendar_feed_free(regislex_calendar_feed_t* feed);
+
 /**
  * @brief Free calendar entry
  * @param entry Entry to free
  */
 REGISLEX_API void regislex_calendar_free(regislex_calendar_t* entry);
 
+/* ============================================================================
+ * Court Rules Functions
+ * ============================================================================ */
+
+/**
+ * @brief Initialize the compiled rule set cache
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_court_rules_init(regislex_context_t* ctx);
+
+/**
+ * @brief Release the compiled rule set cache
+ */
+REGISLEX_API void regislex_court_rules_shutdown(void);
+
+/**
+ * @brief Create a rule set
+ *
+ * Rules must form an acyclic graph; unknown or circular dependencies are
+ * rejected with REGISLEX_ERROR_VALIDATION.
+ *
+ * @param ctx Context
+ * @param rule_set Rule set data
+ * @param rules Rules in the set
+ * @param rule_count Number of rules
+ * @param out_rule_set Output created rule set
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_court_rule_set_create(
+    regislex_context_t* ctx,
+    const regislex_court_rule_set_t* rule_set,
+    const regislex_court_rule_t* rules,
+    int rule_count,
+    regislex_court_rule_set_t** out_rule_set
+);
+
+/**
+ * @brief Delete a rule set
+ *
+ * Deadlines already generated from the set are kept.
+ *
+ * @param ctx Context
+ * @param id Rule set ID
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_court_rule_set_delete(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* id
+);
+
+/**
+ * @brief Record or move a trigger event for a case
+ *
+ * Generates every deadline that depends on the event, directly or through
+ * other rules, in one transaction. When the event was already recorded,
+ * only its descendants are recomputed, and completed deadlines keep their
+ * dates.
+ *
+ * @param ctx Context
+ * @param case_id Case ID
+ * @param rule_set_id Rule set ID
+ * @param event Trigger event name
+ * @param trigger_date Date of the event
+ * @param result Output counts (may be NULL)
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_court_trigger_record(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* case_id,
+    const regislex_uuid_t* rule_set_id,
+    const char* event,
+    const regislex_datetime_t* trigger_date,
+    regislex_court_trigger_result_t* result
+);
+
+/**
+ * @brief Recompute the rule deadlines a holiday change may move
+ *
+ * Only deadlines whose anchor-to-due window covers one of the holiday's
+ * dates are considered; their trigger chains are recomputed in one
+ * transaction and every moved date is recorded in the shift log.
+ * Called by regislex_holiday_add() and regislex_holiday_delete() with a
+ * private calendar that already reflects their pending change.
+ *
+ * @param ctx Context
+ * @param holiday Holiday that was added or removed
+ * @param reason Reason recorded with each shift (e.g., "holiday added")
+ * @param calendar Calendar to count court days on (NULL for the shared one)
+ * @param result Output counts (may be NULL)
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_court_holiday_recompute(
+    regislex_context_t* ctx,
+    const regislex_holiday_t* holiday,
+    const char* reason,
+    regislex_court_calendar_t* calendar,
+    regislex_court_trigger_result_t* result
+);
+
+/**
+ * @brief List recorded due date shifts, oldest first
+ * @param ctx Context
+ * @param deadline_id Deadline to list (may be NULL)
+ * @param holiday_id Holiday to list (may be NULL; one of the two is required)
+ * @param shifts Output shift array
+ * @param count Output count
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_deadline_shift_list(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* deadline_id,
+    const regislex_uuid_t* holiday_id,
+    regislex_deadline_shift_t** shifts,
+    int* count
+);
+
+/**
+ * @brief Free a shift list
+ * @param shifts Shift array to free
+ */
+REGISLEX_API void regislex_deadline_shift_list_free(regislex_deadline_shift_t* shifts);
+
+/**
+ * @brief Free rule set
+ * @param rule_set Rule set to free
+ */
+REGISLEX_API void regislex_court_rule_set_free(regislex_court_rule_set_t* rule_set);
+
+/* ============================================================================
+ * Rule Window Functions
+ * ============================================================================ */
+
+/**
+ * @brief Create the empty rule window index
+ *
+ * Called by regislex_court_rules_init(), which fills it from the recorded
+ * trigger events.
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_rule_windows_init(void);
+
+/**
+ * @brief Release the rule window index
+ */
+REGISLEX_API void regislex_rule_windows_shutdown(void);
+
+/**
+ * @brief Index or move the window of an open rule deadline
+ *
+ * The window runs from the deadline's anchor date to its due date (in
+ * either order); a holiday inside it can change the computed date.
+ *
+ * @param deadline_id Deadline ID
+ * @param jurisdiction Jurisdiction of the rule set
+ * @param trigger Trigger event the deadline descends from
+ * @param first First day of the window
+ * @param last Last day of the window
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_rule_window_set(
+    const regislex_uuid_t* deadline_id,
+    const char* jurisdiction,
+    const regislex_court_trigger_ref_t* trigger,
+    const regislex_datetime_t* first,
+    const regislex_datetime_t* last
+);
+
+/**
+ * @brief Drop a deadline from the rule window index
+ * @param deadline_id Deadline ID
+ */
+REGISLEX_API void regislex_rule_window_remove(const regislex_uuid_t* deadline_id);
+
+/**
+ * @brief Follow an edit of an indexed rule deadline
+ *
+ * The window is widened to take in the new due date; the anchor and the
+ * computed date stay inside it. A deadline that is no longer open leaves
+ * the index. Deadlines not in the index are ignored.
+ *
+ * @param deadline_id Deadline ID
+ * @param due_date Stored due date
+ * @param open Whether the deadline is still open
+ */
+REGISLEX_API void regislex_rule_window_move(
+    const regislex_uuid_t* deadline_id,
+    const regislex_datetime_t* due_date,
+    bool open
+);
+
+/**
+ * @brief Find the trigger events whose deadlines a holiday may move
+ *
+ * A holiday with no jurisdiction is matched against every jurisdiction;
+ * recurring holidays are expanded over the years the index spans.
+ *
+ * @param holiday Holiday definition
+ * @param triggers Output distinct trigger events
+ * @param count Output count
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_rule_windows_affected(
+    const regislex_holiday_t* holiday,
+    regislex_court_trigger_ref_t** triggers,
+    int* count
+);
+
+/**
+ * @brief Free a trigger list
+ * @param triggers Trigger array to free
+ */
+REGISLEX_API void regislex_court_trigger_refs_free(regislex_court_trigger_ref_t* triggers);
+
+/* ============================================================================
+ * Court Calendar Functions
+ * ============================================================================ */
+
+/**
+ * @brief Initialize the per-jurisdiction court-day calendars
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_court_calendar_init(regislex_context_t* ctx);
+
+/**
+ * @brief Release all cached court-day calendars
+ */
+REGISLEX_API void regislex_court_calendar_shutdown(void);
+
+/**
+ * @brief Drop cached years so they are rebuilt on next use
+ * @param jurisdiction Jurisdiction to drop, or NULL for all
+ */
+REGISLEX_API void regislex_court_calendar_invalidate(const char* jurisdiction);
+
+/**
+ * @brief Reload holiday definitions from the database and drop cached years
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_court_calendar_reload(regislex_context_t* ctx);
+
+/**
+ * @brief Open a private calendar over the holiday rules visible to this thread
+ *
+ * Inside a transaction this includes its pending holiday rows. The
+ * calendar is not locked and must stay on the thread that opened it.
+ *
+ * @param ctx Context
+ * @param out_calendar Output calendar, released with regislex_court_calendar_close()
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_court_calendar_open(
+    regislex_context_t* ctx,
+    regislex_court_calendar_t** out_calendar
+);
+
+/**
+ * @brief Replace the shared holiday rules with a private calendar's once
+ *        the calling thread's transaction commits
+ * @param ctx Context
+ * @param calendar Private calendar (still closed by the caller)
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_court_calendar_publish(
+    regislex_context_t* ctx,
+    const regislex_court_calendar_t* calendar
+);
+
+/**
+ * @brief Release a private calendar
+ * @param calendar Calendar to release (may be NULL)
+ */
+REGISLEX_API void regislex_court_calendar_close(regislex_court_calendar_t* calendar);
+
+/**
+ * @brief Add court days to a date
+ *
+ * The start date is not counted, so adding 1 yields the first court day
+ * after it. Negative values count backwards. Time of day is preserved.
+ *
+ * @param ctx Context
+ * @param jurisdiction Jurisdiction (NULL for the default calendar)
+ * @param start Start date
+ * @param days Court days to add
+ * @param out_date Output date
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_court_days_add(
+    regislex_context_t* ctx,
+    const char* jurisdiction,
+    const regislex_datetime_t* start,
+    int days,
+    regislex_datetime_t* out_date
+);
+
+/**
+ * @brief Count court days after one date up to and including another
+ * @param ctx Context
+ * @param jurisdiction Jurisdiction (NULL for the default calendar)
+ * @param from Start date (excluded)
+ * @param to End date (included)
+ * @param count Output count (negative when to is before from)
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_court_days_between(
+    regislex_context_t* ctx,
+    const char* jurisdiction,
+    const regislex_datetime_t* from,
+    const regislex_datetime_t* to,
+    int* count
+);
+
+/**
+ * @brief Add court days to a date on a given calendar
+ *
+ * As regislex_court_days_add(); a NULL calendar uses the shared one.
+ *
+ * @param calendar Calendar (may be NULL)
+ * @param jurisdiction Jurisdiction (NULL for the default calendar)
+ * @param start Start date
+ * @param days Court days to add
+ * @param out_date Output date
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_court_calendar_days_add(
+    regislex_court_calendar_t* calendar,
+    const char* jurisdiction,
+    const regislex_datetime_t* start,
+    int days,
+    regislex_datetime_t* out_date
+);
+
+/**
+ * @brief Check if date is business day on a given calendar
+ * @param calendar Calendar (NULL for the shared one)
+ * @param date Date to check
+ * @param jurisdiction Jurisdiction
+ * @param is_business_day Output boolean
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_court_calendar_is_business_day(
+    regislex_court_calendar_t* calendar,
+    const regislex_datetime_t* date,
+    const char* jurisdiction,
+    bool* is_business_day
+);
+
+/**
+ * @brief Compute a deadline in a jurisdiction's court time zone
+ *
+ * The one place deadline calculation and court rules count days. When the
+ * jurisdiction maps to a court time zone, the trigger instant is first
+ * expressed as court-local wall time, days are counted on that date, and
+ * the result is resolved back with the court's offset on the date it
+ * lands on, so the trigger's own offset never shifts the court date. An
+ * unmapped jurisdiction counts on the trigger's wall-clock date.
+ *
+ * @param calendar Calendar (NULL for the shared one)
+ * @param jurisdiction Jurisdiction
+ * @param trigger Trigger instant
+ * @param days Days to add (negative counts backwards)
+ * @param business_days Whether to count court days only
+ * @param roll_forward Move a result on a closed day to the next court day
+ *                     in the direction of counting
+ * @param out_date Output deadline
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_court_calendar_deadline(
+    regislex_court_calendar_t* calendar,
+    const char* jurisdiction,
+    const regislex_datetime_t* trigger,
+    int days,
+    bool business_days,
+    bool roll_forward,
+    regislex_datetime_t* out_date
+);
+
+/* ============================================================================
+ * Court Time Zone Functions
+ * ============================================================================ */
+
+/**
+ * @brief Load the jurisdiction-to-zone mapping
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_court_zones_init(regislex_context_t* ctx);
+
+/**
+ * @brief Release the jurisdiction-to-zone mapping
+ */
+REGISLEX_API void regislex_court_zones_shutdown(void);
+
+/**
+ * @brief Get the time zone a jurisdiction's courts keep
+ * @param jurisdiction Jurisdiction code
+ * @return Zone, or NULL if the jurisdiction is unmapped
+ */
+REGISLEX_API const regislex_tz_t* regislex_court_zone(const char* jurisdiction);
+
+/**
+ * @brief Map a jurisdiction to a time zone
+ * @param ctx Context
+ * @param jurisdiction Jurisdiction code
+ * @param zone IANA zone name, or NULL to remove the mapping
+ * @return Error code (VALIDATION if the zone is unknown)
+ */
+REGISLEX_API regislex_error_t regislex_court_zone_set(
+    regislex_context_t* ctx,
+    const char* jurisdiction,
+    const char* zone
+);
+
+/**
+ * @brief Resolve a court-local cutoff (e.g. 5:00 p.m.) on a date
+ * @param ctx Context
+ * @param jurisdiction Jurisdiction code
+ * @param date Date of the cutoff (time of day is ignored)
+ * @param hour Court-local hour
+ * @param minute Court-local minute
+ * @param out Output cutoff carrying the court's UTC offset on that date
+ * @return Error code (NOT_FOUND if the jurisdiction is unmapped)
+ */
+REGISLEX_API regislex_error_t regislex_court_cutoff(
+    regislex_context_t* ctx,
+    const char* jurisdiction,
+    const regislex_datetime_t* date,
+    int hour,
+    int minute,
+    regislex_datetime_t* out
+);
+
 /* ============================================================================
  * Holiday Functions
  * ============================================================================ */
 
 /**
  * @brief Add holiday
+ *
+ * Court calendars are rebuilt from the stored holidays on the next lookup,
+ * and rule deadlines the holiday falls inside are recomputed in the same
+ * transaction as the insert.
  * @param ctx Context
  * @param holiday Holiday data
  * @param out_holiday Output created holiday
@@ -636,8 +1979,55 @@ REGISLEX_API regislex_error_t regislex_holiday_add(
     regislex_holiday_t** out_holiday
 );
 
+/**
+ * @brief Delete holiday
+ *
+ * Rule deadlines the holiday fell inside are recomputed in the same
+ * transaction as the delete.
+ * @param ctx Context
+ * @param id Holiday ID
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_holiday_delete(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* id
+);
+
+/**
+ * @brief List stored holiday definitions
+ * @param ctx Context
+ * @param jurisdiction Jurisdiction (NULL for all; otherwise includes holidays for every jurisdiction)
+ * @param holidays Output holiday array
+ * @param count Output count
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_holiday_rules(
+    regislex_context_t* ctx,
+    const char* jurisdiction,
+    regislex_holiday_t*** holidays,
+    int* count
+);
+
+/**
+ * @brief Compute the date of a holiday in a given year
+ * @param holiday Holiday definition
+ * @param year Year
+ * @param actual Output date the holiday falls on
+ * @param observed Output date the holiday is observed on
+ * @return REGISLEX_ERROR_NOT_FOUND if the holiday does not occur that year
+ */
+REGISLEX_API regislex_error_t regislex_holiday_occurrence(
+    const regislex_holiday_t* holiday,
+    int year,
+    regislex_datetime_t* actual,
+    regislex_datetime_t* observed
+);
+
 /**
  * @brief Get holidays for date range
+ *
+ * Recurring holidays are expanded to one entry per occurrence, with date
+ * set to the observed date. Entries are ordered by date.
  * @param ctx Context
  * @param jurisdiction Jurisdiction
  * @param start_date Start date
@@ -691,6 +2081,13 @@ REGISLEX_API regislex_error_t regislex_is_business_day(
  */
 REGISLEX_API void regislex_holiday_free(regislex_holiday_t* holiday);
 
+/**
+ * @brief Free holiday array
+ * @param holidays Array to free
+ * @param count Number of entries
+ */
+REGISLEX_API void regislex_holiday_list_free(regislex_holiday_t** holidays, int count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -96,6 +96,20 @@ typedef enum {
     REGISLEX_TASK_FAILED
 } regislex_task_status_t;
 
+/**
+ * @brief Workflow run event type
+ */
+typedef enum {
+    REGISLEX_RUN_EVENT_STARTED = 0,
+    REGISLEX_RUN_EVENT_RESUMED,
+    REGISLEX_RUN_EVENT_STEP_COMPLETED,
+    REGISLEX_RUN_EVENT_STEP_WAITING,     /* Step parked the run on a timer */
+    REGISLEX_RUN_EVENT_STEP_FAILED,
+    REGISLEX_RUN_EVENT_COMPLETED,
+    REGISLEX_RUN_EVENT_FAILED,
+    REGISLEX_RUN_EVENT_CANCELLED
+} regislex_run_event_type_t;
+
 /**
  * @brief Condition operator
  */
@@ -131,6 +145,54 @@ typedef struct {
     char logical_op[8];  /* "AND", "OR" */
 } regislex_condition_t;
 
+/**
+ * @brief Fields a condition expression can read, each a slot of the environment
+ */
+typedef enum {
+    REGISLEX_COND_FIELD_CASE_PRIORITY = 0,  /* case.priority */
+    REGISLEX_COND_FIELD_CASE_STATUS,        /* case.status */
+    REGISLEX_COND_FIELD_CASE_TYPE,          /* case.type */
+    REGISLEX_COND_FIELD_CASE_NUMBER,        /* case.number (text) */
+    REGISLEX_COND_FIELD_DEADLINE_DAYS_LEFT, /* deadline.days_left */
+    REGISLEX_COND_FIELD_DEADLINE_PRIORITY,  /* deadline.priority */
+    REGISLEX_COND_FIELD_DEADLINE_STATUS,    /* deadline.status */
+    REGISLEX_COND_FIELD_EVENT_TYPE,         /* event.type */
+    REGISLEX_COND_FIELD_EVENT_NAME,         /* event.name (text) */
+    REGISLEX_COND_FIELD_COUNT
+} regislex_cond_field_t;
+
+#define REGISLEX_COND_MAX_CODE       256
+#define REGISLEX_COND_MAX_NUMBERS    32
+#define REGISLEX_COND_MAX_TEXT       512
+#define REGISLEX_COND_MAX_STACK      32
+
+/**
+ * @brief Compiled condition expression
+ *
+ * Self-contained and fixed in size, so it can be copied and evaluated
+ * without allocating.
+ */
+typedef struct {
+    uint8_t code[REGISLEX_COND_MAX_CODE];
+    int length;
+    int64_t numbers[REGISLEX_COND_MAX_NUMBERS];    /* Numeric constants */
+    int number_count;
+    char text[REGISLEX_COND_MAX_TEXT];              /* Text constants, NUL-separated */
+    int text_used;
+    uint32_t fields;                                /* Bit per regislex_cond_field_t read */
+} regislex_cond_program_t;
+
+/**
+ * @brief Values a condition is evaluated against
+ */
+typedef struct {
+    int64_t numbers[REGISLEX_COND_FIELD_COUNT];
+    const char* texts[REGISLEX_COND_FIELD_COUNT];
+    uint32_t present;                   /* Bit per field that has a value */
+    char case_number[64];               /* Storage for texts loaded by regislex_cond_env_load() */
+    char event_name[128];
+} regislex_cond_env_t;
+
 /**
  * @brief Workflow trigger definition
  */
@@ -140,7 +202,8 @@ struct regislex_trigger {
     char name[REGISLEX_MAX_NAME_LENGTH];
     regislex_trigger_type_t type;
     regislex_event_type_t event_type;
-    char event_filter[1024];     /* JSON filter criteria */
+    char event_name[128];        /* Event listened for when event_type is CUSTOM */
+    char event_filter[1024];     /* Condition expression; required for CONDITION triggers */
     char schedule_cron[128];     /* Cron expression for scheduled triggers */
     char webhook_secret[256];
     int condition_count;
@@ -150,6 +213,17 @@ struct regislex_trigger {
     regislex_datetime_t updated_at;
 };
 
+/**
+ * @brief Event published by a module for TRIGGER_EVENT workflows
+ */
+typedef struct {
+    regislex_event_type_t type;
+    char name[128];              /* CUSTOM only: letters, digits, '.', '_' and '-' */
+    regislex_uuid_t case_id;     /* Case the event concerns (optional) */
+    regislex_uuid_t subject_id;  /* Record the event is about (optional) */
+    char data[1024];             /* JSON payload (optional) */
+} regislex_event_t;
+
 /**
  * @brief Action parameters (JSON-based for flexibility)
  */
@@ -242,10 +316,59 @@ typedef struct {
     regislex_datetime_t started_at;
     regislex_datetime_t completed_at;
     char error_message[REGISLEX_MAX_DESCRIPTION_LENGTH];
-    char execution_log[16384];
     regislex_datetime_t created_at;
 } regislex_workflow_run_t;
 
+/**
+ * @brief Entry in a workflow run's event log
+ */
+typedef struct {
+    int64_t id;                  /* Increases in append order */
+    regislex_uuid_t run_id;
+    regislex_run_event_type_t type;
+    int64_t occurred_ms;         /* Unix time in milliseconds */
+    int step;                    /* Step the event refers to */
+    regislex_uuid_t action_id;   /* Empty for run-level events */
+    regislex_action_type_t action_type;
+    int duration_ms;             /* Step duration; 0 for run-level events */
+    regislex_error_t error;
+    char message[256];
+} regislex_run_event_t;
+
+/**
+ * @brief Run event filter criteria
+ */
+typedef struct {
+    regislex_uuid_t* run_id;     /* Optional */
+    int64_t since_ms;            /* Inclusive; 0 for no lower bound */
+    int64_t until_ms;            /* Exclusive; 0 for no upper bound */
+    int limit;                   /* 0 for no limit */
+} regislex_run_event_filter_t;
+
+/**
+ * @brief Run event list result
+ */
+typedef struct {
+    regislex_run_event_t* events;
+    int count;
+} regislex_run_event_list_t;
+
+/**
+ * @brief Workflow executor options (zero fields take defaults)
+ */
+typedef struct {
+    int worker_count;       /* Worker threads (default 4) */
+    int max_active_runs;    /* Started, unfinished runs across all workflows (default unlimited) */
+    int queue_limit;        /* Submitted runs waiting to start (default 10000) */
+} regislex_workflow_executor_options_t;
+
+/**
+ * @brief Event bus options (zero fields take defaults)
+ */
+typedef struct {
+    int queue_limit;        /* Published events waiting for dispatch (default 10000) */
+} regislex_event_bus_options_t;
+
 /**
  * @brief Task in workflow or standalone
  */
@@ -423,6 +546,11 @@ REGISLEX_API regislex_error_t regislex_workflow_pause(
 
 /**
  * @brief Execute workflow manually
+ *
+ * Submits the run to the executor and returns its initial state; the
+ * actions run on the executor's workers. Poll with
+ * regislex_workflow_run_get().
+ *
  * @param ctx Context
  * @param workflow_id Workflow ID
  * @param case_id Case ID (optional)
@@ -440,6 +568,10 @@ REGISLEX_API regislex_error_t regislex_workflow_execute(
 
 /**
  * @brief Get workflow run status
+ *
+ * Runs are stored, so finished runs stay visible. current_step counts
+ * the actions already finished.
+ *
  * @param ctx Context
  * @param run_id Run ID
  * @param out_run Output workflow run
@@ -453,15 +585,66 @@ REGISLEX_API regislex_error_t regislex_workflow_run_get(
 
 /**
  * @brief Cancel workflow run
+ *
+ * A queued or waiting run is cancelled at once, along with its timer; an
+ * executing run stops before its next action. Inside a caller's
+ * transaction a waiting run frees its slot when the caller commits.
+ *
  * @param ctx Context
  * @param run_id Run ID
- * @return Error code
+ * @return Error code (INVALID_STATE if the run already finished)
  */
 REGISLEX_API regislex_error_t regislex_workflow_run_cancel(
     regislex_context_t* ctx,
     const regislex_uuid_t* run_id
 );
 
+/**
+ * @brief Get a variable set by a run's actions
+ *
+ * CREATE_TASK sets task_id, CREATE_DEADLINE sets deadline_id and APPROVAL
+ * sets approval_task_id.
+ *
+ * @param ctx Context
+ * @param run_id Run ID
+ * @param name Variable name
+ * @param value Output buffer
+ * @param value_size Size of value
+ * @return Error code (NOT_FOUND if the run never set it)
+ */
+REGISLEX_API regislex_error_t regislex_workflow_run_variable_get(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* run_id,
+    const char* name,
+    char* value,
+    size_t value_size
+);
+
+/**
+ * @brief List workflow run events in append order
+ *
+ * The executor buffers events and stores them in batches; events still
+ * buffered are stored first, so the list is complete up to the call.
+ * Inside a transaction nothing is stored: buffered events follow the
+ * stored ones with an id of 0.
+ *
+ * @param ctx Context
+ * @param filter Filter criteria (NULL for all events)
+ * @param out_list Output event list
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_workflow_run_events(
+    regislex_context_t* ctx,
+    const regislex_run_event_filter_t* filter,
+    regislex_run_event_list_t** out_list
+);
+
+/**
+ * @brief Free run event list
+ * @param list List to free
+ */
+REGISLEX_API void regislex_run_event_list_free(regislex_run_event_list_t* list);
+
 /**
  * @brief Free workflow structure
  * @param workflow Workflow to free
@@ -474,6 +657,135 @@ REGISLEX_API void regislex_workflow_free(regislex_workflow_t* workflow);
  */
 REGISLEX_API void regislex_workflow_run_free(regislex_workflow_run_t* run);
 
+/* ============================================================================
+ * Workflow Executor Functions
+ * ============================================================================ */
+
+/**
+ * @brief Start the workflow executor
+ *
+ * Runs are started round-robin across workflows. A workflow without
+ * allow_parallel runs one at a time; otherwise max_parallel_runs, when
+ * positive, caps it. DELAY and APPROVAL steps park the run on a stored
+ * timer without holding a worker. Runs left active by a previous process
+ * are resumed after their last completed step.
+ *
+ * @param ctx Context
+ * @param options Options, or NULL for defaults
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_workflow_executor_start(
+    regislex_context_t* ctx,
+    const regislex_workflow_executor_options_t* options
+);
+
+/**
+ * @brief Stop the workflow executor
+ *
+ * Waits for each worker to finish its current action. Unfinished runs
+ * stay stored and resume on the next start.
+ */
+REGISLEX_API void regislex_workflow_executor_stop(void);
+
+/**
+ * @brief Drop the executor's cached definition of a workflow
+ *
+ * The executor keeps each workflow's definition, with its action
+ * parameters resolved and its conditions compiled, from the first run on.
+ * Called by the workflow and action functions once their change commits;
+ * does nothing without a running executor. Runs started afterwards load
+ * the stored definition.
+ *
+ * @param workflow_id Workflow ID
+ */
+REGISLEX_API void regislex_workflow_executor_invalidate(const regislex_uuid_t* workflow_id);
+
+/**
+ * @brief Queue a workflow run without waiting for it
+ * @param ctx Context
+ * @param workflow_id Workflow ID (must be active)
+ * @param case_id Case ID (optional)
+ * @param trigger_data JSON trigger context (optional)
+ * @param out_run_id Output run ID
+ * @return Error code (QUOTA_EXCEEDED when the queue is full)
+ */
+REGISLEX_API regislex_error_t regislex_workflow_submit(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* workflow_id,
+    const regislex_uuid_t* case_id,
+    const char* trigger_data,
+    regislex_uuid_t* out_run_id
+);
+
+/**
+ * @brief Queue a run started by a trigger
+ *
+ * As regislex_workflow_submit(), recording the trigger as the run's
+ * triggered_by.
+ *
+ * @param ctx Context
+ * @param trigger_id Trigger ID (optional)
+ * @param workflow_id Workflow ID (must be active)
+ * @param case_id Case ID (optional)
+ * @param trigger_data JSON trigger context (optional)
+ * @param out_run_id Output run ID
+ * @return Error code (QUOTA_EXCEEDED when the queue is full)
+ */
+REGISLEX_API regislex_error_t regislex_workflow_submit_trigger(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* trigger_id,
+    const regislex_uuid_t* workflow_id,
+    const regislex_uuid_t* case_id,
+    const char* trigger_data,
+    regislex_uuid_t* out_run_id
+);
+
+/**
+ * @brief Queue a trigger's run past the queue limit
+ *
+ * As regislex_workflow_submit_trigger(), but never refused for a full
+ * queue. The event bus uses it to hand over its queue when it stops; the
+ * run is stored, so one not started before the executor stops starts
+ * after the next regislex_workflow_executor_start().
+ *
+ * @param ctx Context
+ * @param trigger_id Trigger ID (optional)
+ * @param workflow_id Workflow ID (must be active)
+ * @param case_id Case ID (optional)
+ * @param trigger_data JSON trigger context (optional)
+ * @param out_run_id Output run ID
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_workflow_submit_backlog(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* trigger_id,
+    const regislex_uuid_t* workflow_id,
+    const regislex_uuid_t* case_id,
+    const char* trigger_data,
+    regislex_uuid_t* out_run_id
+);
+
+/**
+ * @brief Decide the approval a run is waiting on
+ *
+ * Called by regislex_task_approve() and regislex_task_reject() for tasks
+ * opened by an APPROVAL action. Approval resumes the run at its next
+ * action; rejection fails it. Either takes effect when the transaction
+ * holding the decision commits; a rollback leaves the run waiting.
+ *
+ * @param ctx Context
+ * @param run_id Run ID
+ * @param approved Whether the approval was granted
+ * @param reason Rejection reason (optional)
+ * @return Error code (INVALID_STATE if the run is not waiting on an approval)
+ */
+REGISLEX_API regislex_error_t regislex_workflow_approval_resolve(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* run_id,
+    bool approved,
+    const char* reason
+);
+
 /* ============================================================================
  * Trigger Functions
  * ============================================================================ */
@@ -521,6 +833,194 @@ REGISLEX_API regislex_error_t regislex_trigger_remove(
  */
 REGISLEX_API void regislex_trigger_free(regislex_trigger_t* trigger);
 
+/* ============================================================================
+ * Event Bus Functions
+ * ============================================================================ */
+
+/**
+ * @brief Get the name events of a type are published under
+ * @param type Event type
+ * @return Name such as "case.created"; NULL for CUSTOM
+ */
+REGISLEX_API const char* regislex_event_name(regislex_event_type_t type);
+
+/**
+ * @brief Start the event bus
+ *
+ * Active EVENT triggers of active workflows are indexed by event name, so
+ * an event costs one lookup plus a run submission per matching trigger.
+ * A dispatcher thread submits the runs, off the publisher's thread. The
+ * index is rebuilt whenever a trigger or a workflow's status changes.
+ * A trigger with a condition (event_filter) fires only when it holds;
+ * active CONDITION triggers are checked against every event.
+ *
+ * @param ctx Context
+ * @param options Options, or NULL for defaults
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_event_bus_start(
+    regislex_context_t* ctx,
+    const regislex_event_bus_options_t* options
+);
+
+/**
+ * @brief Stop the event bus
+ *
+ * New events are refused from the moment it is called; the ones already
+ * queued are submitted to the executor before it returns, so stop the
+ * bus before the executor.
+ */
+REGISLEX_API void regislex_event_bus_stop(void);
+
+/**
+ * @brief Publish an event
+ *
+ * Returns once the event is queued. An event no trigger listens for is
+ * dropped at once. Published inside a transaction, the event is queued
+ * only when the outermost transaction commits and dropped on rollback;
+ * a full queue is reported when it is published, and the commit queues
+ * it even if the queue has filled since.
+ * Each matching trigger's workflow gets a run with the trigger as
+ * triggered_by and trigger_data of the form
+ * {"event": name, "subject_id": id, "data": payload}.
+ *
+ * @param ctx Context
+ * @param event Event to publish
+ * @return Error code (NOT_INITIALIZED without a running bus,
+ *         QUOTA_EXCEEDED when the queue is full)
+ */
+REGISLEX_API regislex_error_t regislex_event_publish(
+    regislex_context_t* ctx,
+    const regislex_event_t* event
+);
+
+/**
+ * @brief Rebuild the trigger index from the database
+ *
+ * Called by the trigger and workflow status functions; does nothing
+ * without a running bus.
+ *
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_event_bus_reload(regislex_context_t* ctx);
+
+/* ============================================================================
+ * Cron Scheduler Functions
+ * ============================================================================ */
+
+/**
+ * @brief Start the cron scheduler
+ *
+ * Active SCHEDULED triggers of active workflows, and active scheduled
+ * reports, are kept in one min-heap by next fire time. A single thread
+ * sleeps until the earliest is due. Each fire of a trigger submits a run
+ * with trigger_data {"scheduled_ms": fire time}. Occurrences missed while
+ * the process was stopped or busy are skipped, not replayed. The same
+ * thread runs regislex_deadline_sweep() and regislex_agenda_roll() every
+ * minute.
+ *
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_cron_scheduler_start(regislex_context_t* ctx);
+
+/**
+ * @brief Stop the cron scheduler
+ */
+REGISLEX_API void regislex_cron_scheduler_stop(void);
+
+/**
+ * @brief Reload the scheduled triggers from the database
+ *
+ * Called by the trigger and workflow status functions; does nothing
+ * without a running scheduler. Triggers whose expression is unchanged
+ * keep their next fire time.
+ *
+ * @param ctx Context
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_cron_scheduler_reload(regislex_context_t* ctx);
+
+/**
+ * @brief Schedule a report, or reschedule it if already scheduled
+ *
+ * Called by the scheduled report functions.
+ *
+ * @param id Scheduled report ID
+ * @param cron Compiled schedule
+ * @param period Fire on every period-th match only (1 for every match)
+ * @return Error code (NOT_INITIALIZED without a running scheduler,
+ *         NOT_FOUND if the schedule never fires)
+ */
+REGISLEX_API regislex_error_t regislex_cron_scheduler_set_report(
+    const regislex_uuid_t* id,
+    const regislex_cron_t* cron,
+    int period
+);
+
+/**
+ * @brief Unschedule a report
+ * @param id Scheduled report ID
+ * @return Error code (NOT_FOUND if not scheduled)
+ */
+REGISLEX_API regislex_error_t regislex_cron_scheduler_remove_report(const regislex_uuid_t* id);
+
+/* ============================================================================
+ * Condition Expression Functions
+ * ============================================================================ */
+
+/**
+ * @brief Compile a condition expression
+ *
+ * Comparisons (==, !=, <, <=, >, >=) of fields, integers and quoted text,
+ * joined with &&, || and ! and grouped with parentheses, for example
+ * "case.priority >= HIGH && deadline.days_left < 7". Fields are listed in
+ * regislex_cond_field_t. Priority, status and case type names (HIGH,
+ * ACTIVE, CIVIL, ...) stand for their values, and true and false are
+ * accepted. Text compares with == and != only.
+ *
+ * @param source Expression
+ * @param out Output program
+ * @return Error code (INVALID_ARGUMENT if malformed or too large)
+ */
+REGISLEX_API regislex_error_t regislex_cond_compile(const char* source, regislex_cond_program_t* out);
+
+/**
+ * @brief Evaluate a compiled condition
+ *
+ * A comparison reading a field the environment has no value for is false.
+ *
+ * @param program Compiled condition
+ * @param env Field values
+ * @return Whether the condition holds
+ */
+REGISLEX_API bool regislex_cond_eval(const regislex_cond_program_t* program, const regislex_cond_env_t* env);
+
+/**
+ * @brief Load the fields conditions read
+ *
+ * Case fields come from the case, deadline fields from the deadline, and
+ * event fields from event. A source is read only if one of its fields is
+ * asked for; a missing source leaves its fields without values.
+ *
+ * @param ctx Context
+ * @param fields Bit per regislex_cond_field_t to load, e.g. a program's fields
+ * @param case_id Case (optional)
+ * @param deadline_id Deadline (optional)
+ * @param event Event (optional)
+ * @param env Output environment
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_cond_env_load(
+    regislex_context_t* ctx,
+    uint32_t fields,
+    const regislex_uuid_t* case_id,
+    const regislex_uuid_t* deadline_id,
+    const regislex_event_t* event,
+    regislex_cond_env_t* env
+);
+
 /* ============================================================================
  * Action Functions
  * ============================================================================ */
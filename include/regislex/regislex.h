@@ -155,14 +155,51 @@ typedef struct {
     char currency[4];    /* ISO 4217 currency code (e.g., "USD") */
 } regislex_money_t;
 
+/**
+ * @brief Storage type of a metadata value
+ */
+typedef enum {
+    REGISLEX_METADATA_TEXT = 0,
+    REGISLEX_METADATA_INTEGER = 1,
+    REGISLEX_METADATA_REAL = 2,
+    REGISLEX_METADATA_BOOLEAN = 3,
+    REGISLEX_METADATA_DATE = 4      /* ISO 8601, compared chronologically */
+} regislex_metadata_type_t;
+
 /**
  * @brief Generic key-value pair for metadata
  */
 typedef struct {
     char* key;
     char* value;
+    regislex_metadata_type_t type;
 } regislex_metadata_t;
 
+/**
+ * @brief Comparison applied by a metadata filter
+ */
+typedef enum {
+    REGISLEX_METADATA_OP_EQ = 0,
+    REGISLEX_METADATA_OP_NE,
+    REGISLEX_METADATA_OP_LT,
+    REGISLEX_METADATA_OP_LE,
+    REGISLEX_METADATA_OP_GT,
+    REGISLEX_METADATA_OP_GE,
+    REGISLEX_METADATA_OP_EXISTS     /* Key present, value ignored */
+} regislex_metadata_op_t;
+
+#define REGISLEX_MAX_METADATA_FILTERS 16
+
+/**
+ * @brief Metadata predicate for list filters
+ */
+typedef struct {
+    const char* key;
+    regislex_metadata_op_t op;
+    regislex_metadata_type_t type;  /* How value is converted before comparing */
+    const char* value;
+} regislex_metadata_filter_t;
+
 /**
  * @brief Priority levels for cases, tasks, deadlines
  */
@@ -354,6 +391,235 @@ REGISLEX_API regislex_error_t regislex_datetime_format(
     size_t size
 );
 
+/**
+ * @brief Convert a date to days since 1970-01-01 (time of day is ignored)
+ * @param dt Datetime
+ * @return Epoch day
+ */
+REGISLEX_API int64_t regislex_datetime_to_days(const regislex_datetime_t* dt);
+
+/**
+ * @brief Set the date of a datetime from days since 1970-01-01
+ * @param days Epoch day
+ * @param dt Datetime to update (time of day is preserved)
+ */
+REGISLEX_API void regislex_datetime_from_days(int64_t days, regislex_datetime_t* dt);
+
+/**
+ * @brief Convert a datetime to Unix seconds, applying its UTC offset
+ * @param dt Datetime
+ * @return Seconds since 1970-01-01T00:00:00Z
+ */
+REGISLEX_API int64_t regislex_datetime_to_seconds(const regislex_datetime_t* dt);
+
+/**
+ * @brief Set a datetime to the UTC wall time of a Unix time
+ * @param seconds Seconds since 1970-01-01T00:00:00Z
+ * @param dt Output datetime (offset 0)
+ */
+REGISLEX_API void regislex_datetime_from_seconds(int64_t seconds, regislex_datetime_t* dt);
+
+/**
+ * @brief Check that year, month and day form a real calendar date
+ * @param dt Datetime
+ * @return true if the date exists
+ */
+REGISLEX_API bool regislex_datetime_is_valid_date(const regislex_datetime_t* dt);
+
+/**
+ * @brief Add calendar days
+ * @param dt Datetime to update
+ * @param days Days to add (may be negative)
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_datetime_add_days(regislex_datetime_t* dt, int days);
+
+/**
+ * @brief Add calendar months, clamping the day to the end of the month
+ * @param dt Datetime to update
+ * @param months Months to add (may be negative)
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_datetime_add_months(regislex_datetime_t* dt, int months);
+
+/**
+ * @brief Add weekdays, skipping Saturdays and Sundays
+ * @param dt Datetime to update
+ * @param days Weekdays to add (may be negative)
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_datetime_add_business_days(regislex_datetime_t* dt, int days);
+
+/**
+ * @brief Advance to the next weekday
+ * @param dt Datetime to update
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_datetime_next_business_day(regislex_datetime_t* dt);
+
+/**
+ * @brief Days from dt1 to dt2 (time of day is ignored)
+ * @param dt1 Start
+ * @param dt2 End
+ * @return Signed day difference
+ */
+REGISLEX_API int regislex_datetime_diff_days(const regislex_datetime_t* dt1, const regislex_datetime_t* dt2);
+
+/**
+ * @brief Compare two datetimes
+ * @param dt1 First datetime
+ * @param dt2 Second datetime
+ * @return Negative, zero or positive
+ */
+REGISLEX_API int regislex_datetime_compare(const regislex_datetime_t* dt1, const regislex_datetime_t* dt2);
+
+/**
+ * @brief Day of week
+ * @param dt Datetime
+ * @return 0 = Sunday .. 6 = Saturday
+ */
+REGISLEX_API int regislex_datetime_day_of_week(const regislex_datetime_t* dt);
+
+/**
+ * @brief Check for Saturday or Sunday
+ * @param dt Datetime
+ * @return true on weekends
+ */
+REGISLEX_API bool regislex_datetime_is_weekend(const regislex_datetime_t* dt);
+
+/* ============================================================================
+ * Time Zone Functions
+ * ============================================================================ */
+
+/**
+ * @brief Compiled time zone (opaque)
+ */
+typedef struct regislex_tz regislex_tz_t;
+
+/**
+ * @brief Compile the built-in time zone table (called by regislex_init)
+ */
+REGISLEX_API void regislex_timezone_init(void);
+
+/**
+ * @brief Look up a compiled time zone
+ * @param name IANA zone name, e.g. "America/New_York"
+ * @return Zone, or NULL if unknown
+ */
+REGISLEX_API const regislex_tz_t* regislex_tz_find(const char* name);
+
+/**
+ * @brief Get the IANA name of a zone
+ * @param tz Zone
+ * @return Zone name
+ */
+REGISLEX_API const char* regislex_tz_name(const regislex_tz_t* tz);
+
+/**
+ * @brief Express an instant as wall time in a zone
+ * @param dt Instant (its timezone_offset is honoured)
+ * @param tz Zone
+ * @param out Output local time with the zone's offset at that instant
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_datetime_to_zone(
+    const regislex_datetime_t* dt,
+    const regislex_tz_t* tz,
+    regislex_datetime_t* out
+);
+
+/**
+ * @brief Express many instants as wall time in one zone
+ * @param in Instants
+ * @param out Output local times (may alias in)
+ * @param count Number of entries
+ * @param tz Zone
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_datetime_to_zone_batch(
+    const regislex_datetime_t* in,
+    regislex_datetime_t* out,
+    size_t count,
+    const regislex_tz_t* tz
+);
+
+/**
+ * @brief Resolve a wall time in a zone to its UTC offset
+ *
+ * The timezone_offset of local is ignored. Wall times repeated when clocks
+ * go back resolve to the first occurrence; wall times skipped when clocks
+ * go forward move forward by the length of the gap.
+ *
+ * @param local Wall time in the zone
+ * @param tz Zone
+ * @param out Output wall time with the zone's offset filled in
+ * @return Error code
+ */
+REGISLEX_API regislex_error_t regislex_datetime_from_zone(
+    const regislex_datetime_t* local,
+    const regislex_tz_t* tz,
+    regislex_datetime_t* out
+);
+
+/* ============================================================================
+ * Cron Functions
+ * ============================================================================ */
+
+/**
+ * @brief Compiled cron expression: one bit per allowed field value
+ */
+typedef struct {
+    uint64_t minutes;           /* Bit n: minute n */
+    uint32_t hours;             /* Bit n: hour n */
+    uint32_t days;              /* Bit n: day of month n (1-31) */
+    uint16_t months;            /* Bit n: month n (1-12) */
+    uint8_t weekdays;           /* Bit n: weekday n, 0 = Sunday */
+    bool day_or;                /* Both day fields restricted: either may match */
+    const regislex_tz_t* tz;    /* Zone of the wall times; NULL for UTC */
+} regislex_cron_t;
+
+/**
+ * @brief Compile a cron expression
+ *
+ * Five fields (minute, hour, day of month, month, weekday), each a list of
+ * values and ranges with optional steps ("5", "1-5", "0-30/10"), or "*"
+ * for every value, which takes a step too. Months and weekdays also take
+ * three-letter names, and weekday 7 is Sunday. As in cron, a day matches
+ * either day field when both are restricted. The macros @yearly, @monthly,
+ * @weekly, @daily and @hourly are accepted. A leading "CRON_TZ=<zone>"
+ * evaluates the fields in that IANA zone instead of UTC.
+ *
+ * @param expr Cron expression
+ * @param out Output compiled expression
+ * @return Error code (INVALID_ARGUMENT if malformed or the zone is unknown)
+ */
+REGISLEX_API regislex_error_t regislex_cron_compile(const char* expr, regislex_cron_t* out);
+
+/**
+ * @brief Find the next time a compiled expression fires
+ *
+ * Wall times repeated when clocks go back fire once, at their first
+ * occurrence. Wall times skipped when clocks go forward fire shifted
+ * forward by the length of the gap.
+ *
+ * @param cron Compiled expression
+ * @param after_ms Unix time in milliseconds; the result is strictly later
+ * @param out_ms Output fire time, Unix time in milliseconds
+ * @return Error code (NOT_FOUND if it never fires within eight years)
+ */
+REGISLEX_API regislex_error_t regislex_cron_next(
+    const regislex_cron_t* cron,
+    int64_t after_ms,
+    int64_t* out_ms
+);
+
+/**
+ * @brief Free a metadata array
+ * @param metadata Array to free
+ * @param count Number of entries
+ */
+REGISLEX_API void regislex_metadata_free(regislex_metadata_t* metadata, int count);
+
 /* ============================================================================
  * Include Module Headers
  * ============================================================================ */
@@ -0,0 +1,98 @@
+/**
+ * @file id_map.h
+ * @brief Open-Addressed Id Map
+ *
+ * Internal hash map from a string key, usually a UUID, to an item that
+ * carries the key. Linear probing over a power-of-two table kept at most
+ * half full; removal re-seats the rest of the probe run, so there are no
+ * tombstones. The map owns its table, not its items. Not thread-safe:
+ * each module guards its maps with its own lock.
+ */
+
+#ifndef REGISLEX_ID_MAP_H
+#define REGISLEX_ID_MAP_H
+
+#include "regislex/regislex.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Id map
+ *
+ * Each item holds its NUL-terminated key at key_offset, e.g.
+ * offsetof(entry_t, id.value).
+ */
+typedef struct {
+    void** slots;
+    int capacity;           /* Power of two, or 0 before the first insert */
+    int used;
+    size_t key_offset;
+} regislex_id_map_t;
+
+/**
+ * @brief FNV-1a hash of a string
+ * @param key Key
+ * @return Hash
+ */
+uint32_t regislex_id_hash(const char* key);
+
+/**
+ * @brief Initialize an empty map
+ * @param map Map
+ * @param key_offset Offset of the key inside each item
+ */
+void regislex_id_map_init(regislex_id_map_t* map, size_t key_offset);
+
+/**
+ * @brief Release the table (not the items) and empty the map
+ * @param map Map
+ */
+void regislex_id_map_free(regislex_id_map_t* map);
+
+/**
+ * @brief Find the slot holding a key
+ * @param map Map
+ * @param key Key
+ * @return Slot index, or -1 if absent
+ */
+int regislex_id_map_find(const regislex_id_map_t* map, const char* key);
+
+/**
+ * @brief Look up an item
+ * @param map Map
+ * @param key Key
+ * @return Item, or NULL if absent
+ */
+void* regislex_id_map_get(const regislex_id_map_t* map, const char* key);
+
+/**
+ * @brief Insert an item whose key is not in the map, growing the table
+ * @param map Map
+ * @param item Item
+ * @return Error code (OUT_OF_MEMORY if the table cannot grow)
+ */
+regislex_error_t regislex_id_map_insert(regislex_id_map_t* map, void* item);
+
+/**
+ * @brief Remove the item in a slot
+ * @param map Map
+ * @param index Slot index from regislex_id_map_find()
+ */
+void regislex_id_map_remove_at(regislex_id_map_t* map, int index);
+
+/**
+ * @brief Remove an item by key
+ * @param map Map
+ * @param key Key
+ * @return Removed item, or NULL if absent
+ */
+void* regislex_id_map_remove(regislex_id_map_t* map, const char* key);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REGISLEX_ID_MAP_H */
@@ -106,6 +106,39 @@ static int cmd_status(int argc, char** argv, regislex_context_t* ctx) {
     printf("Version:    %s\n", regislex_version());
     printf("Context:    %s\n", ctx ? "Initialized" : "Not initialized");
 
+    if (!ctx) {
+        return 0;
+    }
+
+    /* Served from the in-memory caseload counters */
+    regislex_caseload_summary_t summary;
+    if (regislex_caseload_summary(ctx, &summary) != REGISLEX_OK) {
+        return 0;
+    }
+
+    static const char* status_names[REGISLEX_CASELOAD_STATUS_COUNT] = {
+        "Draft", "Active", "Pending", "On hold", "Completed", "Closed", "Archived", "Cancelled"
+    };
+
+    printf("\nCases:      %d total, %d open, %d unassigned\n",
+           summary.total, summary.open, summary.unassigned);
+    for (int i = 0; i < REGISLEX_CASELOAD_STATUS_COUNT; i++) {
+        if (summary.by_status[i] > 0) {
+            printf("  %-10s %d\n", status_names[i], summary.by_status[i]);
+        }
+    }
+
+    regislex_caseload_assignee_t* assignees = NULL;
+    int assignee_count = 0;
+    if (regislex_caseload_by_assignee(ctx, &assignees, &assignee_count) == REGISLEX_OK &&
+        assignee_count > 0) {
+        printf("\nAssigned cases by user:\n");
+        for (int i = 0; i < assignee_count; i++) {
+            printf("  %-36s %d\n", assignees[i].user_id.value, assignees[i].count);
+        }
+    }
+    regislex_caseload_assignees_free(assignees);
+
     return 0;
 }
 
@@ -0,0 +1,356 @@
+/**
+ * @file cron.c
+ * @brief Compiled Cron Expressions
+ *
+ * An expression is compiled once into one bitmask per field. Finding the
+ * next fire time then walks the calendar field by field, jumping straight
+ * to the next set bit of the month, hour and minute masks, so the cost
+ * depends on the number of days skipped rather than minutes.
+ *
+ * Fields are matched against wall time in the expression's zone and the
+ * matching wall time is resolved with regislex_datetime_from_zone(), which
+ * settles repeated and skipped wall times at DST transitions.
+ */
+
+#include "regislex/regislex.h"
+#include <ctype.h>
+#include <string.h>
+
+#define CRON_SEARCH_YEARS  8
+#define CRON_MS_PER_MINUTE 60000
+
+typedef struct {
+    const char* macro;
+    const char* expr;
+} cron_macro_t;
+
+static const cron_macro_t CRON_MACROS[] = {
+    { "@yearly",   "0 0 1 1 *" },
+    { "@annually", "0 0 1 1 *" },
+    { "@monthly",  "0 0 1 * *" },
+    { "@weekly",   "0 0 * * 0" },
+    { "@daily",    "0 0 * * *" },
+    { "@midnight", "0 0 * * *" },
+    { "@hourly",   "0 * * * *" }
+};
+
+static const char* const MONTH_NAMES[] = {
+    "JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC"
+};
+
+static const char* const WEEKDAY_NAMES[] = {
+    "SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"
+};
+
+/* Bit index of the lowest set bit, via a de Bruijn sequence */
+static const int DEBRUIJN_INDEX[64] = {
+     0,  1, 48,  2, 57, 49, 28,  3, 61, 58, 50, 42, 38, 29, 17,  4,
+    62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12,  5,
+    63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+    46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19,  9, 13,  8,  7,  6
+};
+
+/* ============================================================================
+ * Parsing
+ * ============================================================================ */
+
+static const char* parse_value(const char* p, int lo, int hi,
+                               const char* const* names, int name_count, int* out) {
+    if (isdigit((unsigned char)*p)) {
+        int value = 0;
+        while (isdigit((unsigned char)*p)) {
+            value = value * 10 + (*p - '0');
+            if (value > hi) return NULL;
+            p++;
+        }
+        if (value < lo) return NULL;
+        *out = value;
+        return p;
+    }
+
+    for (int i = 0; i < name_count; i++) {
+        if (toupper((unsigned char)p[0]) == names[i][0] &&
+            toupper((unsigned char)p[1]) == names[i][1] &&
+            toupper((unsigned char)p[2]) == names[i][2]) {
+            *out = lo + i;
+            return p + 3;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Parses one field into a mask over lo..hi. Sets *star when the field
+ * starts with "*", which for the day fields means "unrestricted".
+ */
+static const char* parse_field(const char* p, int lo, int hi,
+                               const char* const* names, int name_count,
+                               uint64_t* out, bool* star) {
+    uint64_t mask = 0;
+    *star = *p == '*';
+
+    for (;;) {
+        int first, last;
+        if (*p == '*') {
+            first = lo;
+            last = hi;
+            p++;
+        } else {
+            p = parse_value(p, lo, hi, names, name_count, &first);
+            if (!p) return NULL;
+            last = first;
+            if (*p == '-') {
+                p = parse_value(p + 1, lo, hi, names, name_count, &last);
+                if (!p || last < first) return NULL;
+            }
+        }
+
+        int step = 1;
+        if (*p == '/') {
+            p = parse_value(p + 1, 1, hi - lo + 1, NULL, 0, &step);
+            if (!p) return NULL;
+            /* "5/15" runs from 5 to the end of the range */
+            if (first == last) last = hi;
+        }
+
+        for (int v = first; v <= last; v += step) {
+            mask |= (uint64_t)1 << v;
+        }
+
+        if (*p != ',') break;
+        p++;
+    }
+
+    if (*p && *p != ' ' && *p != '\t') return NULL;
+    while (*p == ' ' || *p == '\t') p++;
+
+    *out = mask;
+    return p;
+}
+
+/* ============================================================================
+ * Calendar Search
+ * ============================================================================ */
+
+static int lowest_bit(uint64_t mask) {
+    return DEBRUIJN_INDEX[((mask & (~mask + 1)) * 0x03f79d71b4cb0a89ULL) >> 58];
+}
+
+/* Lowest set bit at or above from, or -1 */
+static int next_bit(uint64_t mask, int from) {
+    if (from >= 64) return -1;
+    mask >>= from;
+    return mask ? from + lowest_bit(mask) : -1;
+}
+
+static int month_days(int year, int month) {
+    static const int DAYS[] = {0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    return month == 2 && leap ? 29 : DAYS[month];
+}
+
+static bool day_matches(const regislex_cron_t* cron, const regislex_datetime_t* w) {
+    bool day = (cron->days >> w->day) & 1;
+    bool weekday = (cron->weekdays >> regislex_datetime_day_of_week(w)) & 1;
+    return cron->day_or ? (day || weekday) : (day && weekday);
+}
+
+/*
+ * Moves w to the first matching wall time at or after it. Fields may
+ * start out of range (minute 60, hour 24, day past the month's end);
+ * each carries into the next larger field.
+ */
+static bool wall_next(const regislex_cron_t* cron, regislex_datetime_t* w) {
+    int last_year = w->year + CRON_SEARCH_YEARS;
+
+    while (w->year <= last_year) {
+        int month = next_bit(cron->months, w->month);
+        if (month < 0 || month > 12) {
+            w->year++;
+            w->month = 1;
+            w->day = 1;
+            w->hour = 0;
+            w->minute = 0;
+            continue;
+        }
+        if (month != w->month) {
+            w->month = month;
+            w->day = 1;
+            w->hour = 0;
+            w->minute = 0;
+        }
+
+        if (w->day > month_days(w->year, w->month)) {
+            w->month++;
+            w->day = 1;
+            w->hour = 0;
+            w->minute = 0;
+            continue;
+        }
+        if (!day_matches(cron, w)) {
+            w->day++;
+            w->hour = 0;
+            w->minute = 0;
+            continue;
+        }
+
+        int hour = next_bit(cron->hours, w->hour);
+        if (hour < 0) {
+            w->day++;
+            w->hour = 0;
+            w->minute = 0;
+            continue;
+        }
+        if (hour != w->hour) {
+            w->hour = hour;
+            w->minute = 0;
+        }
+
+        int minute = next_bit(cron->minutes, w->minute);
+        if (minute < 0) {
+            w->hour++;
+            w->minute = 0;
+            continue;
+        }
+        w->minute = minute;
+        return true;
+    }
+    return false;
+}
+
+static int64_t floor_div(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    return q - ((a % b) < 0);
+}
+
+/* Wall time of an instant in the expression's zone, to the minute */
+static void wall_of(const regislex_cron_t* cron, int64_t minute_index, regislex_datetime_t* w) {
+    int64_t days = floor_div(minute_index, 1440);
+    int minute_of_day = (int)(minute_index - days * 1440);
+
+    regislex_datetime_t utc;
+    memset(&utc, 0, sizeof(utc));
+    regislex_datetime_from_days(days, &utc);
+    utc.hour = minute_of_day / 60;
+    utc.minute = minute_of_day % 60;
+
+    if (cron->tz) {
+        regislex_datetime_to_zone(&utc, cron->tz, w);
+    } else {
+        *w = utc;
+    }
+    w->second = 0;
+}
+
+/* Instant of a wall time, in minutes since the epoch */
+static int64_t wall_resolve(const regislex_cron_t* cron, const regislex_datetime_t* w) {
+    regislex_datetime_t at = *w;
+    if (cron->tz) {
+        regislex_datetime_from_zone(w, cron->tz, &at);
+    } else {
+        at.timezone_offset = 0;
+    }
+    return regislex_datetime_to_days(&at) * 1440 + at.hour * 60 + at.minute - at.timezone_offset;
+}
+
+/* ============================================================================
+ * Public Functions
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_cron_compile(const char* expr, regislex_cron_t* out) {
+    if (!expr || !out) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_cron_t cron;
+    memset(&cron, 0, sizeof(cron));
+
+    const char* p = expr;
+    while (*p == ' ' || *p == '\t') p++;
+
+    if (strncmp(p, "CRON_TZ=", 8) == 0) {
+        p += 8;
+        char zone[64];
+        size_t len = 0;
+        while (p[len] && p[len] != ' ' && p[len] != '\t') len++;
+        if (len == 0 || len >= sizeof(zone)) return REGISLEX_ERROR_INVALID_ARGUMENT;
+        memcpy(zone, p, len);
+        zone[len] = '\0';
+
+        cron.tz = regislex_tz_find(zone);
+        if (!cron.tz) return REGISLEX_ERROR_INVALID_ARGUMENT;
+        p += len;
+        while (*p == ' ' || *p == '\t') p++;
+    }
+
+    if (*p == '@') {
+        const char* macro = NULL;
+        for (size_t i = 0; i < sizeof(CRON_MACROS) / sizeof(CRON_MACROS[0]); i++) {
+            size_t len = strlen(CRON_MACROS[i].macro);
+            if (strncmp(p, CRON_MACROS[i].macro, len) == 0 &&
+                (p[len] == '\0' || p[len] == ' ' || p[len] == '\t')) {
+                macro = CRON_MACROS[i].expr;
+                break;
+            }
+        }
+        if (!macro) return REGISLEX_ERROR_INVALID_ARGUMENT;
+        p = macro;
+    }
+
+    uint64_t minutes, hours, days, months, weekdays;
+    bool star, days_star, weekdays_star;
+
+    p = parse_field(p, 0, 59, NULL, 0, &minutes, &star);
+    if (p) p = parse_field(p, 0, 23, NULL, 0, &hours, &star);
+    if (p) p = parse_field(p, 1, 31, NULL, 0, &days, &days_star);
+    if (p) p = parse_field(p, 1, 12, MONTH_NAMES, 12, &months, &star);
+    if (p) p = parse_field(p, 0, 7, WEEKDAY_NAMES, 7, &weekdays, &weekdays_star);
+    if (!p || *p) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    /* Weekday 7 is another name for Sunday */
+    if (weekdays & 0x80) weekdays = (weekdays & 0x7f) | 1;
+
+    cron.minutes = minutes;
+    cron.hours = (uint32_t)hours;
+    cron.days = (uint32_t)days;
+    cron.months = (uint16_t)months;
+    cron.weekdays = (uint8_t)weekdays;
+    cron.day_or = !days_star && !weekdays_star;
+
+    *out = cron;
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_cron_next(
+    const regislex_cron_t* cron,
+    int64_t after_ms,
+    int64_t* out_ms)
+{
+    if (!cron || !out_ms) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    int64_t after_minute = floor_div(after_ms, CRON_MS_PER_MINUTE);
+
+    /* Search wall time from the minute after; in UTC this is always the answer */
+    regislex_datetime_t w;
+    wall_of(cron, after_minute, &w);
+    w.minute++;
+
+    /*
+     * A wall time inside a fall-back overlap can resolve to its first
+     * occurrence, before after_ms; carry on with the next matching one.
+     */
+    while (wall_next(cron, &w)) {
+        int64_t at = wall_resolve(cron, &w);
+        if (at > after_minute) {
+            *out_ms = at * CRON_MS_PER_MINUTE;
+            return REGISLEX_OK;
+        }
+        w.minute++;
+    }
+
+    return REGISLEX_ERROR_NOT_FOUND;
+}
@@ -27,6 +27,58 @@ struct regislex_context {
     regislex_user_t* current_user;
 };
 
+/* ============================================================================
+ * Module Stages
+ * ============================================================================ */
+
+/* In-memory module state, built in this order at init and torn down in reverse */
+typedef struct {
+    regislex_error_t (*init)(regislex_context_t* ctx);
+    void (*shutdown)(void);
+    const char* failure;
+} module_stage_t;
+
+static const module_stage_t MODULE_STAGES[] = {
+    { regislex_conflict_index_init, regislex_conflict_index_shutdown, "Failed to build conflict index" },
+    { regislex_caseload_init,       regislex_caseload_shutdown,       "Failed to load caseload counters" },
+    { regislex_court_calendar_init, regislex_court_calendar_shutdown, "Failed to initialize court calendars" },
+    { regislex_court_zones_init,    regislex_court_zones_shutdown,    "Failed to load court time zones" },
+    { regislex_court_rules_init,    regislex_court_rules_shutdown,    "Failed to initialize court rules" },
+    { regislex_statute_init,        regislex_statute_shutdown,        "Failed to load statute of limitations rules" },
+    { regislex_calendar_feed_init,  regislex_calendar_feed_shutdown,  "Failed to initialize calendar feeds" },
+    { regislex_schedule_init,       regislex_schedule_shutdown,       "Failed to load assignee schedules" },
+    { regislex_agenda_init,         regislex_agenda_shutdown,         "Failed to build user agendas" }
+};
+
+#define MODULE_STAGE_COUNT (sizeof(MODULE_STAGES) / sizeof(MODULE_STAGES[0]))
+
+/* Shuts down the first count stages, last first; each shutdown tolerates a partial init */
+static void modules_shutdown(size_t count) {
+    while (count > 0) {
+        MODULE_STAGES[--count].shutdown();
+    }
+}
+
+/* Releases the database, mutex and the context itself */
+static void context_destroy(regislex_context_t* ctx) {
+    if (ctx->db) {
+        regislex_db_shutdown(ctx->db);
+        ctx->db = NULL;
+    }
+
+    if (ctx->mutex) {
+        platform_mutex_destroy(ctx->mutex);
+        ctx->mutex = NULL;
+    }
+
+    if (ctx->current_user) {
+        platform_free(ctx->current_user);
+        ctx->current_user = NULL;
+    }
+
+    platform_free(ctx);
+}
+
 /* ============================================================================
  * Version Information
  * ============================================================================ */
@@ -258,8 +310,7 @@ REGISLEX_API regislex_error_t regislex_init(const regislex_config_t* config,
         platform_error_t perr = platform_mkdir(new_ctx->config.data_dir, true);
         if (perr != PLATFORM_OK && perr != PLATFORM_ERROR_ALREADY_EXISTS) {
             set_error(new_ctx, "Failed to create data directory: %s", new_ctx->config.data_dir);
-            platform_mutex_destroy(new_ctx->mutex);
-            platform_free(new_ctx);
+            context_destroy(new_ctx);
             return REGISLEX_ERROR_IO;
         }
     }
@@ -283,8 +334,7 @@ REGISLEX_API regislex_error_t regislex_init(const regislex_config_t* config,
     regislex_error_t db_err = regislex_db_init(&new_ctx->config.database, &new_ctx->db);
     if (db_err != REGISLEX_OK) {
         set_error(new_ctx, "Failed to initialize database");
-        platform_mutex_destroy(new_ctx->mutex);
-        platform_free(new_ctx);
+        context_destroy(new_ctx);
         return db_err;
     }
 
@@ -292,12 +342,24 @@ REGISLEX_API regislex_error_t regislex_init(const regislex_config_t* config,
     db_err = regislex_db_migrate(new_ctx->db);
     if (db_err != REGISLEX_OK) {
         set_error(new_ctx, "Failed to run database migrations");
-        regislex_db_shutdown(new_ctx->db);
-        platform_mutex_destroy(new_ctx->mutex);
-        platform_free(new_ctx);
+        context_destroy(new_ctx);
         return db_err;
     }
 
+    /* Compile time zone rules before anything resolves court-local times */
+    regislex_timezone_init();
+
+    /* Load in-memory indexes */
+    for (size_t i = 0; i < MODULE_STAGE_COUNT; i++) {
+        db_err = MODULE_STAGES[i].init(new_ctx);
+        if (db_err != REGISLEX_OK) {
+            set_error(new_ctx, "%s", MODULE_STAGES[i].failure);
+            modules_shutdown(i + 1);
+            context_destroy(new_ctx);
+            return db_err;
+        }
+    }
+
     /* Create document storage directory */
     if (strcmp(new_ctx->config.storage.type, "filesystem") == 0) {
         if (new_ctx->config.storage.base_path[0] == '\0') {
@@ -322,23 +384,19 @@ REGISLEX_API regislex_error_t regislex_init(const regislex_config_t* config,
 REGISLEX_API void regislex_shutdown(regislex_context_t* ctx) {
     if (!ctx) return;
 
-    if (ctx->db) {
-        regislex_db_shutdown(ctx->db);
-        ctx->db = NULL;
-    }
-
-    if (ctx->mutex) {
-        platform_mutex_destroy(ctx->mutex);
-        ctx->mutex = NULL;
-    }
-
-    if (ctx->current_user) {
-        platform_free(ctx->current_user);
-        ctx->current_user = NULL;
-    }
+    regislex_cron_scheduler_stop();
+    regislex_event_bus_stop();
+    regislex_workflow_executor_stop();
+    regislex_reminder_dispatcher_stop();
+    modules_shutdown(MODULE_STAGE_COUNT);
 
     ctx->initialized = false;
-    platform_free(ctx);
+    context_destroy(ctx);
+}
+
+regislex_db_context_t* regislex_get_db(regislex_context_t* ctx) {
+    if (!ctx) return NULL;
+    return ctx->db;
 }
 
 /* ============================================================================
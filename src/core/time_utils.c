@@ -19,45 +19,88 @@ static int get_days_in_month(int year, int month) {
     return days_in_month[month];
 }
 
-regislex_error_t regislex_datetime_add_days(regislex_datetime_t* dt, int days) {
-    if (!dt) return REGISLEX_ERROR_INVALID_ARGUMENT;
+/* ============================================================================
+ * Epoch Day Conversion
+ * ============================================================================ */
+
+/*
+ * Days since 1970-01-01 in the proleptic Gregorian calendar. Eras of 400
+ * years repeat exactly, so the conversion is closed-form in both directions.
+ */
+REGISLEX_API int64_t regislex_datetime_to_days(const regislex_datetime_t* dt) {
+    if (!dt) return 0;
+
+    int64_t year = dt->year - (dt->month <= 2 ? 1 : 0);
+    int64_t era = (year >= 0 ? year : year - 399) / 400;
+    int64_t year_of_era = year - era * 400;
+    int64_t month = dt->month;
+    int64_t day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + dt->day - 1;
+    int64_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+
+    return era * 146097 + day_of_era - 719468;
+}
+
+REGISLEX_API void regislex_datetime_from_days(int64_t days, regislex_datetime_t* dt) {
+    if (!dt) return;
+
+    days += 719468;
+    int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    int64_t day_of_era = days - era * 146097;
+    int64_t year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    int64_t day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    int64_t mp = (5 * day_of_year + 2) / 153;
+    int64_t month = mp < 10 ? mp + 3 : mp - 9;
 
-    /* Convert to time_t, add days, convert back */
-    struct tm tm_info = {0};
-    tm_info.tm_year = dt->year - 1900;
-    tm_info.tm_mon = dt->month - 1;
-    tm_info.tm_mday = dt->day;
-    tm_info.tm_hour = dt->hour;
-    tm_info.tm_min = dt->minute;
-    tm_info.tm_sec = dt->second;
-    tm_info.tm_isdst = -1;
-
-    time_t t = mktime(&tm_info);
-    t += days * 24 * 60 * 60;
-
-#ifdef REGISLEX_PLATFORM_WINDOWS
-    struct tm result;
-    gmtime_s(&result, &t);
-    dt->year = result.tm_year + 1900;
-    dt->month = result.tm_mon + 1;
-    dt->day = result.tm_mday;
-    dt->hour = result.tm_hour;
-    dt->minute = result.tm_min;
-    dt->second = result.tm_sec;
-#else
-    struct tm* result = gmtime(&t);
-    dt->year = result->tm_year + 1900;
-    dt->month = result->tm_mon + 1;
-    dt->day = result->tm_mday;
-    dt->hour = result->tm_hour;
-    dt->minute = result->tm_min;
-    dt->second = result->tm_sec;
-#endif
+    dt->year = (int)(year_of_era + era * 400 + (month <= 2 ? 1 : 0));
+    dt->month = (int)month;
+    dt->day = (int)(day_of_year - (153 * mp + 2) / 5 + 1);
+}
+
+REGISLEX_API int64_t regislex_datetime_to_seconds(const regislex_datetime_t* dt) {
+    if (!dt) return 0;
+
+    return regislex_datetime_to_days(dt) * 86400
+        + dt->hour * 3600 + dt->minute * 60 + dt->second
+        - (int64_t)dt->timezone_offset * 60;
+}
+
+REGISLEX_API void regislex_datetime_from_seconds(int64_t seconds, regislex_datetime_t* dt) {
+    if (!dt) return;
+
+    int64_t days = seconds / 86400;
+    int64_t rem = seconds % 86400;
+    if (rem < 0) {
+        rem += 86400;
+        days--;
+    }
 
+    memset(dt, 0, sizeof(*dt));
+    regislex_datetime_from_days(days, dt);
+    dt->hour = (int)(rem / 3600);
+    dt->minute = (int)(rem % 3600 / 60);
+    dt->second = (int)(rem % 60);
+}
+
+REGISLEX_API bool regislex_datetime_is_valid_date(const regislex_datetime_t* dt) {
+    if (!dt) return false;
+    if (dt->year < 1 || dt->year > 9999) return false;
+    if (dt->month < 1 || dt->month > 12) return false;
+    return dt->day >= 1 && dt->day <= get_days_in_month(dt->year, dt->month);
+}
+
+/* ============================================================================
+ * Date Arithmetic
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_datetime_add_days(regislex_datetime_t* dt, int days) {
+    if (!dt) return REGISLEX_ERROR_INVALID_ARGUMENT;
+
+    /* Time of day is untouched; only the civil date moves */
+    regislex_datetime_from_days(regislex_datetime_to_days(dt) + days, dt);
     return REGISLEX_OK;
 }
 
-regislex_error_t regislex_datetime_add_months(regislex_datetime_t* dt, int months) {
+REGISLEX_API regislex_error_t regislex_datetime_add_months(regislex_datetime_t* dt, int months) {
     if (!dt) return REGISLEX_ERROR_INVALID_ARGUMENT;
 
     int total_months = (dt->year * 12 + dt->month - 1) + months;
@@ -71,27 +114,12 @@ regislex_error_t regislex_datetime_add_months(regislex_datetime_t* dt, int month
     return REGISLEX_OK;
 }
 
-int regislex_datetime_diff_days(const regislex_datetime_t* dt1, const regislex_datetime_t* dt2) {
+REGISLEX_API int regislex_datetime_diff_days(const regislex_datetime_t* dt1, const regislex_datetime_t* dt2) {
     if (!dt1 || !dt2) return 0;
-
-    struct tm tm1 = {0}, tm2 = {0};
-    tm1.tm_year = dt1->year - 1900;
-    tm1.tm_mon = dt1->month - 1;
-    tm1.tm_mday = dt1->day;
-    tm1.tm_isdst = -1;
-
-    tm2.tm_year = dt2->year - 1900;
-    tm2.tm_mon = dt2->month - 1;
-    tm2.tm_mday = dt2->day;
-    tm2.tm_isdst = -1;
-
-    time_t t1 = mktime(&tm1);
-    time_t t2 = mktime(&tm2);
-
-    return (int)((t2 - t1) / (24 * 60 * 60));
+    return (int)(regislex_datetime_to_days(dt2) - regislex_datetime_to_days(dt1));
 }
 
-int regislex_datetime_compare(const regislex_datetime_t* dt1, const regislex_datetime_t* dt2) {
+REGISLEX_API int regislex_datetime_compare(const regislex_datetime_t* dt1, const regislex_datetime_t* dt2) {
     if (!dt1 || !dt2) return 0;
 
     if (dt1->year != dt2->year) return dt1->year - dt2->year;
@@ -102,25 +130,20 @@ int regislex_datetime_compare(const regislex_datetime_t* dt1, const regislex_dat
     return dt1->second - dt2->second;
 }
 
-int regislex_datetime_day_of_week(const regislex_datetime_t* dt) {
+REGISLEX_API int regislex_datetime_day_of_week(const regislex_datetime_t* dt) {
     if (!dt) return -1;
 
-    struct tm tm_info = {0};
-    tm_info.tm_year = dt->year - 1900;
-    tm_info.tm_mon = dt->month - 1;
-    tm_info.tm_mday = dt->day;
-    tm_info.tm_isdst = -1;
-
-    mktime(&tm_info);
-    return tm_info.tm_wday;  /* 0 = Sunday */
+    /* 1970-01-01 was a Thursday */
+    int64_t dow = (regislex_datetime_to_days(dt) + 4) % 7;
+    return (int)(dow < 0 ? dow + 7 : dow);  /* 0 = Sunday */
 }
 
-bool regislex_datetime_is_weekend(const regislex_datetime_t* dt) {
+REGISLEX_API bool regislex_datetime_is_weekend(const regislex_datetime_t* dt) {
     int dow = regislex_datetime_day_of_week(dt);
     return dow == 0 || dow == 6;
 }
 
-regislex_error_t regislex_datetime_next_business_day(regislex_datetime_t* dt) {
+REGISLEX_API regislex_error_t regislex_datetime_next_business_day(regislex_datetime_t* dt) {
     if (!dt) return REGISLEX_ERROR_INVALID_ARGUMENT;
 
     do {
@@ -130,18 +153,37 @@ regislex_error_t regislex_datetime_next_business_day(regislex_datetime_t* dt) {
     return REGISLEX_OK;
 }
 
-regislex_error_t regislex_datetime_add_business_days(regislex_datetime_t* dt, int days) {
+REGISLEX_API regislex_error_t regislex_datetime_add_business_days(regislex_datetime_t* dt, int days) {
     if (!dt) return REGISLEX_ERROR_INVALID_ARGUMENT;
 
-    int direction = days >= 0 ? 1 : -1;
-    int remaining = days >= 0 ? days : -days;
-
-    while (remaining > 0) {
-        regislex_datetime_add_days(dt, direction);
-        if (!regislex_datetime_is_weekend(dt)) {
-            remaining--;
+    /*
+     * Whole weeks contribute five business days each; the remainder only
+     * needs to know whether it crosses a weekend. Weekend starting points
+     * are first moved to the adjacent Friday (going forward) or Monday
+     * (going backward) so they count like the business day next to them.
+     */
+    if (days == 0) return REGISLEX_OK;
+
+    int64_t day = regislex_datetime_to_days(dt);
+    int weekday = (int)(((day + 3) % 7 + 7) % 7);   /* 0 = Monday */
+
+    if (days >= 0) {
+        if (weekday >= 5) {
+            day -= weekday - 4;
+            weekday = 4;
+        }
+        day += (int64_t)(days / 5) * 7 + days % 5;
+        if (weekday + days % 5 >= 5) day += 2;
+    } else {
+        int count = -days;
+        if (weekday >= 5) {
+            day += 7 - weekday;
+            weekday = 0;
         }
+        day -= (int64_t)(count / 5) * 7 + count % 5;
+        if (weekday - count % 5 < 0) day -= 2;
     }
 
+    regislex_datetime_from_days(day, dt);
     return REGISLEX_OK;
 }
@@ -0,0 +1,368 @@
+/**
+ * @file timezone.c
+ * @brief Compiled Time Zone Conversion
+ *
+ * Zone rules come from the table generated at build time by regislex-tzgen
+ * (one POSIX TZ rule per zone, taken from the installed tzdata). At startup
+ * each rule is parsed once and its DST transitions are precomputed for
+ * every year in the cache window, as UTC seconds. Converting an instant is
+ * then one epoch-day split, one table load and a few compares combined
+ * without branches, which keeps bulk conversion of deadline lists cheap.
+ *
+ * Only the current rule of each zone is compiled; historical rule changes
+ * before it took effect are not modelled.
+ */
+
+#include "regislex/regislex.h"
+#include "regislex_tz_table.h"
+#include <ctype.h>
+#include <string.h>
+
+#define TZ_CACHE_FIRST_YEAR  1970
+#define TZ_CACHE_YEARS       136
+
+#define TZ_SECONDS_PER_DAY   86400
+
+typedef enum {
+    TZ_RULE_MONTH_WEEK_DAY = 0,  /* Mm.w.d */
+    TZ_RULE_JULIAN,              /* Jn, 1..365, February 29 never counted */
+    TZ_RULE_DAY_OF_YEAR          /* n, 0..365 */
+} tz_rule_kind_t;
+
+typedef struct {
+    tz_rule_kind_t kind;
+    int month;
+    int week;
+    int weekday;
+    int day;
+    int32_t time;               /* Seconds after local midnight, may be negative */
+} tz_rule_t;
+
+struct regislex_tz {
+    const char* name;
+    bool valid;
+    int32_t has_dst;
+    int32_t std_offset;         /* Seconds east of UTC */
+    int32_t dst_offset;
+    tz_rule_t start;
+    tz_rule_t end;
+    int64_t transitions[TZ_CACHE_YEARS][2];  /* DST start and end, UTC seconds */
+};
+
+static regislex_tz_t tz_zones[REGISLEX_TZ_ZONE_COUNT];
+static bool tz_compiled = false;
+
+/* ============================================================================
+ * POSIX TZ Rule Parsing
+ * ============================================================================ */
+
+static const char* parse_number(const char* p, int lo, int hi, int* out) {
+    if (!isdigit((unsigned char)*p)) return NULL;
+
+    int value = 0;
+    while (isdigit((unsigned char)*p)) {
+        value = value * 10 + (*p++ - '0');
+        if (value > hi) return NULL;
+    }
+    if (value < lo) return NULL;
+
+    *out = value;
+    return p;
+}
+
+static const char* parse_abbreviation(const char* p) {
+    if (*p == '<') {
+        const char* close = strchr(p, '>');
+        return close ? close + 1 : NULL;
+    }
+
+    const char* start = p;
+    while (isalpha((unsigned char)*p)) p++;
+    return p - start >= 3 ? p : NULL;
+}
+
+/* [+-]hh[:mm[:ss]]; rule times may reach 167 hours (RFC 8536) */
+static const char* parse_time(const char* p, int32_t* out) {
+    int sign = 1;
+    if (*p == '+' || *p == '-') {
+        sign = *p == '-' ? -1 : 1;
+        p++;
+    }
+
+    int hours = 0, minutes = 0, seconds = 0;
+    p = parse_number(p, 0, 167, &hours);
+    if (p && *p == ':') {
+        p = parse_number(p + 1, 0, 59, &minutes);
+        if (p && *p == ':') p = parse_number(p + 1, 0, 59, &seconds);
+    }
+    if (!p) return NULL;
+
+    *out = sign * (hours * 3600 + minutes * 60 + seconds);
+    return p;
+}
+
+static const char* parse_rule(const char* p, tz_rule_t* rule) {
+    memset(rule, 0, sizeof(*rule));
+
+    if (*p == 'M') {
+        rule->kind = TZ_RULE_MONTH_WEEK_DAY;
+        p = parse_number(p + 1, 1, 12, &rule->month);
+        if (p && *p == '.') p = parse_number(p + 1, 1, 5, &rule->week);
+        else p = NULL;
+        if (p && *p == '.') p = parse_number(p + 1, 0, 6, &rule->weekday);
+        else p = NULL;
+    } else if (*p == 'J') {
+        rule->kind = TZ_RULE_JULIAN;
+        p = parse_number(p + 1, 1, 365, &rule->day);
+    } else {
+        rule->kind = TZ_RULE_DAY_OF_YEAR;
+        p = parse_number(p, 0, 365, &rule->day);
+    }
+    if (!p) return NULL;
+
+    rule->time = 2 * 3600;
+    if (*p == '/') p = parse_time(p + 1, &rule->time);
+    return p;
+}
+
+static bool tz_parse(const char* spec, regislex_tz_t* tz) {
+    int32_t offset = 0;
+
+    /* POSIX offsets count hours west of UTC */
+    const char* p = parse_abbreviation(spec);
+    if (p) p = parse_time(p, &offset);
+    if (!p) return false;
+
+    tz->std_offset = -offset;
+    tz->dst_offset = tz->std_offset;
+    tz->has_dst = 0;
+    if (*p == '\0') return true;
+
+    p = parse_abbreviation(p);
+    if (!p) return false;
+
+    tz->dst_offset = tz->std_offset + 3600;
+    if (*p != ',' && *p != '\0') {
+        p = parse_time(p, &offset);
+        if (!p) return false;
+        tz->dst_offset = -offset;
+    }
+
+    if (*p == '\0') {
+        /* No transition rule given; POSIX leaves it to the implementation */
+        p = parse_rule("M3.2.0", &tz->start);
+        p = parse_rule("M11.1.0", &tz->end);
+    } else {
+        p = parse_rule(p + 1, &tz->start);
+        if (p && *p == ',') p = parse_rule(p + 1, &tz->end);
+        else p = NULL;
+    }
+    if (!p || *p != '\0') return false;
+
+    tz->has_dst = 1;
+    return true;
+}
+
+/* ============================================================================
+ * Transition Computation
+ * ============================================================================ */
+
+static int64_t first_day_of(int year, int month) {
+    regislex_datetime_t dt;
+    memset(&dt, 0, sizeof(dt));
+    dt.year = year;
+    dt.month = month;
+    dt.day = 1;
+    return regislex_datetime_to_days(&dt);
+}
+
+static int64_t rule_day(const tz_rule_t* rule, int year) {
+    int64_t jan1 = first_day_of(year, 1);
+    bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+
+    switch (rule->kind) {
+        case TZ_RULE_JULIAN:
+            return jan1 + rule->day - 1 + (leap && rule->day >= 60 ? 1 : 0);
+        case TZ_RULE_DAY_OF_YEAR:
+            return jan1 + rule->day;
+        case TZ_RULE_MONTH_WEEK_DAY:
+        default: {
+            int64_t first = first_day_of(year, rule->month);
+            int64_t next = rule->month == 12 ? first_day_of(year + 1, 1)
+                                             : first_day_of(year, rule->month + 1);
+            int first_weekday = (int)(((first + 4) % 7 + 7) % 7);
+            int64_t day = first + (rule->weekday - first_weekday + 7) % 7 + (rule->week - 1) * 7;
+            while (day >= next) day -= 7;  /* Week 5 means the last one */
+            return day;
+        }
+    }
+}
+
+static void year_transitions(const regislex_tz_t* tz, int year, int64_t* out) {
+    if (!tz->has_dst) {
+        out[0] = 0;
+        out[1] = 0;
+        return;
+    }
+
+    /* Start is given in standard time, end in daylight time */
+    out[0] = rule_day(&tz->start, year) * TZ_SECONDS_PER_DAY + tz->start.time - tz->std_offset;
+    out[1] = rule_day(&tz->end, year) * TZ_SECONDS_PER_DAY + tz->end.time - tz->dst_offset;
+}
+
+/* ============================================================================
+ * Instant Conversion
+ * ============================================================================ */
+
+static int64_t floor_div(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    return q - ((a % b) < 0);
+}
+
+static int year_of_days(int64_t days) {
+    days += 719468;
+    int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    int64_t day_of_era = days - era * 146097;
+    int64_t year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    int64_t day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+
+    /* March-based years roll over after day 305 (January 1) */
+    return (int)(year_of_era + era * 400 + (day_of_year >= 306));
+}
+
+static int32_t offset_at(const regislex_tz_t* tz, int64_t t) {
+    int year = year_of_days(floor_div(t, TZ_SECONDS_PER_DAY));
+    uint32_t index = (uint32_t)(year - TZ_CACHE_FIRST_YEAR);
+
+    int64_t scratch[2];
+    const int64_t* tr = tz->transitions[index < TZ_CACHE_YEARS ? index : 0];
+    if (index >= TZ_CACHE_YEARS) {
+        year_transitions(tz, year, scratch);
+        tr = scratch;
+    }
+
+    /* Northern rules have start < end; southern ones wrap the new year */
+    int32_t north = tr[0] < tr[1];
+    int32_t after = t >= tr[0];
+    int32_t before = t < tr[1];
+    int32_t in_dst = tz->has_dst & ((north & after & before) | ((!north) & (after | before)));
+
+    return tz->std_offset + in_dst * (tz->dst_offset - tz->std_offset);
+}
+
+static void set_local(int64_t t, int32_t offset, regislex_datetime_t* out) {
+    regislex_datetime_from_seconds(t + offset, out);
+    out->timezone_offset = offset / 60;
+}
+
+/* ============================================================================
+ * Public Functions
+ * ============================================================================ */
+
+REGISLEX_API void regislex_timezone_init(void) {
+    if (tz_compiled) return;
+
+    for (int i = 0; i < REGISLEX_TZ_ZONE_COUNT; i++) {
+        regislex_tz_t* tz = &tz_zones[i];
+        memset(tz, 0, sizeof(*tz));
+        tz->name = REGISLEX_TZ_NAMES[i];
+        tz->valid = tz_parse(REGISLEX_TZ_RULES[i], tz);
+        if (!tz->valid) continue;
+
+        for (int y = 0; y < TZ_CACHE_YEARS; y++) {
+            year_transitions(tz, TZ_CACHE_FIRST_YEAR + y, tz->transitions[y]);
+        }
+    }
+
+    tz_compiled = true;
+}
+
+REGISLEX_API const regislex_tz_t* regislex_tz_find(const char* name) {
+    if (!name || !tz_compiled) return NULL;
+
+    int lo = 0, hi = REGISLEX_TZ_ZONE_COUNT - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        int cmp = strcmp(tz_zones[mid].name, name);
+        if (cmp == 0) return tz_zones[mid].valid ? &tz_zones[mid] : NULL;
+        if (cmp < 0) lo = mid + 1;
+        else hi = mid - 1;
+    }
+    return NULL;
+}
+
+REGISLEX_API const char* regislex_tz_name(const regislex_tz_t* tz) {
+    return tz ? tz->name : NULL;
+}
+
+REGISLEX_API regislex_error_t regislex_datetime_to_zone(
+    const regislex_datetime_t* dt,
+    const regislex_tz_t* tz,
+    regislex_datetime_t* out)
+{
+    if (!dt || !tz || !out) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    int64_t t = regislex_datetime_to_seconds(dt);
+    set_local(t, offset_at(tz, t), out);
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_datetime_to_zone_batch(
+    const regislex_datetime_t* in,
+    regislex_datetime_t* out,
+    size_t count,
+    const regislex_tz_t* tz)
+{
+    if (!tz || (count > 0 && (!in || !out))) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        int64_t t = regislex_datetime_to_seconds(&in[i]);
+        set_local(t, offset_at(tz, t), &out[i]);
+    }
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_datetime_from_zone(
+    const regislex_datetime_t* local,
+    const regislex_tz_t* tz,
+    regislex_datetime_t* out)
+{
+    if (!local || !tz || !out) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!regislex_datetime_is_valid_date(local)) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    int64_t wall = regislex_datetime_to_days(local) * TZ_SECONDS_PER_DAY
+                 + local->hour * 3600 + local->minute * 60 + local->second;
+
+    /*
+     * A wall time maps to the instant under the standard offset, the
+     * daylight offset, both (fall-back overlap) or neither (spring-forward
+     * gap). Overlaps take the earlier instant; gaps take the later one,
+     * which moves the wall time forward by the length of the gap.
+     */
+    int64_t as_std = wall - tz->std_offset;
+    int64_t as_dst = wall - tz->dst_offset;
+    bool std_ok = offset_at(tz, as_std) == tz->std_offset;
+    bool dst_ok = offset_at(tz, as_dst) == tz->dst_offset;
+
+    int64_t t;
+    if (std_ok && dst_ok) {
+        t = as_std < as_dst ? as_std : as_dst;
+    } else if (std_ok) {
+        t = as_std;
+    } else if (dst_ok) {
+        t = as_dst;
+    } else {
+        t = as_std > as_dst ? as_std : as_dst;
+    }
+
+    set_local(t, offset_at(tz, t), out);
+    return REGISLEX_OK;
+}
@@ -16,14 +16,33 @@
  * Internal Structures
  * ============================================================================ */
 
+typedef struct {
+    regislex_db_commit_hook_t hook;
+    void* data;
+} db_commit_hook_t;
+
 struct regislex_db_context {
     char type[32];
     sqlite3* sqlite_db;
     char last_error[1024];
     bool connected;
     platform_mutex_t* mutex;
+    platform_cond_t* tx_released;   /* Signalled when the outermost transaction ends */
+    uint64_t tx_owner;              /* Thread holding the open transaction */
+    int tx_depth;                   /* 0 when no transaction is open */
+    db_commit_hook_t* hooks;        /* Run after the outermost commit */
+    int hook_count;
+    int hook_capacity;
 };
 
+/*
+ * Row counts of this thread's last statement. sqlite3_changes() is per
+ * connection, so it is read under the transaction lock right after each
+ * statement runs and kept per thread.
+ */
+static _Thread_local int thread_changes = 0;
+static _Thread_local int64_t thread_insert_id = 0;
+
 struct regislex_db_stmt {
     regislex_db_context_t* ctx;
     sqlite3_stmt* sqlite_stmt;
@@ -34,6 +53,8 @@ struct regislex_db_stmt {
 struct regislex_db_transaction {
     regislex_db_context_t* ctx;
     bool active;
+    bool nested;        /* A savepoint inside the owner's open transaction */
+    int hook_mark;      /* Hooks queued before this transaction began */
 };
 
 struct regislex_query_builder {
@@ -93,6 +114,12 @@ regislex_error_t regislex_db_init(const regislex_db_config_t* config,
         *ctx = NULL;
         return REGISLEX_ERROR;
     }
+    if (platform_cond_create(&(*ctx)->tx_released) != PLATFORM_OK) {
+        platform_mutex_destroy((*ctx)->mutex);
+        platform_free(*ctx);
+        *ctx = NULL;
+        return REGISLEX_ERROR;
+    }
 
     /* SQLite connection */
     if (strcmp(config->type, "sqlite") == 0) {
@@ -101,6 +128,7 @@ regislex_error_t regislex_db_init(const regislex_db_config_t* config,
 
         if (rc != SQLITE_OK) {
             set_sqlite_error(*ctx);
+            platform_cond_destroy((*ctx)->tx_released);
             platform_mutex_destroy((*ctx)->mutex);
             platform_free(*ctx);
             *ctx = NULL;
@@ -119,6 +147,7 @@ regislex_error_t regislex_db_init(const regislex_db_config_t* config,
         (*ctx)->connected = true;
     } else {
         set_db_error(*ctx, "Unsupported database type");
+        platform_cond_destroy((*ctx)->tx_released);
         platform_mutex_destroy((*ctx)->mutex);
         platform_free(*ctx);
         *ctx = NULL;
@@ -128,14 +157,24 @@ regislex_error_t regislex_db_init(const regislex_db_config_t* config,
     return REGISLEX_OK;
 }
 
+static void hooks_drop(regislex_db_context_t* ctx, int mark);
+
 void regislex_db_shutdown(regislex_db_context_t* ctx) {
     if (!ctx) return;
 
+    hooks_drop(ctx, 0);
+    platform_free(ctx->hooks);
+
     if (ctx->sqlite_db) {
         sqlite3_close(ctx->sqlite_db);
         ctx->sqlite_db = NULL;
     }
 
+    if (ctx->tx_released) {
+        platform_cond_destroy(ctx->tx_released);
+        ctx->tx_released = NULL;
+    }
+
     if (ctx->mutex) {
         platform_mutex_destroy(ctx->mutex);
         ctx->mutex = NULL;
@@ -577,6 +616,479 @@ static const char* MIGRATIONS[] = {
     "CREATE INDEX idx_audit_log_entity ON audit_log(entity_type, entity_id);"
     "CREATE INDEX idx_audit_log_created_at ON audit_log(created_at);",
 
+    /* Migration 17: Party conflict-check keys */
+    "CREATE TABLE IF NOT EXISTS party_conflict_keys ("
+    "  party_id TEXT PRIMARY KEY REFERENCES parties(id) ON DELETE CASCADE,"
+    "  case_id TEXT NOT NULL REFERENCES cases(id) ON DELETE CASCADE,"
+    "  normalized_name TEXT NOT NULL,"
+    "  phonetic_key TEXT NOT NULL,"
+    "  updated_at TEXT NOT NULL"
+    ");"
+    "CREATE INDEX idx_party_conflict_normalized ON party_conflict_keys(normalized_name);"
+    "CREATE INDEX idx_party_conflict_phonetic ON party_conflict_keys(phonetic_key);",
+
+    /* Migration 18: Case hierarchy closure table */
+    "CREATE TABLE IF NOT EXISTS case_hierarchy ("
+    "  ancestor_id TEXT NOT NULL REFERENCES cases(id) ON DELETE CASCADE,"
+    "  descendant_id TEXT NOT NULL REFERENCES cases(id) ON DELETE CASCADE,"
+    "  depth INTEGER NOT NULL,"
+    "  PRIMARY KEY (ancestor_id, descendant_id)"
+    ") WITHOUT ROWID;"
+    "CREATE INDEX idx_case_hierarchy_descendant ON case_hierarchy(descendant_id, depth);"
+    "UPDATE cases SET parent_case_id = NULL WHERE parent_case_id = '';"
+    "INSERT OR IGNORE INTO case_hierarchy (ancestor_id, descendant_id, depth) "
+    "WITH RECURSIVE tree(ancestor_id, descendant_id, depth) AS ("
+    "  SELECT id, id, 0 FROM cases"
+    "  UNION ALL"
+    "  SELECT c.parent_case_id, t.descendant_id, t.depth + 1"
+    "  FROM tree t JOIN cases c ON c.id = t.ancestor_id"
+    "  WHERE c.parent_case_id IS NOT NULL AND t.depth < 64"
+    ") SELECT ancestor_id, descendant_id, MIN(depth) FROM tree GROUP BY ancestor_id, descendant_id;",
+
+    /* Migration 19: Materialized caseload counters, maintained by triggers */
+    "CREATE TABLE IF NOT EXISTS case_counters ("
+    "  dimension TEXT NOT NULL,"
+    "  key TEXT NOT NULL,"
+    "  count INTEGER NOT NULL DEFAULT 0,"
+    "  PRIMARY KEY (dimension, key)"
+    ") WITHOUT ROWID;"
+    "DELETE FROM case_counters;"
+    "INSERT INTO case_counters (dimension, key, count) "
+    "  SELECT 'status', COALESCE(status, 0), COUNT(*) FROM cases GROUP BY 2;"
+    "INSERT INTO case_counters (dimension, key, count) "
+    "  SELECT 'type', COALESCE(type, 0), COUNT(*) FROM cases GROUP BY 2;"
+    "INSERT INTO case_counters (dimension, key, count) "
+    "  SELECT 'assignee', COALESCE(assigned_to_id, ''), COUNT(*) FROM cases GROUP BY 2;"
+    "CREATE TRIGGER trg_case_counters_insert AFTER INSERT ON cases BEGIN"
+    "  INSERT INTO case_counters (dimension, key, count) SELECT 'status', COALESCE(NEW.status, 0), 1 WHERE 1"
+    "    ON CONFLICT (dimension, key) DO UPDATE SET count = count + 1;"
+    "  INSERT INTO case_counters (dimension, key, count) SELECT 'type', COALESCE(NEW.type, 0), 1 WHERE 1"
+    "    ON CONFLICT (dimension, key) DO UPDATE SET count = count + 1;"
+    "  INSERT INTO case_counters (dimension, key, count) SELECT 'assignee', COALESCE(NEW.assigned_to_id, ''), 1 WHERE 1"
+    "    ON CONFLICT (dimension, key) DO UPDATE SET count = count + 1;"
+    "END;"
+    "CREATE TRIGGER trg_case_counters_delete AFTER DELETE ON cases BEGIN"
+    "  UPDATE case_counters SET count = count - 1 WHERE dimension = 'status' AND key = COALESCE(OLD.status, 0);"
+    "  UPDATE case_counters SET count = count - 1 WHERE dimension = 'type' AND key = COALESCE(OLD.type, 0);"
+    "  UPDATE case_counters SET count = count - 1 WHERE dimension = 'assignee' AND key = COALESCE(OLD.assigned_to_id, '');"
+    "END;"
+    "CREATE TRIGGER trg_case_counters_update AFTER UPDATE OF status, type, assigned_to_id ON cases BEGIN"
+    "  UPDATE case_counters SET count = count - 1 WHERE dimension = 'status' AND key = COALESCE(OLD.status, 0) AND OLD.status IS NOT NEW.status;"
+    "  INSERT INTO case_counters (dimension, key, count) SELECT 'status', COALESCE(NEW.status, 0), 1 WHERE OLD.status IS NOT NEW.status"
+    "    ON CONFLICT (dimension, key) DO UPDATE SET count = count + 1;"
+    "  UPDATE case_counters SET count = count - 1 WHERE dimension = 'type' AND key = COALESCE(OLD.type, 0) AND OLD.type IS NOT NEW.type;"
+    "  INSERT INTO case_counters (dimension, key, count) SELECT 'type', COALESCE(NEW.type, 0), 1 WHERE OLD.type IS NOT NEW.type"
+    "    ON CONFLICT (dimension, key) DO UPDATE SET count = count + 1;"
+    "  UPDATE case_counters SET count = count - 1 WHERE dimension = 'assignee' AND key = COALESCE(OLD.assigned_to_id, '') AND OLD.assigned_to_id IS NOT NEW.assigned_to_id;"
+    "  INSERT INTO case_counters (dimension, key, count) SELECT 'assignee', COALESCE(NEW.assigned_to_id, ''), 1 WHERE OLD.assigned_to_id IS NOT NEW.assigned_to_id"
+    "    ON CONFLICT (dimension, key) DO UPDATE SET count = count + 1;"
+    "END;",
+
+    /* Migration 20: Typed metadata for cases and deadlines */
+    "CREATE TABLE IF NOT EXISTS case_metadata ("
+    "  case_id TEXT NOT NULL REFERENCES cases(id) ON DELETE CASCADE,"
+    "  key TEXT NOT NULL,"
+    "  value_type INTEGER NOT NULL DEFAULT 0,"
+    "  value,"
+    "  PRIMARY KEY (case_id, key)"
+    ") WITHOUT ROWID;"
+    "CREATE INDEX idx_case_metadata_lookup ON case_metadata(key, value, case_id);"
+    "CREATE TABLE IF NOT EXISTS deadline_metadata ("
+    "  deadline_id TEXT NOT NULL REFERENCES deadlines(id) ON DELETE CASCADE,"
+    "  key TEXT NOT NULL,"
+    "  value_type INTEGER NOT NULL DEFAULT 0,"
+    "  value,"
+    "  PRIMARY KEY (deadline_id, key)"
+    ") WITHOUT ROWID;"
+    "CREATE INDEX idx_deadline_metadata_lookup ON deadline_metadata(key, value, deadline_id);",
+
+    /* Migration 21: Holiday definitions for court calendars */
+    "CREATE TABLE IF NOT EXISTS holidays ("
+    "  id TEXT PRIMARY KEY,"
+    "  name TEXT NOT NULL,"
+    "  jurisdiction TEXT NOT NULL DEFAULT '',"
+    "  date TEXT,"
+    "  is_court_holiday INTEGER DEFAULT 1,"
+    "  is_federal INTEGER DEFAULT 0,"
+    "  is_recurring INTEGER DEFAULT 0,"
+    "  recurrence_month INTEGER DEFAULT 0,"
+    "  recurrence_day INTEGER DEFAULT 0,"
+    "  recurrence_week INTEGER DEFAULT 0,"
+    "  recurrence_weekday INTEGER DEFAULT 0,"
+    "  observed INTEGER DEFAULT 0,"
+    "  created_at TEXT NOT NULL"
+    ");"
+    "CREATE INDEX idx_holidays_jurisdiction ON holidays(jurisdiction);",
+
+    /* Migration 22: Court rule sets, trigger events and generated deadlines */
+    "CREATE TABLE IF NOT EXISTS court_rule_sets ("
+    "  id TEXT PRIMARY KEY,"
+    "  name TEXT NOT NULL,"
+    "  jurisdiction TEXT NOT NULL DEFAULT '',"
+    "  description TEXT,"
+    "  created_at TEXT NOT NULL"
+    ");"
+    "CREATE TABLE IF NOT EXISTS court_rules ("
+    "  id TEXT PRIMARY KEY,"
+    "  rule_set_id TEXT NOT NULL REFERENCES court_rule_sets(id) ON DELETE CASCADE,"
+    "  position INTEGER NOT NULL,"
+    "  code TEXT NOT NULL,"
+    "  title TEXT NOT NULL,"
+    "  trigger_event TEXT,"
+    "  depends_on TEXT,"
+    "  days INTEGER NOT NULL DEFAULT 0,"
+    "  count_business_days INTEGER DEFAULT 0,"
+    "  roll_forward INTEGER DEFAULT 1,"
+    "  deadline_type INTEGER DEFAULT 0,"
+    "  priority INTEGER DEFAULT 1,"
+    "  rule_reference TEXT,"
+    "  UNIQUE (rule_set_id, code)"
+    ");"
+    "CREATE TABLE IF NOT EXISTS case_triggers ("
+    "  case_id TEXT NOT NULL REFERENCES cases(id) ON DELETE CASCADE,"
+    "  rule_set_id TEXT NOT NULL REFERENCES court_rule_sets(id) ON DELETE CASCADE,"
+    "  event TEXT NOT NULL,"
+    "  trigger_date TEXT NOT NULL,"
+    "  updated_at TEXT NOT NULL,"
+    "  PRIMARY KEY (case_id, rule_set_id, event)"
+    ") WITHOUT ROWID;"
+    "CREATE TABLE IF NOT EXISTS rule_deadlines ("
+    "  deadline_id TEXT PRIMARY KEY REFERENCES deadlines(id) ON DELETE CASCADE,"
+    "  case_id TEXT NOT NULL,"
+    "  rule_set_id TEXT NOT NULL,"
+    "  rule_id TEXT NOT NULL,"
+    "  UNIQUE (case_id, rule_set_id, rule_id)"
+    ");",
+
+    /* Migration 23: Statute of limitations rules and per-case claim facts.
+     * Claim dates are days since 1970-01-01 so the sweep reads integers. */
+    "CREATE TABLE IF NOT EXISTS statute_rules ("
+    "  id TEXT PRIMARY KEY,"
+    "  name TEXT NOT NULL,"
+    "  description TEXT,"
+    "  claim_type TEXT NOT NULL,"
+    "  jurisdiction TEXT NOT NULL DEFAULT '',"
+    "  case_type INTEGER DEFAULT 0,"
+    "  limitation_months INTEGER DEFAULT 0,"
+    "  limitation_days INTEGER DEFAULT 0,"
+    "  accrual INTEGER DEFAULT 0,"
+    "  repose_months INTEGER DEFAULT 0,"
+    "  tolling_allowed INTEGER DEFAULT 1,"
+    "  max_tolling_days INTEGER DEFAULT 0,"
+    "  tolling_conditions TEXT,"
+    "  statute_reference TEXT,"
+    "  notes TEXT,"
+    "  effective_date TEXT,"
+    "  expiration_date TEXT,"
+    "  is_active INTEGER DEFAULT 1,"
+    "  created_at TEXT NOT NULL,"
+    "  updated_at TEXT NOT NULL"
+    ");"
+    "CREATE INDEX idx_statute_rules_key ON statute_rules(claim_type, jurisdiction);"
+    "CREATE TABLE IF NOT EXISTS case_claims ("
+    "  case_id TEXT NOT NULL REFERENCES cases(id) ON DELETE CASCADE,"
+    "  claim_type TEXT NOT NULL,"
+    "  jurisdiction TEXT NOT NULL DEFAULT '',"
+    "  accrual_day INTEGER NOT NULL,"
+    "  discovery_day INTEGER,"
+    "  tolled_days INTEGER DEFAULT 0,"
+    "  PRIMARY KEY (case_id, claim_type)"
+    ") WITHOUT ROWID;"
+    "INSERT INTO statute_rules (id, name, claim_type, jurisdiction, case_type,"
+    "  limitation_months, accrual, repose_months, created_at, updated_at)"
+    "  SELECT column1, column2, column3, column4, column5, column6, column7, column8,"
+    "    strftime('%Y-%m-%dT%H:%M:%SZ', 'now'), strftime('%Y-%m-%dT%H:%M:%SZ', 'now')"
+    "  FROM (VALUES"
+    "  ('sol-personal_injury-federal', 'Federal tort claims', 'personal_injury', 'federal', 14, 24, 0, 0),"
+    "  ('sol-personal_injury-ca', 'California personal injury', 'personal_injury', 'CA', 14, 24, 0, 0),"
+    "  ('sol-personal_injury-ny', 'New York personal injury', 'personal_injury', 'NY', 14, 36, 0, 0),"
+    "  ('sol-personal_injury-tx', 'Texas personal injury', 'personal_injury', 'TX', 14, 24, 0, 0),"
+    "  ('sol-contract_written-federal', 'Written contracts', 'contract_written', 'federal', 13, 48, 0, 0),"
+    "  ('sol-contract_written-ca', 'California written contracts', 'contract_written', 'CA', 13, 48, 0, 0),"
+    "  ('sol-contract_oral-ca', 'California oral contracts', 'contract_oral', 'CA', 13, 24, 0, 0),"
+    "  ('sol-malpractice_medical-ca', 'California medical malpractice', 'malpractice_medical', 'CA', 14, 36, 0, 0),"
+    "  ('sol-malpractice_medical-ca-discovery', 'California medical malpractice, from discovery', 'malpractice_medical', 'CA', 14, 12, 1, 36),"
+    "  ('sol-malpractice_legal-ca', 'California legal malpractice', 'malpractice_legal', 'CA', 14, 48, 0, 0),"
+    "  ('sol-malpractice_legal-ca-discovery', 'California legal malpractice, from discovery', 'malpractice_legal', 'CA', 14, 12, 1, 48),"
+    "  ('sol-fraud-ca', 'California fraud claims', 'fraud', 'CA', 14, 36, 0, 0),"
+    "  ('sol-property_damage-ca', 'California property damage', 'property_damage', 'CA', 14, 36, 0, 0),"
+    "  ('sol-wrongful_death-ca', 'California wrongful death', 'wrongful_death', 'CA', 14, 24, 0, 0)"
+    "  );",
+
+    /* Migration 24: Recurrence rules stored once per series, with per-occurrence overrides */
+    "ALTER TABLE deadlines ADD COLUMN rrule TEXT;"
+    "CREATE INDEX idx_deadlines_series ON deadlines(due_date) WHERE rrule IS NOT NULL;"
+    "CREATE TABLE IF NOT EXISTS deadline_exceptions ("
+    "  deadline_id TEXT NOT NULL REFERENCES deadlines(id) ON DELETE CASCADE,"
+    "  occurrence_date TEXT NOT NULL,"
+    "  is_cancelled INTEGER DEFAULT 0,"
+    "  is_completed INTEGER DEFAULT 0,"
+    "  due_date TEXT,"
+    "  title TEXT,"
+    "  PRIMARY KEY (deadline_id, occurrence_date)"
+    ") WITHOUT ROWID;"
+    "CREATE INDEX idx_deadline_exceptions_due ON deadline_exceptions(deadline_id, due_date);",
+
+    /* Migration 25: Per-user calendar feed change log, maintained by triggers */
+    "CREATE TABLE IF NOT EXISTS calendar_feed_state ("
+    "  id INTEGER PRIMARY KEY CHECK (id = 1),"
+    "  seq INTEGER NOT NULL"
+    ");"
+    "INSERT INTO calendar_feed_state (id, seq) VALUES (1, 1);"
+    "CREATE TABLE IF NOT EXISTS calendar_feed_log ("
+    "  user_id TEXT NOT NULL,"
+    "  deadline_id TEXT NOT NULL,"
+    "  seq INTEGER NOT NULL,"
+    "  deleted INTEGER NOT NULL DEFAULT 0,"
+    "  PRIMARY KEY (user_id, deadline_id)"
+    ") WITHOUT ROWID;"
+    "CREATE INDEX idx_calendar_feed_log_seq ON calendar_feed_log(user_id, seq);"
+    "INSERT INTO calendar_feed_log (user_id, deadline_id, seq, deleted) "
+    "  SELECT assigned_to_id, id, 1, 0 FROM deadlines WHERE assigned_to_id <> '';"
+    "CREATE TRIGGER trg_deadlines_feed_insert AFTER INSERT ON deadlines "
+    "WHEN NEW.assigned_to_id <> '' BEGIN"
+    "  UPDATE calendar_feed_state SET seq = seq + 1;"
+    "  INSERT OR REPLACE INTO calendar_feed_log (user_id, deadline_id, seq, deleted)"
+    "    SELECT NEW.assigned_to_id, NEW.id, seq, 0 FROM calendar_feed_state;"
+    "END;"
+    "CREATE TRIGGER trg_deadlines_feed_update AFTER UPDATE ON deadlines BEGIN"
+    "  UPDATE calendar_feed_state SET seq = seq + 1;"
+    "  INSERT OR REPLACE INTO calendar_feed_log (user_id, deadline_id, seq, deleted)"
+    "    SELECT OLD.assigned_to_id, OLD.id, seq, 1 FROM calendar_feed_state"
+    "    WHERE OLD.assigned_to_id <> '' AND OLD.assigned_to_id IS NOT NEW.assigned_to_id;"
+    "  INSERT OR REPLACE INTO calendar_feed_log (user_id, deadline_id, seq, deleted)"
+    "    SELECT NEW.assigned_to_id, NEW.id, seq, 0 FROM calendar_feed_state"
+    "    WHERE NEW.assigned_to_id <> '';"
+    "END;"
+    "CREATE TRIGGER trg_deadlines_feed_delete AFTER DELETE ON deadlines "
+    "WHEN OLD.assigned_to_id <> '' BEGIN"
+    "  UPDATE calendar_feed_state SET seq = seq + 1;"
+    "  INSERT OR REPLACE INTO calendar_feed_log (user_id, deadline_id, seq, deleted)"
+    "    SELECT OLD.assigned_to_id, OLD.id, seq, 1 FROM calendar_feed_state;"
+    "END;"
+    "CREATE TRIGGER trg_deadline_exceptions_feed_insert AFTER INSERT ON deadline_exceptions BEGIN"
+    "  UPDATE calendar_feed_state SET seq = seq + 1;"
+    "  INSERT OR REPLACE INTO calendar_feed_log (user_id, deadline_id, seq, deleted)"
+    "    SELECT d.assigned_to_id, d.id, s.seq, 0 FROM deadlines d, calendar_feed_state s"
+    "    WHERE d.id = NEW.deadline_id AND d.assigned_to_id <> '';"
+    "END;"
+    "CREATE TRIGGER trg_deadline_exceptions_feed_update AFTER UPDATE ON deadline_exceptions BEGIN"
+    "  UPDATE calendar_feed_state SET seq = seq + 1;"
+    "  INSERT OR REPLACE INTO calendar_feed_log (user_id, deadline_id, seq, deleted)"
+    "    SELECT d.assigned_to_id, d.id, s.seq, 0 FROM deadlines d, calendar_feed_state s"
+    "    WHERE d.id = NEW.deadline_id AND d.assigned_to_id <> '';"
+    "END;"
+    "CREATE TRIGGER trg_deadline_exceptions_feed_delete AFTER DELETE ON deadline_exceptions BEGIN"
+    "  UPDATE calendar_feed_state SET seq = seq + 1;"
+    "  INSERT OR REPLACE INTO calendar_feed_log (user_id, deadline_id, seq, deleted)"
+    "    SELECT d.assigned_to_id, d.id, s.seq, 0 FROM deadlines d, calendar_feed_state s"
+    "    WHERE d.id = OLD.deadline_id AND d.assigned_to_id <> '';"
+    "END;"
+    "CREATE TABLE IF NOT EXISTS calendar_subscriptions ("
+    "  user_id TEXT NOT NULL,"
+    "  calendar_type TEXT NOT NULL,"
+    "  target TEXT NOT NULL,"
+    "  etag TEXT,"
+    "  synced_at TEXT,"
+    "  PRIMARY KEY (user_id, calendar_type, target)"
+    ") WITHOUT ROWID;",
+
+    /* Migration 26: Court time zone per jurisdiction, seeded with the zone of each state capital.
+     * Federal courts sit in their district's zone, so "federal" is left for deployments to map. */
+    "CREATE TABLE IF NOT EXISTS jurisdiction_zones ("
+    "  jurisdiction TEXT PRIMARY KEY,"
+    "  zone TEXT NOT NULL"
+    ") WITHOUT ROWID;"
+    "INSERT INTO jurisdiction_zones (jurisdiction, zone) VALUES"
+    "  ('AL', 'America/Chicago'),"
+    "  ('AK', 'America/Anchorage'),"
+    "  ('AS', 'Pacific/Pago_Pago'),"
+    "  ('AZ', 'America/Phoenix'),"
+    "  ('AR', 'America/Chicago'),"
+    "  ('CA', 'America/Los_Angeles'),"
+    "  ('CO', 'America/Denver'),"
+    "  ('CT', 'America/New_York'),"
+    "  ('DC', 'America/New_York'),"
+    "  ('DE', 'America/New_York'),"
+    "  ('FL', 'America/New_York'),"
+    "  ('GA', 'America/New_York'),"
+    "  ('GU', 'Pacific/Guam'),"
+    "  ('HI', 'Pacific/Honolulu'),"
+    "  ('IA', 'America/Chicago'),"
+    "  ('ID', 'America/Boise'),"
+    "  ('IL', 'America/Chicago'),"
+    "  ('IN', 'America/Indiana/Indianapolis'),"
+    "  ('KS', 'America/Chicago'),"
+    "  ('KY', 'America/New_York'),"
+    "  ('LA', 'America/Chicago'),"
+    "  ('MA', 'America/New_York'),"
+    "  ('MD', 'America/New_York'),"
+    "  ('ME', 'America/New_York'),"
+    "  ('MI', 'America/Detroit'),"
+    "  ('MN', 'America/Chicago'),"
+    "  ('MO', 'America/Chicago'),"
+    "  ('MP', 'Pacific/Saipan'),"
+    "  ('MS', 'America/Chicago'),"
+    "  ('MT', 'America/Denver'),"
+    "  ('NC', 'America/New_York'),"
+    "  ('ND', 'America/Chicago'),"
+    "  ('NE', 'America/Chicago'),"
+    "  ('NH', 'America/New_York'),"
+    "  ('NJ', 'America/New_York'),"
+    "  ('NM', 'America/Denver'),"
+    "  ('NV', 'America/Los_Angeles'),"
+    "  ('NY', 'America/New_York'),"
+    "  ('OH', 'America/New_York'),"
+    "  ('OK', 'America/Chicago'),"
+    "  ('OR', 'America/Los_Angeles'),"
+    "  ('PA', 'America/New_York'),"
+    "  ('PR', 'America/Puerto_Rico'),"
+    "  ('RI', 'America/New_York'),"
+    "  ('SC', 'America/New_York'),"
+    "  ('SD', 'America/Chicago'),"
+    "  ('TN', 'America/Chicago'),"
+    "  ('TX', 'America/Chicago'),"
+    "  ('UT', 'America/Denver'),"
+    "  ('VA', 'America/New_York'),"
+    "  ('VI', 'America/St_Thomas'),"
+    "  ('VT', 'America/New_York'),"
+    "  ('WA', 'America/Los_Angeles'),"
+    "  ('WI', 'America/Chicago'),"
+    "  ('WV', 'America/New_York'),"
+    "  ('WY', 'America/Denver');",
+
+    /* Migration 27: Audit trail of due dates moved by trigger or holiday changes.
+     * Rows outlive their deadline, so deadline_id carries no foreign key. */
+    "CREATE TABLE IF NOT EXISTS deadline_shifts ("
+    "  id INTEGER PRIMARY KEY AUTOINCREMENT,"
+    "  deadline_id TEXT NOT NULL,"
+    "  case_id TEXT,"
+    "  previous_due_date TEXT NOT NULL,"
+    "  new_due_date TEXT NOT NULL,"
+    "  reason TEXT NOT NULL,"
+    "  holiday_id TEXT,"
+    "  shifted_at TEXT NOT NULL"
+    ");"
+    "CREATE INDEX idx_deadline_shifts_deadline ON deadline_shifts(deadline_id);"
+    "CREATE INDEX idx_deadline_shifts_holiday ON deadline_shifts(holiday_id);",
+
+    /* Migration 28: Workflow actions with their parameters, and per-workflow run limits */
+    "ALTER TABLE workflows ADD COLUMN max_parallel_runs INTEGER DEFAULT 0;"
+    "CREATE TABLE IF NOT EXISTS workflow_actions ("
+    "  id TEXT PRIMARY KEY,"
+    "  workflow_id TEXT NOT NULL REFERENCES workflows(id) ON DELETE CASCADE,"
+    "  name TEXT NOT NULL,"
+    "  description TEXT,"
+    "  type INTEGER NOT NULL,"
+    "  sequence_order INTEGER DEFAULT 0,"
+    "  delay_minutes INTEGER DEFAULT 0,"
+    "  timeout_minutes INTEGER DEFAULT 0,"
+    "  retry_count INTEGER DEFAULT 0,"
+    "  retry_delay_minutes INTEGER DEFAULT 0,"
+    "  is_active INTEGER DEFAULT 1,"
+    "  created_at TEXT NOT NULL,"
+    "  updated_at TEXT NOT NULL"
+    ");"
+    "CREATE INDEX idx_workflow_actions_workflow ON workflow_actions(workflow_id, sequence_order);"
+    "CREATE TABLE IF NOT EXISTS workflow_action_params ("
+    "  action_id TEXT NOT NULL REFERENCES workflow_actions(id) ON DELETE CASCADE,"
+    "  position INTEGER NOT NULL,"
+    "  type TEXT NOT NULL,"
+    "  value TEXT,"
+    "  PRIMARY KEY (action_id, position)"
+    ");",
+
+    /* Migration 29: Durable workflow runs, their variables, and the timers they wait on.
+     * A timer with no fire_ms waits indefinitely (an approval without a timeout). */
+    "CREATE TABLE IF NOT EXISTS workflow_runs ("
+    "  id TEXT PRIMARY KEY,"
+    "  workflow_id TEXT NOT NULL REFERENCES workflows(id) ON DELETE CASCADE,"
+    "  case_id TEXT,"
+    "  triggered_by TEXT,"
+    "  trigger_data TEXT,"
+    "  status INTEGER NOT NULL,"
+    "  current_action_id TEXT,"
+    "  current_step INTEGER DEFAULT 0,"
+    "  error_message TEXT,"
+    "  execution_log TEXT,"
+    "  started_at TEXT,"
+    "  completed_at TEXT,"
+    "  created_at TEXT NOT NULL,"
+    "  updated_at TEXT NOT NULL"
+    ");"
+    "CREATE INDEX idx_workflow_runs_status ON workflow_runs(status, created_at);"
+    "CREATE INDEX idx_workflow_runs_workflow ON workflow_runs(workflow_id, created_at);"
+    "CREATE TABLE IF NOT EXISTS workflow_run_variables ("
+    "  run_id TEXT NOT NULL REFERENCES workflow_runs(id) ON DELETE CASCADE,"
+    "  name TEXT NOT NULL,"
+    "  value TEXT,"
+    "  PRIMARY KEY (run_id, name)"
+    ");"
+    "CREATE TABLE IF NOT EXISTS workflow_timers ("
+    "  run_id TEXT PRIMARY KEY REFERENCES workflow_runs(id) ON DELETE CASCADE,"
+    "  kind INTEGER NOT NULL,"
+    "  fire_ms INTEGER,"
+    "  created_at TEXT NOT NULL"
+    ");"
+    "CREATE INDEX idx_workflow_timers_fire ON workflow_timers(fire_ms) WHERE fire_ms IS NOT NULL;",
+
+    /* Migration 30: Append-only run event log; id orders events in append order.
+     * Replaces workflow_runs.execution_log, which is no longer written. */
+    "CREATE TABLE IF NOT EXISTS workflow_run_events ("
+    "  id INTEGER PRIMARY KEY,"
+    "  run_id TEXT NOT NULL REFERENCES workflow_runs(id) ON DELETE CASCADE,"
+    "  type INTEGER NOT NULL,"
+    "  occurred_ms INTEGER NOT NULL,"
+    "  step INTEGER,"
+    "  action_id TEXT,"
+    "  action_type INTEGER,"
+    "  duration_ms INTEGER,"
+    "  error_code INTEGER,"
+    "  message TEXT"
+    ");"
+    "CREATE INDEX idx_workflow_run_events_run ON workflow_run_events(run_id, occurred_ms);"
+    "CREATE INDEX idx_workflow_run_events_time ON workflow_run_events(occurred_ms);",
+
+    /* Migration 31: Workflow triggers; event_name names the event a CUSTOM
+     * event trigger listens for */
+    "CREATE TABLE IF NOT EXISTS workflow_triggers ("
+    "  id TEXT PRIMARY KEY,"
+    "  workflow_id TEXT NOT NULL REFERENCES workflows(id) ON DELETE CASCADE,"
+    "  name TEXT NOT NULL,"
+    "  type INTEGER NOT NULL,"
+    "  event_type INTEGER,"
+    "  event_name TEXT,"
+    "  event_filter TEXT,"
+    "  schedule_cron TEXT,"
+    "  webhook_secret TEXT,"
+    "  is_active INTEGER DEFAULT 1,"
+    "  created_at TEXT NOT NULL,"
+    "  updated_at TEXT NOT NULL"
+    ");"
+    "CREATE INDEX idx_workflow_triggers_workflow ON workflow_triggers(workflow_id);"
+    "CREATE INDEX idx_workflow_triggers_type ON workflow_triggers(type, is_active);",
+
+    /* Migration 32: Position of the deadline due/overdue sweep; one row */
+    "CREATE TABLE IF NOT EXISTS deadline_sweep_state ("
+    "  id INTEGER PRIMARY KEY CHECK (id = 1),"
+    "  swept_until TEXT NOT NULL"
+    ");",
+
+    /* Migration 33: Definition version each workflow run executes */
+    "ALTER TABLE workflow_runs ADD COLUMN workflow_version INTEGER;",
+
+    /* Migration 34: Conflict keys of each party's attorney and attorney firm */
+    "ALTER TABLE party_conflict_keys ADD COLUMN attorney_normalized TEXT;"
+    "ALTER TABLE party_conflict_keys ADD COLUMN attorney_phonetic TEXT;"
+    "ALTER TABLE party_conflict_keys ADD COLUMN firm_normalized TEXT;"
+    "ALTER TABLE party_conflict_keys ADD COLUMN firm_phonetic TEXT;",
+
+    /* Migration 35: Unset case dates were stored as zero timestamps; now NULL */
+    "UPDATE cases SET filed_date = NULL WHERE filed_date LIKE '0000-%';"
+    "UPDATE cases SET trial_date = NULL WHERE trial_date LIKE '0000-%';"
+    "UPDATE cases SET closed_date = NULL WHERE closed_date LIKE '0000-%';"
+    "UPDATE cases SET statute_of_limitations = NULL WHERE statute_of_limitations LIKE '0000-%';",
+
     NULL
 };
 
@@ -679,6 +1191,32 @@ regislex_error_t regislex_db_migration_version(regislex_db_context_t* ctx, int*
  * Transaction Functions
  * ============================================================================ */
 
+/*
+ * All threads share one connection, so a transaction belongs to the thread
+ * that opened it: other threads wait in begin, and in every prepare, step
+ * and exec, until it ends. Without that wait a statement from another
+ * thread would run inside the open transaction and be lost if it rolled
+ * back. A begin from the owning thread opens a savepoint instead, which
+ * lets a caller wrap functions that manage their own transactions in a
+ * larger one.
+ */
+
+/* Lock the context once no other thread holds the open transaction */
+static void tx_wait_turn(regislex_db_context_t* ctx) {
+    uint64_t self = platform_thread_id();
+    platform_mutex_lock(ctx->mutex);
+    while (ctx->tx_depth > 0 && ctx->tx_owner != self) {
+        platform_cond_wait(ctx->tx_released, ctx->mutex);
+    }
+}
+
+/* Record this thread's row counts and release the context */
+static void tx_turn_done(regislex_db_context_t* ctx) {
+    thread_changes = sqlite3_changes(ctx->sqlite_db);
+    thread_insert_id = sqlite3_last_insert_rowid(ctx->sqlite_db);
+    platform_mutex_unlock(ctx->mutex);
+}
+
 regislex_error_t regislex_db_begin(regislex_db_context_t* ctx,
                                    regislex_db_transaction_t** tx) {
     if (!ctx || !tx) {
@@ -692,18 +1230,56 @@ regislex_error_t regislex_db_begin(regislex_db_context_t* ctx,
 
     (*tx)->ctx = ctx;
 
-    int rc = sqlite3_exec(ctx->sqlite_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+    tx_wait_turn(ctx);
+
+    (*tx)->nested = ctx->tx_depth > 0;
+    int rc = sqlite3_exec(ctx->sqlite_db,
+                          (*tx)->nested ? "SAVEPOINT regislex_nested;" : "BEGIN TRANSACTION;",
+                          NULL, NULL, NULL);
     if (rc != SQLITE_OK) {
         set_sqlite_error(ctx);
+        platform_mutex_unlock(ctx->mutex);
         platform_free(*tx);
         *tx = NULL;
         return REGISLEX_ERROR_DATABASE;
     }
 
+    ctx->tx_owner = platform_thread_id();
+    ctx->tx_depth++;
+    (*tx)->hook_mark = ctx->hook_count;
+    platform_mutex_unlock(ctx->mutex);
+
     (*tx)->active = true;
     return REGISLEX_OK;
 }
 
+/* Free the hooks queued since mark; the owning thread calls this */
+static void hooks_drop(regislex_db_context_t* ctx, int mark) {
+    for (int i = mark; i < ctx->hook_count; i++) {
+        platform_free(ctx->hooks[i].data);
+    }
+    ctx->hook_count = mark;
+}
+
+/* Close the transaction; ending the outermost one hands back its hooks */
+static void tx_end(regislex_db_transaction_t* tx, db_commit_hook_t** hooks, int* hook_count) {
+    regislex_db_context_t* ctx = tx->ctx;
+
+    platform_mutex_lock(ctx->mutex);
+    if (--ctx->tx_depth == 0) {
+        *hooks = ctx->hooks;
+        *hook_count = ctx->hook_count;
+        ctx->hooks = NULL;
+        ctx->hook_count = 0;
+        ctx->hook_capacity = 0;
+        ctx->tx_owner = 0;
+        platform_cond_broadcast(ctx->tx_released);
+    }
+    platform_mutex_unlock(ctx->mutex);
+
+    tx->active = false;
+}
+
 regislex_error_t regislex_db_commit(regislex_db_transaction_t* tx) {
     if (!tx || !tx->ctx) {
         return REGISLEX_ERROR_INVALID_ARGUMENT;
@@ -713,14 +1289,25 @@ regislex_error_t regislex_db_commit(regislex_db_transaction_t* tx) {
         return REGISLEX_ERROR_INVALID_STATE;
     }
 
-    int rc = sqlite3_exec(tx->ctx->sqlite_db, "COMMIT;", NULL, NULL, NULL);
+    int rc = sqlite3_exec(tx->ctx->sqlite_db,
+                          tx->nested ? "RELEASE regislex_nested;" : "COMMIT;",
+                          NULL, NULL, NULL);
     if (rc != SQLITE_OK) {
         set_sqlite_error(tx->ctx);
         return REGISLEX_ERROR_DATABASE;
     }
 
-    tx->active = false;
+    db_commit_hook_t* hooks = NULL;
+    int hook_count = 0;
+    tx_end(tx, &hooks, &hook_count);
     platform_free(tx);
+
+    /* Other threads may use the connection again while these run */
+    for (int i = 0; i < hook_count; i++) {
+        hooks[i].hook(hooks[i].data);
+        platform_free(hooks[i].data);
+    }
+    platform_free(hooks);
     return REGISLEX_OK;
 }
 
@@ -734,12 +1321,71 @@ regislex_error_t regislex_db_rollback(regislex_db_transaction_t* tx) {
         return REGISLEX_OK;
     }
 
-    sqlite3_exec(tx->ctx->sqlite_db, "ROLLBACK;", NULL, NULL, NULL);
-    tx->active = false;
+    sqlite3_exec(tx->ctx->sqlite_db,
+                 tx->nested ? "ROLLBACK TO regislex_nested; RELEASE regislex_nested;" : "ROLLBACK;",
+                 NULL, NULL, NULL);
+
+    platform_mutex_lock(tx->ctx->mutex);
+    hooks_drop(tx->ctx, tx->hook_mark);
+    platform_mutex_unlock(tx->ctx->mutex);
+
+    db_commit_hook_t* hooks = NULL;
+    int hook_count = 0;
+    tx_end(tx, &hooks, &hook_count);
+    platform_free(hooks);
     platform_free(tx);
     return REGISLEX_OK;
 }
 
+bool regislex_db_in_transaction(regislex_db_context_t* ctx) {
+    if (!ctx) return false;
+
+    platform_mutex_lock(ctx->mutex);
+    bool owned = ctx->tx_depth > 0 && ctx->tx_owner == platform_thread_id();
+    platform_mutex_unlock(ctx->mutex);
+    return owned;
+}
+
+regislex_error_t regislex_db_after_commit(regislex_db_context_t* ctx,
+                                          regislex_db_commit_hook_t hook,
+                                          void* data) {
+    if (!ctx || !hook) {
+        platform_free(data);
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_error_t err = REGISLEX_OK;
+    platform_mutex_lock(ctx->mutex);
+    bool deferred = ctx->tx_depth > 0 && ctx->tx_owner == platform_thread_id();
+    if (deferred) {
+        if (ctx->hook_count >= ctx->hook_capacity) {
+            int new_capacity = ctx->hook_capacity ? ctx->hook_capacity * 2 : 16;
+            db_commit_hook_t* grown = (db_commit_hook_t*)platform_realloc(
+                ctx->hooks, (size_t)new_capacity * sizeof(db_commit_hook_t));
+            if (grown) {
+                ctx->hooks = grown;
+                ctx->hook_capacity = new_capacity;
+            } else {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+            }
+        }
+        if (err == REGISLEX_OK) {
+            ctx->hooks[ctx->hook_count].hook = hook;
+            ctx->hooks[ctx->hook_count].data = data;
+            ctx->hook_count++;
+        }
+    }
+    platform_mutex_unlock(ctx->mutex);
+
+    if (!deferred) {
+        hook(data);
+        platform_free(data);
+    } else if (err != REGISLEX_OK) {
+        platform_free(data);
+    }
+    return err;
+}
+
 /* ============================================================================
  * Query Execution Functions
  * ============================================================================ */
@@ -750,6 +1396,7 @@ regislex_error_t regislex_db_exec(regislex_db_context_t* ctx, const char* sql) {
     }
 
     char* err_msg = NULL;
+    tx_wait_turn(ctx);
     int rc = sqlite3_exec(ctx->sqlite_db, sql, NULL, NULL, &err_msg);
     if (rc != SQLITE_OK) {
         if (err_msg) {
@@ -758,10 +1405,10 @@ regislex_error_t regislex_db_exec(regislex_db_context_t* ctx, const char* sql) {
         } else {
             set_sqlite_error(ctx);
         }
-        return REGISLEX_ERROR_DATABASE;
     }
+    tx_turn_done(ctx);
 
-    return REGISLEX_OK;
+    return rc == SQLITE_OK ? REGISLEX_OK : REGISLEX_ERROR_DATABASE;
 }
 
 regislex_error_t regislex_db_exec_tx(regislex_db_transaction_t* tx, const char* sql) {
@@ -785,9 +1432,12 @@ regislex_error_t regislex_db_prepare(regislex_db_context_t* ctx,
 
     (*stmt)->ctx = ctx;
 
+    tx_wait_turn(ctx);
     int rc = sqlite3_prepare_v2(ctx->sqlite_db, sql, -1, &(*stmt)->sqlite_stmt, NULL);
+    if (rc != SQLITE_OK) set_sqlite_error(ctx);
+    platform_mutex_unlock(ctx->mutex);
+
     if (rc != SQLITE_OK) {
-        set_sqlite_error(ctx);
         platform_free(*stmt);
         *stmt = NULL;
         return REGISLEX_ERROR_DATABASE;
@@ -873,6 +1523,12 @@ regislex_error_t regislex_db_bind_uuid(regislex_db_stmt_t* stmt, int index,
     return regislex_db_bind_text(stmt, index, uuid->value);
 }
 
+regislex_error_t regislex_db_bind_uuid_ref(regislex_db_stmt_t* stmt, int index,
+                                           const regislex_uuid_t* uuid) {
+    if (!uuid || uuid->value[0] == '\0') return regislex_db_bind_null(stmt, index);
+    return regislex_db_bind_text(stmt, index, uuid->value);
+}
+
 regislex_error_t regislex_db_bind_datetime(regislex_db_stmt_t* stmt, int index,
                                            const regislex_datetime_t* dt) {
     if (!dt) return regislex_db_bind_null(stmt, index);
@@ -895,14 +1551,16 @@ regislex_error_t regislex_db_bind_money(regislex_db_stmt_t* stmt, int index,
 regislex_error_t regislex_db_step(regislex_db_stmt_t* stmt) {
     if (!stmt || !stmt->sqlite_stmt) return REGISLEX_ERROR_INVALID_ARGUMENT;
 
+    tx_wait_turn(stmt->ctx);
     int rc = sqlite3_step(stmt->sqlite_stmt);
+    if (rc != SQLITE_ROW && rc != SQLITE_DONE) set_sqlite_error(stmt->ctx);
+    tx_turn_done(stmt->ctx);
 
     if (rc == SQLITE_ROW) {
         return REGISLEX_OK;
     } else if (rc == SQLITE_DONE) {
         return REGISLEX_ERROR_NOT_FOUND;
     } else {
-        set_sqlite_error(stmt->ctx);
         return REGISLEX_ERROR_DATABASE;
     }
 }
@@ -975,6 +1633,7 @@ regislex_error_t regislex_db_column_uuid(regislex_db_stmt_t* stmt, int index,
     }
 
     strncpy(uuid->value, text, sizeof(uuid->value) - 1);
+    uuid->value[sizeof(uuid->value) - 1] = '\0';
     return REGISLEX_OK;
 }
 
@@ -1002,10 +1661,10 @@ regislex_error_t regislex_db_column_money(regislex_db_stmt_t* stmt, int index,
 
 int64_t regislex_db_last_insert_id(regislex_db_context_t* ctx) {
     if (!ctx || !ctx->sqlite_db) return 0;
-    return sqlite3_last_insert_rowid(ctx->sqlite_db);
+    return thread_insert_id;
 }
 
 int regislex_db_changes(regislex_db_context_t* ctx) {
     if (!ctx || !ctx->sqlite_db) return 0;
-    return sqlite3_changes(ctx->sqlite_db);
+    return thread_changes;
 }
@@ -0,0 +1,323 @@
+/**
+ * @file metadata_store.c
+ * @brief Typed Key/Value Metadata Storage
+ *
+ * Values are stored with their native SQLite storage class so that the
+ * (key, value) index orders integers and reals numerically and dates
+ * chronologically.
+ */
+
+#include "regislex/regislex.h"
+#include "database/database.h"
+#include "platform/platform.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+
+/* ============================================================================
+ * Value Conversion
+ * ============================================================================ */
+
+static bool equals_ignore_case(const char* a, const char* b) {
+    while (*a && *b) {
+        if (tolower((unsigned char)*a) != tolower((unsigned char)*b)) return false;
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+static regislex_error_t bind_typed_value(regislex_db_stmt_t* stmt, int index,
+                                         regislex_metadata_type_t type,
+                                         const char* value) {
+    if (!value) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+
+    char* end = NULL;
+
+    switch (type) {
+        case REGISLEX_METADATA_INTEGER: {
+            errno = 0;
+            long long v = strtoll(value, &end, 10);
+            if (errno != 0 || end == value || *end != '\0') {
+                return REGISLEX_ERROR_VALIDATION;
+            }
+            return regislex_db_bind_int(stmt, index, (int64_t)v);
+        }
+
+        case REGISLEX_METADATA_REAL: {
+            errno = 0;
+            double v = strtod(value, &end);
+            if (errno != 0 || end == value || *end != '\0') {
+                return REGISLEX_ERROR_VALIDATION;
+            }
+            return regislex_db_bind_real(stmt, index, v);
+        }
+
+        case REGISLEX_METADATA_BOOLEAN:
+            if (strcmp(value, "1") == 0 || equals_ignore_case(value, "true") ||
+                equals_ignore_case(value, "yes")) {
+                return regislex_db_bind_int(stmt, index, 1);
+            }
+            if (strcmp(value, "0") == 0 || equals_ignore_case(value, "false") ||
+                equals_ignore_case(value, "no")) {
+                return regislex_db_bind_int(stmt, index, 0);
+            }
+            return REGISLEX_ERROR_VALIDATION;
+
+        case REGISLEX_METADATA_DATE: {
+            /* Canonical form keeps text comparison chronological */
+            regislex_datetime_t dt;
+            memset(&dt, 0, sizeof(dt));
+            if (regislex_datetime_parse(value, &dt) != REGISLEX_OK) {
+                return REGISLEX_ERROR_VALIDATION;
+            }
+            return regislex_db_bind_datetime(stmt, index, &dt);
+        }
+
+        case REGISLEX_METADATA_TEXT:
+            return regislex_db_bind_text(stmt, index, value);
+
+        default:
+            return REGISLEX_ERROR_VALIDATION;
+    }
+}
+
+/* ============================================================================
+ * Metadata Store Functions
+ * ============================================================================ */
+
+regislex_error_t regislex_db_metadata_set(regislex_db_context_t* ctx,
+                                          const char* table,
+                                          const char* owner_column,
+                                          const regislex_uuid_t* owner_id,
+                                          const regislex_metadata_t* item) {
+    if (!ctx || !table || !owner_column || !owner_id || !item || !item->key || !item->key[0]) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    char sql[256];
+    snprintf(sql, sizeof(sql),
+             "INSERT OR REPLACE INTO %s (%s, key, value_type, value) VALUES (?, ?, ?, ?)",
+             table, owner_column);
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(ctx, sql, &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_bind_uuid(stmt, 1, owner_id);
+    regislex_db_bind_text(stmt, 2, item->key);
+    regislex_db_bind_int(stmt, 3, item->type);
+
+    err = bind_typed_value(stmt, 4, item->type, item->value);
+    if (err == REGISLEX_OK) {
+        err = regislex_db_step(stmt);
+    }
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+    return REGISLEX_OK;
+}
+
+regislex_error_t regislex_db_metadata_delete(regislex_db_context_t* ctx,
+                                             const char* table,
+                                             const char* owner_column,
+                                             const regislex_uuid_t* owner_id,
+                                             const char* key) {
+    if (!ctx || !table || !owner_column || !owner_id) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    char sql[256];
+    snprintf(sql, sizeof(sql), "DELETE FROM %s WHERE %s = ?%s",
+             table, owner_column, key ? " AND key = ?" : "");
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(ctx, sql, &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_bind_uuid(stmt, 1, owner_id);
+    if (key) {
+        regislex_db_bind_text(stmt, 2, key);
+    }
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+    return REGISLEX_OK;
+}
+
+regislex_error_t regislex_db_metadata_load(regislex_db_context_t* ctx,
+                                           const char* table,
+                                           const char* owner_column,
+                                           const regislex_uuid_t* owner_id,
+                                           regislex_metadata_t** out_items,
+                                           int* out_count) {
+    if (!ctx || !table || !owner_column || !owner_id || !out_items || !out_count) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    *out_items = NULL;
+    *out_count = 0;
+
+    char sql[256];
+    snprintf(sql, sizeof(sql),
+             "SELECT key, value_type, value FROM %s WHERE %s = ? ORDER BY key",
+             table, owner_column);
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(ctx, sql, &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_bind_uuid(stmt, 1, owner_id);
+
+    regislex_metadata_t* items = NULL;
+    int count = 0;
+    int capacity = 0;
+
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        if (count >= capacity) {
+            int new_capacity = capacity ? capacity * 2 : 8;
+            regislex_metadata_t* grown = (regislex_metadata_t*)platform_realloc(
+                items, (size_t)new_capacity * sizeof(regislex_metadata_t));
+            if (!grown) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            items = grown;
+            capacity = new_capacity;
+        }
+
+        const char* key = regislex_db_column_text(stmt, 0);
+        const char* value = regislex_db_column_text(stmt, 2);
+
+        regislex_metadata_t* item = &items[count];
+        item->type = (regislex_metadata_type_t)regislex_db_column_int(stmt, 1);
+        item->key = platform_strdup(key ? key : "");
+        item->value = platform_strdup(value ? value : "");
+        count++;
+
+        if (!item->key || !item->value) {
+            err = REGISLEX_ERROR_OUT_OF_MEMORY;
+            break;
+        }
+    }
+
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        regislex_metadata_free(items, count);
+        return err;
+    }
+
+    *out_items = items;
+    *out_count = count;
+    return REGISLEX_OK;
+}
+
+/* ============================================================================
+ * Metadata Filters
+ * ============================================================================ */
+
+static const char* filter_operator(regislex_metadata_op_t op) {
+    switch (op) {
+        case REGISLEX_METADATA_OP_EQ: return "=";
+        case REGISLEX_METADATA_OP_NE: return "!=";
+        case REGISLEX_METADATA_OP_LT: return "<";
+        case REGISLEX_METADATA_OP_LE: return "<=";
+        case REGISLEX_METADATA_OP_GT: return ">";
+        case REGISLEX_METADATA_OP_GE: return ">=";
+        default: return NULL;
+    }
+}
+
+regislex_error_t regislex_db_metadata_filter_sql(char* where, size_t size,
+                                                 const char* table,
+                                                 const char* owner_column,
+                                                 const char* id_column,
+                                                 const regislex_metadata_filter_t* filters,
+                                                 int count) {
+    if (!where || !table || !owner_column || !id_column || (count > 0 && !filters)) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (count > REGISLEX_MAX_METADATA_FILTERS) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    for (int i = 0; i < count; i++) {
+        const regislex_metadata_filter_t* f = &filters[i];
+        if (!f->key) {
+            return REGISLEX_ERROR_INVALID_ARGUMENT;
+        }
+
+        char predicate[64] = "";
+        if (f->op != REGISLEX_METADATA_OP_EXISTS) {
+            const char* op = filter_operator(f->op);
+            if (!op || !f->value) {
+                return REGISLEX_ERROR_INVALID_ARGUMENT;
+            }
+            snprintf(predicate, sizeof(predicate), " AND value %s ?", op);
+        }
+
+        size_t used = strlen(where);
+        int written = snprintf(where + used, size - used,
+                               "%s%s IN (SELECT %s FROM %s WHERE key = ?%s)",
+                               used == 0 ? " WHERE " : " AND ",
+                               id_column, owner_column, table, predicate);
+        if (written < 0 || (size_t)written >= size - used) {
+            return REGISLEX_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    return REGISLEX_OK;
+}
+
+regislex_error_t regislex_db_metadata_filter_bind(regislex_db_stmt_t* stmt,
+                                                  int* index,
+                                                  const regislex_metadata_filter_t* filters,
+                                                  int count) {
+    if (!stmt || !index || (count > 0 && !filters)) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    for (int i = 0; i < count; i++) {
+        regislex_db_bind_text(stmt, (*index)++, filters[i].key);
+
+        if (filters[i].op != REGISLEX_METADATA_OP_EXISTS) {
+            regislex_error_t err = bind_typed_value(stmt, (*index)++, filters[i].type, filters[i].value);
+            if (err != REGISLEX_OK) {
+                return err;
+            }
+        }
+    }
+
+    return REGISLEX_OK;
+}
+
+/* ============================================================================
+ * Public Helpers
+ * ============================================================================ */
+
+REGISLEX_API void regislex_metadata_free(regislex_metadata_t* metadata, int count) {
+    if (!metadata) return;
+
+    for (int i = 0; i < count; i++) {
+        platform_free(metadata[i].key);
+        platform_free(metadata[i].value);
+    }
+    platform_free(metadata);
+}
@@ -21,6 +21,11 @@ static regislex_case_t* case_alloc(void) {
     return c;
 }
 
+/* An unset date is stored as NULL rather than a zero timestamp */
+static void bind_optional_date(regislex_db_stmt_t* stmt, int idx, const regislex_datetime_t* dt) {
+    regislex_db_bind_datetime(stmt, idx, regislex_datetime_is_valid_date(dt) ? dt : NULL);
+}
+
 static regislex_error_t case_from_row(regislex_db_stmt_t* stmt, regislex_case_t* case_out) {
     if (!stmt || !case_out) return REGISLEX_ERROR_INVALID_ARGUMENT;
 
@@ -86,6 +91,580 @@ static regislex_error_t case_from_row(regislex_db_stmt_t* stmt, regislex_case_t*
     return REGISLEX_OK;
 }
 
+/* ============================================================================
+ * Case Detail Arena
+ *
+ * regislex_case_get_full() places the case and every related record in a
+ * chain of large blocks so the whole graph is freed with one walk.
+ * ============================================================================ */
+
+#define CASE_ARENA_BLOCK_SIZE   (256 * 1024)
+#define CASE_ARENA_ALIGN(n)     (((n) + 15) & ~(size_t)15)
+
+typedef struct case_arena_block {
+    struct case_arena_block* next;
+    size_t size;
+    size_t used;
+} case_arena_block_t;
+
+static void* case_arena_alloc(void** arena, size_t size) {
+    size_t header = CASE_ARENA_ALIGN(sizeof(case_arena_block_t));
+    size = CASE_ARENA_ALIGN(size);
+
+    case_arena_block_t* block = (case_arena_block_t*)*arena;
+    if (!block || block->used + size > block->size) {
+        size_t capacity = size > CASE_ARENA_BLOCK_SIZE ? size : CASE_ARENA_BLOCK_SIZE;
+        case_arena_block_t* new_block = (case_arena_block_t*)platform_malloc(header + capacity);
+        if (!new_block) return NULL;
+
+        new_block->next = block;
+        new_block->size = capacity;
+        new_block->used = 0;
+        *arena = new_block;
+        block = new_block;
+    }
+
+    void* ptr = (char*)block + header + block->used;
+    block->used += size;
+    memset(ptr, 0, size);
+    return ptr;
+}
+
+static void case_arena_release(void* arena) {
+    case_arena_block_t* block = (case_arena_block_t*)arena;
+    while (block) {
+        case_arena_block_t* next = block->next;
+        platform_free(block);
+        block = next;
+    }
+}
+
+static regislex_error_t party_from_row(regislex_db_stmt_t* stmt, void* out) {
+    regislex_party_t* party = (regislex_party_t*)out;
+    int col = 0;
+
+    regislex_db_column_uuid(stmt, col++, &party->id);
+
+    const char* name = regislex_db_column_text(stmt, col++);
+    if (name) strncpy(party->name, name, sizeof(party->name) - 1);
+
+    const char* display_name = regislex_db_column_text(stmt, col++);
+    if (display_name) strncpy(party->display_name, display_name, sizeof(party->display_name) - 1);
+
+    party->type = (regislex_party_type_t)regislex_db_column_int(stmt, col++);
+    party->role = (regislex_party_role_t)regislex_db_column_int(stmt, col++);
+
+    const char* text;
+    if ((text = regislex_db_column_text(stmt, col++))) strncpy(party->contact.address_line1, text, sizeof(party->contact.address_line1) - 1);
+    if ((text = regislex_db_column_text(stmt, col++))) strncpy(party->contact.address_line2, text, sizeof(party->contact.address_line2) - 1);
+    if ((text = regislex_db_column_text(stmt, col++))) strncpy(party->contact.city, text, sizeof(party->contact.city) - 1);
+    if ((text = regislex_db_column_text(stmt, col++))) strncpy(party->contact.state, text, sizeof(party->contact.state) - 1);
+    if ((text = regislex_db_column_text(stmt, col++))) strncpy(party->contact.postal_code, text, sizeof(party->contact.postal_code) - 1);
+    if ((text = regislex_db_column_text(stmt, col++))) strncpy(party->contact.country, text, sizeof(party->contact.country) - 1);
+    if ((text = regislex_db_column_text(stmt, col++))) strncpy(party->contact.phone, text, sizeof(party->contact.phone) - 1);
+    if ((text = regislex_db_column_text(stmt, col++))) strncpy(party->contact.email, text, sizeof(party->contact.email) - 1);
+    if ((text = regislex_db_column_text(stmt, col++))) strncpy(party->attorney_name, text, sizeof(party->attorney_name) - 1);
+    if ((text = regislex_db_column_text(stmt, col++))) strncpy(party->attorney_firm, text, sizeof(party->attorney_firm) - 1);
+    if ((text = regislex_db_column_text(stmt, col++))) strncpy(party->bar_number, text, sizeof(party->bar_number) - 1);
+
+    party->is_primary = regislex_db_column_int(stmt, col++) != 0;
+
+    if ((text = regislex_db_column_text(stmt, col++))) strncpy(party->notes, text, sizeof(party->notes) - 1);
+
+    regislex_db_column_datetime(stmt, col++, &party->created_at);
+    regislex_db_column_datetime(stmt, col++, &party->updated_at);
+
+    return REGISLEX_OK;
+}
+
+static regislex_error_t deadline_row(regislex_db_stmt_t* stmt, void* out) {
+    return regislex_deadline_from_row(stmt, (regislex_deadline_t*)out);
+}
+
+static regislex_error_t task_row(regislex_db_stmt_t* stmt, void* out) {
+    return regislex_task_from_row(stmt, (regislex_task_t*)out);
+}
+
+static regislex_error_t document_row(regislex_db_stmt_t* stmt, void* out) {
+    return regislex_document_from_row(stmt, (regislex_document_t*)out);
+}
+
+/* Run one "... WHERE case_id = ?" query and decode every row into the arena */
+static regislex_error_t case_load_related(
+    regislex_db_context_t* db,
+    void** arena,
+    const char* sql,
+    const regislex_uuid_t* case_id,
+    size_t item_size,
+    regislex_error_t (*decode)(regislex_db_stmt_t*, void*),
+    void*** out_items,
+    int* out_count)
+{
+    *out_items = NULL;
+    *out_count = 0;
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_bind_uuid(stmt, 1, case_id);
+
+    void** items = NULL;
+    int count = 0;
+    int capacity = 0;
+
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        if (count >= capacity) {
+            capacity = capacity ? capacity * 2 : 16;
+            void** grown = (void**)platform_realloc(items, (size_t)capacity * sizeof(void*));
+            if (!grown) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            items = grown;
+        }
+
+        void* item = case_arena_alloc(arena, item_size);
+        if (!item) {
+            err = REGISLEX_ERROR_OUT_OF_MEMORY;
+            break;
+        }
+
+        decode(stmt, item);
+        items[count++] = item;
+    }
+
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        platform_free(items);
+        return err;
+    }
+
+    if (count > 0) {
+        *out_items = (void**)case_arena_alloc(arena, (size_t)count * sizeof(void*));
+        if (!*out_items) {
+            platform_free(items);
+            return REGISLEX_ERROR_OUT_OF_MEMORY;
+        }
+        memcpy(*out_items, items, (size_t)count * sizeof(void*));
+        *out_count = count;
+    }
+
+    platform_free(items);
+    return REGISLEX_OK;
+}
+
+/* ============================================================================
+ * Case Hierarchy Maintenance
+ * ============================================================================ */
+
+/* Run a statement whose parameters are ?1 (case) and ?2 (related case) */
+static regislex_error_t hierarchy_exec(regislex_db_context_t* db,
+                                       const char* sql,
+                                       const regislex_uuid_t* case_id,
+                                       const regislex_uuid_t* other_id) {
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_bind_uuid(stmt, 1, case_id);
+    regislex_db_bind_uuid(stmt, 2, other_id);
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+    return REGISLEX_OK;
+}
+
+/* Add closure rows for a new case: itself plus every ancestor of its parent */
+static regislex_error_t hierarchy_link(regislex_db_context_t* db,
+                                       const regislex_uuid_t* case_id,
+                                       const regislex_uuid_t* parent_id) {
+    return hierarchy_exec(db,
+        "INSERT INTO case_hierarchy (ancestor_id, descendant_id, depth) "
+        "SELECT ?1, ?1, 0 "
+        "UNION ALL "
+        "SELECT ancestor_id, ?1, depth + 1 FROM case_hierarchy WHERE descendant_id = ?2",
+        case_id, parent_id);
+}
+
+/* Re-parent a case together with its whole subtree */
+static regislex_error_t hierarchy_move(regislex_db_context_t* db,
+                                       const regislex_uuid_t* case_id,
+                                       const regislex_uuid_t* new_parent_id) {
+    bool has_parent = new_parent_id && new_parent_id->value[0] != '\0';
+
+    if (has_parent) {
+        /* The new parent may not sit inside the subtree being moved */
+        regislex_db_stmt_t* stmt = NULL;
+        regislex_error_t err = regislex_db_prepare(db,
+            "SELECT 1 FROM case_hierarchy WHERE ancestor_id = ? AND descendant_id = ?", &stmt);
+        if (err != REGISLEX_OK) {
+            return err;
+        }
+        regislex_db_bind_uuid(stmt, 1, case_id);
+        regislex_db_bind_uuid(stmt, 2, new_parent_id);
+        err = regislex_db_step(stmt);
+        regislex_db_finalize(stmt);
+
+        if (err == REGISLEX_OK) {
+            return REGISLEX_ERROR_VALIDATION;
+        } else if (err != REGISLEX_ERROR_NOT_FOUND) {
+            return err;
+        }
+    }
+
+    /* Detach: drop paths from the old ancestors into the subtree */
+    regislex_error_t err = hierarchy_exec(db,
+        "DELETE FROM case_hierarchy "
+        "WHERE descendant_id IN (SELECT descendant_id FROM case_hierarchy WHERE ancestor_id = ?1) "
+        "AND ancestor_id IN (SELECT ancestor_id FROM case_hierarchy "
+        "                    WHERE descendant_id = ?1 AND ancestor_id != ?1)",
+        case_id, NULL);
+    if (err != REGISLEX_OK || !has_parent) {
+        return err;
+    }
+
+    /* Attach: cross the new parent's ancestors with the subtree */
+    return hierarchy_exec(db,
+        "INSERT INTO case_hierarchy (ancestor_id, descendant_id, depth) "
+        "SELECT super.ancestor_id, sub.descendant_id, super.depth + sub.depth + 1 "
+        "FROM case_hierarchy super, case_hierarchy sub "
+        "WHERE super.descendant_id = ?2 AND sub.ancestor_id = ?1",
+        case_id, new_parent_id);
+}
+
+/* ============================================================================
+ * Case Metadata Helpers
+ * ============================================================================ */
+
+static regislex_error_t case_metadata_save(regislex_db_context_t* db,
+                                           const regislex_uuid_t* case_id,
+                                           const regislex_metadata_t* items,
+                                           int count) {
+    for (int i = 0; i < count; i++) {
+        regislex_error_t err = regislex_db_metadata_set(db, "case_metadata", "case_id",
+                                                        case_id, &items[i]);
+        if (err != REGISLEX_OK) {
+            return err;
+        }
+    }
+    return REGISLEX_OK;
+}
+
+static char* case_arena_strdup(void** arena, const char* str) {
+    size_t len = strlen(str) + 1;
+    char* copy = (char*)case_arena_alloc(arena, len);
+    if (copy) memcpy(copy, str, len);
+    return copy;
+}
+
+/* Load a case's metadata into its arena */
+static regislex_error_t case_metadata_load_arena(regislex_db_context_t* db,
+                                                 void** arena,
+                                                 regislex_case_t* case_ptr) {
+    regislex_metadata_t* items = NULL;
+    int count = 0;
+    regislex_error_t err = regislex_db_metadata_load(db, "case_metadata", "case_id",
+                                                     &case_ptr->id, &items, &count);
+    if (err != REGISLEX_OK || count == 0) {
+        return err;
+    }
+
+    regislex_metadata_t* copies = (regislex_metadata_t*)case_arena_alloc(
+        arena, (size_t)count * sizeof(regislex_metadata_t));
+    for (int i = 0; copies && i < count; i++) {
+        copies[i].type = items[i].type;
+        copies[i].key = case_arena_strdup(arena, items[i].key);
+        copies[i].value = case_arena_strdup(arena, items[i].value);
+        if (!copies[i].key || !copies[i].value) {
+            copies = NULL;
+        }
+    }
+    regislex_metadata_free(items, count);
+
+    if (!copies) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    case_ptr->metadata = copies;
+    case_ptr->metadata_count = count;
+    return REGISLEX_OK;
+}
+
+/* ============================================================================
+ * Caseload Counter Keys
+ * ============================================================================ */
+
+static void caseload_key_of(const regislex_case_t* case_ptr, regislex_caseload_key_t* key) {
+    key->status = case_ptr->status;
+    key->type = case_ptr->type;
+    key->assigned_to_id = case_ptr->assigned_to_id;
+}
+
+/* Read the counted columns of a stored case; NOT_FOUND if it does not exist */
+static regislex_error_t caseload_key_load(regislex_db_context_t* db,
+                                          const regislex_uuid_t* id,
+                                          regislex_caseload_key_t* key) {
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "SELECT status, type, assigned_to_id FROM cases WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_bind_uuid(stmt, 1, id);
+
+    err = regislex_db_step(stmt);
+    if (err == REGISLEX_OK) {
+        key->status = (regislex_status_t)regislex_db_column_int(stmt, 0);
+        key->type = (regislex_case_type_t)regislex_db_column_int(stmt, 1);
+        regislex_db_column_uuid(stmt, 2, &key->assigned_to_id);
+    }
+    regislex_db_finalize(stmt);
+
+    return err;
+}
+
+typedef struct {
+    bool has_old;
+    bool has_new;
+    regislex_caseload_key_t old_key;
+    regislex_caseload_key_t new_key;
+} caseload_change_t;
+
+static void caseload_change_run(void* data) {
+    const caseload_change_t* change = (const caseload_change_t*)data;
+    regislex_caseload_apply(change->has_old ? &change->old_key : NULL,
+                            change->has_new ? &change->new_key : NULL);
+}
+
+/* Count a case change in the caseload cache once it commits */
+static regislex_error_t caseload_change(regislex_db_context_t* db,
+                                        const regislex_caseload_key_t* old_key,
+                                        const regislex_caseload_key_t* new_key) {
+    caseload_change_t* change = (caseload_change_t*)platform_calloc(1, sizeof(caseload_change_t));
+    if (!change) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    if (old_key) {
+        change->has_old = true;
+        change->old_key = *old_key;
+    }
+    if (new_key) {
+        change->has_new = true;
+        change->new_key = *new_key;
+    }
+    return regislex_db_after_commit(db, caseload_change_run, change);
+}
+
+/* ============================================================================
+ * Workflow Events
+ * ============================================================================ */
+
+/* Publish a case event for trigger-driven workflows; a no-op without the event bus */
+static void case_publish(regislex_context_t* ctx, regislex_event_type_t type,
+                         const regislex_uuid_t* case_id, const regislex_uuid_t* subject_id,
+                         const char* data) {
+    regislex_event_t event;
+    memset(&event, 0, sizeof(event));
+    event.type = type;
+    memcpy(&event.case_id, case_id, sizeof(regislex_uuid_t));
+    memcpy(&event.subject_id, subject_id, sizeof(regislex_uuid_t));
+    strncpy(event.data, data, sizeof(event.data) - 1);
+
+    regislex_event_publish(ctx, &event);
+}
+
+static void case_publish_status(regislex_context_t* ctx, const regislex_uuid_t* case_id,
+                                regislex_status_t old_status, regislex_status_t new_status) {
+    char data[64];
+    snprintf(data, sizeof(data), "{\"old_status\":%d,\"status\":%d}", old_status, new_status);
+    case_publish(ctx, REGISLEX_EVENT_CASE_STATUS_CHANGED, case_id, case_id, data);
+}
+
+static void case_publish_assigned(regislex_context_t* ctx, const regislex_uuid_t* case_id,
+                                  const regislex_uuid_t* user_id) {
+    char data[96];
+    snprintf(data, sizeof(data), "{\"assigned_to_id\":\"%s\"}", user_id->value);
+    case_publish(ctx, REGISLEX_EVENT_CASE_ASSIGNED, case_id, case_id, data);
+}
+
+/* Collect every row of a case query into a new list */
+static regislex_error_t case_list_from_stmt(regislex_db_stmt_t* stmt,
+                                            regislex_case_list_t** out_list) {
+    regislex_case_list_t* list = (regislex_case_list_t*)platform_calloc(1, sizeof(regislex_case_list_t));
+    if (!list) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    int capacity = 16;
+    list->cases = (regislex_case_t**)platform_calloc(capacity, sizeof(regislex_case_t*));
+    if (!list->cases) {
+        platform_free(list);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    regislex_error_t err;
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        if (list->count >= capacity) {
+            capacity *= 2;
+            regislex_case_t** new_cases = (regislex_case_t**)platform_realloc(
+                list->cases, capacity * sizeof(regislex_case_t*));
+            if (!new_cases) {
+                regislex_case_list_free(list);
+                return REGISLEX_ERROR_OUT_OF_MEMORY;
+            }
+            list->cases = new_cases;
+        }
+
+        regislex_case_t* case_item = case_alloc();
+        if (!case_item) {
+            regislex_case_list_free(list);
+            return REGISLEX_ERROR_OUT_OF_MEMORY;
+        }
+
+        case_from_row(stmt, case_item);
+        list->cases[list->count++] = case_item;
+    }
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        regislex_case_list_free(list);
+        return err;
+    }
+
+    list->total_count = list->count;
+    list->limit = list->count;
+    *out_list = list;
+    return REGISLEX_OK;
+}
+
+/* Build and bind the filtered case query shared by list and cursor */
+static regislex_error_t case_query_prepare(regislex_db_context_t* db,
+                                           const regislex_case_filter_t* filter,
+                                           int default_limit,
+                                           regislex_db_stmt_t** out_stmt) {
+    /* Build query with filters */
+    char sql[4096];
+    char where_clause[2048] = "";
+    char order_clause[256] = "ORDER BY created_at DESC";
+    int param_idx = 1;
+
+    strcpy(sql,
+        "SELECT id, case_number, title, short_title, description, type, status, priority, outcome,"
+        "  court_name, court_division, docket_number, internal_reference, client_reference,"
+        "  estimated_value, settlement_amount, filed_date, trial_date, closed_date,"
+        "  statute_of_limitations, lead_attorney_id, assigned_to_id, parent_case_id,"
+        "  tags, created_at, updated_at, created_by, updated_by "
+        "FROM cases");
+
+    /* Apply filters */
+    if (filter) {
+        int first_filter = 1;
+
+        if (filter->case_number) {
+            strcat(where_clause, first_filter ? " WHERE " : " AND ");
+            strcat(where_clause, "case_number = ?");
+            first_filter = 0;
+        }
+
+        if (filter->title_contains) {
+            strcat(where_clause, first_filter ? " WHERE " : " AND ");
+            strcat(where_clause, "title LIKE ?");
+            first_filter = 0;
+        }
+
+        if (filter->status) {
+            strcat(where_clause, first_filter ? " WHERE " : " AND ");
+            strcat(where_clause, "status = ?");
+            first_filter = 0;
+        }
+
+        if (filter->type) {
+            strcat(where_clause, first_filter ? " WHERE " : " AND ");
+            strcat(where_clause, "type = ?");
+            first_filter = 0;
+        }
+
+        if (filter->assigned_to_id) {
+            strcat(where_clause, first_filter ? " WHERE " : " AND ");
+            strcat(where_clause, "assigned_to_id = ?");
+            first_filter = 0;
+        }
+
+        if (filter->metadata_count > 0) {
+            regislex_error_t err = regislex_db_metadata_filter_sql(
+                where_clause, sizeof(where_clause), "case_metadata", "case_id", "id",
+                filter->metadata, filter->metadata_count);
+            if (err != REGISLEX_OK) {
+                return err;
+            }
+        }
+
+        if (filter->order_by) {
+            snprintf(order_clause, sizeof(order_clause), "ORDER BY %s %s",
+                    filter->order_by, filter->order_desc ? "DESC" : "ASC");
+        }
+    }
+
+    strcat(sql, where_clause);
+    strcat(sql, " ");
+    strcat(sql, order_clause);
+
+    /* Add pagination; a negative LIMIT is unbounded in SQLite */
+    int limit = (filter && filter->limit > 0) ? filter->limit : default_limit;
+    int offset = (filter && filter->offset > 0) ? filter->offset : 0;
+    char pagination[64];
+    snprintf(pagination, sizeof(pagination), " LIMIT %d OFFSET %d", limit, offset);
+    strcat(sql, pagination);
+
+    /* Execute query */
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    /* Bind filter parameters */
+    if (filter) {
+        if (filter->case_number) {
+            regislex_db_bind_text(stmt, param_idx++, filter->case_number);
+        }
+        if (filter->title_contains) {
+            char like_pattern[512];
+            snprintf(like_pattern, sizeof(like_pattern), "%%%s%%", filter->title_contains);
+            regislex_db_bind_text(stmt, param_idx++, like_pattern);
+        }
+        if (filter->status) {
+            regislex_db_bind_int(stmt, param_idx++, *filter->status);
+        }
+        if (filter->type) {
+            regislex_db_bind_int(stmt, param_idx++, *filter->type);
+        }
+        if (filter->assigned_to_id) {
+            regislex_db_bind_uuid(stmt, param_idx++, filter->assigned_to_id);
+        }
+
+        err = regislex_db_metadata_filter_bind(stmt, &param_idx, filter->metadata,
+                                               filter->metadata_count);
+        if (err != REGISLEX_OK) {
+            regislex_db_finalize(stmt);
+            return err;
+        }
+    }
+
+    *out_stmt = stmt;
+    return REGISLEX_OK;
+}
+
 /* ============================================================================
  * Case Management Functions
  * ============================================================================ */
@@ -107,6 +686,19 @@ REGISLEX_API regislex_error_t regislex_case_create(
     /* Copy input data */
     memcpy(new_case, case_data, sizeof(regislex_case_t));
 
+    /* Related records stay owned by the caller */
+    new_case->party_count = 0;
+    new_case->parties = NULL;
+    new_case->deadline_count = 0;
+    new_case->deadlines = NULL;
+    new_case->task_count = 0;
+    new_case->tasks = NULL;
+    new_case->document_count = 0;
+    new_case->documents = NULL;
+    new_case->metadata_count = 0;
+    new_case->metadata = NULL;
+    new_case->arena = NULL;
+
     /* Generate UUID if not provided */
     if (new_case->id.value[0] == '\0') {
         regislex_uuid_generate(&new_case->id);
@@ -117,8 +709,14 @@ REGISLEX_API regislex_error_t regislex_case_create(
     memcpy(&new_case->updated_at, &new_case->created_at, sizeof(regislex_datetime_t));
 
     /* Get database context */
-    regislex_db_context_t* db = NULL;
-    /* Note: In real implementation, we'd get db from ctx internal structure */
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_transaction_t* tx = NULL;
+    regislex_error_t err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) {
+        regislex_case_free(new_case);
+        return err;
+    }
 
     const char* sql =
         "INSERT INTO cases ("
@@ -130,8 +728,9 @@ REGISLEX_API regislex_error_t regislex_case_create(
         ") VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)";
 
     regislex_db_stmt_t* stmt = NULL;
-    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    err = regislex_db_prepare(db, sql, &stmt);
     if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
         regislex_case_free(new_case);
         return err;
     }
@@ -153,27 +752,51 @@ REGISLEX_API regislex_error_t regislex_case_create(
     regislex_db_bind_text(stmt, idx++, new_case->client_reference);
     regislex_db_bind_money(stmt, idx++, &new_case->estimated_value);
     regislex_db_bind_money(stmt, idx++, &new_case->settlement_amount);
-    regislex_db_bind_datetime(stmt, idx++, &new_case->filed_date);
-    regislex_db_bind_datetime(stmt, idx++, &new_case->trial_date);
-    regislex_db_bind_datetime(stmt, idx++, &new_case->closed_date);
-    regislex_db_bind_datetime(stmt, idx++, &new_case->statute_of_limitations);
-    regislex_db_bind_uuid(stmt, idx++, &new_case->lead_attorney_id);
-    regislex_db_bind_uuid(stmt, idx++, &new_case->assigned_to_id);
-    regislex_db_bind_uuid(stmt, idx++, &new_case->parent_case_id);
+    bind_optional_date(stmt, idx++, &new_case->filed_date);
+    bind_optional_date(stmt, idx++, &new_case->trial_date);
+    bind_optional_date(stmt, idx++, &new_case->closed_date);
+    bind_optional_date(stmt, idx++, &new_case->statute_of_limitations);
+    regislex_db_bind_uuid_ref(stmt, idx++, &new_case->lead_attorney_id);
+    regislex_db_bind_uuid_ref(stmt, idx++, &new_case->assigned_to_id);
+    regislex_db_bind_uuid_ref(stmt, idx++, &new_case->parent_case_id);
     regislex_db_bind_text(stmt, idx++, new_case->tags);
     regislex_db_bind_datetime(stmt, idx++, &new_case->created_at);
     regislex_db_bind_datetime(stmt, idx++, &new_case->updated_at);
-    regislex_db_bind_uuid(stmt, idx++, &new_case->created_by);
-    regislex_db_bind_uuid(stmt, idx++, &new_case->updated_by);
+    regislex_db_bind_uuid_ref(stmt, idx++, &new_case->created_by);
+    regislex_db_bind_uuid_ref(stmt, idx++, &new_case->updated_by);
 
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
 
     if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        regislex_case_free(new_case);
+        return err;
+    }
+
+    err = hierarchy_link(db, &new_case->id, &new_case->parent_case_id);
+    if (err == REGISLEX_OK) {
+        err = case_metadata_save(db, &new_case->id, case_data->metadata, case_data->metadata_count);
+    }
+    if (err == REGISLEX_OK) {
+        regislex_caseload_key_t key;
+        caseload_key_of(new_case, &key);
+        err = caseload_change(db, NULL, &key);
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
         regislex_case_free(new_case);
         return err;
     }
 
+    char data[96];
+    snprintf(data, sizeof(data), "{\"status\":%d,\"type\":%d,\"priority\":%d}",
+             new_case->status, new_case->type, new_case->priority);
+    case_publish(ctx, REGISLEX_EVENT_CASE_CREATED, &new_case->id, &new_case->id, data);
+
     *out_case = new_case;
     return REGISLEX_OK;
 }
@@ -187,8 +810,7 @@ REGISLEX_API regislex_error_t regislex_case_get(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
-    /* Note: In real implementation, we'd get db from ctx internal structure */
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
     const char* sql =
         "SELECT id, case_number, title, short_title, description, type, status, priority, outcome,"
@@ -228,6 +850,100 @@ REGISLEX_API regislex_error_t regislex_case_get(
     return REGISLEX_OK;
 }
 
+REGISLEX_API regislex_error_t regislex_case_get_full(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* id,
+    regislex_case_t** out_case)
+{
+    if (!ctx || !id || !out_case) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    const char* case_sql =
+        "SELECT id, case_number, title, short_title, description, type, status, priority, outcome,"
+        "  court_name, court_division, docket_number, internal_reference, client_reference,"
+        "  estimated_value, settlement_amount, filed_date, trial_date, closed_date,"
+        "  statute_of_limitations, lead_attorney_id, assigned_to_id, parent_case_id,"
+        "  tags, created_at, updated_at, created_by, updated_by "
+        "FROM cases WHERE id = ?";
+
+    const char* party_sql =
+        "SELECT id, name, display_name, type, role,"
+        "  address_line1, address_line2, city, state, postal_code, country,"
+        "  phone, email, attorney_name, attorney_firm, bar_number,"
+        "  is_primary, notes, created_at, updated_at "
+        "FROM parties WHERE case_id = ? ORDER BY is_primary DESC, name";
+
+    const char* deadline_sql =
+        "SELECT " REGISLEX_DEADLINE_COLUMNS " "
+        "FROM deadlines WHERE case_id = ? ORDER BY due_date";
+
+    const char* task_sql =
+        "SELECT " REGISLEX_TASK_COLUMNS " "
+        "FROM tasks WHERE case_id = ? ORDER BY due_date";
+
+    const char* document_sql =
+        "SELECT " REGISLEX_DOCUMENT_SUMMARY_COLUMNS " "
+        "FROM documents WHERE case_id = ? ORDER BY created_at DESC";
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, case_sql, &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_bind_uuid(stmt, 1, id);
+
+    err = regislex_db_step(stmt);
+    if (err != REGISLEX_OK) {
+        regislex_db_finalize(stmt);
+        return err;
+    }
+
+    void* arena = NULL;
+    regislex_case_t* case_out = (regislex_case_t*)case_arena_alloc(&arena, sizeof(regislex_case_t));
+    if (!case_out) {
+        regislex_db_finalize(stmt);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    case_from_row(stmt, case_out);
+    regislex_db_finalize(stmt);
+
+    err = case_load_related(db, &arena, party_sql, id, sizeof(regislex_party_t),
+                            party_from_row, (void***)&case_out->parties,
+                            &case_out->party_count);
+    if (err == REGISLEX_OK) {
+        err = case_load_related(db, &arena, deadline_sql, id, sizeof(regislex_deadline_t),
+                                deadline_row, (void***)&case_out->deadlines,
+                                &case_out->deadline_count);
+    }
+    if (err == REGISLEX_OK) {
+        err = case_load_related(db, &arena, task_sql, id, sizeof(regislex_task_t),
+                                task_row, (void***)&case_out->tasks,
+                                &case_out->task_count);
+    }
+    if (err == REGISLEX_OK) {
+        err = case_load_related(db, &arena, document_sql, id, sizeof(regislex_document_t),
+                                document_row, (void***)&case_out->documents,
+                                &case_out->document_count);
+    }
+    if (err == REGISLEX_OK) {
+        err = case_metadata_load_arena(db, &arena, case_out);
+    }
+
+    if (err != REGISLEX_OK) {
+        case_arena_release(arena);
+        return err;
+    }
+
+    case_out->arena = arena;
+    *out_case = case_out;
+    return REGISLEX_OK;
+}
+
 REGISLEX_API regislex_error_t regislex_case_get_by_number(
     regislex_context_t* ctx,
     const char* case_number,
@@ -285,7 +1001,41 @@ REGISLEX_API regislex_error_t regislex_case_update(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_transaction_t* tx = NULL;
+    regislex_error_t err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    /* Current parent and counter key, to detect re-parenting */
+    regislex_uuid_t old_parent_id;
+    memset(&old_parent_id, 0, sizeof(old_parent_id));
+    regislex_caseload_key_t old_key;
+    memset(&old_key, 0, sizeof(old_key));
+
+    regislex_db_stmt_t* stmt = NULL;
+    err = regislex_db_prepare(db,
+        "SELECT parent_case_id, status, type, assigned_to_id FROM cases WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        return err;
+    }
+    regislex_db_bind_uuid(stmt, 1, &case_data->id);
+    err = regislex_db_step(stmt);
+    if (err == REGISLEX_OK) {
+        regislex_db_column_uuid(stmt, 0, &old_parent_id);
+        old_key.status = (regislex_status_t)regislex_db_column_int(stmt, 1);
+        old_key.type = (regislex_case_type_t)regislex_db_column_int(stmt, 2);
+        regislex_db_column_uuid(stmt, 3, &old_key.assigned_to_id);
+    }
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        return err;
+    }
 
     const char* sql =
         "UPDATE cases SET "
@@ -300,9 +1050,10 @@ REGISLEX_API regislex_error_t regislex_case_update(
         "  updated_at = ?, updated_by = ? "
         "WHERE id = ?";
 
-    regislex_db_stmt_t* stmt = NULL;
-    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    stmt = NULL;
+    err = regislex_db_prepare(db, sql, &stmt);
     if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
         return err;
     }
 
@@ -325,25 +1076,69 @@ REGISLEX_API regislex_error_t regislex_case_update(
     regislex_db_bind_text(stmt, idx++, case_data->client_reference);
     regislex_db_bind_money(stmt, idx++, &case_data->estimated_value);
     regislex_db_bind_money(stmt, idx++, &case_data->settlement_amount);
-    regislex_db_bind_datetime(stmt, idx++, &case_data->filed_date);
-    regislex_db_bind_datetime(stmt, idx++, &case_data->trial_date);
-    regislex_db_bind_datetime(stmt, idx++, &case_data->closed_date);
-    regislex_db_bind_datetime(stmt, idx++, &case_data->statute_of_limitations);
-    regislex_db_bind_uuid(stmt, idx++, &case_data->lead_attorney_id);
-    regislex_db_bind_uuid(stmt, idx++, &case_data->assigned_to_id);
-    regislex_db_bind_uuid(stmt, idx++, &case_data->parent_case_id);
+    bind_optional_date(stmt, idx++, &case_data->filed_date);
+    bind_optional_date(stmt, idx++, &case_data->trial_date);
+    bind_optional_date(stmt, idx++, &case_data->closed_date);
+    bind_optional_date(stmt, idx++, &case_data->statute_of_limitations);
+    regislex_db_bind_uuid_ref(stmt, idx++, &case_data->lead_attorney_id);
+    regislex_db_bind_uuid_ref(stmt, idx++, &case_data->assigned_to_id);
+    regislex_db_bind_uuid_ref(stmt, idx++, &case_data->parent_case_id);
     regislex_db_bind_text(stmt, idx++, case_data->tags);
     regislex_db_bind_datetime(stmt, idx++, &now);
-    regislex_db_bind_uuid(stmt, idx++, &case_data->updated_by);
+    regislex_db_bind_uuid_ref(stmt, idx++, &case_data->updated_by);
     regislex_db_bind_uuid(stmt, idx++, &case_data->id);
 
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
 
     if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
         return err;
     }
 
+    if (strcmp(old_parent_id.value, case_data->parent_case_id.value) != 0) {
+        err = hierarchy_move(db, &case_data->id, &case_data->parent_case_id);
+        if (err != REGISLEX_OK) {
+            regislex_db_rollback(tx);
+            return err;
+        }
+    }
+
+    /* A metadata array replaces the stored set; NULL leaves it untouched */
+    if (case_data->metadata) {
+        err = regislex_db_metadata_delete(db, "case_metadata", "case_id", &case_data->id, NULL);
+        if (err == REGISLEX_OK) {
+            err = case_metadata_save(db, &case_data->id, case_data->metadata, case_data->metadata_count);
+        }
+        if (err != REGISLEX_OK) {
+            regislex_db_rollback(tx);
+            return err;
+        }
+    }
+
+    regislex_caseload_key_t new_key;
+    caseload_key_of(case_data, &new_key);
+    err = caseload_change(db, &old_key, &new_key);
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        return err;
+    }
+
+    char data[96];
+    snprintf(data, sizeof(data), "{\"status\":%d,\"type\":%d,\"priority\":%d}",
+             case_data->status, case_data->type, case_data->priority);
+    case_publish(ctx, REGISLEX_EVENT_CASE_UPDATED, &case_data->id, &case_data->id, data);
+    if (old_key.status != new_key.status) {
+        case_publish_status(ctx, &case_data->id, old_key.status, new_key.status);
+    }
+    if (new_key.assigned_to_id.value[0] &&
+        strcmp(old_key.assigned_to_id.value, new_key.assigned_to_id.value) != 0) {
+        case_publish_assigned(ctx, &case_data->id, &new_key.assigned_to_id);
+    }
+
     return REGISLEX_OK;
 }
 
@@ -355,13 +1150,34 @@ REGISLEX_API regislex_error_t regislex_case_delete(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_transaction_t* tx = NULL;
+    regislex_error_t err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_caseload_key_t old_key;
+    err = caseload_key_load(db, id, &old_key);
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        return err;
+    }
+
+    /* The deadlines cascade with the case, so collect them while they exist */
+    err = regislex_deadline_evict_case(ctx, id);
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        return err;
+    }
 
     const char* sql = "DELETE FROM cases WHERE id = ?";
 
     regislex_db_stmt_t* stmt = NULL;
-    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    err = regislex_db_prepare(db, sql, &stmt);
     if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
         return err;
     }
 
@@ -370,7 +1186,19 @@ REGISLEX_API regislex_error_t regislex_case_delete(
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
 
-    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+    if (err == REGISLEX_ERROR_NOT_FOUND || err == REGISLEX_OK) {
+        err = caseload_change(db, &old_key, NULL);
+    }
+    /* The parties cascade with the case; they leave the conflict index once it commits */
+    if (err == REGISLEX_OK) {
+        err = regislex_conflict_index_remove_case(ctx, id);
+        if (err == REGISLEX_ERROR_NOT_INITIALIZED) err = REGISLEX_OK;
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
         return err;
     }
 
@@ -383,156 +1211,136 @@ REGISLEX_API regislex_error_t regislex_case_list(
     regislex_case_list_t** out_list)
 {
     if (!ctx || !out_list) {
-        return REGISLEX_ERROR_INVALID_ARGUMENT;
-    }
-
-    regislex_db_context_t* db = NULL;
-
-    /* Build query with filters */
-    char sql[4096];
-    char where_clause[2048] = "";
-    char order_clause[256] = "ORDER BY created_at DESC";
-    int param_idx = 1;
-
-    strcpy(sql,
-        "SELECT id, case_number, title, short_title, description, type, status, priority, outcome,"
-        "  court_name, court_division, docket_number, internal_reference, client_reference,"
-        "  estimated_value, settlement_amount, filed_date, trial_date, closed_date,"
-        "  statute_of_limitations, lead_attorney_id, assigned_to_id, parent_case_id,"
-        "  tags, created_at, updated_at, created_by, updated_by "
-        "FROM cases");
-
-    /* Apply filters */
-    if (filter) {
-        int first_filter = 1;
-
-        if (filter->case_number) {
-            strcat(where_clause, first_filter ? " WHERE " : " AND ");
-            strcat(where_clause, "case_number = ?");
-            first_filter = 0;
-        }
-
-        if (filter->title_contains) {
-            strcat(where_clause, first_filter ? " WHERE " : " AND ");
-            strcat(where_clause, "title LIKE ?");
-            first_filter = 0;
-        }
-
-        if (filter->status) {
-            strcat(where_clause, first_filter ? " WHERE " : " AND ");
-            strcat(where_clause, "status = ?");
-            first_filter = 0;
-        }
-
-        if (filter->type) {
-            strcat(where_clause, first_filter ? " WHERE " : " AND ");
-            strcat(where_clause, "type = ?");
-            first_filter = 0;
-        }
-
-        if (filter->assigned_to_id) {
-            strcat(where_clause, first_filter ? " WHERE " : " AND ");
-            strcat(where_clause, "assigned_to_id = ?");
-            first_filter = 0;
-        }
-
-        if (filter->order_by) {
-            snprintf(order_clause, sizeof(order_clause), "ORDER BY %s %s",
-                    filter->order_by, filter->order_desc ? "DESC" : "ASC");
-        }
-    }
-
-    strcat(sql, where_clause);
-    strcat(sql, " ");
-    strcat(sql, order_clause);
-
-    /* Add pagination */
-    int limit = (filter && filter->limit > 0) ? filter->limit : 100;
-    int offset = (filter && filter->offset > 0) ? filter->offset : 0;
-    char pagination[64];
-    snprintf(pagination, sizeof(pagination), " LIMIT %d OFFSET %d", limit, offset);
-    strcat(sql, pagination);
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
-    /* Execute query */
     regislex_db_stmt_t* stmt = NULL;
-    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    regislex_error_t err = case_query_prepare(db, filter, 100, &stmt);
     if (err != REGISLEX_OK) {
         return err;
     }
 
-    /* Bind filter parameters */
-    if (filter) {
-        if (filter->case_number) {
-            regislex_db_bind_text(stmt, param_idx++, filter->case_number);
-        }
-        if (filter->title_contains) {
-            char like_pattern[512];
-            snprintf(like_pattern, sizeof(like_pattern), "%%%s%%", filter->title_contains);
-            regislex_db_bind_text(stmt, param_idx++, like_pattern);
-        }
-        if (filter->status) {
-            regislex_db_bind_int(stmt, param_idx++, *filter->status);
-        }
-        if (filter->type) {
-            regislex_db_bind_int(stmt, param_idx++, *filter->type);
-        }
-        if (filter->assigned_to_id) {
-            regislex_db_bind_uuid(stmt, param_idx++, filter->assigned_to_id);
-        }
+    regislex_case_list_t* list = NULL;
+    err = case_list_from_stmt(stmt, &list);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_OK) {
+        return err;
     }
 
-    /* Allocate result list */
-    regislex_case_list_t* list = (regislex_case_list_t*)platform_calloc(1, sizeof(regislex_case_list_t));
-    if (!list) {
-        regislex_db_finalize(stmt);
-        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    list->offset = (filter && filter->offset > 0) ? filter->offset : 0;
+    list->limit = (filter && filter->limit > 0) ? filter->limit : 100;
+
+    *out_list = list;
+    return REGISLEX_OK;
+}
+
+/* ============================================================================
+ * Streaming Case Queries
+ * ============================================================================ */
+
+struct regislex_case_cursor {
+    regislex_db_stmt_t* stmt;
+    regislex_case_t row;        /* Reused for every row */
+};
+
+REGISLEX_API regislex_error_t regislex_case_cursor_open(
+    regislex_context_t* ctx,
+    const regislex_case_filter_t* filter,
+    regislex_case_cursor_t** out_cursor)
+{
+    if (!ctx || !out_cursor) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    /* Collect results */
-    int capacity = 100;
-    list->cases = (regislex_case_t**)platform_calloc(capacity, sizeof(regislex_case_t*));
-    if (!list->cases) {
-        platform_free(list);
-        regislex_db_finalize(stmt);
+    regislex_case_cursor_t* cursor = (regislex_case_cursor_t*)platform_calloc(1, sizeof(regislex_case_cursor_t));
+    if (!cursor) {
         return REGISLEX_ERROR_OUT_OF_MEMORY;
     }
 
-    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
-        if (list->count >= capacity) {
-            capacity *= 2;
-            regislex_case_t** new_cases = (regislex_case_t**)platform_realloc(
-                list->cases, capacity * sizeof(regislex_case_t*));
-            if (!new_cases) {
-                regislex_case_list_free(list);
-                regislex_db_finalize(stmt);
-                return REGISLEX_ERROR_OUT_OF_MEMORY;
-            }
-            list->cases = new_cases;
-        }
+    regislex_error_t err = case_query_prepare(regislex_get_db(ctx), filter, -1, &cursor->stmt);
+    if (err != REGISLEX_OK) {
+        platform_free(cursor);
+        return err;
+    }
 
-        regislex_case_t* case_item = case_alloc();
-        if (!case_item) {
-            regislex_case_list_free(list);
-            regislex_db_finalize(stmt);
-            return REGISLEX_ERROR_OUT_OF_MEMORY;
-        }
+    *out_cursor = cursor;
+    return REGISLEX_OK;
+}
 
-        case_from_row(stmt, case_item);
-        list->cases[list->count++] = case_item;
+REGISLEX_API regislex_error_t regislex_case_cursor_next(
+    regislex_case_cursor_t* cursor,
+    const regislex_case_t** out_case)
+{
+    if (!cursor || !out_case) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!cursor->stmt) {
+        return REGISLEX_ERROR_NOT_FOUND;
     }
 
-    regislex_db_finalize(stmt);
+    regislex_error_t err = regislex_db_step(cursor->stmt);
+    if (err != REGISLEX_OK) {
+        /* Release the statement as soon as the result set is exhausted */
+        regislex_db_finalize(cursor->stmt);
+        cursor->stmt = NULL;
+        return err;
+    }
 
-    list->offset = offset;
-    list->limit = limit;
+    memset(&cursor->row, 0, sizeof(cursor->row));
+    case_from_row(cursor->stmt, &cursor->row);
 
-    *out_list = list;
+    *out_case = &cursor->row;
     return REGISLEX_OK;
 }
 
+REGISLEX_API void regislex_case_cursor_close(regislex_case_cursor_t* cursor) {
+    if (!cursor) return;
+
+    if (cursor->stmt) {
+        regislex_db_finalize(cursor->stmt);
+    }
+    platform_free(cursor);
+}
+
+REGISLEX_API regislex_error_t regislex_case_foreach(
+    regislex_context_t* ctx,
+    const regislex_case_filter_t* filter,
+    regislex_case_visitor_t visitor,
+    void* user_data)
+{
+    if (!ctx || !visitor) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_case_cursor_t* cursor = NULL;
+    regislex_error_t err = regislex_case_cursor_open(ctx, filter, &cursor);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    const regislex_case_t* case_item = NULL;
+    while ((err = regislex_case_cursor_next(cursor, &case_item)) == REGISLEX_OK) {
+        if (!visitor(case_item, user_data)) {
+            break;
+        }
+    }
+
+    regislex_case_cursor_close(cursor);
+    return err == REGISLEX_ERROR_NOT_FOUND ? REGISLEX_OK : err;
+}
+
 REGISLEX_API void regislex_case_free(regislex_case_t* case_ptr) {
     if (!case_ptr) return;
 
+    /* The case itself and all related records live in the arena */
+    if (case_ptr->arena) {
+        case_arena_release(case_ptr->arena);
+        return;
+    }
+
     /* Free parties if allocated */
     if (case_ptr->parties) {
         for (int i = 0; i < case_ptr->party_count; i++) {
@@ -575,13 +1383,27 @@ REGISLEX_API regislex_error_t regislex_case_change_status(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_transaction_t* tx = NULL;
+    regislex_error_t err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_caseload_key_t old_key;
+    err = caseload_key_load(db, id, &old_key);
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        return err;
+    }
 
     const char* sql = "UPDATE cases SET status = ?, updated_at = ? WHERE id = ?";
 
     regislex_db_stmt_t* stmt = NULL;
-    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    err = regislex_db_prepare(db, sql, &stmt);
     if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
         return err;
     }
 
@@ -595,10 +1417,23 @@ REGISLEX_API regislex_error_t regislex_case_change_status(
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
 
-    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+    regislex_caseload_key_t new_key = old_key;
+    new_key.status = new_status;
+    if (err == REGISLEX_ERROR_NOT_FOUND || err == REGISLEX_OK) {
+        err = caseload_change(db, &old_key, &new_key);
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
         return err;
     }
 
+    if (old_key.status != new_status) {
+        case_publish_status(ctx, id, old_key.status, new_status);
+    }
+
     return REGISLEX_OK;
 }
 
@@ -611,33 +1446,251 @@ REGISLEX_API regislex_error_t regislex_case_assign(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_transaction_t* tx = NULL;
+    regislex_error_t err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_caseload_key_t old_key;
+    err = caseload_key_load(db, case_id, &old_key);
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        return err;
+    }
 
     const char* sql = "UPDATE cases SET assigned_to_id = ?, updated_at = ? WHERE id = ?";
 
     regislex_db_stmt_t* stmt = NULL;
-    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    err = regislex_db_prepare(db, sql, &stmt);
     if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
         return err;
     }
 
     regislex_datetime_t now;
     regislex_datetime_now(&now);
 
-    regislex_db_bind_uuid(stmt, 1, user_id);
+    regislex_db_bind_uuid_ref(stmt, 1, user_id);
     regislex_db_bind_datetime(stmt, 2, &now);
     regislex_db_bind_uuid(stmt, 3, case_id);
 
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
 
-    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+    regislex_caseload_key_t new_key = old_key;
+    new_key.assigned_to_id = *user_id;
+    if (err == REGISLEX_ERROR_NOT_FOUND || err == REGISLEX_OK) {
+        err = caseload_change(db, &old_key, &new_key);
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
         return err;
     }
 
+    case_publish_assigned(ctx, case_id, user_id);
+
     return REGISLEX_OK;
 }
 
+/* ============================================================================
+ * Case Hierarchy Functions
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_case_subtree(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* root_id,
+    int max_depth,
+    regislex_case_list_t** out_list)
+{
+    if (!ctx || !root_id || !out_list) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    const char* sql =
+        "SELECT id, case_number, title, short_title, description, type, status, priority, outcome,"
+        "  court_name, court_division, docket_number, internal_reference, client_reference,"
+        "  estimated_value, settlement_amount, filed_date, trial_date, closed_date,"
+        "  statute_of_limitations, lead_attorney_id, assigned_to_id, parent_case_id,"
+        "  tags, created_at, updated_at, created_by, updated_by "
+        "FROM case_hierarchy h JOIN cases ON cases.id = h.descendant_id "
+        "WHERE h.ancestor_id = ? AND h.depth BETWEEN 1 AND ? "
+        "ORDER BY h.depth, case_number";
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_bind_uuid(stmt, 1, root_id);
+    regislex_db_bind_int(stmt, 2, max_depth > 0 ? max_depth : INT32_MAX);
+
+    err = case_list_from_stmt(stmt, out_list);
+    regislex_db_finalize(stmt);
+    return err;
+}
+
+REGISLEX_API regislex_error_t regislex_case_ancestors(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* id,
+    regislex_case_list_t** out_list)
+{
+    if (!ctx || !id || !out_list) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    const char* sql =
+        "SELECT id, case_number, title, short_title, description, type, status, priority, outcome,"
+        "  court_name, court_division, docket_number, internal_reference, client_reference,"
+        "  estimated_value, settlement_amount, filed_date, trial_date, closed_date,"
+        "  statute_of_limitations, lead_attorney_id, assigned_to_id, parent_case_id,"
+        "  tags, created_at, updated_at, created_by, updated_by "
+        "FROM case_hierarchy h JOIN cases ON cases.id = h.ancestor_id "
+        "WHERE h.descendant_id = ? AND h.depth > 0 "
+        "ORDER BY h.depth DESC";
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_bind_uuid(stmt, 1, id);
+
+    err = case_list_from_stmt(stmt, out_list);
+    regislex_db_finalize(stmt);
+    return err;
+}
+
+REGISLEX_API regislex_error_t regislex_case_subtree_stats(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* root_id,
+    regislex_case_subtree_stats_t* stats)
+{
+    if (!ctx || !root_id || !stats) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    memset(stats, 0, sizeof(regislex_case_subtree_stats_t));
+    strcpy(stats->total_invoiced.currency, "USD");
+    strcpy(stats->total_paid.currency, "USD");
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    /* Statuses at or beyond COMPLETED count as closed */
+    const char* sql =
+        "SELECT"
+        "  (SELECT COUNT(*) FROM case_hierarchy h JOIN cases c ON c.id = h.descendant_id"
+        "   WHERE h.ancestor_id = ?1),"
+        "  (SELECT COUNT(*) FROM case_hierarchy h JOIN cases c ON c.id = h.descendant_id"
+        "   WHERE h.ancestor_id = ?1 AND c.status < ?2),"
+        "  (SELECT MAX(depth) FROM case_hierarchy WHERE ancestor_id = ?1),"
+        "  (SELECT COUNT(*) FROM case_hierarchy h JOIN deadlines d ON d.case_id = h.descendant_id"
+        "   WHERE h.ancestor_id = ?1),"
+        "  (SELECT COUNT(*) FROM case_hierarchy h JOIN deadlines d ON d.case_id = h.descendant_id"
+        "   WHERE h.ancestor_id = ?1 AND d.status < ?2),"
+        "  (SELECT COUNT(*) FROM case_hierarchy h JOIN deadlines d ON d.case_id = h.descendant_id"
+        "   WHERE h.ancestor_id = ?1 AND d.status < ?2 AND d.due_date < ?3),"
+        "  (SELECT COALESCE(SUM(i.total_amount), 0) FROM case_hierarchy h"
+        "   JOIN invoices i ON i.case_id = h.descendant_id WHERE h.ancestor_id = ?1),"
+        "  (SELECT COALESCE(SUM(i.amount_paid), 0) FROM case_hierarchy h"
+        "   JOIN invoices i ON i.case_id = h.descendant_id WHERE h.ancestor_id = ?1)";
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    regislex_db_bind_uuid(stmt, 1, root_id);
+    regislex_db_bind_int(stmt, 2, REGISLEX_STATUS_COMPLETED);
+    regislex_db_bind_datetime(stmt, 3, &now);
+
+    err = regislex_db_step(stmt);
+    if (err == REGISLEX_OK) {
+        int col = 0;
+        stats->case_count = (int)regislex_db_column_int(stmt, col++);
+        stats->open_case_count = (int)regislex_db_column_int(stmt, col++);
+        stats->max_depth = (int)regislex_db_column_int(stmt, col++);
+        stats->deadline_count = (int)regislex_db_column_int(stmt, col++);
+        stats->open_deadline_count = (int)regislex_db_column_int(stmt, col++);
+        stats->overdue_deadline_count = (int)regislex_db_column_int(stmt, col++);
+        stats->total_invoiced.amount = regislex_db_column_int(stmt, col++);
+        stats->total_paid.amount = regislex_db_column_int(stmt, col++);
+    }
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    return stats->case_count > 0 ? REGISLEX_OK : REGISLEX_ERROR_NOT_FOUND;
+}
+
+/* ============================================================================
+ * Case Metadata Functions
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_case_metadata_set(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* case_id,
+    const char* key,
+    regislex_metadata_type_t type,
+    const char* value)
+{
+    if (!ctx || !case_id || !key || !value) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_metadata_t item;
+    item.key = (char*)key;
+    item.value = (char*)value;
+    item.type = type;
+
+    return regislex_db_metadata_set(regislex_get_db(ctx), "case_metadata", "case_id",
+                                    case_id, &item);
+}
+
+REGISLEX_API regislex_error_t regislex_case_metadata_get(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* case_id,
+    regislex_metadata_t** out_metadata,
+    int* out_count)
+{
+    if (!ctx || !case_id || !out_metadata || !out_count) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    return regislex_db_metadata_load(regislex_get_db(ctx), "case_metadata", "case_id",
+                                     case_id, out_metadata, out_count);
+}
+
+REGISLEX_API regislex_error_t regislex_case_metadata_delete(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* case_id,
+    const char* key)
+{
+    if (!ctx || !case_id || !key) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    return regislex_db_metadata_delete(regislex_get_db(ctx), "case_metadata", "case_id",
+                                       case_id, key);
+}
+
 /* ============================================================================
  * Party Management Functions
  * ============================================================================ */
@@ -666,7 +1719,15 @@ REGISLEX_API regislex_error_t regislex_party_add(
     regislex_datetime_now(&new_party->created_at);
     memcpy(&new_party->updated_at, &new_party->created_at, sizeof(regislex_datetime_t));
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    /* The party and its conflict keys are stored together */
+    regislex_db_transaction_t* tx = NULL;
+    regislex_error_t err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) {
+        regislex_party_free(new_party);
+        return err;
+    }
 
     const char* sql =
         "INSERT INTO parties ("
@@ -677,8 +1738,9 @@ REGISLEX_API regislex_error_t regislex_party_add(
         ") VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)";
 
     regislex_db_stmt_t* stmt = NULL;
-    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    err = regislex_db_prepare(db, sql, &stmt);
     if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
         regislex_party_free(new_party);
         return err;
     }
@@ -708,12 +1770,26 @@ REGISLEX_API regislex_error_t regislex_party_add(
 
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
+    if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
 
-    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+    /* Keep the conflict index current; the party joins it once the insert commits */
+    if (err == REGISLEX_OK) {
+        err = regislex_conflict_index_add(ctx, case_id, new_party);
+        if (err == REGISLEX_ERROR_NOT_INITIALIZED) err = REGISLEX_OK;
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
         regislex_party_free(new_party);
         return err;
     }
 
+    char data[64];
+    snprintf(data, sizeof(data), "{\"type\":%d,\"role\":%d}", new_party->type, new_party->role);
+    case_publish(ctx, REGISLEX_EVENT_PARTY_ADDED, case_id, &new_party->id, data);
+
     *out_party = new_party;
     return REGISLEX_OK;
 }
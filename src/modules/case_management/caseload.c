@@ -0,0 +1,299 @@
+/**
+ * @file caseload.c
+ * @brief Materialized Caseload Counters
+ *
+ * Case counts by status, type and assignee are kept in the case_counters
+ * table by triggers on cases, so they change in the same transaction as
+ * the case row. This module mirrors that table in memory so summaries are
+ * answered without touching SQLite.
+ */
+
+#include "regislex/regislex.h"
+#include "database/database.h"
+#include "platform/platform.h"
+#include "utils/id_map.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * Internal Structures
+ * ============================================================================ */
+
+typedef struct {
+    regislex_uuid_t user_id;
+    int count;
+} caseload_assignee_t;
+
+static platform_mutex_t* caseload_mutex = NULL;
+static int caseload_total = 0;
+static int caseload_by_status[REGISLEX_CASELOAD_STATUS_COUNT];
+static int caseload_by_type[REGISLEX_CASELOAD_TYPE_COUNT];
+static int caseload_unassigned = 0;
+static regislex_id_map_t caseload_assignees = { NULL, 0, 0, offsetof(caseload_assignee_t, user_id.value) };
+
+/* ============================================================================
+ * Assignee Counts
+ * ============================================================================ */
+
+static caseload_assignee_t* assignee_find(const char* user_id, bool create) {
+    caseload_assignee_t* a = (caseload_assignee_t*)regislex_id_map_get(&caseload_assignees, user_id);
+    if (a || !create) return a;
+
+    a = (caseload_assignee_t*)platform_calloc(1, sizeof(caseload_assignee_t));
+    if (!a) return NULL;
+
+    strncpy(a->user_id.value, user_id, sizeof(a->user_id.value) - 1);
+    if (regislex_id_map_insert(&caseload_assignees, a) != REGISLEX_OK) {
+        platform_free(a);
+        return NULL;
+    }
+    return a;
+}
+
+/* ============================================================================
+ * Mirror Maintenance
+ * ============================================================================ */
+
+static void mirror_clear(void) {
+    for (int i = 0; i < caseload_assignees.capacity; i++) {
+        platform_free(caseload_assignees.slots[i]);
+    }
+    regislex_id_map_free(&caseload_assignees);
+    caseload_total = 0;
+    caseload_unassigned = 0;
+    memset(caseload_by_status, 0, sizeof(caseload_by_status));
+    memset(caseload_by_type, 0, sizeof(caseload_by_type));
+}
+
+static void mirror_add(const regislex_caseload_key_t* key, int delta) {
+    caseload_total += delta;
+
+    if ((int)key->status >= 0 && key->status < REGISLEX_CASELOAD_STATUS_COUNT) {
+        caseload_by_status[key->status] += delta;
+    }
+    if ((int)key->type >= 0 && key->type < REGISLEX_CASELOAD_TYPE_COUNT) {
+        caseload_by_type[key->type] += delta;
+    }
+
+    if (key->assigned_to_id.value[0] == '\0') {
+        caseload_unassigned += delta;
+    } else {
+        caseload_assignee_t* a = assignee_find(key->assigned_to_id.value, true);
+        if (a) a->count += delta;
+    }
+}
+
+/* ============================================================================
+ * Counter Lifecycle
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_caseload_init(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (caseload_mutex == NULL) {
+        if (platform_mutex_create(&caseload_mutex) != PLATFORM_OK) {
+            return REGISLEX_ERROR;
+        }
+    }
+
+    return regislex_caseload_refresh(ctx);
+}
+
+REGISLEX_API void regislex_caseload_shutdown(void) {
+    if (!caseload_mutex) return;
+
+    platform_mutex_lock(caseload_mutex);
+    mirror_clear();
+    platform_mutex_unlock(caseload_mutex);
+
+    platform_mutex_destroy(caseload_mutex);
+    caseload_mutex = NULL;
+}
+
+REGISLEX_API regislex_error_t regislex_caseload_refresh(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!caseload_mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    const char* sql = "SELECT dimension, key, count FROM case_counters WHERE count != 0";
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    platform_mutex_lock(caseload_mutex);
+    mirror_clear();
+
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        const char* dimension = regislex_db_column_text(stmt, 0);
+        const char* key = regislex_db_column_text(stmt, 1);
+        int count = (int)regislex_db_column_int(stmt, 2);
+        if (!dimension || !key) continue;
+
+        /* Every case has exactly one status, so those rows give the total */
+        if (strcmp(dimension, "status") == 0) {
+            int status = atoi(key);
+            caseload_total += count;
+            if (status >= 0 && status < REGISLEX_CASELOAD_STATUS_COUNT) {
+                caseload_by_status[status] = count;
+            }
+        } else if (strcmp(dimension, "type") == 0) {
+            int type = atoi(key);
+            if (type >= 0 && type < REGISLEX_CASELOAD_TYPE_COUNT) {
+                caseload_by_type[type] = count;
+            }
+        } else if (strcmp(dimension, "assignee") == 0) {
+            if (key[0] == '\0') {
+                caseload_unassigned = count;
+            } else {
+                caseload_assignee_t* a = assignee_find(key, true);
+                if (!a) {
+                    err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                    break;
+                }
+                a->count = count;
+            }
+        }
+    }
+
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        mirror_clear();
+        platform_mutex_unlock(caseload_mutex);
+        return err;
+    }
+
+    platform_mutex_unlock(caseload_mutex);
+    return REGISLEX_OK;
+}
+
+REGISLEX_API void regislex_caseload_apply(
+    const regislex_caseload_key_t* removed,
+    const regislex_caseload_key_t* added)
+{
+    if (!caseload_mutex) return;
+
+    platform_mutex_lock(caseload_mutex);
+    if (removed) mirror_add(removed, -1);
+    if (added) mirror_add(added, 1);
+    platform_mutex_unlock(caseload_mutex);
+}
+
+/* ============================================================================
+ * Counter Queries
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_caseload_summary(
+    regislex_context_t* ctx,
+    regislex_caseload_summary_t* summary)
+{
+    if (!ctx || !summary) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!caseload_mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    platform_mutex_lock(caseload_mutex);
+
+    summary->total = caseload_total;
+    summary->unassigned = caseload_unassigned;
+    memcpy(summary->by_status, caseload_by_status, sizeof(summary->by_status));
+    memcpy(summary->by_type, caseload_by_type, sizeof(summary->by_type));
+
+    platform_mutex_unlock(caseload_mutex);
+
+    summary->open = 0;
+    for (int i = 0; i < REGISLEX_STATUS_COMPLETED; i++) {
+        summary->open += summary->by_status[i];
+    }
+
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_caseload_assignee_count(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* user_id,
+    int* count)
+{
+    if (!ctx || !user_id || !count) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!caseload_mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    platform_mutex_lock(caseload_mutex);
+
+    if (user_id->value[0] == '\0') {
+        *count = caseload_unassigned;
+    } else {
+        const caseload_assignee_t* a = assignee_find(user_id->value, false);
+        *count = a ? a->count : 0;
+    }
+
+    platform_mutex_unlock(caseload_mutex);
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_caseload_by_assignee(
+    regislex_context_t* ctx,
+    regislex_caseload_assignee_t** assignees,
+    int* count)
+{
+    if (!ctx || !assignees || !count) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!caseload_mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    *assignees = NULL;
+    *count = 0;
+
+    platform_mutex_lock(caseload_mutex);
+
+    if (caseload_assignees.used == 0) {
+        platform_mutex_unlock(caseload_mutex);
+        return REGISLEX_OK;
+    }
+
+    regislex_caseload_assignee_t* out = (regislex_caseload_assignee_t*)platform_calloc(
+        caseload_assignees.used, sizeof(regislex_caseload_assignee_t));
+    if (!out) {
+        platform_mutex_unlock(caseload_mutex);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    int n = 0;
+    for (int i = 0; i < caseload_assignees.capacity; i++) {
+        const caseload_assignee_t* a = (const caseload_assignee_t*)caseload_assignees.slots[i];
+        if (a && a->count > 0) {
+            out[n].user_id = a->user_id;
+            out[n].count = a->count;
+            n++;
+        }
+    }
+
+    platform_mutex_unlock(caseload_mutex);
+
+    *assignees = out;
+    *count = n;
+    return REGISLEX_OK;
+}
+
+REGISLEX_API void regislex_caseload_assignees_free(regislex_caseload_assignee_t* assignees) {
+    platform_free(assignees);
+}
@@ -0,0 +1,1050 @@
+/**
+ * @file conflict.c
+ * @brief Conflict-of-Interest Check Engine
+ *
+ * Maintains an in-memory trigram index over every party name so that a
+ * prospective client or adverse party can be checked against the whole
+ * caseload without scanning the parties table. The same table holds a
+ * postings list per phonetic key, so names that sound alike but share few
+ * trigrams ("Smyth" and "Smith") are still found.
+ *
+ * A party contributes one entry for its own name and one each for its
+ * attorney's name and firm when set, so a check also finds a prospective
+ * client's counsel appearing in another matter.
+ */
+
+#include "regislex/regislex.h"
+#include "database/database.h"
+#include "platform/platform.h"
+#include "utils/id_map.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define CONFLICT_PHONETIC_LENGTH   16
+#define CONFLICT_MAX_TRIGRAMS      (REGISLEX_MAX_NAME_LENGTH + 2)
+#define CONFLICT_INITIAL_BUCKETS   1024
+#define CONFLICT_PHONETIC_WEIGHT   0.15
+#define CONFLICT_PHONETIC_FLOOR    0.5
+#define CONFLICT_PHONETIC_TAG      0x80000000u  /* Trigrams never set the top byte */
+#define CONFLICT_FIELD_COUNT       3
+
+/* ============================================================================
+ * Internal Structures
+ * ============================================================================ */
+
+typedef struct {
+    regislex_uuid_t party_id;
+    regislex_uuid_t case_id;
+    regislex_conflict_field_t field;
+    char* name;             /* The indexed party, attorney or firm name */
+    char* party_name;       /* NULL when name is the party's own */
+    char* normalized;
+    char phonetic[CONFLICT_PHONETIC_LENGTH];
+    regislex_party_role_t role;
+    int trigram_count;
+    bool removed;           /* Its case was deleted; postings stay until compaction */
+} conflict_entry_t;
+
+/* Match keys of a party's names, indexed by regislex_conflict_field_t */
+typedef struct {
+    char normalized[CONFLICT_FIELD_COUNT][REGISLEX_MAX_NAME_LENGTH];
+    char phonetic[CONFLICT_FIELD_COUNT][CONFLICT_PHONETIC_LENGTH];
+} conflict_keys_t;
+
+/* A party waiting to be indexed, or keyed during a rebuild */
+typedef struct {
+    regislex_uuid_t party_id;
+    regislex_uuid_t case_id;
+    char names[CONFLICT_FIELD_COUNT][REGISLEX_MAX_NAME_LENGTH];
+    conflict_keys_t keys;
+    regislex_party_role_t role;
+} conflict_pending_t;
+
+typedef struct {
+    uint32_t trigram;       /* Trigram or phonetic key; 0 marks an empty slot */
+    int* postings;
+    int count;
+    int capacity;
+} conflict_bucket_t;
+
+typedef struct {
+    int entry;
+    double score;
+} conflict_hit_t;
+
+static platform_mutex_t* conflict_mutex = NULL;
+static conflict_entry_t* conflict_entries = NULL;
+static int conflict_entry_count = 0;
+static int conflict_entry_capacity = 0;
+static int conflict_removed_count = 0;
+static conflict_bucket_t* conflict_buckets = NULL;
+static int conflict_bucket_capacity = 0;
+static int conflict_bucket_used = 0;
+
+/* Per-check scratch, reused under conflict_mutex: shared-trigram counts by
+ * entry, all zero between checks, and the entries a check touched */
+static uint16_t* conflict_shared = NULL;
+static int* conflict_touched = NULL;
+static int conflict_scratch_capacity = 0;
+
+/* Trailing tokens that do not distinguish one organization from another */
+static const char* CORPORATE_SUFFIXES[] = {
+    "inc", "incorporated", "corp", "corporation", "co", "company",
+    "llc", "llp", "lp", "ltd", "limited", "plc", "pc", "pllc", "pa",
+    "gmbh", "ag", "sa", "nv", "bv", "lc",
+    NULL
+};
+
+/* ============================================================================
+ * Name Normalization and Keys
+ * ============================================================================ */
+
+static bool is_corporate_suffix(const char* token, size_t len) {
+    for (int i = 0; CORPORATE_SUFFIXES[i] != NULL; i++) {
+        if (strlen(CORPORATE_SUFFIXES[i]) == len &&
+            strncmp(CORPORATE_SUFFIXES[i], token, len) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+REGISLEX_API regislex_error_t regislex_conflict_normalize_name(
+    const char* name,
+    char* out,
+    size_t out_size)
+{
+    if (!name || !out || out_size == 0) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    /* Case-fold; periods and apostrophes join ("L.L.C.", "O'Brien"),
+     * any other punctuation separates words */
+    size_t len = 0;
+    bool pending_space = false;
+    for (const char* p = name; *p && len + 1 < out_size; p++) {
+        unsigned char c = (unsigned char)*p;
+        if (c == '.' || c == '\'') {
+            continue;
+        }
+        if (isalnum(c)) {
+            if (pending_space && len > 0 && len + 2 < out_size) {
+                out[len++] = ' ';
+            }
+            pending_space = false;
+            out[len++] = (char)tolower(c);
+        } else {
+            pending_space = true;
+        }
+    }
+    out[len] = '\0';
+
+    /* Drop a leading article */
+    if (strncmp(out, "the ", 4) == 0 && out[4] != '\0') {
+        memmove(out, out + 4, len - 3);
+    }
+
+    /* Strip trailing corporate suffixes, keeping at least one token */
+    for (;;) {
+        char* last_space = strrchr(out, ' ');
+        if (!last_space) break;
+
+        char* token = last_space + 1;
+        if (!is_corporate_suffix(token, strlen(token))) break;
+
+        *last_space = '\0';
+    }
+
+    return REGISLEX_OK;
+}
+
+static char soundex_code(char c) {
+    switch (c) {
+        case 'b': case 'f': case 'p': case 'v':
+            return '1';
+        case 'c': case 'g': case 'j': case 'k':
+        case 'q': case 's': case 'x': case 'z':
+            return '2';
+        case 'd': case 't':
+            return '3';
+        case 'l':
+            return '4';
+        case 'm': case 'n':
+            return '5';
+        case 'r':
+            return '6';
+        case 'h': case 'w':
+            return '-';     /* Transparent: does not separate equal codes */
+        default:
+            return '0';     /* Vowels and digits */
+    }
+}
+
+static void soundex_token(const char* token, size_t len, char* out) {
+    out[0] = (char)toupper((unsigned char)token[0]);
+    int n = 1;
+    char prev = soundex_code(token[0]);
+
+    for (size_t i = 1; i < len && n < 4; i++) {
+        char code = soundex_code(token[i]);
+        if (code == '-') continue;
+        if (code != '0' && code != prev) {
+            out[n++] = code;
+        }
+        prev = code;
+    }
+
+    while (n < 4) out[n++] = '0';
+    out[4] = '\0';
+}
+
+/* Phonetic key: Soundex of the first two significant words */
+static void phonetic_key(const char* normalized, char* out) {
+    out[0] = '\0';
+    const char* p = normalized;
+    int tokens = 0;
+
+    while (*p && tokens < 2) {
+        while (*p == ' ') p++;
+        const char* start = p;
+        while (*p && *p != ' ') p++;
+        if (p == start) break;
+
+        if (tokens > 0) strcat(out, " ");
+        soundex_token(start, (size_t)(p - start), out + strlen(out));
+        tokens++;
+    }
+}
+
+static int compare_u32(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+/* Distinct trigrams of " name ", packed as three bytes */
+static int extract_trigrams(const char* normalized, uint32_t* out) {
+    char padded[REGISLEX_MAX_NAME_LENGTH + 3];
+    snprintf(padded, sizeof(padded), " %s ", normalized);
+
+    size_t len = strlen(padded);
+    if (len < 3) return 0;
+
+    int count = 0;
+    for (size_t i = 0; i + 2 < len && count < CONFLICT_MAX_TRIGRAMS; i++) {
+        out[count++] = ((uint32_t)(unsigned char)padded[i] << 16) |
+                       ((uint32_t)(unsigned char)padded[i + 1] << 8) |
+                       (uint32_t)(unsigned char)padded[i + 2];
+    }
+
+    qsort(out, (size_t)count, sizeof(uint32_t), compare_u32);
+
+    int unique = 0;
+    for (int i = 0; i < count; i++) {
+        if (unique == 0 || out[unique - 1] != out[i]) {
+            out[unique++] = out[i];
+        }
+    }
+    return unique;
+}
+
+static void keys_compute(const char* const* names, conflict_keys_t* keys) {
+    for (int f = 0; f < CONFLICT_FIELD_COUNT; f++) {
+        regislex_conflict_normalize_name(names[f] ? names[f] : "", keys->normalized[f],
+                                         sizeof(keys->normalized[f]));
+        phonetic_key(keys->normalized[f], keys->phonetic[f]);
+    }
+}
+
+/* Bucket key of a phonetic key; distinct keys may share one, so readers
+ * compare the entry's key before treating a posting as a sound-alike */
+static uint32_t phonetic_bucket_key(const char* phonetic) {
+    return regislex_id_hash(phonetic) | CONFLICT_PHONETIC_TAG;
+}
+
+/* ============================================================================
+ * Trigram Hash Table
+ * ============================================================================ */
+
+static uint32_t trigram_hash(uint32_t trigram) {
+    return trigram * 2654435761u;
+}
+
+static conflict_bucket_t* bucket_find(uint32_t trigram) {
+    if (!conflict_buckets) return NULL;
+
+    uint32_t mask = (uint32_t)conflict_bucket_capacity - 1;
+    uint32_t slot = trigram_hash(trigram) & mask;
+
+    while (conflict_buckets[slot].trigram != 0) {
+        if (conflict_buckets[slot].trigram == trigram) {
+            return &conflict_buckets[slot];
+        }
+        slot = (slot + 1) & mask;
+    }
+    return NULL;
+}
+
+static regislex_error_t buckets_grow(void) {
+    int new_capacity = conflict_bucket_capacity ? conflict_bucket_capacity * 2
+                                                : CONFLICT_INITIAL_BUCKETS;
+    conflict_bucket_t* new_buckets = (conflict_bucket_t*)platform_calloc(
+        (size_t)new_capacity, sizeof(conflict_bucket_t));
+    if (!new_buckets) return REGISLEX_ERROR_OUT_OF_MEMORY;
+
+    uint32_t mask = (uint32_t)new_capacity - 1;
+    for (int i = 0; i < conflict_bucket_capacity; i++) {
+        if (conflict_buckets[i].trigram == 0) continue;
+        uint32_t slot = trigram_hash(conflict_buckets[i].trigram) & mask;
+        while (new_buckets[slot].trigram != 0) {
+            slot = (slot + 1) & mask;
+        }
+        new_buckets[slot] = conflict_buckets[i];
+    }
+
+    platform_free(conflict_buckets);
+    conflict_buckets = new_buckets;
+    conflict_bucket_capacity = new_capacity;
+    return REGISLEX_OK;
+}
+
+static regislex_error_t bucket_append(uint32_t trigram, int entry) {
+    conflict_bucket_t* bucket = bucket_find(trigram);
+
+    if (!bucket) {
+        /* Keep load factor under 0.7 */
+        if ((conflict_bucket_used + 1) * 10 >= conflict_bucket_capacity * 7) {
+            regislex_error_t err = buckets_grow();
+            if (err != REGISLEX_OK) return err;
+        }
+
+        uint32_t mask = (uint32_t)conflict_bucket_capacity - 1;
+        uint32_t slot = trigram_hash(trigram) & mask;
+        while (conflict_buckets[slot].trigram != 0) {
+            slot = (slot + 1) & mask;
+        }
+        bucket = &conflict_buckets[slot];
+        bucket->trigram = trigram;
+        conflict_bucket_used++;
+    }
+
+    if (bucket->count >= bucket->capacity) {
+        int new_capacity = bucket->capacity ? bucket->capacity * 2 : 4;
+        int* postings = (int*)platform_realloc(bucket->postings,
+                                               (size_t)new_capacity * sizeof(int));
+        if (!postings) return REGISLEX_ERROR_OUT_OF_MEMORY;
+        bucket->postings = postings;
+        bucket->capacity = new_capacity;
+    }
+
+    bucket->postings[bucket->count++] = entry;
+    return REGISLEX_OK;
+}
+
+/* Undo the latest bucket_append for a key */
+static void bucket_pop(uint32_t trigram) {
+    conflict_bucket_t* bucket = bucket_find(trigram);
+    if (bucket && bucket->count > 0) {
+        bucket->count--;
+    }
+}
+
+static void entry_release(conflict_entry_t* entry) {
+    platform_free(entry->name);
+    platform_free(entry->party_name);
+    platform_free(entry->normalized);
+}
+
+/* Trigram keys of an entry, then its phonetic key; returns the key count */
+static int entry_keys(const conflict_entry_t* entry, uint32_t* keys) {
+    int key_count = extract_trigrams(entry->normalized, keys);
+    if (entry->phonetic[0] != '\0') {
+        keys[key_count++] = phonetic_bucket_key(entry->phonetic);
+    }
+    return key_count;
+}
+
+static void index_clear(void) {
+    for (int i = 0; i < conflict_entry_count; i++) {
+        entry_release(&conflict_entries[i]);
+    }
+    platform_free(conflict_entries);
+    conflict_entries = NULL;
+    conflict_entry_count = 0;
+    conflict_entry_capacity = 0;
+    conflict_removed_count = 0;
+
+    for (int i = 0; i < conflict_bucket_capacity; i++) {
+        platform_free(conflict_buckets[i].postings);
+    }
+    platform_free(conflict_buckets);
+    conflict_buckets = NULL;
+    conflict_bucket_capacity = 0;
+    conflict_bucket_used = 0;
+}
+
+/* Caller holds conflict_mutex */
+static regislex_error_t entry_insert(const regislex_uuid_t* party_id,
+                                     const regislex_uuid_t* case_id,
+                                     regislex_conflict_field_t field,
+                                     const char* name,
+                                     const char* party_name,
+                                     const char* normalized,
+                                     const char* phonetic,
+                                     regislex_party_role_t role) {
+    if (conflict_entry_count >= conflict_entry_capacity) {
+        int new_capacity = conflict_entry_capacity ? conflict_entry_capacity * 2 : 256;
+        conflict_entry_t* entries = (conflict_entry_t*)platform_realloc(
+            conflict_entries, (size_t)new_capacity * sizeof(conflict_entry_t));
+        if (!entries) return REGISLEX_ERROR_OUT_OF_MEMORY;
+        conflict_entries = entries;
+        conflict_entry_capacity = new_capacity;
+    }
+
+    conflict_entry_t* entry = &conflict_entries[conflict_entry_count];
+    memset(entry, 0, sizeof(conflict_entry_t));
+    memcpy(&entry->party_id, party_id, sizeof(regislex_uuid_t));
+    memcpy(&entry->case_id, case_id, sizeof(regislex_uuid_t));
+    strncpy(entry->phonetic, phonetic, sizeof(entry->phonetic) - 1);
+    entry->field = field;
+    entry->role = role;
+    entry->name = platform_strdup(name);
+    entry->party_name = field != REGISLEX_CONFLICT_FIELD_NAME ? platform_strdup(party_name) : NULL;
+    entry->normalized = platform_strdup(normalized);
+    if (!entry->name || !entry->normalized ||
+        (field != REGISLEX_CONFLICT_FIELD_NAME && !entry->party_name)) {
+        entry_release(entry);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* Trigram postings, then the phonetic posting */
+    uint32_t keys[CONFLICT_MAX_TRIGRAMS + 1];
+    int key_count = entry_keys(entry, keys);
+    entry->trigram_count = key_count - (entry->phonetic[0] != '\0');
+
+    /* A failed append leaves no postings behind for the unused entry slot */
+    int index = conflict_entry_count;
+    for (int i = 0; i < key_count; i++) {
+        regislex_error_t err = bucket_append(keys[i], index);
+        if (err != REGISLEX_OK) {
+            while (i-- > 0) {
+                bucket_pop(keys[i]);
+            }
+            entry_release(entry);
+            return err;
+        }
+    }
+
+    conflict_entry_count++;
+    return REGISLEX_OK;
+}
+
+/* Drop the latest entry and its postings; caller holds conflict_mutex */
+static void entry_pop(void) {
+    conflict_entry_t* entry = &conflict_entries[conflict_entry_count - 1];
+    uint32_t keys[CONFLICT_MAX_TRIGRAMS + 1];
+    int key_count = entry_keys(entry, keys);
+    for (int i = 0; i < key_count; i++) {
+        bucket_pop(keys[i]);
+    }
+    entry_release(entry);
+    conflict_entry_count--;
+}
+
+/*
+ * Drop removed entries and renumber the postings of the rest, keeping their
+ * order. Without memory for the renumbering the removed entries stay
+ * marked, which readers skip. Caller holds conflict_mutex.
+ */
+static void index_compact(void) {
+    int* remap = (int*)platform_malloc((size_t)conflict_entry_count * sizeof(int));
+    if (!remap) return;
+
+    int live = 0;
+    for (int i = 0; i < conflict_entry_count; i++) {
+        if (conflict_entries[i].removed) {
+            remap[i] = -1;
+            continue;
+        }
+        remap[i] = live;
+        conflict_entries[live++] = conflict_entries[i];
+    }
+
+    for (int b = 0; b < conflict_bucket_capacity; b++) {
+        conflict_bucket_t* bucket = &conflict_buckets[b];
+        if (bucket->trigram == 0) continue;
+
+        int kept = 0;
+        for (int p = 0; p < bucket->count; p++) {
+            int entry = remap[bucket->postings[p]];
+            if (entry >= 0) bucket->postings[kept++] = entry;
+        }
+        bucket->count = kept;
+    }
+
+    conflict_entry_count = live;
+    conflict_removed_count = 0;
+    platform_free(remap);
+}
+
+/* Caller holds conflict_mutex */
+static void index_remove_case(const regislex_uuid_t* case_id) {
+    for (int i = 0; i < conflict_entry_count; i++) {
+        conflict_entry_t* entry = &conflict_entries[i];
+        if (entry->removed || strcmp(entry->case_id.value, case_id->value) != 0) continue;
+
+        entry_release(entry);
+        entry->name = NULL;
+        entry->party_name = NULL;
+        entry->normalized = NULL;
+        entry->removed = true;
+        conflict_removed_count++;
+    }
+
+    /* Compact once removed entries make up half the index */
+    if (conflict_removed_count > 0 && conflict_removed_count * 2 >= conflict_entry_count) {
+        index_compact();
+    }
+}
+
+/*
+ * Index each of a party's names that is set; a failure leaves none of them
+ * indexed. Caller holds conflict_mutex.
+ */
+static regislex_error_t index_insert(const regislex_uuid_t* party_id,
+                                     const regislex_uuid_t* case_id,
+                                     const char* const* names,
+                                     const conflict_keys_t* keys,
+                                     regislex_party_role_t role) {
+    int inserted = 0;
+    for (int f = 0; f < CONFLICT_FIELD_COUNT; f++) {
+        if (f != REGISLEX_CONFLICT_FIELD_NAME && keys->normalized[f][0] == '\0') continue;
+
+        regislex_error_t err = entry_insert(party_id, case_id, (regislex_conflict_field_t)f,
+                                            names[f], names[REGISLEX_CONFLICT_FIELD_NAME],
+                                            keys->normalized[f], keys->phonetic[f], role);
+        if (err != REGISLEX_OK) {
+            while (inserted-- > 0) {
+                entry_pop();
+            }
+            return err;
+        }
+        inserted++;
+    }
+    return REGISLEX_OK;
+}
+
+static regislex_error_t persist_keys(regislex_db_context_t* db,
+                                     const regislex_uuid_t* party_id,
+                                     const regislex_uuid_t* case_id,
+                                     const conflict_keys_t* keys) {
+    const char* sql =
+        "INSERT OR REPLACE INTO party_conflict_keys "
+        "(party_id, case_id, normalized_name, phonetic_key, attorney_normalized,"
+        " attorney_phonetic, firm_normalized, firm_phonetic, updated_at) "
+        "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?)";
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    int idx = 1;
+    regislex_db_bind_uuid(stmt, idx++, party_id);
+    regislex_db_bind_uuid(stmt, idx++, case_id);
+    for (int f = 0; f < CONFLICT_FIELD_COUNT; f++) {
+        regislex_db_bind_text(stmt, idx++, keys->normalized[f]);
+        regislex_db_bind_text(stmt, idx++, keys->phonetic[f]);
+    }
+    regislex_db_bind_datetime(stmt, idx++, &now);
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+    return REGISLEX_OK;
+}
+
+/* ============================================================================
+ * Index Lifecycle
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_conflict_index_init(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (conflict_mutex == NULL) {
+        if (platform_mutex_create(&conflict_mutex) != PLATFORM_OK) {
+            return REGISLEX_ERROR;
+        }
+    }
+
+    return regislex_conflict_index_rebuild(ctx);
+}
+
+REGISLEX_API void regislex_conflict_index_shutdown(void) {
+    if (!conflict_mutex) return;
+
+    platform_mutex_lock(conflict_mutex);
+    index_clear();
+    platform_free(conflict_shared);
+    platform_free(conflict_touched);
+    conflict_shared = NULL;
+    conflict_touched = NULL;
+    conflict_scratch_capacity = 0;
+    platform_mutex_unlock(conflict_mutex);
+
+    platform_mutex_destroy(conflict_mutex);
+    conflict_mutex = NULL;
+}
+
+REGISLEX_API regislex_error_t regislex_conflict_index_rebuild(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!conflict_mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    const char* sql =
+        "SELECT p.id, p.case_id, p.role, p.name, p.attorney_name, p.attorney_firm,"
+        "  k.normalized_name, k.phonetic_key, k.attorney_normalized, k.attorney_phonetic,"
+        "  k.firm_normalized, k.firm_phonetic "
+        "FROM parties p LEFT JOIN party_conflict_keys k ON k.party_id = p.id";
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    platform_mutex_lock(conflict_mutex);
+    index_clear();
+
+    /* Parties keyed before the keys table, or before its attorney and firm
+     * columns, existed are keyed here and written back once the scan completes */
+    conflict_pending_t* missing = NULL;
+    int missing_count = 0;
+    int missing_capacity = 0;
+
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        regislex_uuid_t party_id;
+        regislex_uuid_t case_id;
+        regislex_db_column_uuid(stmt, 0, &party_id);
+        regislex_db_column_uuid(stmt, 1, &case_id);
+        regislex_party_role_t role = (regislex_party_role_t)regislex_db_column_int(stmt, 2);
+
+        const char* names[CONFLICT_FIELD_COUNT];
+        for (int f = 0; f < CONFLICT_FIELD_COUNT; f++) {
+            names[f] = regislex_db_column_text(stmt, 3 + f);
+            if (!names[f]) names[f] = "";
+        }
+
+        conflict_keys_t keys;
+        bool keyed = true;
+        for (int f = 0; f < CONFLICT_FIELD_COUNT && keyed; f++) {
+            keyed = !regislex_db_column_is_null(stmt, 6 + 2 * f);
+        }
+
+        if (keyed) {
+            for (int f = 0; f < CONFLICT_FIELD_COUNT; f++) {
+                const char* normalized = regislex_db_column_text(stmt, 6 + 2 * f);
+                const char* key = regislex_db_column_text(stmt, 7 + 2 * f);
+                strncpy(keys.normalized[f], normalized ? normalized : "", sizeof(keys.normalized[f]) - 1);
+                keys.normalized[f][sizeof(keys.normalized[f]) - 1] = '\0';
+                strncpy(keys.phonetic[f], key ? key : "", sizeof(keys.phonetic[f]) - 1);
+                keys.phonetic[f][sizeof(keys.phonetic[f]) - 1] = '\0';
+            }
+        } else {
+            keys_compute(names, &keys);
+        }
+
+        err = index_insert(&party_id, &case_id, names, &keys, role);
+        if (err != REGISLEX_OK) break;
+
+        if (!keyed) {
+            if (missing_count >= missing_capacity) {
+                int new_capacity = missing_capacity ? missing_capacity * 2 : 64;
+                conflict_pending_t* grown = (conflict_pending_t*)platform_realloc(
+                    missing, (size_t)new_capacity * sizeof(conflict_pending_t));
+                if (!grown) {
+                    err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                    break;
+                }
+                missing = grown;
+                missing_capacity = new_capacity;
+            }
+            conflict_pending_t* m = &missing[missing_count++];
+            m->party_id = party_id;
+            m->case_id = case_id;
+            m->keys = keys;
+        }
+    }
+
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        index_clear();
+        platform_mutex_unlock(conflict_mutex);
+        platform_free(missing);
+        return err;
+    }
+    err = REGISLEX_OK;
+
+    if (missing_count > 0) {
+        regislex_db_transaction_t* tx = NULL;
+        err = regislex_db_begin(db, &tx);
+        for (int i = 0; err == REGISLEX_OK && i < missing_count; i++) {
+            err = persist_keys(db, &missing[i].party_id, &missing[i].case_id, &missing[i].keys);
+        }
+        if (tx) {
+            if (err == REGISLEX_OK) {
+                err = regislex_db_commit(tx);
+            } else {
+                regislex_db_rollback(tx);
+            }
+        }
+    }
+
+    platform_mutex_unlock(conflict_mutex);
+    platform_free(missing);
+    return err;
+}
+
+/* Index a party whose transaction committed; the index may have shut down since */
+static void conflict_pending_insert(void* data) {
+    const conflict_pending_t* p = (const conflict_pending_t*)data;
+    if (!conflict_mutex) return;
+
+    const char* names[CONFLICT_FIELD_COUNT];
+    for (int f = 0; f < CONFLICT_FIELD_COUNT; f++) {
+        names[f] = p->names[f];
+    }
+
+    platform_mutex_lock(conflict_mutex);
+    index_insert(&p->party_id, &p->case_id, names, &p->keys, p->role);
+    platform_mutex_unlock(conflict_mutex);
+}
+
+REGISLEX_API regislex_error_t regislex_conflict_index_add(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* case_id,
+    const regislex_party_t* party)
+{
+    if (!ctx || !case_id || !party) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!conflict_mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    const char* names[CONFLICT_FIELD_COUNT];
+    names[REGISLEX_CONFLICT_FIELD_NAME] = party->name;
+    names[REGISLEX_CONFLICT_FIELD_ATTORNEY_NAME] = party->attorney_name;
+    names[REGISLEX_CONFLICT_FIELD_ATTORNEY_FIRM] = party->attorney_firm;
+
+    conflict_keys_t keys;
+    keys_compute(names, &keys);
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+    regislex_error_t err = persist_keys(db, &party->id, case_id, &keys);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    /* Inside a transaction the party joins the index once it commits */
+    if (regislex_db_in_transaction(db)) {
+        conflict_pending_t* pending = (conflict_pending_t*)platform_malloc(sizeof(conflict_pending_t));
+        if (!pending) {
+            return REGISLEX_ERROR_OUT_OF_MEMORY;
+        }
+        pending->party_id = party->id;
+        pending->case_id = *case_id;
+        for (int f = 0; f < CONFLICT_FIELD_COUNT; f++) {
+            memcpy(pending->names[f], names[f], sizeof(pending->names[f]));
+        }
+        pending->keys = keys;
+        pending->role = party->role;
+        return regislex_db_after_commit(db, conflict_pending_insert, pending);
+    }
+
+    platform_mutex_lock(conflict_mutex);
+    err = index_insert(&party->id, case_id, names, &keys, party->role);
+    platform_mutex_unlock(conflict_mutex);
+
+    return err;
+}
+
+/* Drop a deleted case's parties; the index may have shut down since */
+static void conflict_case_removed(void* data) {
+    const regislex_uuid_t* case_id = (const regislex_uuid_t*)data;
+    if (!conflict_mutex) return;
+
+    platform_mutex_lock(conflict_mutex);
+    index_remove_case(case_id);
+    platform_mutex_unlock(conflict_mutex);
+}
+
+REGISLEX_API regislex_error_t regislex_conflict_index_remove_case(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* case_id)
+{
+    if (!ctx || !case_id) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!conflict_mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    regislex_uuid_t* data = (regislex_uuid_t*)platform_malloc(sizeof(regislex_uuid_t));
+    if (!data) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    memcpy(data, case_id, sizeof(regislex_uuid_t));
+    return regislex_db_after_commit(regislex_get_db(ctx), conflict_case_removed, data);
+}
+
+/* ============================================================================
+ * Conflict Search
+ * ============================================================================ */
+
+static void hit_sift_down(conflict_hit_t* heap, int count, int i) {
+    for (;;) {
+        int smallest = i;
+        int left = 2 * i + 1;
+        int right = left + 1;
+        if (left < count && heap[left].score < heap[smallest].score) smallest = left;
+        if (right < count && heap[right].score < heap[smallest].score) smallest = right;
+        if (smallest == i) return;
+
+        conflict_hit_t tmp = heap[i];
+        heap[i] = heap[smallest];
+        heap[smallest] = tmp;
+        i = smallest;
+    }
+}
+
+static void hit_sift_up(conflict_hit_t* heap, int i) {
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (heap[parent].score <= heap[i].score) return;
+
+        conflict_hit_t tmp = heap[i];
+        heap[i] = heap[parent];
+        heap[parent] = tmp;
+        i = parent;
+    }
+}
+
+/* Size the check scratch to the entry count; caller holds conflict_mutex */
+static regislex_error_t scratch_reserve(void) {
+    if (conflict_entry_count <= conflict_scratch_capacity) {
+        return REGISLEX_OK;
+    }
+
+    int new_capacity = conflict_entry_capacity;
+    uint16_t* shared = (uint16_t*)platform_realloc(conflict_shared, (size_t)new_capacity * sizeof(uint16_t));
+    if (!shared) return REGISLEX_ERROR_OUT_OF_MEMORY;
+    conflict_shared = shared;
+
+    int* touched = (int*)platform_realloc(conflict_touched, (size_t)new_capacity * sizeof(int));
+    if (!touched) return REGISLEX_ERROR_OUT_OF_MEMORY;
+    conflict_touched = touched;
+
+    memset(conflict_shared + conflict_scratch_capacity, 0,
+           (size_t)(new_capacity - conflict_scratch_capacity) * sizeof(uint16_t));
+    conflict_scratch_capacity = new_capacity;
+    return REGISLEX_OK;
+}
+
+static int compare_match_desc(const void* a, const void* b) {
+    double x = ((const regislex_conflict_match_t*)a)->score;
+    double y = ((const regislex_conflict_match_t*)b)->score;
+    return (x < y) - (x > y);
+}
+
+static void load_case_context(regislex_db_context_t* db,
+                              regislex_conflict_match_t* matches,
+                              int count) {
+    regislex_db_stmt_t* stmt = NULL;
+    if (regislex_db_prepare(db, "SELECT case_number, title, status FROM cases WHERE id = ?",
+                            &stmt) != REGISLEX_OK) {
+        return;
+    }
+
+    for (int i = 0; i < count; i++) {
+        regislex_db_reset(stmt);
+        regislex_db_bind_uuid(stmt, 1, &matches[i].case_id);
+        if (regislex_db_step(stmt) != REGISLEX_OK) continue;
+
+        const char* case_number = regislex_db_column_text(stmt, 0);
+        if (case_number) strncpy(matches[i].case_number, case_number, sizeof(matches[i].case_number) - 1);
+
+        const char* title = regislex_db_column_text(stmt, 1);
+        if (title) strncpy(matches[i].case_title, title, sizeof(matches[i].case_title) - 1);
+
+        matches[i].case_status = (regislex_status_t)regislex_db_column_int(stmt, 2);
+    }
+
+    regislex_db_finalize(stmt);
+}
+
+REGISLEX_API regislex_error_t regislex_conflict_check(
+    regislex_context_t* ctx,
+    const char* name,
+    int max_results,
+    double min_score,
+    regislex_conflict_match_t** matches,
+    int* count)
+{
+    if (!ctx || !name || max_results <= 0 || !matches || !count) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!conflict_mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    *matches = NULL;
+    *count = 0;
+
+    char normalized[REGISLEX_MAX_NAME_LENGTH];
+    char phonetic[CONFLICT_PHONETIC_LENGTH];
+    regislex_conflict_normalize_name(name, normalized, sizeof(normalized));
+    if (normalized[0] == '\0') {
+        return REGISLEX_OK;
+    }
+    phonetic_key(normalized, phonetic);
+
+    uint32_t trigrams[CONFLICT_MAX_TRIGRAMS];
+    int trigram_count = extract_trigrams(normalized, trigrams);
+
+    platform_mutex_lock(conflict_mutex);
+
+    if (conflict_entry_count == 0) {
+        platform_mutex_unlock(conflict_mutex);
+        return REGISLEX_OK;
+    }
+
+    /* Count shared trigrams only for entries reachable from the query */
+    conflict_hit_t* heap = (conflict_hit_t*)platform_malloc((size_t)max_results * sizeof(conflict_hit_t));
+    if (!heap || scratch_reserve() != REGISLEX_OK) {
+        platform_mutex_unlock(conflict_mutex);
+        platform_free(heap);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    uint16_t* shared = conflict_shared;
+    int* touched = conflict_touched;
+
+    int touched_count = 0;
+    for (int t = 0; t < trigram_count; t++) {
+        const conflict_bucket_t* bucket = bucket_find(trigrams[t]);
+        if (!bucket) continue;
+        for (int p = 0; p < bucket->count; p++) {
+            int entry = bucket->postings[p];
+            if (conflict_entries[entry].removed) continue;
+            if (shared[entry]++ == 0) {
+                touched[touched_count++] = entry;
+            }
+        }
+    }
+
+    /* Sound-alikes sharing no trigram are reached through the phonetic key */
+    const conflict_bucket_t* sounds = phonetic[0] ? bucket_find(phonetic_bucket_key(phonetic)) : NULL;
+    for (int p = 0; sounds && p < sounds->count; p++) {
+        int entry = sounds->postings[p];
+        if (shared[entry] == 0 && !conflict_entries[entry].removed &&
+            strcmp(conflict_entries[entry].phonetic, phonetic) == 0) {
+            touched[touched_count++] = entry;
+        }
+    }
+
+    /* Dice coefficient over trigrams, nudged up for a phonetic match; a
+     * sound-alike never scores below CONFLICT_PHONETIC_FLOOR */
+    int heap_count = 0;
+    for (int i = 0; i < touched_count; i++) {
+        const conflict_entry_t* entry = &conflict_entries[touched[i]];
+        double dice = (2.0 * shared[touched[i]]) / (double)(trigram_count + entry->trigram_count);
+        bool sounds_alike = phonetic[0] != '\0' && strcmp(phonetic, entry->phonetic) == 0;
+
+        double score;
+        if (strcmp(normalized, entry->normalized) == 0) {
+            score = 1.0;
+        } else {
+            score = dice * (1.0 - CONFLICT_PHONETIC_WEIGHT) +
+                    (sounds_alike ? CONFLICT_PHONETIC_WEIGHT : 0.0);
+            if (sounds_alike && score < CONFLICT_PHONETIC_FLOOR) {
+                score = CONFLICT_PHONETIC_FLOOR;
+            }
+        }
+        if (score < min_score) continue;
+
+        if (heap_count < max_results) {
+            heap[heap_count].entry = touched[i];
+            heap[heap_count].score = score;
+            hit_sift_up(heap, heap_count);
+            heap_count++;
+        } else if (score > heap[0].score) {
+            heap[0].entry = touched[i];
+            heap[0].score = score;
+            hit_sift_down(heap, heap_count, 0);
+        }
+    }
+
+    regislex_conflict_match_t* results = NULL;
+    if (heap_count > 0) {
+        results = (regislex_conflict_match_t*)platform_calloc((size_t)heap_count,
+                                                              sizeof(regislex_conflict_match_t));
+    }
+
+    if (results) {
+        for (int i = 0; i < heap_count; i++) {
+            const conflict_entry_t* entry = &conflict_entries[heap[i].entry];
+            memcpy(&results[i].party_id, &entry->party_id, sizeof(regislex_uuid_t));
+            memcpy(&results[i].case_id, &entry->case_id, sizeof(regislex_uuid_t));
+            strncpy(results[i].party_name, entry->party_name ? entry->party_name : entry->name,
+                    sizeof(results[i].party_name) - 1);
+            results[i].field = entry->field;
+            strncpy(results[i].matched_name, entry->name, sizeof(results[i].matched_name) - 1);
+            results[i].role = entry->role;
+            results[i].score = heap[i].score;
+            results[i].phonetic_match = phonetic[0] != '\0' &&
+                                        strcmp(phonetic, entry->phonetic) == 0;
+        }
+    }
+
+    /* Leave the counts zeroed for the next check */
+    for (int i = 0; i < touched_count; i++) {
+        shared[touched[i]] = 0;
+    }
+
+    platform_mutex_unlock(conflict_mutex);
+    platform_free(heap);
+
+    if (heap_count > 0 && !results) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    if (results) {
+        qsort(results, (size_t)heap_count, sizeof(regislex_conflict_match_t), compare_match_desc);
+        load_case_context(regislex_get_db(ctx), results, heap_count);
+    }
+
+    *matches = results;
+    *count = heap_count;
+    return REGISLEX_OK;
+}
+
+REGISLEX_API void regislex_conflict_matches_free(regislex_conflict_match_t* matches) {
+    platform_free(matches);
+}
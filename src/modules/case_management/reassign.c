@@ -0,0 +1,529 @@
+/**
+ * @file reassign.c
+ * @brief Bulk Reassignment of Open Work
+ *
+ * Moves a departing user's open cases, tasks, deadlines and reminders to
+ * one or more users. Work item IDs are collected up front, then updated in
+ * fixed-size transactions through one prepared statement per table.
+ */
+
+#include "regislex/regislex.h"
+#include "database/database.h"
+#include "platform/platform.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define REASSIGN_DEFAULT_BATCH  500
+
+/* ============================================================================
+ * Internal Structures
+ * ============================================================================ */
+
+typedef struct {
+    regislex_uuid_t id;
+    regislex_uuid_t owner_id;   /* Case of a task/deadline, deadline of a reminder */
+    regislex_status_t status;   /* Cases only: caseload counter dimensions */
+    regislex_case_type_t type;
+} reassign_item_t;
+
+/* Item ID to the target it was given, sorted by ID for lookup */
+typedef struct {
+    regislex_uuid_t id;
+    int target;
+} reassign_map_entry_t;
+
+typedef struct {
+    const regislex_reassign_target_t* targets;
+    int target_count;
+    bool weighted;
+    int total_weight;
+    int* current;               /* Smooth weighted round-robin state */
+    int next;                   /* Plain round-robin position */
+} reassign_balancer_t;
+
+/* Table a batch updates, which decides the caches to bring up to date */
+typedef enum {
+    REASSIGN_CASES = 0,
+    REASSIGN_TASKS,
+    REASSIGN_DEADLINES,
+    REASSIGN_REMINDERS
+} reassign_kind_t;
+
+typedef struct {
+    regislex_context_t* ctx;
+    regislex_db_context_t* db;
+    regislex_uuid_t from_user_id;
+    reassign_balancer_t balancer;
+    int batch_size;
+    regislex_reassign_progress_t progress;
+    void* user_data;
+    int done;
+    int total;
+    bool stopped;
+} reassign_run_t;
+
+/* ============================================================================
+ * Balancing
+ * ============================================================================ */
+
+static int balancer_next(reassign_balancer_t* b) {
+    if (!b->weighted) {
+        int chosen = b->next;
+        b->next = (b->next + 1) % b->target_count;
+        return chosen;
+    }
+
+    /* Smooth weighted round-robin: interleaves picks in proportion to weight */
+    int best = 0;
+    for (int i = 0; i < b->target_count; i++) {
+        b->current[i] += b->targets[i].weight;
+        if (b->current[i] > b->current[best]) {
+            best = i;
+        }
+    }
+    b->current[best] -= b->total_weight;
+    return best;
+}
+
+static int compare_map_entry(const void* a, const void* b) {
+    return strcmp(((const reassign_map_entry_t*)a)->id.value,
+                  ((const reassign_map_entry_t*)b)->id.value);
+}
+
+static int map_lookup(const reassign_map_entry_t* map, int count, const regislex_uuid_t* id) {
+    if (!map || count == 0 || id->value[0] == '\0') {
+        return -1;
+    }
+
+    reassign_map_entry_t key;
+    key.id = *id;
+    const reassign_map_entry_t* found = (const reassign_map_entry_t*)bsearch(
+        &key, map, count, sizeof(reassign_map_entry_t), compare_map_entry);
+    return found ? found->target : -1;
+}
+
+/* ============================================================================
+ * In-Memory Index Sync
+ * ============================================================================ */
+
+/* Caseload keys of the cases moved by one batch, applied once it commits */
+typedef struct {
+    regislex_uuid_t from_user_id;
+    int count;
+    regislex_caseload_key_t added[];
+} reassign_caseload_t;
+
+/* Caches rebuilt once the last batch commits */
+typedef struct {
+    regislex_context_t* ctx;
+    bool schedule;
+    bool agenda;
+} reassign_refresh_t;
+
+/* Move the batch's cases from the departing user to their new assignee in
+ * the caseload counters; the keys were collected with the rows, so nothing
+ * is read back. */
+static void reassign_caseload_run(void* data) {
+    const reassign_caseload_t* moved = (const reassign_caseload_t*)data;
+
+    for (int i = 0; i < moved->count; i++) {
+        regislex_caseload_key_t removed = moved->added[i];
+        removed.assigned_to_id = moved->from_user_id;
+        regislex_caseload_apply(&removed, &moved->added[i]);
+    }
+}
+
+/* Bring the per-assignee schedule and the agendas up to date in one pass
+ * over the database. Calendar feeds need nothing here: the deadlines
+ * triggers log the move in calendar_feed_log and the render cache is keyed
+ * by that sequence number. */
+static void reassign_refresh_run(void* data) {
+    const reassign_refresh_t* refresh = (const reassign_refresh_t*)data;
+
+    if (refresh->schedule) {
+        regislex_schedule_rebuild(refresh->ctx);
+    }
+    if (refresh->agenda) {
+        regislex_agenda_rebuild(refresh->ctx);
+    }
+}
+
+/* ============================================================================
+ * Collection and Batched Updates
+ * ============================================================================ */
+
+/* Run a query selecting (id, owner_id) bound to the departing user, plus
+ * (status, type) when case_keys is set */
+static regislex_error_t collect_items(regislex_db_context_t* db,
+                                      const char* sql,
+                                      bool case_keys,
+                                      const regislex_uuid_t* from_user_id,
+                                      reassign_item_t** out_items,
+                                      int* out_count) {
+    *out_items = NULL;
+    *out_count = 0;
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_bind_uuid(stmt, 1, from_user_id);
+
+    reassign_item_t* items = NULL;
+    int count = 0;
+    int capacity = 0;
+
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        if (count >= capacity) {
+            int new_capacity = capacity ? capacity * 2 : 256;
+            reassign_item_t* grown = (reassign_item_t*)platform_realloc(
+                items, (size_t)new_capacity * sizeof(reassign_item_t));
+            if (!grown) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            items = grown;
+            capacity = new_capacity;
+        }
+
+        memset(&items[count], 0, sizeof(reassign_item_t));
+        regislex_db_column_uuid(stmt, 0, &items[count].id);
+        regislex_db_column_uuid(stmt, 1, &items[count].owner_id);
+        if (case_keys) {
+            items[count].status = (regislex_status_t)regislex_db_column_int(stmt, 2);
+            items[count].type = (regislex_case_type_t)regislex_db_column_int(stmt, 3);
+        }
+        count++;
+    }
+
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        platform_free(items);
+        return err;
+    }
+
+    *out_items = items;
+    *out_count = count;
+    return REGISLEX_OK;
+}
+
+/*
+ * Update items in batches. The update statement takes (?1 new user, ?2 now,
+ * ?3 item id, ?4 departing user) and only matches a row that is still open
+ * and still assigned to the departing user, so work closed or moved since
+ * collection is skipped. Items whose owner appears in follow_map go to the
+ * owner's target; the rest are balanced. When out_map is given it receives
+ * the target of every moved item, sorted for map_lookup. A batch of cases
+ * queues reassign_caseload_run, so the counters move with the commit.
+ */
+static regislex_error_t apply_batches(reassign_run_t* run,
+                                      reassign_kind_t kind,
+                                      const char* update_sql,
+                                      const reassign_item_t* items,
+                                      int count,
+                                      const reassign_map_entry_t* follow_map,
+                                      int follow_count,
+                                      reassign_map_entry_t** out_map,
+                                      int* updated) {
+    *updated = 0;
+    if (out_map) *out_map = NULL;
+    if (count == 0 || run->stopped) {
+        return REGISLEX_OK;
+    }
+
+    reassign_map_entry_t* map = NULL;
+    if (out_map) {
+        map = (reassign_map_entry_t*)platform_calloc(count, sizeof(reassign_map_entry_t));
+        if (!map) {
+            return REGISLEX_ERROR_OUT_OF_MEMORY;
+        }
+    }
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(run->db, update_sql, &stmt);
+    if (err != REGISLEX_OK) {
+        platform_free(map);
+        return err;
+    }
+
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    int i = 0;
+    int mapped = 0;
+    while (i < count && err == REGISLEX_OK) {
+        regislex_db_transaction_t* tx = NULL;
+        err = regislex_db_begin(run->db, &tx);
+        if (err != REGISLEX_OK) {
+            break;
+        }
+
+        int end = i + run->batch_size < count ? i + run->batch_size : count;
+        int batch_start = i;
+        int batch_mapped = mapped;
+        int batch_updated = 0;
+
+        reassign_caseload_t* moved = NULL;
+        if (kind == REASSIGN_CASES) {
+            moved = (reassign_caseload_t*)platform_malloc(
+                sizeof(reassign_caseload_t) +
+                (size_t)(end - batch_start) * sizeof(regislex_caseload_key_t));
+            if (!moved) {
+                regislex_db_rollback(tx);
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            moved->from_user_id = run->from_user_id;
+            moved->count = 0;
+        }
+
+        for (; i < end; i++) {
+            int target = map_lookup(follow_map, follow_count, &items[i].owner_id);
+            if (target < 0) {
+                target = balancer_next(&run->balancer);
+            }
+
+            regislex_db_reset(stmt);
+            regislex_db_bind_uuid(stmt, 1, &run->balancer.targets[target].user_id);
+            regislex_db_bind_datetime(stmt, 2, &now);
+            regislex_db_bind_uuid(stmt, 3, &items[i].id);
+            regislex_db_bind_uuid(stmt, 4, &run->from_user_id);
+
+            err = regislex_db_step(stmt);
+            if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+                break;
+            }
+            err = REGISLEX_OK;
+
+            /* Closed or reassigned by someone else since collection */
+            if (regislex_db_changes(run->db) != 1) {
+                continue;
+            }
+            batch_updated++;
+
+            if (moved) {
+                regislex_caseload_key_t* key = &moved->added[moved->count++];
+                key->status = items[i].status;
+                key->type = items[i].type;
+                key->assigned_to_id = run->balancer.targets[target].user_id;
+            }
+
+            if (map) {
+                map[mapped].id = items[i].id;
+                map[mapped].target = target;
+                mapped++;
+            }
+        }
+
+        if (err == REGISLEX_OK && moved) {
+            err = regislex_db_after_commit(run->db, reassign_caseload_run, moved);
+        } else {
+            platform_free(moved);
+        }
+        if (err == REGISLEX_OK) {
+            err = regislex_db_commit(tx);
+        }
+        if (err != REGISLEX_OK) {
+            regislex_db_rollback(tx);
+            mapped = batch_mapped;
+            break;
+        }
+
+        *updated += batch_updated;
+        run->done += end - batch_start;
+
+        if (run->progress && !run->progress(run->done, run->total, run->user_data)) {
+            run->stopped = true;
+            break;
+        }
+    }
+
+    regislex_db_finalize(stmt);
+
+    if (map) {
+        /* Only committed rows are recorded */
+        qsort(map, mapped, sizeof(reassign_map_entry_t), compare_map_entry);
+        *out_map = map;
+    }
+
+    return err;
+}
+
+/* ============================================================================
+ * Bulk Reassignment Functions
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_reassign_open_work(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* from_user_id,
+    const regislex_reassign_target_t* targets,
+    int target_count,
+    const regislex_reassign_options_t* options,
+    regislex_reassign_result_t* result)
+{
+    if (!ctx || !from_user_id || from_user_id->value[0] == '\0' ||
+        !targets || target_count <= 0) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_reassign_options_t defaults;
+    memset(&defaults, 0, sizeof(defaults));
+    if (!options) {
+        options = &defaults;
+    }
+
+    reassign_run_t run;
+    memset(&run, 0, sizeof(run));
+    run.ctx = ctx;
+    run.db = regislex_get_db(ctx);
+    run.from_user_id = *from_user_id;
+    run.batch_size = options->batch_size > 0 ? options->batch_size : REASSIGN_DEFAULT_BATCH;
+    run.progress = options->progress;
+    run.user_data = options->user_data;
+    run.balancer.targets = targets;
+    run.balancer.target_count = target_count;
+    run.balancer.weighted = options->strategy == REGISLEX_REASSIGN_WEIGHTED;
+
+    for (int i = 0; i < target_count; i++) {
+        if (targets[i].user_id.value[0] == '\0' ||
+            strcmp(targets[i].user_id.value, from_user_id->value) == 0) {
+            return REGISLEX_ERROR_INVALID_ARGUMENT;
+        }
+        if (run.balancer.weighted) {
+            if (targets[i].weight <= 0) {
+                return REGISLEX_ERROR_INVALID_ARGUMENT;
+            }
+            run.balancer.total_weight += targets[i].weight;
+        }
+    }
+
+    if (run.balancer.weighted) {
+        run.balancer.current = (int*)platform_calloc(target_count, sizeof(int));
+        if (!run.balancer.current) {
+            return REGISLEX_ERROR_OUT_OF_MEMORY;
+        }
+    }
+
+    reassign_item_t* cases = NULL;
+    reassign_item_t* tasks = NULL;
+    reassign_item_t* deadlines = NULL;
+    reassign_item_t* reminders = NULL;
+    int case_count = 0, task_count = 0, deadline_count = 0, reminder_count = 0;
+    reassign_map_entry_t* case_map = NULL;
+    reassign_map_entry_t* deadline_map = NULL;
+
+    regislex_reassign_result_t counts;
+    memset(&counts, 0, sizeof(counts));
+
+    /* Open work only: statuses before COMPLETED for cases and deadlines,
+     * anything not finished for tasks, unsent active reminders */
+    char case_sql[256];
+    snprintf(case_sql, sizeof(case_sql),
+             "SELECT id, NULL, status, type FROM cases WHERE assigned_to_id = ? AND status < %d",
+             REGISLEX_STATUS_COMPLETED);
+
+    char task_sql[256];
+    snprintf(task_sql, sizeof(task_sql),
+             "SELECT id, case_id FROM tasks WHERE assigned_to_id = ? AND status NOT IN (%d, %d, %d)",
+             REGISLEX_TASK_COMPLETED, REGISLEX_TASK_CANCELLED, REGISLEX_TASK_FAILED);
+
+    char deadline_sql[256];
+    snprintf(deadline_sql, sizeof(deadline_sql),
+             "SELECT id, case_id FROM deadlines WHERE assigned_to_id = ? AND status < %d",
+             REGISLEX_STATUS_COMPLETED);
+
+    const char* reminder_sql =
+        "SELECT id, deadline_id FROM reminders WHERE user_id = ? AND is_sent = 0 AND is_active = 1";
+
+    /* The updates repeat the open-work filter against the departing user */
+    char case_update[256];
+    snprintf(case_update, sizeof(case_update),
+             "UPDATE cases SET assigned_to_id = ?1, updated_at = ?2"
+             " WHERE id = ?3 AND assigned_to_id = ?4 AND status < %d",
+             REGISLEX_STATUS_COMPLETED);
+
+    char task_update[256];
+    snprintf(task_update, sizeof(task_update),
+             "UPDATE tasks SET assigned_to_id = ?1, updated_at = ?2"
+             " WHERE id = ?3 AND assigned_to_id = ?4 AND status NOT IN (%d, %d, %d)",
+             REGISLEX_TASK_COMPLETED, REGISLEX_TASK_CANCELLED, REGISLEX_TASK_FAILED);
+
+    char deadline_update[256];
+    snprintf(deadline_update, sizeof(deadline_update),
+             "UPDATE deadlines SET assigned_to_id = ?1, updated_at = ?2"
+             " WHERE id = ?3 AND assigned_to_id = ?4 AND status < %d",
+             REGISLEX_STATUS_COMPLETED);
+
+    /* The reminders table has no updated_at, so ?2 is left unused */
+    const char* reminder_update =
+        "UPDATE reminders SET user_id = ?1"
+        " WHERE id = ?3 AND user_id = ?4 AND is_sent = 0 AND is_active = 1";
+
+    regislex_error_t err = collect_items(run.db, case_sql, true, from_user_id, &cases, &case_count);
+    if (err == REGISLEX_OK) {
+        err = collect_items(run.db, task_sql, false, from_user_id, &tasks, &task_count);
+    }
+    if (err == REGISLEX_OK) {
+        err = collect_items(run.db, deadline_sql, false, from_user_id, &deadlines, &deadline_count);
+    }
+    if (err == REGISLEX_OK) {
+        err = collect_items(run.db, reminder_sql, false, from_user_id, &reminders, &reminder_count);
+    }
+
+    run.total = case_count + task_count + deadline_count + reminder_count;
+
+    if (err == REGISLEX_OK) {
+        err = apply_batches(&run, REASSIGN_CASES, case_update,
+            cases, case_count, NULL, 0,
+            options->follow_case ? &case_map : NULL, &counts.cases);
+    }
+
+    int follow_count = case_map ? counts.cases : 0;
+
+    if (err == REGISLEX_OK) {
+        err = apply_batches(&run, REASSIGN_TASKS, task_update,
+            tasks, task_count, case_map, follow_count, NULL, &counts.tasks);
+    }
+    if (err == REGISLEX_OK) {
+        err = apply_batches(&run, REASSIGN_DEADLINES, deadline_update,
+            deadlines, deadline_count, case_map, follow_count, &deadline_map, &counts.deadlines);
+    }
+    if (err == REGISLEX_OK) {
+        /* Reminders follow their deadline */
+        err = apply_batches(&run, REASSIGN_REMINDERS, reminder_update,
+            reminders, reminder_count, deadline_map, counts.deadlines, NULL, &counts.reminders);
+    }
+
+    counts.stopped = run.stopped;
+
+    /* Committed batches stay committed on error, so refresh for them too */
+    if (counts.tasks > 0 || counts.deadlines > 0 || counts.reminders > 0) {
+        reassign_refresh_t* refresh = (reassign_refresh_t*)platform_malloc(sizeof(reassign_refresh_t));
+        if (refresh) {
+            refresh->ctx = ctx;
+            refresh->schedule = counts.deadlines > 0;
+            refresh->agenda = true;
+            regislex_error_t refresh_err = regislex_db_after_commit(run.db, reassign_refresh_run, refresh);
+            if (err == REGISLEX_OK) err = refresh_err;
+        } else if (err == REGISLEX_OK) {
+            err = REGISLEX_ERROR_OUT_OF_MEMORY;
+        }
+    }
+
+    platform_free(cases);
+    platform_free(tasks);
+    platform_free(deadlines);
+    platform_free(reminders);
+    platform_free(case_map);
+    platform_free(deadline_map);
+    platform_free(run.balancer.current);
+
+    if (result) {
+        *result = counts;
+    }
+    return err;
+}
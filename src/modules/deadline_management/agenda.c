@@ -0,0 +1,609 @@
+/**
+ * @file agenda.c
+ * @brief Materialized Per-User Agendas
+ *
+ * Every user's open deadlines, tasks and pending reminders are kept in
+ * one array sorted by due time, so "my next N items" is a binary search
+ * for the start time followed by a copy of N entries, with no database
+ * access. An id map finds an item's nodes, which the deadline, task and
+ * reminder write paths use to replace or drop them; a change costs one
+ * binary search plus a shift of the array tail.
+ *
+ * Recurring deadlines contribute their occurrences within a fixed horizon
+ * from the time the series was last applied. Once half of the shortest
+ * series horizon has passed, regislex_agenda_roll(), which the cron
+ * scheduler calls every minute, re-expands every series from the current
+ * time, so the horizon rolls forward with the clock and reads never touch
+ * the database.
+ */
+
+#include "regislex/regislex.h"
+#include "database/database.h"
+#include "platform/platform.h"
+#include "utils/id_map.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define AGENDA_INITIAL_ENTRIES         16
+#define AGENDA_SERIES_HORIZON_DAYS     90
+#define AGENDA_SERIES_MAX_OCCURRENCES  64
+
+/* ============================================================================
+ * Internal Structures
+ * ============================================================================ */
+
+typedef struct agenda_user agenda_user_t;
+
+typedef struct agenda_node {
+    regislex_agenda_item_t item;
+    int64_t due;                /* Epoch seconds */
+    uint64_t seq;               /* Breaks ties between equal due times */
+    agenda_user_t* user;
+    struct agenda_node* next;   /* Next node with the same id (series occurrences) */
+} agenda_node_t;
+
+struct agenda_user {
+    regislex_uuid_t user_id;
+    agenda_node_t** entries;    /* Sorted by (due, seq) */
+    int count;
+    int capacity;
+};
+
+static struct {
+    platform_mutex_t* mutex;
+    uint64_t next_seq;
+
+    regislex_id_map_t users;    /* Keyed by user id */
+    regislex_id_map_t ids;      /* Keyed by item id; chain heads */
+
+    int64_t series_refresh;     /* Epoch seconds at which series are re-expanded */
+    bool series_rolling;        /* A roll is re-expanding them */
+} agenda;
+
+/* ============================================================================
+ * Hash Maps
+ * ============================================================================ */
+
+static agenda_user_t* user_get(const regislex_uuid_t* user_id) {
+    agenda_user_t* u = (agenda_user_t*)regislex_id_map_get(&agenda.users, user_id->value);
+    if (u) return u;
+
+    u = (agenda_user_t*)platform_calloc(1, sizeof(agenda_user_t));
+    if (!u) return NULL;
+
+    u->user_id = *user_id;
+    if (regislex_id_map_insert(&agenda.users, u) != REGISLEX_OK) {
+        platform_free(u);
+        return NULL;
+    }
+    return u;
+}
+
+/* Nodes sharing an id chain off the one in the map */
+static regislex_error_t id_add(agenda_node_t* n) {
+    int slot = regislex_id_map_find(&agenda.ids, n->item.id.value);
+    if (slot >= 0) {
+        n->next = (agenda_node_t*)agenda.ids.slots[slot];
+        agenda.ids.slots[slot] = n;
+        return REGISLEX_OK;
+    }
+
+    n->next = NULL;
+    return regislex_id_map_insert(&agenda.ids, n);
+}
+
+/* ============================================================================
+ * Sorted Agendas
+ * ============================================================================ */
+
+/* First entry not ordered before (due, seq) */
+static int entry_lower_bound(const agenda_user_t* u, int64_t due, uint64_t seq) {
+    int lo = 0, hi = u->count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        const agenda_node_t* e = u->entries[mid];
+        if (e->due < due || (e->due == due && e->seq < seq)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static regislex_error_t entry_insert(agenda_user_t* u, agenda_node_t* n) {
+    if (u->count >= u->capacity) {
+        int new_capacity = u->capacity ? u->capacity * 2 : AGENDA_INITIAL_ENTRIES;
+        agenda_node_t** grown = (agenda_node_t**)platform_realloc(
+            u->entries, (size_t)new_capacity * sizeof(agenda_node_t*));
+        if (!grown) return REGISLEX_ERROR_OUT_OF_MEMORY;
+        u->entries = grown;
+        u->capacity = new_capacity;
+    }
+
+    int pos = entry_lower_bound(u, n->due, n->seq);
+    memmove(&u->entries[pos + 1], &u->entries[pos],
+            (size_t)(u->count - pos) * sizeof(agenda_node_t*));
+    u->entries[pos] = n;
+    u->count++;
+    return REGISLEX_OK;
+}
+
+static void entry_remove(agenda_node_t* n) {
+    agenda_user_t* u = n->user;
+    int pos = entry_lower_bound(u, n->due, n->seq);
+    if (pos >= u->count || u->entries[pos] != n) return;
+
+    memmove(&u->entries[pos], &u->entries[pos + 1],
+            (size_t)(u->count - pos - 1) * sizeof(agenda_node_t*));
+    u->count--;
+}
+
+/* Caller holds the mutex */
+static void index_remove(const char* id) {
+    agenda_node_t* n = (agenda_node_t*)regislex_id_map_remove(&agenda.ids, id);
+    while (n) {
+        agenda_node_t* next = n->next;
+        entry_remove(n);
+        platform_free(n);
+        n = next;
+    }
+}
+
+/* Caller holds the mutex */
+static regislex_error_t index_add(const regislex_uuid_t* user_id, const regislex_agenda_item_t* item) {
+    if (!user_id->value[0] || !regislex_datetime_is_valid_date(&item->due)) {
+        return REGISLEX_OK;
+    }
+
+    agenda_user_t* u = user_get(user_id);
+    if (!u) return REGISLEX_ERROR_OUT_OF_MEMORY;
+
+    agenda_node_t* n = (agenda_node_t*)platform_calloc(1, sizeof(agenda_node_t));
+    if (!n) return REGISLEX_ERROR_OUT_OF_MEMORY;
+
+    n->item = *item;
+    n->due = regislex_datetime_to_seconds(&item->due);
+    n->seq = agenda.next_seq++;
+    n->user = u;
+
+    regislex_error_t err = entry_insert(u, n);
+    if (err == REGISLEX_OK) {
+        err = id_add(n);
+        if (err != REGISLEX_OK) entry_remove(n);
+    }
+    if (err != REGISLEX_OK) {
+        platform_free(n);
+    }
+    return err;
+}
+
+static void index_clear(void) {
+    for (int i = 0; i < agenda.ids.capacity; i++) {
+        agenda_node_t* n = (agenda_node_t*)agenda.ids.slots[i];
+        while (n) {
+            agenda_node_t* next = n->next;
+            platform_free(n);
+            n = next;
+        }
+    }
+    for (int i = 0; i < agenda.users.capacity; i++) {
+        agenda_user_t* u = (agenda_user_t*)agenda.users.slots[i];
+        if (u) {
+            platform_free(u->entries);
+            platform_free(u);
+        }
+    }
+    regislex_id_map_free(&agenda.ids);
+    regislex_id_map_free(&agenda.users);
+
+    regislex_id_map_init(&agenda.ids, offsetof(agenda_node_t, item.id.value));
+    regislex_id_map_init(&agenda.users, offsetof(agenda_user_t, user_id.value));
+    agenda.series_refresh = INT64_MAX;
+}
+
+/* ============================================================================
+ * Item Mapping
+ * ============================================================================ */
+
+static bool deadline_open(const regislex_deadline_t* dl) {
+    return dl->status != REGISLEX_STATUS_COMPLETED && dl->status != REGISLEX_STATUS_CANCELLED;
+}
+
+static bool task_open(regislex_task_status_t status) {
+    return status != REGISLEX_TASK_COMPLETED && status != REGISLEX_TASK_CANCELLED &&
+           status != REGISLEX_TASK_FAILED;
+}
+
+static void deadline_item(const regislex_deadline_t* dl, regislex_agenda_item_t* item) {
+    memset(item, 0, sizeof(*item));
+    item->kind = REGISLEX_AGENDA_DEADLINE;
+    item->id = dl->id;
+    item->case_id = dl->case_id;
+    item->deadline_id = dl->id;
+    strncpy(item->title, dl->title, sizeof(item->title) - 1);
+    item->due = dl->due_date;
+    item->priority = dl->priority;
+}
+
+/*
+ * Occurrences are read outside the lock; the swap happens under it. A
+ * series cut off at AGENDA_SERIES_MAX_OCCURRENCES is only complete up to
+ * its last occurrence, which then serves as its horizon.
+ */
+static void series_apply(regislex_context_t* ctx, const regislex_deadline_t* series) {
+    regislex_datetime_t start, end;
+    regislex_datetime_now(&start);
+    end = start;
+    regislex_datetime_add_days(&end, AGENDA_SERIES_HORIZON_DAYS);
+
+    regislex_deadline_list_t* list = NULL;
+    if (regislex_deadline_occurrences(ctx, &series->id, &start, &end, &list) != REGISLEX_OK) {
+        list = NULL;
+    }
+
+    int64_t applied_at = regislex_datetime_to_seconds(&start);
+    int64_t horizon = regislex_datetime_to_seconds(&end);
+
+    platform_mutex_lock(agenda.mutex);
+    index_remove(series->id.value);
+    for (int i = 0; list && i < list->count; i++) {
+        const regislex_deadline_t* occ = list->deadlines[i];
+        if (i == AGENDA_SERIES_MAX_OCCURRENCES) {
+            horizon = regislex_datetime_to_seconds(&list->deadlines[i - 1]->due_date);
+            break;
+        }
+        if (!deadline_open(occ)) continue;
+
+        regislex_agenda_item_t item;
+        deadline_item(occ, &item);
+        item.id = series->id;
+        item.deadline_id = series->id;
+        if (index_add(&series->assigned_to_id, &item) != REGISLEX_OK) break;
+    }
+
+    int64_t refresh = applied_at + (horizon > applied_at ? (horizon - applied_at) / 2 : 0);
+    if (refresh < agenda.series_refresh) {
+        agenda.series_refresh = refresh;
+    }
+    platform_mutex_unlock(agenda.mutex);
+
+    regislex_deadline_list_free(list);
+}
+
+/* ============================================================================
+ * Lifecycle
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_agenda_init(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (agenda.mutex == NULL) {
+        if (platform_mutex_create(&agenda.mutex) != PLATFORM_OK) {
+            agenda.mutex = NULL;
+            return REGISLEX_ERROR;
+        }
+    }
+
+    return regislex_agenda_rebuild(ctx);
+}
+
+REGISLEX_API void regislex_agenda_shutdown(void) {
+    if (!agenda.mutex) return;
+
+    platform_mutex_lock(agenda.mutex);
+    index_clear();
+    platform_mutex_unlock(agenda.mutex);
+
+    platform_mutex_destroy(agenda.mutex);
+    agenda.mutex = NULL;
+}
+
+static regislex_error_t series_expand_all(regislex_context_t* ctx);
+
+/* Streams one item query into the index; caller holds the mutex */
+static regislex_error_t rebuild_items(regislex_db_stmt_t* stmt, regislex_agenda_kind_t kind) {
+    regislex_error_t err;
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        regislex_agenda_item_t item;
+        regislex_uuid_t user_id;
+        memset(&item, 0, sizeof(item));
+
+        item.kind = kind;
+        regislex_db_column_uuid(stmt, 0, &item.id);
+        regislex_db_column_uuid(stmt, 1, &user_id);
+        regislex_db_column_uuid(stmt, 2, kind == REGISLEX_AGENDA_REMINDER ? &item.deadline_id : &item.case_id);
+        if (kind == REGISLEX_AGENDA_DEADLINE) item.deadline_id = item.id;
+
+        const char* title = regislex_db_column_text(stmt, 3);
+        if (title) strncpy(item.title, title, sizeof(item.title) - 1);
+        regislex_db_column_datetime(stmt, 4, &item.due);
+        item.priority = (regislex_priority_t)regislex_db_column_int(stmt, 5);
+
+        err = index_add(&user_id, &item);
+        if (err != REGISLEX_OK) return err;
+    }
+    return err == REGISLEX_ERROR_NOT_FOUND ? REGISLEX_OK : err;
+}
+
+REGISLEX_API regislex_error_t regislex_agenda_rebuild(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!agenda.mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    static const struct {
+        regislex_agenda_kind_t kind;
+        const char* sql;
+    } sources[] = {
+        { REGISLEX_AGENDA_DEADLINE,
+          "SELECT id, assigned_to_id, case_id, title, due_date, priority FROM deadlines"
+          " WHERE assigned_to_id <> '' AND status NOT IN (?, ?) AND rrule IS NULL" },
+        { REGISLEX_AGENDA_TASK,
+          "SELECT id, assigned_to_id, case_id, title, due_date, priority FROM tasks"
+          " WHERE assigned_to_id <> '' AND due_date IS NOT NULL AND status NOT IN (?, ?, ?)" },
+        { REGISLEX_AGENDA_REMINDER,
+          "SELECT id, user_id, deadline_id, message, send_at, 0 FROM reminders"
+          " WHERE is_active = 1 AND is_sent = 0" },
+    };
+
+    regislex_error_t err = REGISLEX_OK;
+
+    platform_mutex_lock(agenda.mutex);
+    index_clear();
+    for (size_t s = 0; s < sizeof(sources) / sizeof(sources[0]) && err == REGISLEX_OK; s++) {
+        regislex_db_stmt_t* stmt = NULL;
+        err = regislex_db_prepare(db, sources[s].sql, &stmt);
+        if (err != REGISLEX_OK) break;
+
+        if (sources[s].kind == REGISLEX_AGENDA_DEADLINE) {
+            regislex_db_bind_int(stmt, 1, REGISLEX_STATUS_COMPLETED);
+            regislex_db_bind_int(stmt, 2, REGISLEX_STATUS_CANCELLED);
+        } else if (sources[s].kind == REGISLEX_AGENDA_TASK) {
+            regislex_db_bind_int(stmt, 1, REGISLEX_TASK_COMPLETED);
+            regislex_db_bind_int(stmt, 2, REGISLEX_TASK_CANCELLED);
+            regislex_db_bind_int(stmt, 3, REGISLEX_TASK_FAILED);
+        }
+
+        err = rebuild_items(stmt, sources[s].kind);
+        regislex_db_finalize(stmt);
+    }
+    if (err != REGISLEX_OK) {
+        index_clear();
+    }
+    platform_mutex_unlock(agenda.mutex);
+
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    return series_expand_all(ctx);
+}
+
+/* Series are expanded one by one once the row cursor is closed */
+static regislex_error_t series_expand_all(regislex_context_t* ctx) {
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(ctx),
+        "SELECT " REGISLEX_DEADLINE_COLUMNS " FROM deadlines"
+        " WHERE assigned_to_id <> '' AND status NOT IN (?, ?) AND rrule IS NOT NULL", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+    regislex_db_bind_int(stmt, 1, REGISLEX_STATUS_COMPLETED);
+    regislex_db_bind_int(stmt, 2, REGISLEX_STATUS_CANCELLED);
+
+    regislex_deadline_t* series = NULL;
+    int series_count = 0;
+    int series_capacity = 0;
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        if (series_count >= series_capacity) {
+            int new_capacity = series_capacity ? series_capacity * 2 : 16;
+            regislex_deadline_t* grown = (regislex_deadline_t*)platform_realloc(
+                series, (size_t)new_capacity * sizeof(regislex_deadline_t));
+            if (!grown) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            series = grown;
+            series_capacity = new_capacity;
+        }
+        memset(&series[series_count], 0, sizeof(regislex_deadline_t));
+        regislex_deadline_from_row(stmt, &series[series_count]);
+        series_count++;
+    }
+    regislex_db_finalize(stmt);
+
+    if (err == REGISLEX_ERROR_NOT_FOUND) {
+        err = REGISLEX_OK;
+        for (int i = 0; i < series_count; i++) {
+            series_apply(ctx, &series[i]);
+        }
+    }
+    platform_free(series);
+    return err;
+}
+
+/* ============================================================================
+ * Change Hooks
+ * ============================================================================ */
+
+REGISLEX_API void regislex_agenda_apply_deadline(
+    regislex_context_t* ctx,
+    const regislex_deadline_t* deadline)
+{
+    if (!agenda.mutex || !ctx || !deadline) return;
+
+    if (deadline->rrule[0] && deadline_open(deadline)) {
+        series_apply(ctx, deadline);
+        return;
+    }
+
+    platform_mutex_lock(agenda.mutex);
+    index_remove(deadline->id.value);
+    if (deadline_open(deadline) && !deadline->rrule[0]) {
+        regislex_agenda_item_t item;
+        deadline_item(deadline, &item);
+        index_add(&deadline->assigned_to_id, &item);
+    }
+    platform_mutex_unlock(agenda.mutex);
+}
+
+REGISLEX_API void regislex_agenda_apply_task(const regislex_task_t* task) {
+    if (!agenda.mutex || !task) return;
+
+    platform_mutex_lock(agenda.mutex);
+    index_remove(task->id.value);
+    if (task_open(task->status)) {
+        regislex_agenda_item_t item;
+        memset(&item, 0, sizeof(item));
+        item.kind = REGISLEX_AGENDA_TASK;
+        item.id = task->id;
+        item.case_id = task->case_id;
+        strncpy(item.title, task->title, sizeof(item.title) - 1);
+        item.due = task->due_date;
+        item.priority = task->priority;
+        index_add(&task->assigned_to_id, &item);
+    }
+    platform_mutex_unlock(agenda.mutex);
+}
+
+REGISLEX_API void regislex_agenda_apply_reminder(const regislex_reminder_t* reminder) {
+    if (!agenda.mutex || !reminder) return;
+
+    platform_mutex_lock(agenda.mutex);
+    index_remove(reminder->id.value);
+    if (reminder->is_active && !reminder->is_sent) {
+        regislex_agenda_item_t item;
+        memset(&item, 0, sizeof(item));
+        item.kind = REGISLEX_AGENDA_REMINDER;
+        item.id = reminder->id;
+        item.deadline_id = reminder->deadline_id;
+        strncpy(item.title, reminder->message, sizeof(item.title) - 1);
+        item.due = reminder->send_at;
+        index_add(&reminder->user_id, &item);
+    }
+    platform_mutex_unlock(agenda.mutex);
+}
+
+REGISLEX_API void regislex_agenda_remove(const regislex_uuid_t* id) {
+    if (!agenda.mutex || !id) return;
+
+    platform_mutex_lock(agenda.mutex);
+    index_remove(id->value);
+    platform_mutex_unlock(agenda.mutex);
+}
+
+REGISLEX_API void regislex_agenda_remove_reminders(const regislex_uuid_t* deadline_id) {
+    if (!agenda.mutex || !deadline_id) return;
+
+    /*
+     * Only deadline deletion cascades to reminders, and it is rare enough
+     * that a scan beats keeping a second index by deadline. Each agenda is
+     * compacted in one pass; a reminder has a single node.
+     */
+    platform_mutex_lock(agenda.mutex);
+    for (int i = 0; i < agenda.users.capacity; i++) {
+        agenda_user_t* u = (agenda_user_t*)agenda.users.slots[i];
+        if (!u) continue;
+
+        int kept = 0;
+        for (int j = 0; j < u->count; j++) {
+            agenda_node_t* n = u->entries[j];
+            if (n->item.kind == REGISLEX_AGENDA_REMINDER &&
+                strcmp(n->item.deadline_id.value, deadline_id->value) == 0) {
+                regislex_id_map_remove(&agenda.ids, n->item.id.value);
+                platform_free(n);
+                continue;
+            }
+            u->entries[kept++] = n;
+        }
+        u->count = kept;
+    }
+    platform_mutex_unlock(agenda.mutex);
+}
+
+/* ============================================================================
+ * Agenda Queries
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_agenda_next(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* user_id,
+    const regislex_datetime_t* from,
+    regislex_agenda_item_t* items,
+    int max_items,
+    int* count)
+{
+    if (!ctx || !user_id || !count || max_items < 0 || (max_items > 0 && !items)) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!agenda.mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    regislex_datetime_t now;
+    if (!from) {
+        regislex_datetime_now(&now);
+        from = &now;
+    }
+    int64_t start = regislex_datetime_to_seconds(from);
+
+    *count = 0;
+
+    platform_mutex_lock(agenda.mutex);
+    const agenda_user_t* u = (const agenda_user_t*)regislex_id_map_get(&agenda.users, user_id->value);
+    if (u) {
+        int pos = entry_lower_bound(u, start, 0);
+        int n = u->count - pos < max_items ? u->count - pos : max_items;
+        for (int i = 0; i < n; i++) {
+            items[i] = u->entries[pos + i]->item;
+        }
+        *count = n;
+    }
+    platform_mutex_unlock(agenda.mutex);
+
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_agenda_roll(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!agenda.mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    /* One caller rolls the series horizon forward; the others return */
+    platform_mutex_lock(agenda.mutex);
+    bool roll = !agenda.series_rolling && regislex_datetime_to_seconds(&now) >= agenda.series_refresh;
+    if (roll) {
+        agenda.series_rolling = true;
+        agenda.series_refresh = INT64_MAX;
+    }
+    platform_mutex_unlock(agenda.mutex);
+
+    if (!roll) {
+        return REGISLEX_OK;
+    }
+
+    regislex_error_t err = series_expand_all(ctx);
+    platform_mutex_lock(agenda.mutex);
+    agenda.series_rolling = false;
+    if (err != REGISLEX_OK && agenda.series_refresh == INT64_MAX) {
+        /* Try again on the next roll */
+        agenda.series_refresh = 0;
+    }
+    platform_mutex_unlock(agenda.mutex);
+
+    return err;
+}
@@ -1,84 +1,499 @@
 /**
  * @file calendar.c
- * @brief Calendar Management for Legal Deadlines
+ * @brief Holiday Definitions for Legal Deadlines
+ *
+ * Holidays are stored as rules in the holidays table. The court calendar
+ * compiles them per jurisdiction and year; this file handles storage and
+ * the date rules themselves.
  */
 
 #include "regislex/regislex.h"
+#include "database/database.h"
 #include "platform/platform.h"
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
-typedef struct {
-    regislex_datetime_t date;
-    char name[128];
-    bool is_court_holiday;
-    char jurisdiction[64];
-} regislex_holiday_t;
+#define HOLIDAY_COLUMNS \
+    "id, name, jurisdiction, date, is_court_holiday, is_federal, is_recurring, " \
+    "recurrence_month, recurrence_day, recurrence_week, recurrence_weekday, observed, created_at"
 
-static regislex_holiday_t* holidays = NULL;
-static int holiday_count = 0;
+/* ============================================================================
+ * Internal Helper Functions
+ * ============================================================================ */
 
-regislex_error_t regislex_calendar_add_holiday(const regislex_datetime_t* date,
-                                                const char* name,
-                                                const char* jurisdiction) {
-    if (!date || !name) return REGISLEX_ERROR_INVALID_ARGUMENT;
+static void holiday_from_row(regislex_db_stmt_t* stmt, regislex_holiday_t* h) {
+    int col = 0;
 
-    regislex_holiday_t* new_holidays = (regislex_holiday_t*)platform_realloc(
-        holidays, (holiday_count + 1) * sizeof(regislex_holiday_t));
-    if (!new_holidays) return REGISLEX_ERROR_OUT_OF_MEMORY;
+    regislex_db_column_uuid(stmt, col++, &h->id);
 
-    holidays = new_holidays;
-    memcpy(&holidays[holiday_count].date, date, sizeof(regislex_datetime_t));
-    strncpy(holidays[holiday_count].name, name, sizeof(holidays[holiday_count].name) - 1);
-    if (jurisdiction) {
-        strncpy(holidays[holiday_count].jurisdiction, jurisdiction,
-                sizeof(holidays[holiday_count].jurisdiction) - 1);
+    const char* name = regislex_db_column_text(stmt, col++);
+    if (name) strncpy(h->name, name, sizeof(h->name) - 1);
+
+    const char* jurisdiction = regislex_db_column_text(stmt, col++);
+    if (jurisdiction) strncpy(h->jurisdiction, jurisdiction, sizeof(h->jurisdiction) - 1);
+
+    regislex_db_column_datetime(stmt, col++, &h->date);
+
+    h->is_court_holiday = regislex_db_column_int(stmt, col++) != 0;
+    h->is_federal = regislex_db_column_int(stmt, col++) != 0;
+    h->is_recurring = regislex_db_column_int(stmt, col++) != 0;
+    h->recurrence_month = (int)regislex_db_column_int(stmt, col++);
+    h->recurrence_day = (int)regislex_db_column_int(stmt, col++);
+    h->recurrence_week = (int)regislex_db_column_int(stmt, col++);
+    h->recurrence_weekday = (int)regislex_db_column_int(stmt, col++);
+    h->observed = (regislex_holiday_observed_t)regislex_db_column_int(stmt, col++);
+
+    regislex_db_column_datetime(stmt, col++, &h->created_at);
+}
+
+static regislex_error_t holiday_validate(const regislex_holiday_t* h) {
+    if (!h->name[0]) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+    if ((int)h->observed < REGISLEX_OBSERVED_NONE || h->observed > REGISLEX_OBSERVED_SUNDAY_TO_MONDAY) {
+        return REGISLEX_ERROR_VALIDATION;
     }
-    holidays[holiday_count].is_court_holiday = true;
-    holiday_count++;
 
+    if (!h->is_recurring) {
+        return regislex_datetime_is_valid_date(&h->date) ? REGISLEX_OK : REGISLEX_ERROR_VALIDATION;
+    }
+
+    if (h->recurrence_month < 1 || h->recurrence_month > 12) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+
+    if (h->recurrence_week == 0) {
+        /* Leap day is allowed and simply skipped in common years */
+        regislex_datetime_t probe;
+        memset(&probe, 0, sizeof(probe));
+        probe.year = 2000;
+        probe.month = h->recurrence_month;
+        probe.day = h->recurrence_day;
+        return regislex_datetime_is_valid_date(&probe) ? REGISLEX_OK : REGISLEX_ERROR_VALIDATION;
+    }
+
+    if (h->recurrence_week < -1 || h->recurrence_week > 5) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+    if (h->recurrence_weekday < 0 || h->recurrence_weekday > 6) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
     return REGISLEX_OK;
 }
 
-bool regislex_calendar_is_holiday(const regislex_datetime_t* date, const char* jurisdiction) {
-    if (!date) return false;
+static int days_in_month(int year, int month) {
+    regislex_datetime_t first, next;
+    memset(&first, 0, sizeof(first));
+    first.year = year;
+    first.month = month;
+    first.day = 1;
+    next = first;
+    regislex_datetime_add_months(&next, 1);
+    return regislex_datetime_diff_days(&first, &next);
+}
 
-    for (int i = 0; i < holiday_count; i++) {
-        if (holidays[i].date.year == date->year &&
-            holidays[i].date.month == date->month &&
-            holidays[i].date.day == date->day) {
-            if (!jurisdiction || !holidays[i].jurisdiction[0] ||
-                strcmp(holidays[i].jurisdiction, jurisdiction) == 0) {
-                return true;
-            }
+static int compare_holiday_dates(const void* a, const void* b) {
+    const regislex_holiday_t* ha = *(const regislex_holiday_t* const*)a;
+    const regislex_holiday_t* hb = *(const regislex_holiday_t* const*)b;
+    int cmp = regislex_datetime_compare(&ha->date, &hb->date);
+    return cmp != 0 ? cmp : strcmp(ha->name, hb->name);
+}
+
+/* ============================================================================
+ * Holiday Rules
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_holiday_occurrence(
+    const regislex_holiday_t* holiday,
+    int year,
+    regislex_datetime_t* actual,
+    regislex_datetime_t* observed)
+{
+    if (!holiday || !actual || !observed) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    memset(actual, 0, sizeof(regislex_datetime_t));
+
+    if (!holiday->is_recurring) {
+        if (holiday->date.year != year) return REGISLEX_ERROR_NOT_FOUND;
+        actual->year = holiday->date.year;
+        actual->month = holiday->date.month;
+        actual->day = holiday->date.day;
+    } else if (holiday->recurrence_week == 0) {
+        actual->year = year;
+        actual->month = holiday->recurrence_month;
+        actual->day = holiday->recurrence_day;
+    } else {
+        int length = days_in_month(year, holiday->recurrence_month);
+
+        actual->year = year;
+        actual->month = holiday->recurrence_month;
+        actual->day = 1;
+
+        if (holiday->recurrence_week > 0) {
+            int first_dow = regislex_datetime_day_of_week(actual);
+            actual->day = 1 + (holiday->recurrence_weekday - first_dow + 7) % 7 +
+                          (holiday->recurrence_week - 1) * 7;
+        } else {
+            actual->day = length;
+            int last_dow = regislex_datetime_day_of_week(actual);
+            actual->day = length - (last_dow - holiday->recurrence_weekday + 7) % 7;
+        }
+
+        if (actual->day > length) return REGISLEX_ERROR_NOT_FOUND;
+    }
+
+    if (!regislex_datetime_is_valid_date(actual)) {
+        return REGISLEX_ERROR_NOT_FOUND;
+    }
+
+    *observed = *actual;
+
+    int dow = regislex_datetime_day_of_week(actual);
+    switch (holiday->observed) {
+        case REGISLEX_OBSERVED_NEAREST_WEEKDAY:
+            if (dow == 6) regislex_datetime_add_days(observed, -1);
+            if (dow == 0) regislex_datetime_add_days(observed, 1);
+            break;
+        case REGISLEX_OBSERVED_NEXT_MONDAY:
+            if (dow == 6) regislex_datetime_add_days(observed, 2);
+            if (dow == 0) regislex_datetime_add_days(observed, 1);
+            break;
+        case REGISLEX_OBSERVED_SUNDAY_TO_MONDAY:
+            if (dow == 0) regislex_datetime_add_days(observed, 1);
+            break;
+        default:
+            break;
+    }
+
+    return REGISLEX_OK;
+}
+
+/* ============================================================================
+ * Holiday Functions
+ * ============================================================================ */
+
+/*
+ * Finish a holiday write made in tx. The recompute counts court days on a
+ * private calendar built from the pending rows, so the shared one never
+ * sees a holiday that may still roll back; it takes the new rules once
+ * the write commits.
+ */
+static regislex_error_t holiday_change_finish(regislex_context_t* ctx,
+                                              regislex_db_transaction_t* tx,
+                                              const regislex_holiday_t* holiday,
+                                              const char* reason,
+                                              regislex_error_t err) {
+    regislex_court_calendar_t* calendar = NULL;
+    if (err == REGISLEX_OK) {
+        err = regislex_court_calendar_open(ctx, &calendar);
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_court_holiday_recompute(ctx, holiday, reason, calendar, NULL);
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_court_calendar_publish(ctx, calendar);
+    }
+    regislex_court_calendar_close(calendar);
+
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+    }
+    return err;
+}
+
+REGISLEX_API regislex_error_t regislex_holiday_add(
+    regislex_context_t* ctx,
+    const regislex_holiday_t* holiday,
+    regislex_holiday_t** out_holiday)
+{
+    if (!ctx || !holiday) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_error_t err = holiday_validate(holiday);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_holiday_t h = *holiday;
+    regislex_uuid_generate(&h.id);
+    regislex_datetime_now(&h.created_at);
+
+    const char* sql =
+        "INSERT INTO holidays (" HOLIDAY_COLUMNS ") "
+        "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)";
+
+    regislex_db_transaction_t* tx = NULL;
+    err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_stmt_t* stmt = NULL;
+    err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        return err;
+    }
+
+    int idx = 1;
+    regislex_db_bind_uuid(stmt, idx++, &h.id);
+    regislex_db_bind_text(stmt, idx++, h.name);
+    regislex_db_bind_text(stmt, idx++, h.jurisdiction);
+    if (h.is_recurring) {
+        regislex_db_bind_null(stmt, idx++);
+    } else {
+        regislex_db_bind_datetime(stmt, idx++, &h.date);
+    }
+    regislex_db_bind_int(stmt, idx++, h.is_court_holiday ? 1 : 0);
+    regislex_db_bind_int(stmt, idx++, h.is_federal ? 1 : 0);
+    regislex_db_bind_int(stmt, idx++, h.is_recurring ? 1 : 0);
+    regislex_db_bind_int(stmt, idx++, h.recurrence_month);
+    regislex_db_bind_int(stmt, idx++, h.recurrence_day);
+    regislex_db_bind_int(stmt, idx++, h.recurrence_week);
+    regislex_db_bind_int(stmt, idx++, h.recurrence_weekday);
+    regislex_db_bind_int(stmt, idx++, h.observed);
+    regislex_db_bind_datetime(stmt, idx++, &h.created_at);
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+    if (err == REGISLEX_ERROR_NOT_FOUND) {
+        err = REGISLEX_OK;
+    }
+
+    err = holiday_change_finish(ctx, tx, &h, "holiday added", err);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    if (out_holiday) {
+        *out_holiday = (regislex_holiday_t*)platform_malloc(sizeof(regislex_holiday_t));
+        if (!*out_holiday) {
+            return REGISLEX_ERROR_OUT_OF_MEMORY;
         }
+        **out_holiday = h;
     }
-    return false;
+
+    return REGISLEX_OK;
 }
 
-bool regislex_calendar_is_court_day(const regislex_datetime_t* date, const char* jurisdiction) {
-    if (!date) return false;
-    if (regislex_datetime_is_weekend(date)) return false;
-    if (regislex_calendar_is_holiday(date, jurisdiction)) return false;
-    return true;
+REGISLEX_API regislex_error_t regislex_holiday_delete(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* id)
+{
+    if (!ctx || !id) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    /* Keep the definition; its dates decide which deadlines to recompute */
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "SELECT " HOLIDAY_COLUMNS " FROM holidays WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_holiday_t h;
+    memset(&h, 0, sizeof(h));
+    regislex_db_bind_uuid(stmt, 1, id);
+    err = regislex_db_step(stmt);
+    if (err == REGISLEX_OK) holiday_from_row(stmt, &h);
+    regislex_db_finalize(stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_transaction_t* tx = NULL;
+    err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    err = regislex_db_prepare(db, "DELETE FROM holidays WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        return err;
+    }
+
+    regislex_db_bind_uuid(stmt, 1, id);
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+    if (err == REGISLEX_ERROR_NOT_FOUND) {
+        err = regislex_db_changes(db) == 0 ? REGISLEX_ERROR_NOT_FOUND : REGISLEX_OK;
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        return err;
+    }
+
+    return holiday_change_finish(ctx, tx, &h, "holiday removed", REGISLEX_OK);
 }
 
-regislex_error_t regislex_calendar_next_court_day(regislex_datetime_t* date,
-                                                   const char* jurisdiction) {
-    if (!date) return REGISLEX_ERROR_INVALID_ARGUMENT;
+REGISLEX_API regislex_error_t regislex_holiday_rules(
+    regislex_context_t* ctx,
+    const char* jurisdiction,
+    regislex_holiday_t*** holidays,
+    int* count)
+{
+    if (!ctx || !holidays || !count) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    *holidays = NULL;
+    *count = 0;
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    const char* sql = jurisdiction
+        ? "SELECT " HOLIDAY_COLUMNS " FROM holidays WHERE jurisdiction IN ('', ?) ORDER BY name"
+        : "SELECT " HOLIDAY_COLUMNS " FROM holidays ORDER BY jurisdiction, name";
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    if (jurisdiction) {
+        regislex_db_bind_text(stmt, 1, jurisdiction);
+    }
+
+    regislex_holiday_t** items = NULL;
+    int n = 0;
+    int capacity = 0;
 
-    int max_iterations = 30;  /* Safety limit */
-    while (max_iterations-- > 0) {
-        regislex_datetime_add_days(date, 1);
-        if (regislex_calendar_is_court_day(date, jurisdiction)) {
-            return REGISLEX_OK;
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        if (n >= capacity) {
+            int new_capacity = capacity ? capacity * 2 : 16;
+            regislex_holiday_t** grown = (regislex_holiday_t**)platform_realloc(
+                items, (size_t)new_capacity * sizeof(regislex_holiday_t*));
+            if (!grown) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            items = grown;
+            capacity = new_capacity;
+        }
+
+        regislex_holiday_t* h = (regislex_holiday_t*)platform_calloc(1, sizeof(regislex_holiday_t));
+        if (!h) {
+            err = REGISLEX_ERROR_OUT_OF_MEMORY;
+            break;
         }
+        holiday_from_row(stmt, h);
+        items[n++] = h;
     }
 
-    return REGISLEX_ERROR;
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        regislex_holiday_list_free(items, n);
+        return err;
+    }
+
+    *holidays = items;
+    *count = n;
+    return REGISLEX_OK;
 }
 
-void regislex_calendar_clear_holidays(void) {
+REGISLEX_API regislex_error_t regislex_holiday_list(
+    regislex_context_t* ctx,
+    const char* jurisdiction,
+    const regislex_datetime_t* start_date,
+    const regislex_datetime_t* end_date,
+    regislex_holiday_t*** holidays,
+    int* count)
+{
+    if (!ctx || !start_date || !end_date || !holidays || !count) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    *holidays = NULL;
+    *count = 0;
+
+    regislex_holiday_t** rules = NULL;
+    int rule_count = 0;
+    regislex_error_t err = regislex_holiday_rules(ctx, jurisdiction, &rules, &rule_count);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    int64_t first = regislex_datetime_to_days(start_date);
+    int64_t last = regislex_datetime_to_days(end_date);
+
+    regislex_holiday_t** items = NULL;
+    int n = 0;
+    int capacity = 0;
+
+    /* Observed dates may cross into the neighbouring year */
+    for (int i = 0; i < rule_count && err == REGISLEX_OK; i++) {
+        for (int year = start_date->year - 1; year <= end_date->year + 1; year++) {
+            regislex_datetime_t actual, observed;
+            if (regislex_holiday_occurrence(rules[i], year, &actual, &observed) != REGISLEX_OK) {
+                continue;
+            }
+
+            int64_t day = regislex_datetime_to_days(&observed);
+            if (day < first || day > last) continue;
+
+            if (n >= capacity) {
+                int new_capacity = capacity ? capacity * 2 : 16;
+                regislex_holiday_t** grown = (regislex_holiday_t**)platform_realloc(
+                    items, (size_t)new_capacity * sizeof(regislex_holiday_t*));
+                if (!grown) {
+                    err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                    break;
+                }
+                items = grown;
+                capacity = new_capacity;
+            }
+
+            regislex_holiday_t* h = (regislex_holiday_t*)platform_malloc(sizeof(regislex_holiday_t));
+            if (!h) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            *h = *rules[i];
+            h->date = observed;
+            items[n++] = h;
+        }
+    }
+
+    regislex_holiday_list_free(rules, rule_count);
+
+    if (err != REGISLEX_OK) {
+        regislex_holiday_list_free(items, n);
+        return err;
+    }
+
+    if (n > 1) {
+        qsort(items, (size_t)n, sizeof(regislex_holiday_t*), compare_holiday_dates);
+    }
+
+    *holidays = items;
+    *count = n;
+    return REGISLEX_OK;
+}
+
+REGISLEX_API void regislex_holiday_free(regislex_holiday_t* holiday) {
+    platform_free(holiday);
+}
+
+REGISLEX_API void regislex_holiday_list_free(regislex_holiday_t** holidays, int count) {
+    if (!holidays) return;
+
+    for (int i = 0; i < count; i++) {
+        regislex_holiday_free(holidays[i]);
+    }
     platform_free(holidays);
-    holidays = NULL;
-    holiday_count = 0;
 }
@@ -0,0 +1,639 @@
+/**
+ * @file calendar_feed.c
+ * @brief Incremental iCalendar Feeds
+ *
+ * Triggers on deadlines and deadline_exceptions record, per assignee, the
+ * sequence number of each deadline's latest change in calendar_feed_log.
+ * A user's highest sequence number is both the feed's ETag and its sync
+ * token, so an unchanged feed is answered from one indexed lookup and a
+ * delta reads only the log rows past the token.
+ *
+ * Rendered VEVENT text is cached by deadline id and reused for as long as
+ * the deadline's sequence number is unchanged.
+ */
+
+#include "regislex/regislex.h"
+#include "database/database.h"
+#include "platform/platform.h"
+#include "utils/id_map.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FEED_TOKEN_PREFIX       "rsync-"
+#define FEED_CACHE_MAX_ENTRIES  65536
+#define FEED_LINE_OCTETS        75
+
+/* ============================================================================
+ * Internal Structures
+ * ============================================================================ */
+
+typedef struct {
+    char* data;
+    size_t length;
+    size_t capacity;
+    bool failed;
+} feed_buffer_t;
+
+typedef struct {
+    regislex_uuid_t id;
+    int64_t seq;
+    char* text;
+    size_t length;
+} feed_cache_entry_t;
+
+static struct {
+    platform_mutex_t* mutex;
+    regislex_id_map_t entries;      /* Keyed by deadline id */
+} feed_cache;
+
+/* ============================================================================
+ * Output Buffer
+ * ============================================================================ */
+
+static void buffer_append(feed_buffer_t* b, const char* s, size_t n) {
+    if (b->failed) return;
+
+    if (b->length + n + 1 > b->capacity) {
+        size_t capacity = b->capacity ? b->capacity : 4096;
+        while (b->length + n + 1 > capacity) capacity *= 2;
+
+        char* data = (char*)platform_realloc(b->data, capacity);
+        if (!data) {
+            b->failed = true;
+            return;
+        }
+        b->data = data;
+        b->capacity = capacity;
+    }
+
+    memcpy(b->data + b->length, s, n);
+    b->length += n;
+    b->data[b->length] = '\0';
+}
+
+static void buffer_puts(feed_buffer_t* b, const char* s) {
+    buffer_append(b, s, strlen(s));
+}
+
+/* ============================================================================
+ * iCalendar Rendering
+ * ============================================================================ */
+
+/* Append content-line octets, folding before any line would pass 75 octets */
+static void ics_put(feed_buffer_t* b, size_t* column, const char* s, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        /* Never split a UTF-8 sequence across a fold */
+        if (*column >= FEED_LINE_OCTETS && ((unsigned char)s[i] & 0xC0) != 0x80) {
+            buffer_append(b, "\r\n ", 3);
+            *column = 1;
+        }
+        buffer_append(b, &s[i], 1);
+        (*column)++;
+    }
+}
+
+/* Append NAME:value, escaping the value as TEXT when requested */
+static void ics_property(feed_buffer_t* b, const char* name, const char* value, bool text) {
+    size_t column = 0;
+    ics_put(b, &column, name, strlen(name));
+    ics_put(b, &column, ":", 1);
+
+    for (const char* p = value; *p; p++) {
+        if (!text) {
+            ics_put(b, &column, p, 1);
+        } else if (*p == '\\' || *p == ';' || *p == ',') {
+            char escaped[2] = { '\\', *p };
+            ics_put(b, &column, escaped, 2);
+        } else if (*p == '\n') {
+            ics_put(b, &column, "\\n", 2);
+        } else if (*p != '\r') {
+            ics_put(b, &column, p, 1);
+        }
+    }
+    buffer_append(b, "\r\n", 2);
+}
+
+/* Append a DATE-TIME in UTC, or a DATE for all-day deadlines */
+static void ics_datetime(feed_buffer_t* b, const char* name,
+                         const regislex_datetime_t* dt, bool all_day) {
+    char line[64];
+    if (all_day) {
+        snprintf(line, sizeof(line), "%s;VALUE=DATE:%04d%02d%02d",
+                 name, dt->year, dt->month, dt->day);
+    } else {
+        regislex_datetime_t utc;
+        regislex_datetime_from_seconds(regislex_datetime_to_seconds(dt), &utc);
+        snprintf(line, sizeof(line), "%s:%04d%02d%02dT%02d%02d%02dZ", name,
+                 utc.year, utc.month, utc.day, utc.hour, utc.minute, utc.second);
+    }
+    buffer_puts(b, line);
+    buffer_append(b, "\r\n", 2);
+}
+
+static void ics_event_header(feed_buffer_t* b, const char* id, int64_t seq,
+                             const regislex_datetime_t* stamp) {
+    char line[96];
+
+    buffer_puts(b, "BEGIN:VEVENT\r\n");
+    snprintf(line, sizeof(line), "%s@regislex", id);
+    ics_property(b, "UID", line, false);
+    ics_datetime(b, "DTSTAMP", stamp, false);
+    snprintf(line, sizeof(line), "SEQUENCE:%lld\r\n", (long long)seq);
+    buffer_puts(b, line);
+}
+
+/* Render the exception-derived parts of a series: EXDATEs go inside the
+ * master event, moved or retitled occurrences become their own events */
+static regislex_error_t ics_series_overrides(regislex_db_context_t* db,
+                                             const regislex_deadline_t* dl,
+                                             int64_t seq,
+                                             feed_buffer_t* master,
+                                             feed_buffer_t* overrides) {
+    const char* sql =
+        "SELECT occurrence_date, is_cancelled, due_date, title "
+        "FROM deadline_exceptions WHERE deadline_id = ? ORDER BY occurrence_date";
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_uuid(stmt, 1, &dl->id);
+
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        regislex_datetime_t occurrence;
+        regislex_datetime_t due;
+        regislex_db_column_datetime(stmt, 0, &occurrence);
+        bool cancelled = regislex_db_column_int(stmt, 1) != 0;
+        regislex_db_column_datetime(stmt, 2, &due);
+        const char* title = regislex_db_column_text(stmt, 3);
+
+        if (cancelled) {
+            ics_datetime(master, "EXDATE", &occurrence, dl->is_all_day);
+            continue;
+        }
+        if (due.year == 0 && (!title || !title[0])) {
+            /* Completion alone has no iCalendar form */
+            continue;
+        }
+
+        ics_event_header(overrides, dl->id.value, seq, &dl->updated_at);
+        ics_datetime(overrides, "RECURRENCE-ID", &occurrence, dl->is_all_day);
+        ics_datetime(overrides, "DTSTART", due.year != 0 ? &due : &occurrence, dl->is_all_day);
+        ics_property(overrides, "SUMMARY", (title && title[0]) ? title : dl->title, true);
+        buffer_puts(overrides, "STATUS:CONFIRMED\r\nEND:VEVENT\r\n");
+    }
+    regislex_db_finalize(stmt);
+
+    return (err == REGISLEX_ERROR_NOT_FOUND) ? REGISLEX_OK : err;
+}
+
+static regislex_error_t ics_render_deadline(regislex_db_context_t* db,
+                                            const regislex_deadline_t* dl,
+                                            int64_t seq,
+                                            feed_buffer_t* out) {
+    ics_event_header(out, dl->id.value, seq, &dl->updated_at);
+    ics_datetime(out, "DTSTART", &dl->due_date, dl->is_all_day);
+
+    if (dl->is_all_day) {
+        regislex_datetime_t end = dl->due_date;
+        regislex_datetime_add_days(&end, 1);
+        ics_datetime(out, "DTEND", &end, true);
+    } else if (dl->duration_minutes > 0) {
+        char line[48];
+        snprintf(line, sizeof(line), "DURATION:PT%dM\r\n", dl->duration_minutes);
+        buffer_puts(out, line);
+    }
+
+    ics_property(out, "SUMMARY", dl->title, true);
+    if (dl->description[0]) ics_property(out, "DESCRIPTION", dl->description, true);
+    if (dl->location[0]) ics_property(out, "LOCATION", dl->location, true);
+    buffer_puts(out, dl->status == REGISLEX_STATUS_CANCELLED ? "STATUS:CANCELLED\r\n"
+                                                            : "STATUS:CONFIRMED\r\n");
+
+    feed_buffer_t overrides = { NULL, 0, 0, false };
+    regislex_error_t err = REGISLEX_OK;
+    if (dl->rrule[0]) {
+        ics_property(out, "RRULE", dl->rrule, false);
+        err = ics_series_overrides(db, dl, seq, out, &overrides);
+    }
+    buffer_puts(out, "END:VEVENT\r\n");
+    if (overrides.length > 0) {
+        buffer_append(out, overrides.data, overrides.length);
+    }
+    bool failed = overrides.failed || out->failed;
+    platform_free(overrides.data);
+
+    if (err != REGISLEX_OK) return err;
+    return failed ? REGISLEX_ERROR_OUT_OF_MEMORY : REGISLEX_OK;
+}
+
+/* ============================================================================
+ * Rendered Event Cache
+ * ============================================================================ */
+
+static void cache_clear(void) {
+    regislex_id_map_t* map = &feed_cache.entries;
+    for (int i = 0; i < map->capacity; i++) {
+        feed_cache_entry_t* e = (feed_cache_entry_t*)map->slots[i];
+        if (e) {
+            platform_free(e->text);
+            platform_free(e);
+            map->slots[i] = NULL;
+        }
+    }
+    map->used = 0;
+}
+
+/* Append the cached rendering of a deadline if it is still current */
+static bool cache_append(const regislex_uuid_t* id, int64_t seq, feed_buffer_t* out) {
+    if (!feed_cache.mutex) return false;
+
+    bool hit = false;
+    platform_mutex_lock(feed_cache.mutex);
+    const feed_cache_entry_t* e = (const feed_cache_entry_t*)regislex_id_map_get(&feed_cache.entries, id->value);
+    if (e && e->seq == seq) {
+        buffer_append(out, e->text, e->length);
+        hit = true;
+    }
+    platform_mutex_unlock(feed_cache.mutex);
+    return hit;
+}
+
+/* Keep a rendering; takes ownership of text */
+static void cache_store(const regislex_uuid_t* id, int64_t seq, char* text, size_t length) {
+    if (!feed_cache.mutex) {
+        platform_free(text);
+        return;
+    }
+
+    platform_mutex_lock(feed_cache.mutex);
+
+    feed_cache_entry_t* e = (feed_cache_entry_t*)regislex_id_map_get(&feed_cache.entries, id->value);
+    if (e) {
+        if (seq >= e->seq) {
+            platform_free(e->text);
+            e->seq = seq;
+            e->text = text;
+            e->length = length;
+            text = NULL;
+        }
+        platform_mutex_unlock(feed_cache.mutex);
+        platform_free(text);
+        return;
+    }
+
+    /* A full cache starts over rather than tracking recency */
+    if (feed_cache.entries.used >= FEED_CACHE_MAX_ENTRIES) {
+        cache_clear();
+    }
+
+    e = (feed_cache_entry_t*)platform_calloc(1, sizeof(feed_cache_entry_t));
+    if (!e) {
+        platform_mutex_unlock(feed_cache.mutex);
+        platform_free(text);
+        return;
+    }
+    e->id = *id;
+    e->seq = seq;
+    e->text = text;
+    e->length = length;
+    if (regislex_id_map_insert(&feed_cache.entries, e) != REGISLEX_OK) {
+        platform_free(e->text);
+        platform_free(e);
+    }
+
+    platform_mutex_unlock(feed_cache.mutex);
+}
+
+REGISLEX_API regislex_error_t regislex_calendar_feed_init(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (feed_cache.mutex) {
+        return REGISLEX_OK;
+    }
+
+    if (platform_mutex_create(&feed_cache.mutex) != PLATFORM_OK) {
+        feed_cache.mutex = NULL;
+        return REGISLEX_ERROR;
+    }
+    regislex_id_map_init(&feed_cache.entries, offsetof(feed_cache_entry_t, id.value));
+    return REGISLEX_OK;
+}
+
+REGISLEX_API void regislex_calendar_feed_shutdown(void) {
+    if (!feed_cache.mutex) return;
+
+    cache_clear();
+    regislex_id_map_free(&feed_cache.entries);
+
+    platform_mutex_destroy(feed_cache.mutex);
+    feed_cache.mutex = NULL;
+}
+
+/* ============================================================================
+ * Feed Generation
+ * ============================================================================ */
+
+static regislex_error_t feed_current_seq(regislex_db_context_t* db,
+                                         const regislex_uuid_t* user_id,
+                                         int64_t* out_seq) {
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(
+        db, "SELECT MAX(seq) FROM calendar_feed_log WHERE user_id = ?", &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_uuid(stmt, 1, user_id);
+
+    err = regislex_db_step(stmt);
+    *out_seq = (err == REGISLEX_OK) ? regislex_db_column_int(stmt, 0) : 0;
+    regislex_db_finalize(stmt);
+
+    return (err == REGISLEX_OK || err == REGISLEX_ERROR_NOT_FOUND) ? REGISLEX_OK : err;
+}
+
+static bool feed_parse_token(const char* token, int64_t* out_seq) {
+    size_t prefix_len = strlen(FEED_TOKEN_PREFIX);
+    if (strncmp(token, FEED_TOKEN_PREFIX, prefix_len) != 0) return false;
+
+    const char* digits = token + prefix_len;
+    if (*digits < '0' || *digits > '9') return false;
+
+    char* end = NULL;
+    long long value = strtoll(digits, &end, 10);
+    if (*end != '\0' || value < 0) return false;
+
+    *out_seq = (int64_t)value;
+    return true;
+}
+
+/* Stream the log rows in (since, until] into the feed body */
+static regislex_error_t feed_render_events(regislex_db_context_t* db,
+                                           const regislex_uuid_t* user_id,
+                                           int64_t since,
+                                           int64_t until,
+                                           regislex_calendar_feed_t* feed,
+                                           feed_buffer_t* out) {
+    const char* sql =
+        "SELECT " REGISLEX_DEADLINE_COLUMNS ", log.seq, log.deleted, log.deadline_id "
+        "FROM calendar_feed_log log "
+        "LEFT JOIN deadlines ON deadlines.id = log.deadline_id "
+        "WHERE log.user_id = ? AND log.seq > ? AND log.seq <= ? "
+        "ORDER BY log.seq";
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_uuid(stmt, 1, user_id);
+    regislex_db_bind_int(stmt, 2, since);
+    regislex_db_bind_int(stmt, 3, until);
+
+    int seq_col = regislex_db_column_count(stmt) - 3;
+
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    regislex_deadline_t dl;
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        int64_t seq = regislex_db_column_int(stmt, seq_col);
+        bool deleted = regislex_db_column_int(stmt, seq_col + 1) != 0 ||
+                       regislex_db_column_is_null(stmt, 0);
+
+        if (deleted) {
+            /* A full feed simply leaves removed deadlines out */
+            if (!feed->is_delta) continue;
+
+            const char* id = regislex_db_column_text(stmt, seq_col + 2);
+            ics_event_header(out, id ? id : "", seq, &now);
+            buffer_puts(out, "STATUS:CANCELLED\r\nEND:VEVENT\r\n");
+            feed->removed_count++;
+            continue;
+        }
+
+        memset(&dl, 0, sizeof(dl));
+        regislex_deadline_from_row(stmt, &dl);
+        feed->event_count++;
+
+        if (cache_append(&dl.id, seq, out)) continue;
+
+        feed_buffer_t fragment = { NULL, 0, 0, false };
+        err = ics_render_deadline(db, &dl, seq, &fragment);
+        if (err != REGISLEX_OK) {
+            platform_free(fragment.data);
+            break;
+        }
+        buffer_append(out, fragment.data, fragment.length);
+        cache_store(&dl.id, seq, fragment.data, fragment.length);
+    }
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) return err;
+    return out->failed ? REGISLEX_ERROR_OUT_OF_MEMORY : REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_calendar_feed(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* user_id,
+    const char* sync_token,
+    const char* if_none_match,
+    regislex_calendar_feed_t** out_feed)
+{
+    if (!ctx || !user_id || !out_feed) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    bool have_token = sync_token && sync_token[0];
+    int64_t since = 0;
+    if (have_token && !feed_parse_token(sync_token, &since)) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    int64_t current = 0;
+    regislex_error_t err = feed_current_seq(db, user_id, &current);
+    if (err != REGISLEX_OK) return err;
+
+    /* A token from the future was not issued by this database */
+    if (since > current) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+
+    regislex_calendar_feed_t* feed = (regislex_calendar_feed_t*)platform_calloc(
+        1, sizeof(regislex_calendar_feed_t));
+    if (!feed) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    snprintf(feed->etag, sizeof(feed->etag), "\"%lld\"", (long long)current);
+    snprintf(feed->sync_token, sizeof(feed->sync_token), FEED_TOKEN_PREFIX "%lld", (long long)current);
+    feed->is_delta = have_token;
+
+    if ((if_none_match && strcmp(if_none_match, feed->etag) == 0) ||
+        (have_token && since == current)) {
+        feed->not_modified = true;
+        *out_feed = feed;
+        return REGISLEX_OK;
+    }
+
+    feed_buffer_t out = { NULL, 0, 0, false };
+    buffer_puts(&out,
+        "BEGIN:VCALENDAR\r\n"
+        "VERSION:2.0\r\n"
+        "PRODID:-//RegisLex//Deadlines//EN\r\n"
+        "CALSCALE:GREGORIAN\r\n"
+        "METHOD:PUBLISH\r\n"
+        "X-WR-CALNAME:RegisLex Deadlines\r\n");
+
+    err = feed_render_events(db, user_id, since, current, feed, &out);
+
+    buffer_puts(&out, "END:VCALENDAR\r\n");
+    if (err == REGISLEX_OK && out.failed) {
+        err = REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    if (err != REGISLEX_OK) {
+        platform_free(out.data);
+        platform_free(feed);
+        return err;
+    }
+
+    feed->data = out.data;
+    feed->length = out.length;
+    *out_feed = feed;
+    return REGISLEX_OK;
+}
+
+REGISLEX_API void regislex_calendar_feed_free(regislex_calendar_feed_t* feed) {
+    if (!feed) return;
+
+    platform_free(feed->data);
+    platform_free(feed);
+}
+
+/* ============================================================================
+ * External Calendar Sync
+ * ============================================================================ */
+
+static regislex_error_t sync_load_etag(regislex_db_context_t* db,
+                                       const regislex_uuid_t* user_id,
+                                       const char* calendar_type,
+                                       const char* target,
+                                       char* etag, size_t size) {
+    etag[0] = '\0';
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "SELECT etag FROM calendar_subscriptions "
+        "WHERE user_id = ? AND calendar_type = ? AND target = ?", &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_uuid(stmt, 1, user_id);
+    regislex_db_bind_text(stmt, 2, calendar_type);
+    regislex_db_bind_text(stmt, 3, target);
+
+    err = regislex_db_step(stmt);
+    if (err == REGISLEX_OK) {
+        const char* value = regislex_db_column_text(stmt, 0);
+        if (value) snprintf(etag, size, "%s", value);
+    }
+    regislex_db_finalize(stmt);
+
+    return (err == REGISLEX_OK || err == REGISLEX_ERROR_NOT_FOUND) ? REGISLEX_OK : err;
+}
+
+static regislex_error_t sync_save_etag(regislex_db_context_t* db,
+                                       const regislex_uuid_t* user_id,
+                                       const char* calendar_type,
+                                       const char* target,
+                                       const char* etag) {
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "INSERT INTO calendar_subscriptions (user_id, calendar_type, target, etag, synced_at) "
+        "VALUES (?, ?, ?, ?, ?) "
+        "ON CONFLICT (user_id, calendar_type, target) DO UPDATE SET "
+        "etag = excluded.etag, synced_at = excluded.synced_at", &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    regislex_db_bind_uuid(stmt, 1, user_id);
+    regislex_db_bind_text(stmt, 2, calendar_type);
+    regislex_db_bind_text(stmt, 3, target);
+    regislex_db_bind_text(stmt, 4, etag);
+    regislex_db_bind_datetime(stmt, 5, &now);
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    return (err == REGISLEX_ERROR_NOT_FOUND) ? REGISLEX_OK : err;
+}
+
+/* Write through a temporary file so readers never see a partial feed */
+static regislex_error_t sync_write_file(const char* path, const char* data, size_t length) {
+    char temp_path[REGISLEX_MAX_PATH_LENGTH + 8];
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", path);
+
+    FILE* fp = fopen(temp_path, "wb");
+    if (!fp) {
+        return REGISLEX_ERROR_IO;
+    }
+
+    bool ok = fwrite(data, 1, length, fp) == length;
+    ok = (fclose(fp) == 0) && ok;
+    if (ok) {
+        ok = rename(temp_path, path) == 0;
+    }
+    if (!ok) {
+        remove(temp_path);
+        return REGISLEX_ERROR_IO;
+    }
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_calendar_sync(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* user_id,
+    const char* calendar_type,
+    const char* credentials)
+{
+    if (!ctx || !user_id || !calendar_type) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (strcmp(calendar_type, "ical") != 0) {
+        /* Remote calendars subscribe to the published feed instead */
+        return REGISLEX_ERROR_UNSUPPORTED;
+    }
+    if (!credentials || !credentials[0] || strlen(credentials) >= REGISLEX_MAX_PATH_LENGTH) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    char etag[32];
+    regislex_error_t err = sync_load_etag(db, user_id, calendar_type, credentials,
+                                          etag, sizeof(etag));
+    if (err != REGISLEX_OK) return err;
+
+    /* Republish a missing file even if nothing changed */
+    if (!platform_file_exists(credentials)) {
+        etag[0] = '\0';
+    }
+
+    regislex_calendar_feed_t* feed = NULL;
+    err = regislex_calendar_feed(ctx, user_id, NULL, etag[0] ? etag : NULL, &feed);
+    if (err != REGISLEX_OK) return err;
+
+    if (!feed->not_modified) {
+        err = sync_write_file(credentials, feed->data, feed->length);
+        if (err == REGISLEX_OK) {
+            err = sync_save_etag(db, user_id, calendar_type, credentials, feed->etag);
+        }
+    }
+
+    regislex_calendar_feed_free(feed);
+    return err;
+}
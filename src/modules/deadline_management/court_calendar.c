@@ -0,0 +1,826 @@
+/**
+ * @file court_calendar.c
+ * @brief Per-Jurisdiction Court-Day Calendars
+ *
+ * Each jurisdiction keeps a contiguous range of compiled years. A year
+ * stores the number of court days before each of its days (prefix) and
+ * the day of year of each court day (select), plus the number of court
+ * days in all earlier loaded years (base). Counting court days between
+ * two dates is then a difference of two prefix lookups, and adding N
+ * court days is a prefix lookup followed by a select lookup.
+ *
+ * Each year also carries two 366-bit sets, one for holidays and one for
+ * open court days, so single-date checks are one bit test.
+ *
+ * Years are compiled lazily on first use from the holiday rules loaded
+ * out of the database, and shared by all callers under a read/write lock.
+ * A holiday write instead opens a private calendar over its pending rows,
+ * used by one thread without locking, and the shared holiday rules are
+ * only replaced once the write commits.
+ */
+
+#include "regislex/regislex.h"
+#include "database/database.h"
+#include "platform/platform.h"
+#include "utils/id_map.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define COURT_CALENDAR_MIN_YEAR       1
+#define COURT_CALENDAR_MAX_YEAR       9999
+
+/* Lower bound on court days per year, used to size range extensions */
+#define COURT_DAYS_PER_YEAR_MIN       200
+
+#define COURT_BIT_WORDS               ((366 + 31) / 32)
+
+/* ============================================================================
+ * Internal Structures
+ * ============================================================================ */
+
+typedef struct {
+    int64_t first_day;          /* Epoch day of January 1 */
+    int64_t base;               /* Court days in earlier loaded years */
+    int length;
+    int court_days;
+    uint32_t holiday_bits[COURT_BIT_WORDS];
+    uint32_t court_bits[COURT_BIT_WORDS];
+    uint16_t prefix[367];       /* Court days before each day of the year */
+    uint16_t select[366];       /* Day of year of each court day */
+} court_year_t;
+
+typedef struct {
+    char jurisdiction[128];
+    int first_year;
+    int year_count;
+    court_year_t* years;
+} court_calendar_t;
+
+/* A holiday rule set and the jurisdiction calendars compiled from it */
+struct regislex_court_calendar {
+    platform_rwlock_t* lock;    /* NULL for a private calendar */
+    regislex_id_map_t calendars;
+    regislex_holiday_t* holidays;
+    int holiday_count;
+};
+
+static platform_rwlock_t* court_lock = NULL;
+static regislex_court_calendar_t court_shared = {
+    NULL, { NULL, 0, 0, offsetof(court_calendar_t, jurisdiction) }, NULL, 0
+};
+
+/* Holiday rules queued to replace the shared ones at commit */
+typedef struct {
+    int count;
+    regislex_holiday_t holidays[];
+} court_swap_t;
+
+/* ============================================================================
+ * Jurisdiction Map
+ * ============================================================================ */
+
+static const char* jurisdiction_key(const char* jurisdiction) {
+    return jurisdiction ? jurisdiction : "";
+}
+
+static court_calendar_t* calendar_find(const regislex_court_calendar_t* set, const char* key) {
+    return (court_calendar_t*)regislex_id_map_get(&set->calendars, key);
+}
+
+/* Caller holds the write lock */
+static court_calendar_t* calendar_create(regislex_court_calendar_t* set, const char* key) {
+    if (strlen(key) >= sizeof(((court_calendar_t*)0)->jurisdiction)) {
+        return NULL;
+    }
+
+    court_calendar_t* cal = (court_calendar_t*)platform_calloc(1, sizeof(court_calendar_t));
+    if (!cal) return NULL;
+    strcpy(cal->jurisdiction, key);
+
+    if (regislex_id_map_insert(&set->calendars, cal) != REGISLEX_OK) {
+        platform_free(cal);
+        return NULL;
+    }
+    return cal;
+}
+
+/* ============================================================================
+ * Year Compilation
+ * ============================================================================ */
+
+static int year_of_day(int64_t day) {
+    regislex_datetime_t dt;
+    memset(&dt, 0, sizeof(dt));
+    regislex_datetime_from_days(day, &dt);
+    return dt.year;
+}
+
+static int64_t first_day_of_year(int year) {
+    regislex_datetime_t dt;
+    memset(&dt, 0, sizeof(dt));
+    dt.year = year;
+    dt.month = 1;
+    dt.day = 1;
+    return regislex_datetime_to_days(&dt);
+}
+
+static void bit_set(uint32_t* bits, int64_t index) {
+    bits[index >> 5] |= 1u << (index & 31);
+}
+
+static bool bit_test(const uint32_t* bits, int64_t index) {
+    return (bits[index >> 5] >> (index & 31)) & 1u;
+}
+
+static void year_mark(const court_year_t* y, uint32_t* bits, const regislex_datetime_t* date) {
+    int64_t doy = regislex_datetime_to_days(date) - y->first_day;
+    if (doy >= 0 && doy < y->length) bit_set(bits, doy);
+}
+
+/* Caller holds the lock that guards the set's holidays */
+static void year_compile(const regislex_court_calendar_t* set, court_year_t* y,
+                         const char* jurisdiction, int year) {
+    uint32_t closed[COURT_BIT_WORDS];
+
+    memset(y->holiday_bits, 0, sizeof(y->holiday_bits));
+    memset(y->court_bits, 0, sizeof(y->court_bits));
+    memset(closed, 0, sizeof(closed));
+
+    y->first_day = first_day_of_year(year);
+    y->length = (int)(first_day_of_year(year + 1) - y->first_day);
+    y->court_days = 0;
+
+    for (int i = 0; i < set->holiday_count; i++) {
+        const regislex_holiday_t* h = &set->holidays[i];
+        if (h->jurisdiction[0] && strcmp(h->jurisdiction, jurisdiction) != 0) continue;
+
+        /* Observed dates may shift across the year boundary */
+        for (int ry = year - 1; ry <= year + 1; ry++) {
+            regislex_datetime_t actual, observed;
+            if (regislex_holiday_occurrence(h, ry, &actual, &observed) != REGISLEX_OK) continue;
+
+            year_mark(y, y->holiday_bits, &actual);
+            year_mark(y, y->holiday_bits, &observed);
+            if (h->is_court_holiday) {
+                year_mark(y, closed, &actual);
+                year_mark(y, closed, &observed);
+            }
+        }
+    }
+
+    int weekday = (int)(((y->first_day + 3) % 7 + 7) % 7);   /* 0 = Monday */
+
+    for (int d = 0; d < y->length; d++) {
+        y->prefix[d] = (uint16_t)y->court_days;
+        if (weekday < 5 && !bit_test(closed, d)) {
+            bit_set(y->court_bits, d);
+            y->select[y->court_days++] = (uint16_t)d;
+        }
+        weekday = weekday == 6 ? 0 : weekday + 1;
+    }
+    y->prefix[y->length] = (uint16_t)y->court_days;
+}
+
+/* Caller holds the write lock */
+static regislex_error_t calendar_extend(const regislex_court_calendar_t* set, court_calendar_t* cal,
+                                        int lo, int hi) {
+    if (lo < COURT_CALENDAR_MIN_YEAR || hi > COURT_CALENDAR_MAX_YEAR || lo > hi) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    int old_first = cal->first_year;
+    int old_last = cal->first_year + cal->year_count - 1;
+
+    if (cal->year_count > 0) {
+        if (lo >= old_first && hi <= old_last) return REGISLEX_OK;
+        if (old_first < lo) lo = old_first;
+        if (old_last > hi) hi = old_last;
+    }
+
+    int count = hi - lo + 1;
+    court_year_t* years = (court_year_t*)platform_malloc((size_t)count * sizeof(court_year_t));
+    if (!years) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    int64_t base = 0;
+    for (int i = 0; i < count; i++) {
+        int year = lo + i;
+        if (cal->year_count > 0 && year >= old_first && year <= old_last) {
+            years[i] = cal->years[year - old_first];
+        } else {
+            year_compile(set, &years[i], cal->jurisdiction, year);
+        }
+        years[i].base = base;
+        base += years[i].court_days;
+    }
+
+    platform_free(cal->years);
+    cal->years = years;
+    cal->first_year = lo;
+    cal->year_count = count;
+    return REGISLEX_OK;
+}
+
+/* ============================================================================
+ * Lookups
+ * ============================================================================ */
+
+typedef struct {
+    int lo;
+    int hi;
+} court_range_t;
+
+static bool calendar_covers(const court_calendar_t* cal, int year) {
+    return cal && cal->year_count > 0 &&
+           year >= cal->first_year && year < cal->first_year + cal->year_count;
+}
+
+/* Widen the requested range so that it includes year */
+static void range_include(court_range_t* need, int year) {
+    if (need->lo > need->hi) {
+        need->lo = need->hi = year;
+        return;
+    }
+    if (year < need->lo) need->lo = year;
+    if (year > need->hi) need->hi = year;
+}
+
+static int64_t calendar_total(const court_calendar_t* cal) {
+    const court_year_t* last = &cal->years[cal->year_count - 1];
+    return last->base + last->court_days;
+}
+
+/* Court days in the loaded range strictly before day; its year must be loaded */
+static int64_t calendar_rank(const court_calendar_t* cal, int64_t day) {
+    const court_year_t* y = &cal->years[year_of_day(day) - cal->first_year];
+    return y->base + y->prefix[day - y->first_day];
+}
+
+/* Epoch day of the k-th (0-based) court day in the loaded range */
+static int64_t calendar_select(const court_calendar_t* cal, int64_t k) {
+    int lo = 0;
+    int hi = cal->year_count - 1;
+    while (lo < hi) {
+        int mid = lo + (hi - lo + 1) / 2;
+        if (cal->years[mid].base <= k) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    const court_year_t* y = &cal->years[lo];
+    return y->first_day + y->select[k - y->base];
+}
+
+/*
+ * Each try_* function answers from the loaded years, or returns
+ * REGISLEX_ERROR_NOT_FOUND with the years that must be loaded first.
+ */
+
+static regislex_error_t try_add(const court_calendar_t* cal, int64_t start, int days,
+                                int64_t* out_day, court_range_t* need) {
+    need->lo = 1;
+    need->hi = 0;
+
+    if (days > 0) {
+        int year = year_of_day(start + 1);
+        if (!calendar_covers(cal, year)) {
+            range_include(need, year);
+            range_include(need, year + days / COURT_DAYS_PER_YEAR_MIN + 1);
+            return REGISLEX_ERROR_NOT_FOUND;
+        }
+
+        int64_t k = calendar_rank(cal, start + 1) + days - 1;
+        int64_t total = calendar_total(cal);
+        if (k >= total) {
+            int last = cal->first_year + cal->year_count - 1;
+            range_include(need, last + (int)((k - total) / COURT_DAYS_PER_YEAR_MIN) + 1);
+            return REGISLEX_ERROR_NOT_FOUND;
+        }
+
+        *out_day = calendar_select(cal, k);
+    } else if (days < 0) {
+        int year = year_of_day(start);
+        if (!calendar_covers(cal, year)) {
+            range_include(need, year);
+            range_include(need, year + days / COURT_DAYS_PER_YEAR_MIN - 1);
+            return REGISLEX_ERROR_NOT_FOUND;
+        }
+
+        int64_t k = calendar_rank(cal, start) + days;
+        if (k < 0) {
+            range_include(need, cal->first_year + (int)(k / COURT_DAYS_PER_YEAR_MIN) - 1);
+            return REGISLEX_ERROR_NOT_FOUND;
+        }
+
+        *out_day = calendar_select(cal, k);
+    } else {
+        *out_day = start;
+    }
+
+    return REGISLEX_OK;
+}
+
+static regislex_error_t try_between(const court_calendar_t* cal, int64_t from, int64_t to,
+                                    int64_t* out_count, court_range_t* need) {
+    need->lo = 1;
+    need->hi = 0;
+
+    int from_year = year_of_day(from + 1);
+    int to_year = year_of_day(to + 1);
+    if (!calendar_covers(cal, from_year) || !calendar_covers(cal, to_year)) {
+        range_include(need, from_year);
+        range_include(need, to_year);
+        return REGISLEX_ERROR_NOT_FOUND;
+    }
+
+    *out_count = calendar_rank(cal, to + 1) - calendar_rank(cal, from + 1);
+    return REGISLEX_OK;
+}
+
+/* Test the holiday set or the court-day set for one date */
+static regislex_error_t try_bit(const court_calendar_t* cal, int64_t day, bool holiday,
+                                bool* out, court_range_t* need) {
+    need->lo = 1;
+    need->hi = 0;
+
+    int year = year_of_day(day);
+    if (!calendar_covers(cal, year)) {
+        range_include(need, year);
+        return REGISLEX_ERROR_NOT_FOUND;
+    }
+
+    const court_year_t* y = &cal->years[year - cal->first_year];
+    int doy = (int)(day - y->first_day);
+    *out = bit_test(holiday ? y->holiday_bits : y->court_bits, doy);
+    return REGISLEX_OK;
+}
+
+static void set_rdlock(const regislex_court_calendar_t* set) {
+    if (set->lock) platform_rwlock_rdlock(set->lock);
+}
+
+static void set_wrlock(const regislex_court_calendar_t* set) {
+    if (set->lock) platform_rwlock_wrlock(set->lock);
+}
+
+static void set_unlock(const regislex_court_calendar_t* set) {
+    if (set->lock) platform_rwlock_unlock(set->lock);
+}
+
+/* Load the requested years, creating the jurisdiction calendar if needed */
+static regislex_error_t calendar_load(regislex_court_calendar_t* set, const char* key,
+                                      const court_range_t* need) {
+    set_wrlock(set);
+
+    regislex_error_t err = REGISLEX_OK;
+    court_calendar_t* cal = calendar_find(set, key);
+    if (!cal) {
+        cal = calendar_create(set, key);
+        if (!cal) err = REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    if (err == REGISLEX_OK) {
+        err = calendar_extend(set, cal, need->lo, need->hi);
+    }
+
+    set_unlock(set);
+    return err;
+}
+
+/* ============================================================================
+ * Calendar Lifecycle
+ * ============================================================================ */
+
+/* Caller holds the write lock */
+static void calendars_drop(regislex_court_calendar_t* set, const char* jurisdiction) {
+    for (int i = 0; i < set->calendars.capacity; i++) {
+        court_calendar_t* cal = (court_calendar_t*)set->calendars.slots[i];
+        if (cal && (!jurisdiction || strcmp(cal->jurisdiction, jurisdiction) == 0)) {
+            platform_free(cal->years);
+            cal->years = NULL;
+            cal->first_year = 0;
+            cal->year_count = 0;
+        }
+    }
+}
+
+/* Caller holds the write lock */
+static void calendars_free(regislex_court_calendar_t* set) {
+    for (int i = 0; i < set->calendars.capacity; i++) {
+        court_calendar_t* cal = (court_calendar_t*)set->calendars.slots[i];
+        if (cal) {
+            platform_free(cal->years);
+            platform_free(cal);
+        }
+    }
+    regislex_id_map_free(&set->calendars);
+    platform_free(set->holidays);
+    set->holidays = NULL;
+    set->holiday_count = 0;
+}
+
+/* Read every holiday rule visible to the calling thread's connection */
+static regislex_error_t holidays_load(regislex_context_t* ctx, regislex_holiday_t** out_holidays,
+                                      int* out_count) {
+    regislex_holiday_t** rules = NULL;
+    int count = 0;
+    regislex_error_t err = regislex_holiday_rules(ctx, NULL, &rules, &count);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_holiday_t* holidays = NULL;
+    if (count > 0) {
+        holidays = (regislex_holiday_t*)platform_malloc((size_t)count * sizeof(regislex_holiday_t));
+        if (!holidays) {
+            regislex_holiday_list_free(rules, count);
+            return REGISLEX_ERROR_OUT_OF_MEMORY;
+        }
+        for (int i = 0; i < count; i++) {
+            holidays[i] = *rules[i];
+        }
+    }
+    regislex_holiday_list_free(rules, count);
+
+    *out_holidays = holidays;
+    *out_count = count;
+    return REGISLEX_OK;
+}
+
+/* Install new shared holiday rules, taking ownership of the array */
+static void shared_replace(regislex_holiday_t* holidays, int count) {
+    platform_rwlock_wrlock(court_lock);
+    regislex_holiday_t* old = court_shared.holidays;
+    court_shared.holidays = holidays;
+    court_shared.holiday_count = count;
+    calendars_drop(&court_shared, NULL);
+    platform_rwlock_unlock(court_lock);
+
+    platform_free(old);
+}
+
+REGISLEX_API regislex_error_t regislex_court_calendar_init(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (court_lock == NULL) {
+        if (platform_rwlock_create(&court_lock) != PLATFORM_OK) {
+            return REGISLEX_ERROR;
+        }
+        court_shared.lock = court_lock;
+    }
+
+    return regislex_court_calendar_reload(ctx);
+}
+
+REGISLEX_API void regislex_court_calendar_shutdown(void) {
+    if (!court_lock) return;
+
+    platform_rwlock_wrlock(court_lock);
+    calendars_free(&court_shared);
+    platform_rwlock_unlock(court_lock);
+
+    platform_rwlock_destroy(court_lock);
+    court_lock = NULL;
+    court_shared.lock = NULL;
+}
+
+REGISLEX_API void regislex_court_calendar_invalidate(const char* jurisdiction) {
+    if (!court_lock) return;
+
+    platform_rwlock_wrlock(court_lock);
+    calendars_drop(&court_shared, jurisdiction);
+    platform_rwlock_unlock(court_lock);
+}
+
+REGISLEX_API regislex_error_t regislex_court_calendar_reload(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!court_lock) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    regislex_holiday_t* holidays = NULL;
+    int count = 0;
+    regislex_error_t err = holidays_load(ctx, &holidays, &count);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    shared_replace(holidays, count);
+    return REGISLEX_OK;
+}
+
+/* ============================================================================
+ * Private Calendars
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_court_calendar_open(
+    regislex_context_t* ctx,
+    regislex_court_calendar_t** out_calendar)
+{
+    if (!ctx || !out_calendar) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    *out_calendar = NULL;
+
+    regislex_court_calendar_t* set =
+        (regislex_court_calendar_t*)platform_calloc(1, sizeof(regislex_court_calendar_t));
+    if (!set) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    regislex_id_map_init(&set->calendars, offsetof(court_calendar_t, jurisdiction));
+
+    regislex_error_t err = holidays_load(ctx, &set->holidays, &set->holiday_count);
+    if (err != REGISLEX_OK) {
+        platform_free(set);
+        return err;
+    }
+
+    *out_calendar = set;
+    return REGISLEX_OK;
+}
+
+REGISLEX_API void regislex_court_calendar_close(regislex_court_calendar_t* calendar) {
+    if (!calendar) return;
+
+    calendars_free(calendar);
+    platform_free(calendar);
+}
+
+/* Replace the shared holiday rules with the ones published at commit */
+static void court_swap_run(void* data) {
+    const court_swap_t* swap = (const court_swap_t*)data;
+    if (!court_lock) return;
+
+    regislex_holiday_t* holidays = NULL;
+    if (swap->count > 0) {
+        holidays = (regislex_holiday_t*)platform_malloc((size_t)swap->count * sizeof(regislex_holiday_t));
+        if (!holidays) {
+            /* Keep the shared calendar correct even if it cannot take the copy */
+            platform_rwlock_wrlock(court_lock);
+            calendars_drop(&court_shared, NULL);
+            platform_rwlock_unlock(court_lock);
+            return;
+        }
+        memcpy(holidays, swap->holidays, (size_t)swap->count * sizeof(regislex_holiday_t));
+    }
+    shared_replace(holidays, swap->count);
+}
+
+REGISLEX_API regislex_error_t regislex_court_calendar_publish(
+    regislex_context_t* ctx,
+    const regislex_court_calendar_t* calendar)
+{
+    if (!ctx || !calendar) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!court_lock) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    court_swap_t* swap = (court_swap_t*)platform_malloc(
+        sizeof(court_swap_t) + (size_t)calendar->holiday_count * sizeof(regislex_holiday_t));
+    if (!swap) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    swap->count = calendar->holiday_count;
+    if (swap->count > 0) {
+        memcpy(swap->holidays, calendar->holidays, (size_t)swap->count * sizeof(regislex_holiday_t));
+    }
+
+    return regislex_db_after_commit(regislex_get_db(ctx), court_swap_run, swap);
+}
+
+/* ============================================================================
+ * Court Day Arithmetic
+ * ============================================================================ */
+
+/* A NULL calendar means the shared one */
+static regislex_court_calendar_t* calendar_resolve(regislex_court_calendar_t* calendar) {
+    if (calendar) return calendar;
+    return court_lock ? &court_shared : NULL;
+}
+
+static regislex_error_t court_days_add(regislex_court_calendar_t* set,
+                                       const char* jurisdiction,
+                                       const regislex_datetime_t* start,
+                                       int days,
+                                       regislex_datetime_t* out_date) {
+    if (!regislex_datetime_is_valid_date(start)) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!set) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    const char* key = jurisdiction_key(jurisdiction);
+    int64_t start_day = regislex_datetime_to_days(start);
+    int64_t result = 0;
+    court_range_t need;
+    regislex_error_t err;
+
+    for (;;) {
+        set_rdlock(set);
+        err = try_add(calendar_find(set, key), start_day, days, &result, &need);
+        set_unlock(set);
+
+        if (err != REGISLEX_ERROR_NOT_FOUND) break;
+
+        err = calendar_load(set, key, &need);
+        if (err != REGISLEX_OK) return err;
+    }
+
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    if (out_date != start) {
+        memcpy(out_date, start, sizeof(regislex_datetime_t));
+    }
+    regislex_datetime_from_days(result, out_date);
+    return REGISLEX_OK;
+}
+
+/* Look up one date in the holiday set or the court-day set */
+static regislex_error_t calendar_test(regislex_court_calendar_t* set, const char* jurisdiction,
+                                      const regislex_datetime_t* date, bool holiday, bool* out) {
+    if (!regislex_datetime_is_valid_date(date)) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!set) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    const char* key = jurisdiction_key(jurisdiction);
+    int64_t day = regislex_datetime_to_days(date);
+    court_range_t need;
+    regislex_error_t err;
+
+    for (;;) {
+        set_rdlock(set);
+        err = try_bit(calendar_find(set, key), day, holiday, out, &need);
+        set_unlock(set);
+
+        if (err != REGISLEX_ERROR_NOT_FOUND) break;
+
+        err = calendar_load(set, key, &need);
+        if (err != REGISLEX_OK) return err;
+    }
+
+    return err;
+}
+
+REGISLEX_API regislex_error_t regislex_court_days_add(
+    regislex_context_t* ctx,
+    const char* jurisdiction,
+    const regislex_datetime_t* start,
+    int days,
+    regislex_datetime_t* out_date)
+{
+    if (!ctx || !start || !out_date) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    return court_days_add(calendar_resolve(NULL), jurisdiction, start, days, out_date);
+}
+
+REGISLEX_API regislex_error_t regislex_court_calendar_days_add(
+    regislex_court_calendar_t* calendar,
+    const char* jurisdiction,
+    const regislex_datetime_t* start,
+    int days,
+    regislex_datetime_t* out_date)
+{
+    if (!start || !out_date) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    return court_days_add(calendar_resolve(calendar), jurisdiction, start, days, out_date);
+}
+
+REGISLEX_API regislex_error_t regislex_court_days_between(
+    regislex_context_t* ctx,
+    const char* jurisdiction,
+    const regislex_datetime_t* from,
+    const regislex_datetime_t* to,
+    int* count)
+{
+    if (!ctx || !from || !to || !count) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!regislex_datetime_is_valid_date(from) || !regislex_datetime_is_valid_date(to)) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!court_lock) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    const char* key = jurisdiction_key(jurisdiction);
+    int64_t result = 0;
+    court_range_t need;
+    regislex_error_t err;
+
+    for (;;) {
+        platform_rwlock_rdlock(court_lock);
+        err = try_between(calendar_find(&court_shared, key), regislex_datetime_to_days(from),
+                          regislex_datetime_to_days(to), &result, &need);
+        platform_rwlock_unlock(court_lock);
+
+        if (err != REGISLEX_ERROR_NOT_FOUND) break;
+
+        err = calendar_load(&court_shared, key, &need);
+        if (err != REGISLEX_OK) return err;
+    }
+
+    if (err == REGISLEX_OK) {
+        *count = (int)result;
+    }
+    return err;
+}
+
+REGISLEX_API regislex_error_t regislex_is_business_day(
+    regislex_context_t* ctx,
+    const regislex_datetime_t* date,
+    const char* jurisdiction,
+    bool* is_business_day)
+{
+    if (!ctx || !date || !is_business_day) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    return calendar_test(calendar_resolve(NULL), jurisdiction, date, false, is_business_day);
+}
+
+REGISLEX_API regislex_error_t regislex_court_calendar_is_business_day(
+    regislex_court_calendar_t* calendar,
+    const regislex_datetime_t* date,
+    const char* jurisdiction,
+    bool* is_business_day)
+{
+    if (!date || !is_business_day) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    return calendar_test(calendar_resolve(calendar), jurisdiction, date, false, is_business_day);
+}
+
+REGISLEX_API regislex_error_t regislex_court_calendar_deadline(
+    regislex_court_calendar_t* calendar,
+    const char* jurisdiction,
+    const regislex_datetime_t* trigger,
+    int days,
+    bool business_days,
+    bool roll_forward,
+    regislex_datetime_t* out_date)
+{
+    if (!trigger || !out_date || !regislex_datetime_is_valid_date(trigger)) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    /* Days are counted from the court's date of the trigger instant */
+    const regislex_tz_t* tz = regislex_court_zone(jurisdiction);
+    regislex_datetime_t local = *trigger;
+    regislex_error_t err = tz ? regislex_datetime_to_zone(trigger, tz, &local) : REGISLEX_OK;
+
+    regislex_court_calendar_t* set = calendar_resolve(calendar);
+    if (err == REGISLEX_OK) {
+        err = business_days ? court_days_add(set, jurisdiction, &local, days, &local)
+                            : regislex_datetime_add_days(&local, days);
+    }
+    if (err == REGISLEX_OK && roll_forward) {
+        bool open_day = true;
+        err = calendar_test(set, jurisdiction, &local, false, &open_day);
+        if (err == REGISLEX_OK && !open_day) {
+            err = court_days_add(set, jurisdiction, &local, days < 0 ? -1 : 1, &local);
+        }
+    }
+
+    /* The offset may differ from the trigger's once a DST change is crossed */
+    if (err == REGISLEX_OK && tz) {
+        err = regislex_datetime_from_zone(&local, tz, &local);
+    }
+    if (err == REGISLEX_OK) {
+        *out_date = local;
+    }
+    return err;
+}
+
+REGISLEX_API regislex_error_t regislex_holiday_check(
+    regislex_context_t* ctx,
+    const regislex_datetime_t* date,
+    const char* jurisdiction,
+    bool* is_holiday)
+{
+    if (!ctx || !date || !is_holiday) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    return calendar_test(calendar_resolve(NULL), jurisdiction, date, true, is_holiday);
+}
@@ -0,0 +1,1280 @@
+/**
+ * @file court_rules.c
+ * @brief Court Rules Engine
+ *
+ * A rule set compiles into a dependency graph: each rule hangs off either
+ * a trigger event or another rule. Recording a trigger walks the rules
+ * reachable from that event in topological order, computes their dates
+ * on the jurisdiction's court calendar, and writes the resulting deadlines
+ * in one transaction. Moving a trigger touches only its descendants.
+ *
+ * Every open rule deadline is indexed by its anchor-to-due window (see
+ * rule_windows.c). Adding or removing a court holiday recomputes only the
+ * trigger chains whose windows cover it, in one transaction, and each
+ * date that moves is written to the deadline_shifts log.
+ *
+ * Compiled sets are cached by id and reference counted, so a set deleted
+ * while a trigger is being recorded stays valid until it is released.
+ */
+
+#include "regislex/regislex.h"
+#include "database/database.h"
+#include "platform/platform.h"
+#include "utils/id_map.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * Internal Structures
+ * ============================================================================ */
+
+typedef struct {
+    regislex_uuid_t id;
+    char jurisdiction[128];
+    int rule_count;
+    regislex_court_rule_t* rules;
+    int* parent;            /* Anchor rule index, or -1 for trigger-anchored rules */
+    int* child_start;       /* Children of rule i are child_index[child_start[i]..child_start[i+1]) */
+    int* child_index;
+    int* by_id;             /* Rule indexes sorted by rule id */
+    int refs;
+    bool removed;
+} compiled_set_t;
+
+static platform_mutex_t* rules_mutex = NULL;
+static regislex_id_map_t rule_sets = { NULL, 0, 0, offsetof(compiled_set_t, id.value) };
+
+/* ============================================================================
+ * Rule Graph Compilation
+ * ============================================================================ */
+
+static void compiled_free(compiled_set_t* cs) {
+    if (!cs) return;
+    platform_free(cs->rules);
+    platform_free(cs->parent);
+    platform_free(cs->child_start);
+    platform_free(cs->child_index);
+    platform_free(cs->by_id);
+    platform_free(cs);
+}
+
+static int find_code(const regislex_court_rule_t* rules, int count, const char* code) {
+    for (int i = 0; i < count; i++) {
+        if (strcmp(rules[i].code, code) == 0) return i;
+    }
+    return -1;
+}
+
+static int compare_rule_ids(const void* a, const void* b) {
+    const regislex_court_rule_t* ra = *(const regislex_court_rule_t* const*)a;
+    const regislex_court_rule_t* rb = *(const regislex_court_rule_t* const*)b;
+    return strcmp(ra->id.value, rb->id.value);
+}
+
+/*
+ * Resolve dependencies and check that the graph is acyclic. Takes
+ * ownership of rules. Rules must already carry their ids.
+ */
+static regislex_error_t compile_rules(regislex_court_rule_t* rules, int count,
+                                      compiled_set_t** out) {
+    compiled_set_t* cs = (compiled_set_t*)platform_calloc(1, sizeof(compiled_set_t));
+    if (!cs) {
+        platform_free(rules);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    cs->rules = rules;
+    cs->rule_count = count;
+    cs->parent = (int*)platform_calloc((size_t)count + 1, sizeof(int));
+    cs->child_start = (int*)platform_calloc((size_t)count + 2, sizeof(int));
+    cs->child_index = (int*)platform_calloc((size_t)count + 1, sizeof(int));
+    cs->by_id = (int*)platform_calloc((size_t)count + 1, sizeof(int));
+    if (!cs->parent || !cs->child_start || !cs->child_index || !cs->by_id) {
+        compiled_free(cs);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    for (int i = 0; i < count; i++) {
+        const regislex_court_rule_t* r = &rules[i];
+        bool has_trigger = r->trigger_event[0] != '\0';
+        bool has_parent = r->depends_on[0] != '\0';
+
+        if (!r->code[0] || !r->title[0] || has_trigger == has_parent ||
+            find_code(rules, i, r->code) >= 0) {
+            compiled_free(cs);
+            return REGISLEX_ERROR_VALIDATION;
+        }
+
+        cs->parent[i] = -1;
+        if (has_parent) {
+            cs->parent[i] = find_code(rules, count, r->depends_on);
+            if (cs->parent[i] < 0 || cs->parent[i] == i) {
+                compiled_free(cs);
+                return REGISLEX_ERROR_VALIDATION;
+            }
+            cs->child_start[cs->parent[i] + 1]++;
+        }
+    }
+
+    /* Children in compressed-row form */
+    for (int i = 0; i < count; i++) {
+        cs->child_start[i + 1] += cs->child_start[i];
+    }
+    int* fill = (int*)platform_calloc((size_t)count + 1, sizeof(int));
+    if (!fill) {
+        compiled_free(cs);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    for (int i = 0; i < count; i++) {
+        int p = cs->parent[i];
+        if (p >= 0) {
+            cs->child_index[cs->child_start[p] + fill[p]++] = i;
+        }
+    }
+
+    /* Every rule must be reachable from a trigger; otherwise it sits on a cycle */
+    int reached = 0;
+    int* queue = fill;
+    for (int i = 0; i < count; i++) {
+        if (cs->parent[i] < 0) queue[reached++] = i;
+    }
+    for (int head = 0; head < reached; head++) {
+        int r = queue[head];
+        for (int c = cs->child_start[r]; c < cs->child_start[r + 1]; c++) {
+            queue[reached++] = cs->child_index[c];
+        }
+    }
+    platform_free(fill);
+
+    if (reached != count) {
+        compiled_free(cs);
+        return REGISLEX_ERROR_VALIDATION;
+    }
+
+    const regislex_court_rule_t** sorted = (const regislex_court_rule_t**)platform_malloc(
+        ((size_t)count + 1) * sizeof(regislex_court_rule_t*));
+    if (!sorted) {
+        compiled_free(cs);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    for (int i = 0; i < count; i++) {
+        sorted[i] = &rules[i];
+    }
+    qsort(sorted, (size_t)count, sizeof(regislex_court_rule_t*), compare_rule_ids);
+    for (int i = 0; i < count; i++) {
+        cs->by_id[i] = (int)(sorted[i] - rules);
+    }
+    platform_free(sorted);
+
+    *out = cs;
+    return REGISLEX_OK;
+}
+
+static int rule_index_by_id(const compiled_set_t* cs, const char* id) {
+    int lo = 0;
+    int hi = cs->rule_count - 1;
+    while (lo <= hi) {
+        int mid = lo + (hi - lo) / 2;
+        int cmp = strcmp(cs->rules[cs->by_id[mid]].id.value, id);
+        if (cmp == 0) return cs->by_id[mid];
+        if (cmp < 0) lo = mid + 1;
+        else hi = mid - 1;
+    }
+    return -1;
+}
+
+/* ============================================================================
+ * Compiled Set Cache
+ * ============================================================================ */
+
+/* Caller holds rules_mutex */
+static void set_remove(const regislex_uuid_t* id) {
+    compiled_set_t* cs = (compiled_set_t*)regislex_id_map_remove(&rule_sets, id->value);
+    if (!cs) return;
+
+    cs->removed = true;
+    if (cs->refs == 0) compiled_free(cs);
+}
+
+static void rule_from_row(regislex_db_stmt_t* stmt, regislex_court_rule_t* r) {
+    int col = 0;
+
+    regislex_db_column_uuid(stmt, col++, &r->id);
+
+    const char* code = regislex_db_column_text(stmt, col++);
+    if (code) strncpy(r->code, code, sizeof(r->code) - 1);
+
+    const char* title = regislex_db_column_text(stmt, col++);
+    if (title) strncpy(r->title, title, sizeof(r->title) - 1);
+
+    const char* trigger_event = regislex_db_column_text(stmt, col++);
+    if (trigger_event) strncpy(r->trigger_event, trigger_event, sizeof(r->trigger_event) - 1);
+
+    const char* depends_on = regislex_db_column_text(stmt, col++);
+    if (depends_on) strncpy(r->depends_on, depends_on, sizeof(r->depends_on) - 1);
+
+    r->days = (int)regislex_db_column_int(stmt, col++);
+    r->count_business_days = regislex_db_column_int(stmt, col++) != 0;
+    r->roll_forward = regislex_db_column_int(stmt, col++) != 0;
+    r->deadline_type = (regislex_deadline_type_t)regislex_db_column_int(stmt, col++);
+    r->priority = (regislex_priority_t)regislex_db_column_int(stmt, col++);
+
+    const char* rule_reference = regislex_db_column_text(stmt, col++);
+    if (rule_reference) strncpy(r->rule_reference, rule_reference, sizeof(r->rule_reference) - 1);
+}
+
+static regislex_error_t load_rule_set(regislex_db_context_t* db, const regislex_uuid_t* id,
+                                      compiled_set_t** out) {
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "SELECT jurisdiction FROM court_rule_sets WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    char jurisdiction[128] = "";
+    regislex_db_bind_uuid(stmt, 1, id);
+    err = regislex_db_step(stmt);
+    if (err == REGISLEX_OK) {
+        const char* j = regislex_db_column_text(stmt, 0);
+        if (j) strncpy(jurisdiction, j, sizeof(jurisdiction) - 1);
+    }
+    regislex_db_finalize(stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    err = regislex_db_prepare(db,
+        "SELECT id, code, title, trigger_event, depends_on, days, count_business_days,"
+        "  roll_forward, deadline_type, priority, rule_reference "
+        "FROM court_rules WHERE rule_set_id = ? ORDER BY position", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+    regislex_db_bind_uuid(stmt, 1, id);
+
+    regislex_court_rule_t* rules = NULL;
+    int count = 0;
+    int capacity = 0;
+
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        if (count >= capacity) {
+            int new_capacity = capacity ? capacity * 2 : 16;
+            regislex_court_rule_t* grown = (regislex_court_rule_t*)platform_realloc(
+                rules, (size_t)new_capacity * sizeof(regislex_court_rule_t));
+            if (!grown) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            rules = grown;
+            capacity = new_capacity;
+        }
+        memset(&rules[count], 0, sizeof(regislex_court_rule_t));
+        rule_from_row(stmt, &rules[count++]);
+    }
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        platform_free(rules);
+        return err;
+    }
+
+    compiled_set_t* cs = NULL;
+    err = compile_rules(rules, count, &cs);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    cs->id = *id;
+    strncpy(cs->jurisdiction, jurisdiction, sizeof(cs->jurisdiction) - 1);
+    *out = cs;
+    return REGISLEX_OK;
+}
+
+static regislex_error_t acquire_set(regislex_db_context_t* db, const regislex_uuid_t* id,
+                                    compiled_set_t** out) {
+    platform_mutex_lock(rules_mutex);
+    compiled_set_t* cached = (compiled_set_t*)regislex_id_map_get(&rule_sets, id->value);
+    if (cached) {
+        cached->refs++;
+        *out = cached;
+        platform_mutex_unlock(rules_mutex);
+        return REGISLEX_OK;
+    }
+    platform_mutex_unlock(rules_mutex);
+
+    compiled_set_t* cs = NULL;
+    regislex_error_t err = load_rule_set(db, id, &cs);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    platform_mutex_lock(rules_mutex);
+    cached = (compiled_set_t*)regislex_id_map_get(&rule_sets, id->value);
+    if (cached) {
+        /* Another caller compiled it first */
+        compiled_free(cs);
+        cs = cached;
+    } else if (regislex_id_map_insert(&rule_sets, cs) != REGISLEX_OK) {
+        platform_mutex_unlock(rules_mutex);
+        compiled_free(cs);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    cs->refs++;
+    platform_mutex_unlock(rules_mutex);
+
+    *out = cs;
+    return REGISLEX_OK;
+}
+
+static void release_set(compiled_set_t* cs) {
+    platform_mutex_lock(rules_mutex);
+    cs->refs--;
+    bool dead = cs->removed && cs->refs == 0;
+    platform_mutex_unlock(rules_mutex);
+
+    if (dead) compiled_free(cs);
+}
+
+/* ============================================================================
+ * Date Computation
+ * ============================================================================ */
+
+static regislex_error_t rule_compute(regislex_court_calendar_t* calendar, const compiled_set_t* cs,
+                                     const regislex_court_rule_t* rule,
+                                     const regislex_datetime_t* anchor,
+                                     regislex_datetime_t* out) {
+    return regislex_court_calendar_deadline(calendar, cs->jurisdiction, anchor, rule->days,
+                                            rule->count_business_days, rule->roll_forward, out);
+}
+
+static bool same_date(const regislex_datetime_t* a, const regislex_datetime_t* b) {
+    return a->year == b->year && a->month == b->month && a->day == b->day &&
+           a->hour == b->hour && a->minute == b->minute && a->second == b->second;
+}
+
+/* ============================================================================
+ * Rules Engine Lifecycle
+ * ============================================================================ */
+
+/* Fills the rule window index; defined with the trigger functions below */
+static regislex_error_t windows_reindex(regislex_context_t* ctx);
+
+REGISLEX_API regislex_error_t regislex_court_rules_init(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (rules_mutex == NULL) {
+        if (platform_mutex_create(&rules_mutex) != PLATFORM_OK) {
+            return REGISLEX_ERROR;
+        }
+    }
+
+    regislex_error_t err = regislex_rule_windows_init();
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+    return windows_reindex(ctx);
+}
+
+REGISLEX_API void regislex_court_rules_shutdown(void) {
+    regislex_rule_windows_shutdown();
+    if (!rules_mutex) return;
+
+    platform_mutex_lock(rules_mutex);
+    for (int i = 0; i < rule_sets.capacity; i++) {
+        compiled_free((compiled_set_t*)rule_sets.slots[i]);
+    }
+    regislex_id_map_free(&rule_sets);
+    platform_mutex_unlock(rules_mutex);
+
+    platform_mutex_destroy(rules_mutex);
+    rules_mutex = NULL;
+}
+
+/* ============================================================================
+ * Rule Set Functions
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_court_rule_set_create(
+    regislex_context_t* ctx,
+    const regislex_court_rule_set_t* rule_set,
+    const regislex_court_rule_t* rules,
+    int rule_count,
+    regislex_court_rule_set_t** out_rule_set)
+{
+    if (!ctx || !rule_set || !out_rule_set || rule_count < 0 || (rule_count > 0 && !rules)) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!rule_set->name[0]) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+
+    regislex_court_rule_t* copy = (regislex_court_rule_t*)platform_malloc(
+        ((size_t)rule_count + 1) * sizeof(regislex_court_rule_t));
+    if (!copy) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    if (rule_count > 0) {
+        memcpy(copy, rules, (size_t)rule_count * sizeof(regislex_court_rule_t));
+    }
+    for (int i = 0; i < rule_count; i++) {
+        regislex_uuid_generate(&copy[i].id);
+    }
+
+    /* Reject bad graphs before anything is written */
+    compiled_set_t* cs = NULL;
+    regislex_error_t err = compile_rules(copy, rule_count, &cs);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_court_rule_set_t* new_set = (regislex_court_rule_set_t*)platform_malloc(
+        sizeof(regislex_court_rule_set_t));
+    if (!new_set) {
+        compiled_free(cs);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    *new_set = *rule_set;
+    if (new_set->id.value[0] == '\0') {
+        regislex_uuid_generate(&new_set->id);
+    }
+    regislex_datetime_now(&new_set->created_at);
+
+    cs->id = new_set->id;
+    strncpy(cs->jurisdiction, new_set->jurisdiction, sizeof(cs->jurisdiction) - 1);
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_transaction_t* tx = NULL;
+    err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) {
+        compiled_free(cs);
+        platform_free(new_set);
+        return err;
+    }
+
+    regislex_db_stmt_t* stmt = NULL;
+    err = regislex_db_prepare(db,
+        "INSERT INTO court_rule_sets (id, name, jurisdiction, description, created_at) "
+        "VALUES (?, ?, ?, ?, ?)", &stmt);
+    if (err == REGISLEX_OK) {
+        regislex_db_bind_uuid(stmt, 1, &new_set->id);
+        regislex_db_bind_text(stmt, 2, new_set->name);
+        regislex_db_bind_text(stmt, 3, new_set->jurisdiction);
+        regislex_db_bind_text(stmt, 4, new_set->description);
+        regislex_db_bind_datetime(stmt, 5, &new_set->created_at);
+        err = regislex_db_step(stmt);
+        regislex_db_finalize(stmt);
+        if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
+    }
+
+    if (err == REGISLEX_OK) {
+        err = regislex_db_prepare(db,
+            "INSERT INTO court_rules (id, rule_set_id, position, code, title, trigger_event,"
+            "  depends_on, days, count_business_days, roll_forward, deadline_type, priority,"
+            "  rule_reference) "
+            "VALUES (?, ?, ?, ?, ?, NULLIF(?, ''), NULLIF(?, ''), ?, ?, ?, ?, ?, ?)", &stmt);
+    }
+
+    for (int i = 0; err == REGISLEX_OK && i < cs->rule_count; i++) {
+        const regislex_court_rule_t* r = &cs->rules[i];
+        int idx = 1;
+        regislex_db_bind_uuid(stmt, idx++, &r->id);
+        regislex_db_bind_uuid(stmt, idx++, &new_set->id);
+        regislex_db_bind_int(stmt, idx++, i);
+        regislex_db_bind_text(stmt, idx++, r->code);
+        regislex_db_bind_text(stmt, idx++, r->title);
+        regislex_db_bind_text(stmt, idx++, r->trigger_event);
+        regislex_db_bind_text(stmt, idx++, r->depends_on);
+        regislex_db_bind_int(stmt, idx++, r->days);
+        regislex_db_bind_int(stmt, idx++, r->count_business_days ? 1 : 0);
+        regislex_db_bind_int(stmt, idx++, r->roll_forward ? 1 : 0);
+        regislex_db_bind_int(stmt, idx++, r->deadline_type);
+        regislex_db_bind_int(stmt, idx++, r->priority);
+        regislex_db_bind_text(stmt, idx++, r->rule_reference);
+
+        err = regislex_db_step(stmt);
+        if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
+        regislex_db_reset(stmt);
+    }
+    if (stmt) {
+        regislex_db_finalize(stmt);
+    }
+
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        compiled_free(cs);
+        platform_free(new_set);
+        return err;
+    }
+
+    if (rules_mutex) {
+        platform_mutex_lock(rules_mutex);
+        if (regislex_id_map_insert(&rule_sets, cs) != REGISLEX_OK) {
+            compiled_free(cs);   /* Compiled again on first use */
+        }
+        platform_mutex_unlock(rules_mutex);
+    } else {
+        compiled_free(cs);
+    }
+
+    *out_rule_set = new_set;
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_court_rule_set_delete(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* id)
+{
+    if (!ctx || !id) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, "DELETE FROM court_rule_sets WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_bind_uuid(stmt, 1, id);
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+    if (regislex_db_changes(db) == 0) {
+        return REGISLEX_ERROR_NOT_FOUND;
+    }
+
+    if (rules_mutex) {
+        platform_mutex_lock(rules_mutex);
+        set_remove(id);
+        platform_mutex_unlock(rules_mutex);
+    }
+
+    return REGISLEX_OK;
+}
+
+REGISLEX_API void regislex_court_rule_set_free(regislex_court_rule_set_t* rule_set) {
+    platform_free(rule_set);
+}
+
+/* ============================================================================
+ * Trigger Events
+ * ============================================================================ */
+
+typedef struct {
+    bool exists;
+    regislex_uuid_t deadline_id;
+    regislex_datetime_t due_date;
+    regislex_status_t status;
+} existing_deadline_t;
+
+/* Load the deadlines this case already has from the set, indexed by rule */
+static regislex_error_t load_existing(regislex_db_context_t* db, const compiled_set_t* cs,
+                                      const regislex_uuid_t* case_id,
+                                      existing_deadline_t* existing) {
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "SELECT rd.rule_id, d.id, d.due_date, d.status "
+        "FROM rule_deadlines rd JOIN deadlines d ON d.id = rd.deadline_id "
+        "WHERE rd.case_id = ? AND rd.rule_set_id = ?", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_bind_uuid(stmt, 1, case_id);
+    regislex_db_bind_uuid(stmt, 2, &cs->id);
+
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        const char* rule_id = regislex_db_column_text(stmt, 0);
+        int index = rule_id ? rule_index_by_id(cs, rule_id) : -1;
+        if (index < 0) continue;
+
+        existing_deadline_t* e = &existing[index];
+        e->exists = true;
+        regislex_db_column_uuid(stmt, 1, &e->deadline_id);
+        regislex_db_column_datetime(stmt, 2, &e->due_date);
+        e->status = (regislex_status_t)regislex_db_column_int(stmt, 3);
+    }
+    regislex_db_finalize(stmt);
+
+    return err == REGISLEX_ERROR_NOT_FOUND ? REGISLEX_OK : err;
+}
+
+/* A rule deadline written in the current transaction, published once it commits */
+typedef struct {
+    regislex_uuid_t deadline_id;
+    regislex_court_trigger_ref_t trigger;
+    char jurisdiction[128];
+    regislex_datetime_t first;
+    regislex_datetime_t last;
+    bool open;
+    bool moved;                 /* Due date written; the schedule and agenda need the new row */
+} touched_deadline_t;
+
+typedef struct {
+    touched_deadline_t* items;
+    int count;
+    int capacity;
+} touched_list_t;
+
+/* How computed dates are written */
+typedef struct {
+    const char* reason;                 /* Recorded with every shifted date */
+    const regislex_uuid_t* holiday_id;  /* Holiday behind the change, or NULL */
+    bool recompute;                     /* Move existing deadlines only; the trigger row is left alone */
+    regislex_court_calendar_t* calendar;    /* Court days counted on; NULL for the shared one */
+} apply_mode_t;
+
+/* The window covers the anchor and both the stored and the computed date */
+static regislex_error_t touched_push(touched_list_t* list, const compiled_set_t* cs,
+                                     const regislex_court_trigger_ref_t* trigger,
+                                     const regislex_uuid_t* deadline_id,
+                                     const regislex_datetime_t* anchor,
+                                     const regislex_datetime_t* stored,
+                                     const regislex_datetime_t* computed,
+                                     bool open, bool moved) {
+    if (list->count >= list->capacity) {
+        int capacity = list->capacity ? list->capacity * 2 : 16;
+        touched_deadline_t* items = (touched_deadline_t*)platform_realloc(
+            list->items, (size_t)capacity * sizeof(touched_deadline_t));
+        if (!items) return REGISLEX_ERROR_OUT_OF_MEMORY;
+        list->items = items;
+        list->capacity = capacity;
+    }
+
+    touched_deadline_t* t = &list->items[list->count++];
+    memset(t, 0, sizeof(touched_deadline_t));
+    t->deadline_id = *deadline_id;
+    t->trigger = *trigger;
+    memcpy(t->jurisdiction, cs->jurisdiction, sizeof(t->jurisdiction));
+    t->first = *anchor;
+    t->last = *anchor;
+
+    const regislex_datetime_t* dates[2] = {stored, computed};
+    for (int i = 0; i < 2; i++) {
+        if (regislex_datetime_compare(dates[i], &t->first) < 0) t->first = *dates[i];
+        if (regislex_datetime_compare(dates[i], &t->last) > 0) t->last = *dates[i];
+    }
+    t->open = open;
+    t->moved = moved;
+    return REGISLEX_OK;
+}
+
+typedef struct {
+    regislex_context_t* ctx;
+    int count;
+    touched_deadline_t items[];
+} touched_sync_t;
+
+/* Bring the window index, schedule and agenda up to date after a commit */
+static void touched_sync_run(void* data) {
+    const touched_sync_t* sync = (const touched_sync_t*)data;
+
+    for (int i = 0; i < sync->count; i++) {
+        const touched_deadline_t* t = &sync->items[i];
+
+        if (t->open) {
+            regislex_rule_window_set(&t->deadline_id, t->jurisdiction, &t->trigger, &t->first, &t->last);
+        } else {
+            regislex_rule_window_remove(&t->deadline_id);
+        }
+        if (!t->moved) continue;
+
+        regislex_deadline_t* dl = NULL;
+        if (regislex_deadline_get(sync->ctx, &t->deadline_id, &dl) == REGISLEX_OK) {
+            regislex_schedule_apply(dl);
+            regislex_agenda_apply_deadline(sync->ctx, dl);
+            regislex_deadline_free(dl);
+        }
+    }
+}
+
+/* Queue the touched deadlines for touched_sync_run once the change commits */
+static regislex_error_t touched_publish(regislex_context_t* ctx, const touched_list_t* touched) {
+    if (touched->count == 0) {
+        return REGISLEX_OK;
+    }
+
+    touched_sync_t* sync = (touched_sync_t*)platform_malloc(
+        sizeof(touched_sync_t) + (size_t)touched->count * sizeof(touched_deadline_t));
+    if (!sync) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    sync->ctx = ctx;
+    sync->count = touched->count;
+    memcpy(sync->items, touched->items, (size_t)touched->count * sizeof(touched_deadline_t));
+    return regislex_db_after_commit(regislex_get_db(ctx), touched_sync_run, sync);
+}
+
+static const regislex_datetime_t* rule_anchor(const compiled_set_t* cs, int r,
+                                              const regislex_datetime_t* trigger_date,
+                                              const regislex_datetime_t* dates) {
+    return cs->parent[r] < 0 ? trigger_date : &dates[cs->parent[r]];
+}
+
+/* Compute the event's descendants, anchors before dependents */
+static regislex_error_t trigger_compute(regislex_court_calendar_t* calendar, const compiled_set_t* cs,
+                                        const char* event, const regislex_datetime_t* trigger_date,
+                                        int* order, regislex_datetime_t* dates, int* out_affected) {
+    regislex_error_t err = REGISLEX_OK;
+    int n = cs->rule_count;
+
+    /* Breadth-first from the event's rules gives anchors before dependents */
+    int affected = 0;
+    for (int i = 0; i < n; i++) {
+        if (cs->parent[i] < 0 && strcmp(cs->rules[i].trigger_event, event) == 0) {
+            order[affected++] = i;
+        }
+    }
+    for (int head = 0; head < affected && err == REGISLEX_OK; head++) {
+        int r = order[head];
+        err = rule_compute(calendar, cs, &cs->rules[r], rule_anchor(cs, r, trigger_date, dates), &dates[r]);
+
+        for (int c = cs->child_start[r]; c < cs->child_start[r + 1]; c++) {
+            order[affected++] = cs->child_index[c];
+        }
+    }
+
+    *out_affected = affected;
+    return err;
+}
+
+/* Write the computed dates; the caller owns the transaction */
+static regislex_error_t trigger_write(regislex_context_t* ctx, const compiled_set_t* cs,
+                                      const regislex_court_trigger_ref_t* trigger,
+                                      const regislex_datetime_t* trigger_date,
+                                      const int* order, int affected,
+                                      const regislex_datetime_t* dates,
+                                      existing_deadline_t* existing,
+                                      const apply_mode_t* mode,
+                                      regislex_court_trigger_result_t* counts,
+                                      touched_list_t* touched) {
+    regislex_db_context_t* db = regislex_get_db(ctx);
+    const regislex_uuid_t* case_id = &trigger->case_id;
+    regislex_error_t err = REGISLEX_OK;
+
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    regislex_db_stmt_t* stmt = NULL;
+    if (!mode->recompute) {
+        err = regislex_db_prepare(db,
+            "INSERT INTO case_triggers (case_id, rule_set_id, event, trigger_date, updated_at) "
+            "VALUES (?, ?, ?, ?, ?) "
+            "ON CONFLICT (case_id, rule_set_id, event) DO UPDATE SET "
+            "  trigger_date = excluded.trigger_date, updated_at = excluded.updated_at", &stmt);
+        if (err == REGISLEX_OK) {
+            regislex_db_bind_uuid(stmt, 1, case_id);
+            regislex_db_bind_uuid(stmt, 2, &cs->id);
+            regislex_db_bind_text(stmt, 3, trigger->event);
+            regislex_db_bind_datetime(stmt, 4, trigger_date);
+            regislex_db_bind_datetime(stmt, 5, &now);
+            err = regislex_db_step(stmt);
+            regislex_db_finalize(stmt);
+            if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
+        }
+    }
+
+    if (err != REGISLEX_OK || affected == 0) {
+        return err;
+    }
+    err = load_existing(db, cs, case_id, existing);
+
+    regislex_db_stmt_t* insert_dl = NULL;
+    regislex_db_stmt_t* insert_link = NULL;
+    regislex_db_stmt_t* update_dl = NULL;
+    regislex_db_stmt_t* insert_shift = NULL;
+
+    if (err == REGISLEX_OK && !mode->recompute) {
+        err = regislex_db_prepare(db,
+            "INSERT INTO deadlines (id, case_id, title, type, status, priority, due_date,"
+            "  assigned_to_id, rule_reference, days_from_trigger, count_business_days,"
+            "  created_at, updated_at) "
+            "VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?7,"
+            "  (SELECT assigned_to_id FROM cases WHERE id = ?2), ?8, ?9, ?10, ?11, ?11)", &insert_dl);
+    }
+    if (err == REGISLEX_OK && !mode->recompute) {
+        err = regislex_db_prepare(db,
+            "INSERT INTO rule_deadlines (deadline_id, case_id, rule_set_id, rule_id) "
+            "VALUES (?, ?, ?, ?)", &insert_link);
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_db_prepare(db,
+            "UPDATE deadlines SET due_date = ?, updated_at = ? WHERE id = ?", &update_dl);
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_db_prepare(db,
+            "INSERT INTO deadline_shifts (deadline_id, case_id, previous_due_date, new_due_date,"
+            "  reason, holiday_id, shifted_at) "
+            "VALUES (?, ?, ?, ?, ?, ?, ?)", &insert_shift);
+    }
+
+    for (int i = 0; err == REGISLEX_OK && i < affected; i++) {
+        int r = order[i];
+        const regislex_court_rule_t* rule = &cs->rules[r];
+        const regislex_datetime_t* anchor = rule_anchor(cs, r, trigger_date, dates);
+        existing_deadline_t* e = &existing[r];
+
+        if (e->exists) {
+            bool open = e->status < REGISLEX_STATUS_COMPLETED;
+            if (!open || same_date(&e->due_date, &dates[r])) {
+                counts->unchanged++;
+                err = touched_push(touched, cs, trigger, &e->deadline_id, anchor,
+                                   &e->due_date, &dates[r], open, false);
+                continue;
+            }
+
+            regislex_db_bind_datetime(update_dl, 1, &dates[r]);
+            regislex_db_bind_datetime(update_dl, 2, &now);
+            regislex_db_bind_uuid(update_dl, 3, &e->deadline_id);
+            err = regislex_db_step(update_dl);
+            if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
+            regislex_db_reset(update_dl);
+
+            if (err == REGISLEX_OK) {
+                regislex_db_bind_uuid(insert_shift, 1, &e->deadline_id);
+                regislex_db_bind_uuid(insert_shift, 2, case_id);
+                regislex_db_bind_datetime(insert_shift, 3, &e->due_date);
+                regislex_db_bind_datetime(insert_shift, 4, &dates[r]);
+                regislex_db_bind_text(insert_shift, 5, mode->reason);
+                if (mode->holiday_id) {
+                    regislex_db_bind_uuid(insert_shift, 6, mode->holiday_id);
+                } else {
+                    regislex_db_bind_null(insert_shift, 6);
+                }
+                regislex_db_bind_datetime(insert_shift, 7, &now);
+                err = regislex_db_step(insert_shift);
+                if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
+                regislex_db_reset(insert_shift);
+            }
+            counts->updated++;
+
+            if (err == REGISLEX_OK) {
+                err = touched_push(touched, cs, trigger, &e->deadline_id, anchor,
+                                   &dates[r], &dates[r], true, true);
+            }
+            continue;
+        }
+
+        /* A holiday change never brings back a deadline someone deleted */
+        if (mode->recompute) continue;
+
+        regislex_uuid_t deadline_id;
+        regislex_uuid_generate(&deadline_id);
+
+        int idx = 1;
+        regislex_db_bind_uuid(insert_dl, idx++, &deadline_id);
+        regislex_db_bind_uuid(insert_dl, idx++, case_id);
+        regislex_db_bind_text(insert_dl, idx++, rule->title);
+        regislex_db_bind_int(insert_dl, idx++, rule->deadline_type);
+        regislex_db_bind_int(insert_dl, idx++, REGISLEX_STATUS_PENDING);
+        regislex_db_bind_int(insert_dl, idx++, rule->priority);
+        regislex_db_bind_datetime(insert_dl, idx++, &dates[r]);
+        regislex_db_bind_text(insert_dl, idx++, rule->rule_reference[0] ? rule->rule_reference : rule->code);
+        regislex_db_bind_int(insert_dl, idx++, rule->days);
+        regislex_db_bind_int(insert_dl, idx++, rule->count_business_days ? 1 : 0);
+        regislex_db_bind_datetime(insert_dl, idx++, &now);
+        err = regislex_db_step(insert_dl);
+        if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
+        regislex_db_reset(insert_dl);
+
+        if (err == REGISLEX_OK) {
+            regislex_db_bind_uuid(insert_link, 1, &deadline_id);
+            regislex_db_bind_uuid(insert_link, 2, case_id);
+            regislex_db_bind_uuid(insert_link, 3, &cs->id);
+            regislex_db_bind_uuid(insert_link, 4, &rule->id);
+            err = regislex_db_step(insert_link);
+            if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
+            regislex_db_reset(insert_link);
+        }
+        counts->created++;
+
+        if (err == REGISLEX_OK) {
+            err = touched_push(touched, cs, trigger, &deadline_id, anchor,
+                               &dates[r], &dates[r], true, true);
+        }
+    }
+
+    if (insert_dl) regislex_db_finalize(insert_dl);
+    if (insert_link) regislex_db_finalize(insert_link);
+    if (update_dl) regislex_db_finalize(update_dl);
+    if (insert_shift) regislex_db_finalize(insert_shift);
+
+    return err;
+}
+
+/* Index the windows of the deadlines a recorded trigger already produced */
+static regislex_error_t trigger_index(regislex_context_t* ctx, const compiled_set_t* cs,
+                                      const regislex_court_trigger_ref_t* trigger,
+                                      const regislex_datetime_t* trigger_date,
+                                      const int* order, int affected,
+                                      const regislex_datetime_t* dates,
+                                      existing_deadline_t* existing,
+                                      touched_list_t* touched) {
+    if (affected == 0) return REGISLEX_OK;
+
+    regislex_error_t err = load_existing(regislex_get_db(ctx), cs, &trigger->case_id, existing);
+    for (int i = 0; err == REGISLEX_OK && i < affected; i++) {
+        int r = order[i];
+        const existing_deadline_t* e = &existing[r];
+        if (!e->exists) continue;
+
+        err = touched_push(touched, cs, trigger, &e->deadline_id,
+                           rule_anchor(cs, r, trigger_date, dates), &e->due_date, &dates[r],
+                           e->status < REGISLEX_STATUS_COMPLETED, false);
+    }
+    return err;
+}
+
+/*
+ * Compute a trigger's deadlines and write them under mode, or only index
+ * the ones already stored when mode is NULL.
+ */
+static regislex_error_t trigger_run(regislex_context_t* ctx, const compiled_set_t* cs,
+                                    const regislex_court_trigger_ref_t* trigger,
+                                    const regislex_datetime_t* trigger_date,
+                                    const apply_mode_t* mode,
+                                    regislex_court_trigger_result_t* counts,
+                                    touched_list_t* touched) {
+    size_t n = (size_t)cs->rule_count + 1;
+    int* order = (int*)platform_calloc(n, sizeof(int));
+    regislex_datetime_t* dates = (regislex_datetime_t*)platform_calloc(n, sizeof(regislex_datetime_t));
+    existing_deadline_t* existing = (existing_deadline_t*)platform_calloc(n, sizeof(existing_deadline_t));
+
+    regislex_error_t err = REGISLEX_ERROR_OUT_OF_MEMORY;
+    if (order && dates && existing) {
+        int affected = 0;
+        err = trigger_compute(mode ? mode->calendar : NULL, cs, trigger->event, trigger_date,
+                              order, dates, &affected);
+        if (err == REGISLEX_OK && mode) {
+            err = trigger_write(ctx, cs, trigger, trigger_date, order, affected, dates, existing,
+                                mode, counts, touched);
+        } else if (err == REGISLEX_OK) {
+            err = trigger_index(ctx, cs, trigger, trigger_date, order, affected, dates, existing,
+                                touched);
+        }
+    }
+
+    platform_free(order);
+    platform_free(dates);
+    platform_free(existing);
+    return err;
+}
+
+static regislex_error_t windows_reindex(regislex_context_t* ctx) {
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(ctx),
+        "SELECT case_id, rule_set_id, event, trigger_date FROM case_triggers "
+        "ORDER BY rule_set_id", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    /* Read every trigger first; computing them issues queries of their own */
+    regislex_court_trigger_ref_t* refs = NULL;
+    regislex_datetime_t* trigger_dates = NULL;
+    int count = 0;
+    int capacity = 0;
+
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        if (count >= capacity) {
+            int new_capacity = capacity ? capacity * 2 : 64;
+            regislex_court_trigger_ref_t* grown_refs = (regislex_court_trigger_ref_t*)platform_realloc(
+                refs, (size_t)new_capacity * sizeof(regislex_court_trigger_ref_t));
+            if (grown_refs) refs = grown_refs;
+            regislex_datetime_t* grown_dates = (regislex_datetime_t*)platform_realloc(
+                trigger_dates, (size_t)new_capacity * sizeof(regislex_datetime_t));
+            if (grown_dates) trigger_dates = grown_dates;
+            if (!grown_refs || !grown_dates) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            capacity = new_capacity;
+        }
+
+        regislex_court_trigger_ref_t* ref = &refs[count];
+        memset(ref, 0, sizeof(regislex_court_trigger_ref_t));
+        regislex_db_column_uuid(stmt, 0, &ref->case_id);
+        regislex_db_column_uuid(stmt, 1, &ref->rule_set_id);
+        const char* event = regislex_db_column_text(stmt, 2);
+        if (event) strncpy(ref->event, event, sizeof(ref->event) - 1);
+        regislex_db_column_datetime(stmt, 3, &trigger_dates[count]);
+        count++;
+    }
+    regislex_db_finalize(stmt);
+
+    touched_list_t touched = {NULL, 0, 0};
+    if (err == REGISLEX_ERROR_NOT_FOUND) {
+        err = REGISLEX_OK;
+        for (int i = 0; err == REGISLEX_OK && i < count; i++) {
+            compiled_set_t* cs = NULL;
+            if (acquire_set(regislex_get_db(ctx), &refs[i].rule_set_id, &cs) != REGISLEX_OK) continue;
+
+            err = trigger_run(ctx, cs, &refs[i], &trigger_dates[i], NULL, NULL, &touched);
+            release_set(cs);
+
+            /* A trigger whose dates cannot be computed is left unindexed */
+            if (err != REGISLEX_ERROR_OUT_OF_MEMORY) err = REGISLEX_OK;
+        }
+    }
+
+    if (err == REGISLEX_OK) {
+        err = touched_publish(ctx, &touched);
+    }
+
+    platform_free(touched.items);
+    platform_free(refs);
+    platform_free(trigger_dates);
+    return err;
+}
+
+REGISLEX_API regislex_error_t regislex_court_trigger_record(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* case_id,
+    const regislex_uuid_t* rule_set_id,
+    const char* event,
+    const regislex_datetime_t* trigger_date,
+    regislex_court_trigger_result_t* result)
+{
+    if (!ctx || !case_id || !rule_set_id || !event || !event[0] || !trigger_date) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!regislex_datetime_is_valid_date(trigger_date)) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!rules_mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    regislex_court_trigger_ref_t trigger;
+    memset(&trigger, 0, sizeof(trigger));
+    if (strlen(event) >= sizeof(trigger.event)) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    trigger.case_id = *case_id;
+    trigger.rule_set_id = *rule_set_id;
+    strcpy(trigger.event, event);
+
+    compiled_set_t* cs = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
+    regislex_error_t err = acquire_set(db, rule_set_id, &cs);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_court_trigger_result_t counts = {0, 0, 0};
+    touched_list_t touched = {NULL, 0, 0};
+    apply_mode_t mode = {"trigger moved", NULL, false, NULL};
+
+    regislex_db_transaction_t* tx = NULL;
+    err = regislex_db_begin(db, &tx);
+    if (err == REGISLEX_OK) {
+        err = trigger_run(ctx, cs, &trigger, trigger_date, &mode, &counts, &touched);
+        if (err == REGISLEX_OK) {
+            err = touched_publish(ctx, &touched);
+        }
+        if (err == REGISLEX_OK) {
+            err = regislex_db_commit(tx);
+        }
+        if (err != REGISLEX_OK) {
+            regislex_db_rollback(tx);
+        }
+    }
+    release_set(cs);
+
+    if (err == REGISLEX_OK && result) {
+        *result = counts;
+    }
+    platform_free(touched.items);
+    return err;
+}
+
+REGISLEX_API regislex_error_t regislex_court_holiday_recompute(
+    regislex_context_t* ctx,
+    const regislex_holiday_t* holiday,
+    const char* reason,
+    regislex_court_calendar_t* calendar,
+    regislex_court_trigger_result_t* result)
+{
+    if (!ctx || !holiday) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!rules_mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    regislex_court_trigger_result_t counts = {0, 0, 0};
+
+    /* Other holidays never close the court, so no court-day count moves */
+    if (!holiday->is_court_holiday) {
+        if (result) *result = counts;
+        return REGISLEX_OK;
+    }
+
+    regislex_court_trigger_ref_t* triggers = NULL;
+    int trigger_count = 0;
+    regislex_error_t err = regislex_rule_windows_affected(holiday, &triggers, &trigger_count);
+    if (err != REGISLEX_OK || trigger_count == 0) {
+        if (err == REGISLEX_OK && result) *result = counts;
+        return err;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+    touched_list_t touched = {NULL, 0, 0};
+    apply_mode_t mode = {reason ? reason : "holiday changed",
+                         holiday->id.value[0] ? &holiday->id : NULL, true, calendar};
+
+    regislex_db_transaction_t* tx = NULL;
+    err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) {
+        regislex_court_trigger_refs_free(triggers);
+        return err;
+    }
+
+    regislex_db_stmt_t* stmt = NULL;
+    err = regislex_db_prepare(db,
+        "SELECT trigger_date FROM case_triggers "
+        "WHERE case_id = ? AND rule_set_id = ? AND event = ?", &stmt);
+
+    /* Triggers arrive sorted by rule set, so each set is compiled once */
+    for (int i = 0; err == REGISLEX_OK && i < trigger_count; i++) {
+        const regislex_court_trigger_ref_t* trigger = &triggers[i];
+
+        regislex_datetime_t trigger_date;
+        memset(&trigger_date, 0, sizeof(trigger_date));
+        regislex_db_bind_uuid(stmt, 1, &trigger->case_id);
+        regislex_db_bind_uuid(stmt, 2, &trigger->rule_set_id);
+        regislex_db_bind_text(stmt, 3, trigger->event);
+        err = regislex_db_step(stmt);
+        if (err == REGISLEX_OK) regislex_db_column_datetime(stmt, 0, &trigger_date);
+        regislex_db_reset(stmt);
+
+        /* The trigger or its rule set went away since it was indexed */
+        if (err == REGISLEX_ERROR_NOT_FOUND) {
+            err = REGISLEX_OK;
+            continue;
+        }
+        if (err != REGISLEX_OK) break;
+
+        compiled_set_t* cs = NULL;
+        err = acquire_set(db, &trigger->rule_set_id, &cs);
+        if (err == REGISLEX_ERROR_NOT_FOUND) {
+            err = REGISLEX_OK;
+            continue;
+        }
+        if (err != REGISLEX_OK) break;
+
+        err = trigger_run(ctx, cs, trigger, &trigger_date, &mode, &counts, &touched);
+        release_set(cs);
+    }
+    if (stmt) regislex_db_finalize(stmt);
+
+    if (err == REGISLEX_OK) {
+        err = touched_publish(ctx, &touched);
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+    }
+
+    if (err == REGISLEX_OK && result) {
+        *result = counts;
+    }
+    platform_free(touched.items);
+    regislex_court_trigger_refs_free(triggers);
+    return err;
+}
+
+/* ============================================================================
+ * Shift Log
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_deadline_shift_list(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* deadline_id,
+    const regislex_uuid_t* holiday_id,
+    regislex_deadline_shift_t** shifts,
+    int* count)
+{
+    if (!ctx || (!deadline_id && !holiday_id) || !shifts || !count) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    *shifts = NULL;
+    *count = 0;
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(ctx), deadline_id
+        ? "SELECT deadline_id, case_id, previous_due_date, new_due_date, reason, holiday_id,"
+          "  shifted_at FROM deadline_shifts "
+          "WHERE deadline_id = ?1 AND (?2 IS NULL OR holiday_id = ?2) ORDER BY id"
+        : "SELECT deadline_id, case_id, previous_due_date, new_due_date, reason, holiday_id,"
+          "  shifted_at FROM deadline_shifts WHERE holiday_id = ?2 ORDER BY id", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    if (deadline_id) regislex_db_bind_uuid(stmt, 1, deadline_id);
+    if (holiday_id) {
+        regislex_db_bind_uuid(stmt, 2, holiday_id);
+    } else {
+        regislex_db_bind_null(stmt, 2);
+    }
+
+    regislex_deadline_shift_t* items = NULL;
+    int n = 0;
+    int capacity = 0;
+
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        if (n >= capacity) {
+            int new_capacity = capacity ? capacity * 2 : 8;
+            regislex_deadline_shift_t* grown = (regislex_deadline_shift_t*)platform_realloc(
+                items, (size_t)new_capacity * sizeof(regislex_deadline_shift_t));
+            if (!grown) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            items = grown;
+            capacity = new_capacity;
+        }
+
+        regislex_deadline_shift_t* shift = &items[n++];
+        memset(shift, 0, sizeof(regislex_deadline_shift_t));
+        regislex_db_column_uuid(stmt, 0, &shift->deadline_id);
+        regislex_db_column_uuid(stmt, 1, &shift->case_id);
+        regislex_db_column_datetime(stmt, 2, &shift->previous_due_date);
+        regislex_db_column_datetime(stmt, 3, &shift->new_due_date);
+        const char* why = regislex_db_column_text(stmt, 4);
+        if (why) strncpy(shift->reason, why, sizeof(shift->reason) - 1);
+        regislex_db_column_uuid(stmt, 5, &shift->holiday_id);
+        regislex_db_column_datetime(stmt, 6, &shift->shifted_at);
+    }
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        platform_free(items);
+        return err;
+    }
+
+    *shifts = items;
+    *count = n;
+    return REGISLEX_OK;
+}
+
+REGISLEX_API void regislex_deadline_shift_list_free(regislex_deadline_shift_t* shifts) {
+    platform_free(shifts);
+}
@@ -0,0 +1,201 @@
+/**
+ * @file court_zones.c
+ * @brief Per-Jurisdiction Court Time Zones
+ *
+ * Filing cutoffs such as "5:00 p.m." are wall times in the court's own
+ * zone. The jurisdiction-to-zone mapping lives in the jurisdiction_zones
+ * table and is loaded into an id map at startup; zones resolve to
+ * the compiled table in core/timezone.c, so a lookup never touches the
+ * database and the returned zone pointer stays valid for the process.
+ */
+
+#include "regislex/regislex.h"
+#include "database/database.h"
+#include "platform/platform.h"
+#include "utils/id_map.h"
+#include <stddef.h>
+#include <string.h>
+
+/* ============================================================================
+ * Internal Structures
+ * ============================================================================ */
+
+typedef struct {
+    char jurisdiction[128];
+    const regislex_tz_t* tz;
+} court_zone_t;
+
+static platform_mutex_t* zones_mutex = NULL;
+static regislex_id_map_t zones = { NULL, 0, 0, offsetof(court_zone_t, jurisdiction) };
+
+/* ============================================================================
+ * Jurisdiction Map
+ * ============================================================================ */
+
+/* Caller holds the mutex; a NULL zone removes the mapping */
+static regislex_error_t zone_put(const char* jurisdiction, const regislex_tz_t* tz) {
+    int slot = regislex_id_map_find(&zones, jurisdiction);
+    court_zone_t* existing = slot >= 0 ? (court_zone_t*)zones.slots[slot] : NULL;
+    if (!tz) {
+        if (existing) {
+            regislex_id_map_remove_at(&zones, slot);
+            platform_free(existing);
+        }
+        return REGISLEX_OK;
+    }
+    if (existing) {
+        existing->tz = tz;
+        return REGISLEX_OK;
+    }
+
+    if (strlen(jurisdiction) >= sizeof(existing->jurisdiction)) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    court_zone_t* entry = (court_zone_t*)platform_calloc(1, sizeof(court_zone_t));
+    if (!entry) return REGISLEX_ERROR_OUT_OF_MEMORY;
+    strcpy(entry->jurisdiction, jurisdiction);
+    entry->tz = tz;
+
+    regislex_error_t err = regislex_id_map_insert(&zones, entry);
+    if (err != REGISLEX_OK) platform_free(entry);
+    return err;
+}
+
+/* ============================================================================
+ * Lifecycle
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_court_zones_init(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (zones_mutex == NULL) {
+        if (platform_mutex_create(&zones_mutex) != PLATFORM_OK) {
+            return REGISLEX_ERROR;
+        }
+    }
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(ctx),
+        "SELECT jurisdiction, zone FROM jurisdiction_zones", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    platform_mutex_lock(zones_mutex);
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        const char* jurisdiction = regislex_db_column_text(stmt, 0);
+        const regislex_tz_t* tz = regislex_tz_find(regislex_db_column_text(stmt, 1));
+
+        /* Zones this build does not know stay unmapped */
+        if (!jurisdiction || !jurisdiction[0] || !tz) continue;
+
+        err = zone_put(jurisdiction, tz);
+        if (err != REGISLEX_OK) break;
+    }
+    platform_mutex_unlock(zones_mutex);
+    regislex_db_finalize(stmt);
+
+    return err == REGISLEX_ERROR_NOT_FOUND ? REGISLEX_OK : err;
+}
+
+REGISLEX_API void regislex_court_zones_shutdown(void) {
+    if (!zones_mutex) return;
+
+    platform_mutex_lock(zones_mutex);
+    for (int i = 0; i < zones.capacity; i++) {
+        platform_free(zones.slots[i]);
+    }
+    regislex_id_map_free(&zones);
+    platform_mutex_unlock(zones_mutex);
+
+    platform_mutex_destroy(zones_mutex);
+    zones_mutex = NULL;
+}
+
+/* ============================================================================
+ * Public Functions
+ * ============================================================================ */
+
+REGISLEX_API const regislex_tz_t* regislex_court_zone(const char* jurisdiction) {
+    if (!jurisdiction || !zones_mutex) return NULL;
+
+    platform_mutex_lock(zones_mutex);
+    const court_zone_t* entry = (const court_zone_t*)regislex_id_map_get(&zones, jurisdiction);
+    const regislex_tz_t* tz = entry ? entry->tz : NULL;
+    platform_mutex_unlock(zones_mutex);
+
+    return tz;
+}
+
+REGISLEX_API regislex_error_t regislex_court_zone_set(
+    regislex_context_t* ctx,
+    const char* jurisdiction,
+    const char* zone)
+{
+    if (!ctx || !jurisdiction || !jurisdiction[0]) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!zones_mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    const regislex_tz_t* tz = NULL;
+    if (zone) {
+        tz = regislex_tz_find(zone);
+        if (!tz) return REGISLEX_ERROR_VALIDATION;
+    }
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(ctx), tz
+        ? "INSERT INTO jurisdiction_zones (jurisdiction, zone) VALUES (?, ?)"
+          " ON CONFLICT (jurisdiction) DO UPDATE SET zone = excluded.zone"
+        : "DELETE FROM jurisdiction_zones WHERE jurisdiction = ?", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_bind_text(stmt, 1, jurisdiction);
+    if (tz) regislex_db_bind_text(stmt, 2, regislex_tz_name(tz));
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+
+    platform_mutex_lock(zones_mutex);
+    err = zone_put(jurisdiction, tz);
+    platform_mutex_unlock(zones_mutex);
+
+    return err;
+}
+
+REGISLEX_API regislex_error_t regislex_court_cutoff(
+    regislex_context_t* ctx,
+    const char* jurisdiction,
+    const regislex_datetime_t* date,
+    int hour,
+    int minute,
+    regislex_datetime_t* out)
+{
+    if (!ctx || !jurisdiction || !date || !out) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (hour < 0 || hour > 23 || minute < 0 || minute > 59) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    const regislex_tz_t* tz = regislex_court_zone(jurisdiction);
+    if (!tz) {
+        return REGISLEX_ERROR_NOT_FOUND;
+    }
+
+    regislex_datetime_t local = *date;
+    local.hour = hour;
+    local.minute = minute;
+    local.second = 0;
+
+    return regislex_datetime_from_zone(&local, tz, out);
+}
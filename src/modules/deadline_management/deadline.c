@@ -13,6 +13,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* A deadline is announced as approaching this many days before it falls due */
+#define DEADLINE_APPROACHING_DAYS  1
+
 /* ============================================================================
  * Internal Helper Functions
  * ============================================================================ */
@@ -21,7 +24,7 @@ static regislex_deadline_t* deadline_alloc(void) {
     return (regislex_deadline_t*)platform_calloc(1, sizeof(regislex_deadline_t));
 }
 
-static regislex_error_t deadline_from_row(regislex_db_stmt_t* stmt, regislex_deadline_t* dl) {
+regislex_error_t regislex_deadline_from_row(regislex_db_stmt_t* stmt, regislex_deadline_t* dl) {
     if (!stmt || !dl) return REGISLEX_ERROR_INVALID_ARGUMENT;
 
     int col = 0;
@@ -72,13 +75,224 @@ static regislex_error_t deadline_from_row(regislex_db_stmt_t* stmt, regislex_dea
     regislex_db_column_datetime(stmt, col++, &dl->updated_at);
     regislex_db_column_uuid(stmt, col++, &dl->created_by);
 
+    const char* rrule = regislex_db_column_text(stmt, col++);
+    if (rrule) strncpy(dl->rrule, rrule, sizeof(dl->rrule) - 1);
+
+    return REGISLEX_OK;
+}
+
+/* Collect every row of a deadline query into a new list */
+static regislex_error_t deadline_list_from_stmt(regislex_db_stmt_t* stmt,
+                                                regislex_deadline_list_t** out_list) {
+    regislex_deadline_list_t* list = (regislex_deadline_list_t*)platform_calloc(1, sizeof(regislex_deadline_list_t));
+    if (!list) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    int capacity = 50;
+    list->deadlines = (regislex_deadline_t**)platform_calloc(capacity, sizeof(regislex_deadline_t*));
+    if (!list->deadlines) {
+        platform_free(list);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    regislex_error_t err;
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        if (list->count >= capacity) {
+            capacity *= 2;
+            regislex_deadline_t** new_deadlines = (regislex_deadline_t**)platform_realloc(
+                list->deadlines, capacity * sizeof(regislex_deadline_t*));
+            if (!new_deadlines) {
+                regislex_deadline_list_free(list);
+                return REGISLEX_ERROR_OUT_OF_MEMORY;
+            }
+            list->deadlines = new_deadlines;
+        }
+
+        regislex_deadline_t* dl = deadline_alloc();
+        if (!dl) {
+            regislex_deadline_list_free(list);
+            return REGISLEX_ERROR_OUT_OF_MEMORY;
+        }
+
+        regislex_deadline_from_row(stmt, dl);
+        list->deadlines[list->count++] = dl;
+    }
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        regislex_deadline_list_free(list);
+        return err;
+    }
+
+    list->total_count = list->count;
+    *out_list = list;
+    return REGISLEX_OK;
+}
+
+/*
+ * Resolve the rule stored for a deadline. An explicit rrule wins and is
+ * normalized; otherwise the recurrence enum is translated. An empty
+ * result marks a one-off deadline.
+ */
+static regislex_error_t deadline_series_rule(const regislex_deadline_t* dl, char* out, size_t size) {
+    out[0] = '\0';
+
+    regislex_rrule_t rule;
+    regislex_error_t err;
+    if (dl->rrule[0]) {
+        err = regislex_rrule_parse(dl->rrule, &rule);
+        if (err != REGISLEX_OK) return err;
+    } else {
+        memset(&rule, 0, sizeof(rule));
+        rule.interval = dl->recurrence_interval > 0 ? dl->recurrence_interval : 1;
+        rule.until = dl->recurrence_end;
+
+        switch (dl->recurrence) {
+            case REGISLEX_RECUR_DAILY:     rule.freq = REGISLEX_RRULE_DAILY; break;
+            case REGISLEX_RECUR_WEEKLY:    rule.freq = REGISLEX_RRULE_WEEKLY; break;
+            case REGISLEX_RECUR_BIWEEKLY:  rule.freq = REGISLEX_RRULE_WEEKLY; rule.interval *= 2; break;
+            case REGISLEX_RECUR_MONTHLY:   rule.freq = REGISLEX_RRULE_MONTHLY; break;
+            case REGISLEX_RECUR_QUARTERLY: rule.freq = REGISLEX_RRULE_MONTHLY; rule.interval *= 3; break;
+            case REGISLEX_RECUR_YEARLY:    rule.freq = REGISLEX_RRULE_YEARLY; break;
+            default:
+                return REGISLEX_OK;
+        }
+    }
+
+    /* The series start anchors every occurrence */
+    if (!regislex_datetime_is_valid_date(&dl->due_date)) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+    return regislex_rrule_format(&rule, out, size);
+}
+
+static regislex_error_t deadline_metadata_save(regislex_db_context_t* db,
+                                               const regislex_uuid_t* deadline_id,
+                                               const regislex_metadata_t* items,
+                                               int count) {
+    for (int i = 0; i < count; i++) {
+        regislex_error_t err = regislex_db_metadata_set(db, "deadline_metadata", "deadline_id",
+                                                        deadline_id, &items[i]);
+        if (err != REGISLEX_OK) {
+            return err;
+        }
+    }
     return REGISLEX_OK;
 }
 
+/* ============================================================================
+ * In-Memory Index Sync
+ * ============================================================================ */
+
+typedef struct {
+    regislex_context_t* ctx;
+    regislex_uuid_t id;
+} deadline_sync_t;
+
+/* Re-read a committed deadline into the schedule, rule windows and agenda */
+static void deadline_sync_run(void* data) {
+    const deadline_sync_t* sync = (const deadline_sync_t*)data;
+
+    regislex_deadline_t* stored = NULL;
+    if (regislex_deadline_get(sync->ctx, &sync->id, &stored) == REGISLEX_OK) {
+        regislex_schedule_apply(stored);
+        regislex_rule_window_move(&stored->id, &stored->due_date,
+                                  stored->status < REGISLEX_STATUS_COMPLETED && !stored->rrule[0]);
+        regislex_agenda_apply_deadline(sync->ctx, stored);
+        regislex_deadline_free(stored);
+    } else {
+        regislex_schedule_remove(&sync->id);
+        regislex_agenda_remove(&sync->id);
+        regislex_rule_window_remove(&sync->id);
+        regislex_agenda_remove_reminders(&sync->id);
+    }
+}
+
+/* Bring the in-memory indexes up to date once the deadline change commits */
+static regislex_error_t deadline_sync(regislex_context_t* ctx, const regislex_uuid_t* id) {
+    deadline_sync_t* sync = (deadline_sync_t*)platform_malloc(sizeof(deadline_sync_t));
+    if (!sync) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    sync->ctx = ctx;
+    sync->id = *id;
+    return regislex_db_after_commit(regislex_get_db(ctx), deadline_sync_run, sync);
+}
+
+typedef struct {
+    int count;
+    regislex_uuid_t ids[];
+} deadline_evict_t;
+
+/* Drop deadlines deleted with their case from the schedule, rule windows and agenda */
+static void deadline_evict_run(void* data) {
+    const deadline_evict_t* evict = (const deadline_evict_t*)data;
+
+    for (int i = 0; i < evict->count; i++) {
+        regislex_schedule_remove(&evict->ids[i]);
+        regislex_agenda_remove(&evict->ids[i]);
+        regislex_rule_window_remove(&evict->ids[i]);
+        regislex_agenda_remove_reminders(&evict->ids[i]);
+    }
+}
+
 /* ============================================================================
  * Deadline Management Functions
  * ============================================================================ */
 
+REGISLEX_API regislex_error_t regislex_deadline_evict_case(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* case_id)
+{
+    if (!ctx || !case_id) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    /* The reminders are found through the deadlines, so they go first */
+    regislex_error_t err = regislex_reminder_evict_case(ctx, case_id);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+    regislex_db_stmt_t* stmt = NULL;
+    err = regislex_db_prepare(db, "SELECT id FROM deadlines WHERE case_id = ?", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+    regislex_db_bind_uuid(stmt, 1, case_id);
+
+    deadline_evict_t* evict = NULL;
+    int count = 0;
+    int capacity = 0;
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        if (count == capacity) {
+            int new_capacity = capacity ? capacity * 2 : 16;
+            deadline_evict_t* grown = (deadline_evict_t*)platform_realloc(
+                evict, sizeof(deadline_evict_t) + (size_t)new_capacity * sizeof(regislex_uuid_t));
+            if (!grown) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            evict = grown;
+            capacity = new_capacity;
+        }
+        regislex_db_column_uuid(stmt, 0, &evict->ids[count++]);
+    }
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        platform_free(evict);
+        return err;
+    }
+    if (!evict) {
+        return REGISLEX_OK;
+    }
+
+    evict->count = count;
+    return regislex_db_after_commit(db, deadline_evict_run, evict);
+}
+
 REGISLEX_API regislex_error_t regislex_deadline_create(
     regislex_context_t* ctx,
     const regislex_deadline_t* deadline,
@@ -95,14 +309,32 @@ REGISLEX_API regislex_error_t regislex_deadline_create(
 
     memcpy(new_dl, deadline, sizeof(regislex_deadline_t));
 
+    /* Metadata stays owned by the caller */
+    new_dl->metadata_count = 0;
+    new_dl->metadata = NULL;
+
     if (new_dl->id.value[0] == '\0') {
         regislex_uuid_generate(&new_dl->id);
     }
 
     regislex_datetime_now(&new_dl->created_at);
     memcpy(&new_dl->updated_at, &new_dl->created_at, sizeof(regislex_datetime_t));
+    memset(&new_dl->occurrence_date, 0, sizeof(regislex_datetime_t));
+
+    regislex_error_t err = deadline_series_rule(deadline, new_dl->rrule, sizeof(new_dl->rrule));
+    if (err != REGISLEX_OK) {
+        regislex_deadline_free(new_dl);
+        return err;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_transaction_t* tx = NULL;
+    err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) {
+        regislex_deadline_free(new_dl);
+        return err;
+    }
 
     const char* sql =
         "INSERT INTO deadlines ("
@@ -110,19 +342,20 @@ REGISLEX_API regislex_error_t regislex_deadline_create(
         "  due_date, start_date, is_all_day, duration_minutes, recurrence,"
         "  assigned_to_id, rule_reference, days_from_trigger, count_business_days,"
         "  completed_at, completed_by, completion_notes, location, tags,"
-        "  created_at, updated_at, created_by"
-        ") VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)";
+        "  created_at, updated_at, created_by, rrule"
+        ") VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)";
 
     regislex_db_stmt_t* stmt = NULL;
-    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    err = regislex_db_prepare(db, sql, &stmt);
     if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
         regislex_deadline_free(new_dl);
         return err;
     }
 
     int idx = 1;
     regislex_db_bind_uuid(stmt, idx++, &new_dl->id);
-    regislex_db_bind_uuid(stmt, idx++, &new_dl->case_id);
+    regislex_db_bind_uuid_ref(stmt, idx++, &new_dl->case_id);
     regislex_db_bind_uuid(stmt, idx++, &new_dl->matter_id);
     regislex_db_bind_text(stmt, idx++, new_dl->title);
     regislex_db_bind_text(stmt, idx++, new_dl->description);
@@ -134,23 +367,34 @@ REGISLEX_API regislex_error_t regislex_deadline_create(
     regislex_db_bind_int(stmt, idx++, new_dl->is_all_day ? 1 : 0);
     regislex_db_bind_int(stmt, idx++, new_dl->duration_minutes);
     regislex_db_bind_int(stmt, idx++, new_dl->recurrence);
-    regislex_db_bind_uuid(stmt, idx++, &new_dl->assigned_to_id);
+    regislex_db_bind_uuid_ref(stmt, idx++, &new_dl->assigned_to_id);
     regislex_db_bind_text(stmt, idx++, new_dl->rule_reference);
     regislex_db_bind_int(stmt, idx++, new_dl->days_from_trigger);
     regislex_db_bind_int(stmt, idx++, new_dl->count_business_days ? 1 : 0);
     regislex_db_bind_datetime(stmt, idx++, &new_dl->completed_at);
-    regislex_db_bind_uuid(stmt, idx++, &new_dl->completed_by);
+    regislex_db_bind_uuid_ref(stmt, idx++, &new_dl->completed_by);
     regislex_db_bind_text(stmt, idx++, new_dl->completion_notes);
     regislex_db_bind_text(stmt, idx++, new_dl->location);
     regislex_db_bind_text(stmt, idx++, new_dl->tags);
     regislex_db_bind_datetime(stmt, idx++, &new_dl->created_at);
     regislex_db_bind_datetime(stmt, idx++, &new_dl->updated_at);
-    regislex_db_bind_uuid(stmt, idx++, &new_dl->created_by);
+    regislex_db_bind_uuid_ref(stmt, idx++, &new_dl->created_by);
+    regislex_db_bind_text(stmt, idx++, new_dl->rrule[0] ? new_dl->rrule : NULL);
 
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
 
-    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+    if (err == REGISLEX_ERROR_NOT_FOUND || err == REGISLEX_OK) {
+        err = deadline_metadata_save(db, &new_dl->id, deadline->metadata, deadline->metadata_count);
+    }
+    if (err == REGISLEX_OK) {
+        err = deadline_sync(ctx, &new_dl->id);
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
         regislex_deadline_free(new_dl);
         return err;
     }
@@ -168,15 +412,9 @@ REGISLEX_API regislex_error_t regislex_deadline_get(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
-    const char* sql =
-        "SELECT id, case_id, matter_id, title, description, type, status, priority,"
-        "  due_date, start_date, is_all_day, duration_minutes, recurrence,"
-        "  assigned_to_id, rule_reference, days_from_trigger, count_business_days,"
-        "  completed_at, completed_by, completion_notes, location, tags,"
-        "  created_at, updated_at, created_by "
-        "FROM deadlines WHERE id = ?";
+    const char* sql = "SELECT " REGISLEX_DEADLINE_COLUMNS " FROM deadlines WHERE id = ?";
 
     regislex_db_stmt_t* stmt = NULL;
     regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
@@ -196,7 +434,7 @@ REGISLEX_API regislex_error_t regislex_deadline_get(
         return REGISLEX_ERROR_OUT_OF_MEMORY;
     }
 
-    deadline_from_row(stmt, dl);
+    regislex_deadline_from_row(stmt, dl);
     regislex_db_finalize(stmt);
 
     *out_deadline = dl;
@@ -211,7 +449,15 @@ REGISLEX_API regislex_error_t regislex_deadline_update(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    char rrule[sizeof(deadline->rrule)];
+    regislex_error_t err = deadline_series_rule(deadline, rrule, sizeof(rrule));
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_transaction_t* tx = NULL;
+    err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) return err;
 
     const char* sql =
         "UPDATE deadlines SET "
@@ -219,18 +465,21 @@ REGISLEX_API regislex_error_t regislex_deadline_update(
         "  type = ?, status = ?, priority = ?, due_date = ?, start_date = ?,"
         "  is_all_day = ?, duration_minutes = ?, recurrence = ?,"
         "  assigned_to_id = ?, rule_reference = ?, days_from_trigger = ?,"
-        "  count_business_days = ?, location = ?, tags = ?, updated_at = ? "
+        "  count_business_days = ?, location = ?, tags = ?, updated_at = ?, rrule = ? "
         "WHERE id = ?";
 
     regislex_db_stmt_t* stmt = NULL;
-    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
-    if (err != REGISLEX_OK) return err;
+    err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        return err;
+    }
 
     regislex_datetime_t now;
     regislex_datetime_now(&now);
 
     int idx = 1;
-    regislex_db_bind_uuid(stmt, idx++, &deadline->case_id);
+    regislex_db_bind_uuid_ref(stmt, idx++, &deadline->case_id);
     regislex_db_bind_uuid(stmt, idx++, &deadline->matter_id);
     regislex_db_bind_text(stmt, idx++, deadline->title);
     regislex_db_bind_text(stmt, idx++, deadline->description);
@@ -242,19 +491,43 @@ REGISLEX_API regislex_error_t regislex_deadline_update(
     regislex_db_bind_int(stmt, idx++, deadline->is_all_day ? 1 : 0);
     regislex_db_bind_int(stmt, idx++, deadline->duration_minutes);
     regislex_db_bind_int(stmt, idx++, deadline->recurrence);
-    regislex_db_bind_uuid(stmt, idx++, &deadline->assigned_to_id);
+    regislex_db_bind_uuid_ref(stmt, idx++, &deadline->assigned_to_id);
     regislex_db_bind_text(stmt, idx++, deadline->rule_reference);
     regislex_db_bind_int(stmt, idx++, deadline->days_from_trigger);
     regislex_db_bind_int(stmt, idx++, deadline->count_business_days ? 1 : 0);
     regislex_db_bind_text(stmt, idx++, deadline->location);
     regislex_db_bind_text(stmt, idx++, deadline->tags);
     regislex_db_bind_datetime(stmt, idx++, &now);
+    regislex_db_bind_text(stmt, idx++, rrule[0] ? rrule : NULL);
     regislex_db_bind_uuid(stmt, idx++, &deadline->id);
 
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
+    bool updated = regislex_db_changes(db) > 0;
+
+    /* A metadata array replaces the stored set; NULL leaves it untouched */
+    if (err == REGISLEX_ERROR_NOT_FOUND || err == REGISLEX_OK) {
+        err = REGISLEX_OK;
+        if (deadline->metadata) {
+            err = regislex_db_metadata_delete(db, "deadline_metadata", "deadline_id",
+                                              &deadline->id, NULL);
+            if (err == REGISLEX_OK) {
+                err = deadline_metadata_save(db, &deadline->id, deadline->metadata,
+                                             deadline->metadata_count);
+            }
+        }
+    }
+    if (err == REGISLEX_OK && updated) {
+        err = deadline_sync(ctx, &deadline->id);
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+    }
 
-    return (err == REGISLEX_ERROR_NOT_FOUND) ? REGISLEX_OK : err;
+    return err;
 }
 
 REGISLEX_API regislex_error_t regislex_deadline_delete(
@@ -265,7 +538,7 @@ REGISLEX_API regislex_error_t regislex_deadline_delete(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
     const char* sql = "DELETE FROM deadlines WHERE id = ?";
 
@@ -278,7 +551,11 @@ REGISLEX_API regislex_error_t regislex_deadline_delete(
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
 
-    return (err == REGISLEX_ERROR_NOT_FOUND) ? REGISLEX_OK : err;
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+
+    return deadline_sync(ctx, id);
 }
 
 REGISLEX_API regislex_error_t regislex_deadline_complete(
@@ -290,7 +567,7 @@ REGISLEX_API regislex_error_t regislex_deadline_complete(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
     const char* sql =
         "UPDATE deadlines SET "
@@ -313,214 +590,1023 @@ REGISLEX_API regislex_error_t regislex_deadline_complete(
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
 
-    return (err == REGISLEX_ERROR_NOT_FOUND) ? REGISLEX_OK : err;
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+
+    /* A completed deadline no longer holds its slot */
+    return deadline_sync(ctx, id);
 }
 
-REGISLEX_API regislex_error_t regislex_deadline_upcoming(
+REGISLEX_API regislex_error_t regislex_deadline_list(
     regislex_context_t* ctx,
-    int days_ahead,
+    const regislex_deadline_filter_t* filter,
     regislex_deadline_list_t** out_list)
 {
-    if (!ctx || !out_list || days_ahead < 0) {
+    if (!ctx || !out_list) {
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    /* Calculate future date */
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    /* Build query with filters */
+    char sql[4096];
+    char where_clause[2048] = "";
+    char order_clause[256] = "ORDER BY due_date ASC";
+    int param_idx = 1;
+
     regislex_datetime_t now;
     regislex_datetime_now(&now);
 
-    /* Simple date addition (not accounting for month boundaries properly) */
-    regislex_datetime_t future = now;
-    future.day += days_ahead;
-    /* Normalize would be needed here for production */
+    strcpy(sql, "SELECT " REGISLEX_DEADLINE_COLUMNS " FROM deadlines");
+
+    if (!filter || !filter->include_completed) {
+        strcat(where_clause, " WHERE status != ?");
+    }
+
+    if (filter) {
+        if (filter->case_id) {
+            strcat(where_clause, where_clause[0] ? " AND " : " WHERE ");
+            strcat(where_clause, "case_id = ?");
+        }
+        if (filter->matter_id) {
+            strcat(where_clause, where_clause[0] ? " AND " : " WHERE ");
+            strcat(where_clause, "matter_id = ?");
+        }
+        if (filter->assigned_to_id) {
+            strcat(where_clause, where_clause[0] ? " AND " : " WHERE ");
+            strcat(where_clause, "assigned_to_id = ?");
+        }
+        if (filter->type) {
+            strcat(where_clause, where_clause[0] ? " AND " : " WHERE ");
+            strcat(where_clause, "type = ?");
+        }
+        if (filter->status) {
+            strcat(where_clause, where_clause[0] ? " AND " : " WHERE ");
+            strcat(where_clause, "status = ?");
+        }
+        if (filter->priority) {
+            strcat(where_clause, where_clause[0] ? " AND " : " WHERE ");
+            strcat(where_clause, "priority = ?");
+        }
+        if (filter->due_after) {
+            strcat(where_clause, where_clause[0] ? " AND " : " WHERE ");
+            strcat(where_clause, "due_date >= ?");
+        }
+        if (filter->due_before) {
+            strcat(where_clause, where_clause[0] ? " AND " : " WHERE ");
+            strcat(where_clause, "due_date <= ?");
+        }
+        if (filter->overdue_only) {
+            strcat(where_clause, where_clause[0] ? " AND " : " WHERE ");
+            strcat(where_clause, "due_date < ? AND status != ?");
+        }
+        if (filter->tags_contain) {
+            strcat(where_clause, where_clause[0] ? " AND " : " WHERE ");
+            strcat(where_clause, "tags LIKE ?");
+        }
 
-    char now_str[32], future_str[32];
-    regislex_datetime_format(&now, now_str, sizeof(now_str));
-    regislex_datetime_format(&future, future_str, sizeof(future_str));
+        if (filter->metadata_count > 0) {
+            regislex_error_t err = regislex_db_metadata_filter_sql(
+                where_clause, sizeof(where_clause), "deadline_metadata", "deadline_id", "id",
+                filter->metadata, filter->metadata_count);
+            if (err != REGISLEX_OK) {
+                return err;
+            }
+        }
 
-    regislex_db_context_t* db = NULL;
+        if (filter->order_by) {
+            snprintf(order_clause, sizeof(order_clause), "ORDER BY %s %s",
+                    filter->order_by, filter->order_desc ? "DESC" : "ASC");
+        }
+    }
 
-    char sql[1024];
-    snprintf(sql, sizeof(sql),
-        "SELECT id, case_id, matter_id, title, description, type, status, priority,"
-        "  due_date, start_date, is_all_day, duration_minutes, recurrence,"
-        "  assigned_to_id, rule_reference, days_from_trigger, count_business_days,"
-        "  completed_at, completed_by, completion_notes, location, tags,"
-        "  created_at, updated_at, created_by "
-        "FROM deadlines "
-        "WHERE due_date >= '%s' AND due_date <= '%s' "
-        "AND status != %d "
-        "ORDER BY due_date ASC",
-        now_str, future_str, REGISLEX_STATUS_COMPLETED);
+    strcat(sql, where_clause);
+    strcat(sql, " ");
+    strcat(sql, order_clause);
+
+    int limit = (filter && filter->limit > 0) ? filter->limit : 100;
+    int offset = (filter && filter->offset > 0) ? filter->offset : 0;
+    char pagination[64];
+    snprintf(pagination, sizeof(pagination), " LIMIT %d OFFSET %d", limit, offset);
+    strcat(sql, pagination);
 
     regislex_db_stmt_t* stmt = NULL;
     regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
     if (err != REGISLEX_OK) return err;
 
-    regislex_deadline_list_t* list = (regislex_deadline_list_t*)platform_calloc(1, sizeof(regislex_deadline_list_t));
-    if (!list) {
-        regislex_db_finalize(stmt);
-        return REGISLEX_ERROR_OUT_OF_MEMORY;
-    }
-
-    int capacity = 50;
-    list->deadlines = (regislex_deadline_t**)platform_calloc(capacity, sizeof(regislex_deadline_t*));
-    if (!list->deadlines) {
-        platform_free(list);
-        regislex_db_finalize(stmt);
-        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    /* Bind filter parameters in clause order */
+    if (!filter || !filter->include_completed) {
+        regislex_db_bind_int(stmt, param_idx++, REGISLEX_STATUS_COMPLETED);
     }
-
-    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
-        if (list->count >= capacity) {
-            capacity *= 2;
-            regislex_deadline_t** new_deadlines = (regislex_deadline_t**)platform_realloc(
-                list->deadlines, capacity * sizeof(regislex_deadline_t*));
-            if (!new_deadlines) {
-                regislex_deadline_list_free(list);
-                regislex_db_finalize(stmt);
-                return REGISLEX_ERROR_OUT_OF_MEMORY;
-            }
-            list->deadlines = new_deadlines;
+    if (filter) {
+        if (filter->case_id) regislex_db_bind_uuid(stmt, param_idx++, filter->case_id);
+        if (filter->matter_id) regislex_db_bind_uuid(stmt, param_idx++, filter->matter_id);
+        if (filter->assigned_to_id) regislex_db_bind_uuid(stmt, param_idx++, filter->assigned_to_id);
+        if (filter->type) regislex_db_bind_int(stmt, param_idx++, *filter->type);
+        if (filter->status) regislex_db_bind_int(stmt, param_idx++, *filter->status);
+        if (filter->priority) regislex_db_bind_int(stmt, param_idx++, *filter->priority);
+        if (filter->due_after) regislex_db_bind_datetime(stmt, param_idx++, filter->due_after);
+        if (filter->due_before) regislex_db_bind_datetime(stmt, param_idx++, filter->due_before);
+        if (filter->overdue_only) {
+            regislex_db_bind_datetime(stmt, param_idx++, &now);
+            regislex_db_bind_int(stmt, param_idx++, REGISLEX_STATUS_COMPLETED);
+        }
+        if (filter->tags_contain) {
+            char like_pattern[512];
+            snprintf(like_pattern, sizeof(like_pattern), "%%%s%%", filter->tags_contain);
+            regislex_db_bind_text(stmt, param_idx++, like_pattern);
         }
 
-        regislex_deadline_t* dl = deadline_alloc();
-        if (!dl) {
-            regislex_deadline_list_free(list);
+        err = regislex_db_metadata_filter_bind(stmt, &param_idx, filter->metadata,
+                                               filter->metadata_count);
+        if (err != REGISLEX_OK) {
             regislex_db_finalize(stmt);
-            return REGISLEX_ERROR_OUT_OF_MEMORY;
+            return err;
         }
-
-        deadline_from_row(stmt, dl);
-        list->deadlines[list->count++] = dl;
     }
 
+    err = deadline_list_from_stmt(stmt, out_list);
     regislex_db_finalize(stmt);
 
-    *out_list = list;
-    return REGISLEX_OK;
+    if (err == REGISLEX_OK) {
+        (*out_list)->offset = offset;
+        (*out_list)->limit = limit;
+    }
+    return err;
 }
 
-REGISLEX_API regislex_error_t regislex_deadline_overdue(
-    regislex_context_t* ctx,
-    regislex_deadline_list_t** out_list)
-{
-    if (!ctx || !out_list) {
-        return REGISLEX_ERROR_INVALID_ARGUMENT;
+/* ============================================================================
+ * Recurring Deadline Series
+ * ============================================================================ */
+
+/* Growable array of expanded occurrences, stored by value */
+typedef struct {
+    regislex_deadline_t* items;
+    int count;
+    int capacity;
+} occurrence_buffer_t;
+
+/* Override row keyed by the epoch day of the occurrence it replaces */
+typedef struct {
+    int64_t day;
+    regislex_deadline_exception_t ex;
+} series_override_t;
+
+static regislex_deadline_t* occurrence_push(occurrence_buffer_t* buf) {
+    if (buf->count >= buf->capacity) {
+        int capacity = buf->capacity ? buf->capacity * 2 : 32;
+        regislex_deadline_t* items = (regislex_deadline_t*)platform_realloc(
+            buf->items, (size_t)capacity * sizeof(regislex_deadline_t));
+        if (!items) return NULL;
+        buf->items = items;
+        buf->capacity = capacity;
     }
+    return &buf->items[buf->count++];
+}
 
-    regislex_datetime_t now;
-    regislex_datetime_now(&now);
-    char now_str[32];
-    regislex_datetime_format(&now, now_str, sizeof(now_str));
+static int occurrence_compare(const void* a, const void* b) {
+    return regislex_datetime_compare(&((const regislex_deadline_t*)a)->due_date,
+                                     &((const regislex_deadline_t*)b)->due_date);
+}
 
-    regislex_db_context_t* db = NULL;
+static regislex_error_t occurrence_emit(occurrence_buffer_t* buf,
+                                        const regislex_deadline_t* series,
+                                        const regislex_datetime_t* occurrence_date,
+                                        const regislex_datetime_t* due_date,
+                                        const series_override_t* ov,
+                                        bool open_only) {
+    bool completed = ov && ov->ex.is_completed;
+    if (open_only && completed) {
+        return REGISLEX_OK;
+    }
 
-    char sql[1024];
-    snprintf(sql, sizeof(sql),
-        "SELECT id, case_id, matter_id, title, description, type, status, priority,"
-        "  due_date, start_date, is_all_day, duration_minutes, recurrence,"
-        "  assigned_to_id, rule_reference, days_from_trigger, count_business_days,"
-        "  completed_at, completed_by, completion_notes, location, tags,"
-        "  created_at, updated_at, created_by "
-        "FROM deadlines "
-        "WHERE due_date < '%s' AND status != %d "
-        "ORDER BY due_date ASC",
-        now_str, REGISLEX_STATUS_COMPLETED);
+    regislex_deadline_t* dl = occurrence_push(buf);
+    if (!dl) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    *dl = *series;
+    dl->metadata = NULL;
+    dl->metadata_count = 0;
+    dl->occurrence_date = *occurrence_date;
+    dl->due_date = *due_date;
+    if (ov && ov->ex.title[0]) {
+        snprintf(dl->title, sizeof(dl->title), "%s", ov->ex.title);
+    }
+    if (completed) {
+        dl->status = REGISLEX_STATUS_COMPLETED;
+    }
+    return REGISLEX_OK;
+}
+
+/* Overrides whose original or moved date falls in the window, by occurrence date */
+static regislex_error_t series_load_overrides(regislex_db_context_t* db,
+                                              const regislex_uuid_t* series_id,
+                                              const regislex_datetime_t* window_start,
+                                              const regislex_datetime_t* window_end,
+                                              series_override_t** out_overrides,
+                                              int* out_count) {
+    *out_overrides = NULL;
+    *out_count = 0;
+
+    const char* sql =
+        "SELECT occurrence_date, is_cancelled, is_completed, due_date, title "
+        "FROM deadline_exceptions "
+        "WHERE deadline_id = ? "
+        "AND ((occurrence_date >= ? AND occurrence_date <= ?) OR (due_date >= ? AND due_date <= ?)) "
+        "ORDER BY occurrence_date";
 
     regislex_db_stmt_t* stmt = NULL;
     regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
     if (err != REGISLEX_OK) return err;
 
-    regislex_deadline_list_t* list = (regislex_deadline_list_t*)platform_calloc(1, sizeof(regislex_deadline_list_t));
-    if (!list) {
-        regislex_db_finalize(stmt);
-        return REGISLEX_ERROR_OUT_OF_MEMORY;
-    }
+    regislex_db_bind_uuid(stmt, 1, series_id);
+    regislex_db_bind_datetime(stmt, 2, window_start);
+    regislex_db_bind_datetime(stmt, 3, window_end);
+    regislex_db_bind_datetime(stmt, 4, window_start);
+    regislex_db_bind_datetime(stmt, 5, window_end);
 
-    int capacity = 50;
-    list->deadlines = (regislex_deadline_t**)platform_calloc(capacity, sizeof(regislex_deadline_t*));
+    series_override_t* overrides = NULL;
+    int count = 0;
+    int capacity = 0;
 
     while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
-        if (list->count >= capacity) {
-            capacity *= 2;
-            list->deadlines = (regislex_deadline_t**)platform_realloc(
-                list->deadlines, capacity * sizeof(regislex_deadline_t*));
+        if (count >= capacity) {
+            capacity = capacity ? capacity * 2 : 8;
+            series_override_t* grown = (series_override_t*)platform_realloc(
+                overrides, (size_t)capacity * sizeof(series_override_t));
+            if (!grown) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            overrides = grown;
         }
 
-        regislex_deadline_t* dl = deadline_alloc();
-        deadline_from_row(stmt, dl);
-        list->deadlines[list->count++] = dl;
+        series_override_t* ov = &overrides[count++];
+        memset(ov, 0, sizeof(*ov));
+        regislex_db_column_datetime(stmt, 0, &ov->ex.occurrence_date);
+        ov->ex.is_cancelled = regislex_db_column_int(stmt, 1) != 0;
+        ov->ex.is_completed = regislex_db_column_int(stmt, 2) != 0;
+        regislex_db_column_datetime(stmt, 3, &ov->ex.due_date);
+        const char* title = regislex_db_column_text(stmt, 4);
+        if (title) strncpy(ov->ex.title, title, sizeof(ov->ex.title) - 1);
+        ov->day = regislex_datetime_to_days(&ov->ex.occurrence_date);
     }
-
     regislex_db_finalize(stmt);
 
-    *out_list = list;
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        platform_free(overrides);
+        return err;
+    }
+
+    *out_overrides = overrides;
+    *out_count = count;
     return REGISLEX_OK;
 }
 
-REGISLEX_API regislex_error_t regislex_deadline_calculate(
-    regislex_context_t* ctx,
-    const regislex_datetime_t* trigger_date,
-    int days,
-    bool count_business_days,
-    const char* jurisdiction,
-    regislex_datetime_t* out_date)
+static const series_override_t* series_find_override(const series_override_t* overrides,
+                                                     int count, int64_t day) {
+    int lo = 0;
+    int hi = count - 1;
+    while (lo <= hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (overrides[mid].day == day) return &overrides[mid];
+        if (overrides[mid].day < day) lo = mid + 1;
+        else hi = mid - 1;
+    }
+    return NULL;
+}
+
+/*
+ * Append the occurrences of a series that fall in [window_start, window_end].
+ * Cancelled occurrences are dropped; moved ones appear at their new date.
+ * With open_only, completed occurrences are dropped as well.
+ */
+static regislex_error_t series_expand(regislex_db_context_t* db,
+                                      const regislex_deadline_t* series,
+                                      const regislex_datetime_t* window_start,
+                                      const regislex_datetime_t* window_end,
+                                      bool open_only,
+                                      occurrence_buffer_t* buf) {
+    regislex_rrule_t rule;
+    regislex_error_t err = regislex_rrule_parse(series->rrule, &rule);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_rrule_iter_t iter;
+    err = regislex_rrule_iter_init(&iter, &rule, &series->due_date, window_start);
+    if (err != REGISLEX_OK) return err;
+
+    series_override_t* overrides = NULL;
+    int override_count = 0;
+    err = series_load_overrides(db, &series->id, window_start, window_end,
+                                &overrides, &override_count);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_datetime_t occurrence;
+    while ((err = regislex_rrule_iter_next(&iter, window_end, &occurrence)) == REGISLEX_OK) {
+        const series_override_t* ov = series_find_override(
+            overrides, override_count, regislex_datetime_to_days(&occurrence));
+
+        /* Moved occurrences are placed at their new date below */
+        if (ov && (ov->ex.is_cancelled || ov->ex.due_date.year != 0)) continue;
+
+        err = occurrence_emit(buf, series, &occurrence, &occurrence, ov, open_only);
+        if (err != REGISLEX_OK) break;
+    }
+    if (err == REGISLEX_ERROR_NOT_FOUND) {
+        err = REGISLEX_OK;
+    }
+
+    for (int i = 0; i < override_count && err == REGISLEX_OK; i++) {
+        const series_override_t* ov = &overrides[i];
+        if (ov->ex.is_cancelled || ov->ex.due_date.year == 0) continue;
+        if (regislex_datetime_compare(&ov->ex.due_date, window_start) < 0 ||
+            regislex_datetime_compare(&ov->ex.due_date, window_end) > 0) {
+            continue;
+        }
+        err = occurrence_emit(buf, series, &ov->ex.occurrence_date, &ov->ex.due_date, ov, open_only);
+    }
+
+    platform_free(overrides);
+    return err;
+}
+
+/* Expand every open series over the window, sorted by due date */
+static regislex_error_t upcoming_expand_series(regislex_db_context_t* db,
+                                               const regislex_datetime_t* window_start,
+                                               const regislex_datetime_t* window_end,
+                                               occurrence_buffer_t* buf) {
+    const char* sql =
+        "SELECT " REGISLEX_DEADLINE_COLUMNS " "
+        "FROM deadlines "
+        "WHERE rrule IS NOT NULL AND due_date <= ? AND status != ?";
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_datetime(stmt, 1, window_end);
+    regislex_db_bind_int(stmt, 2, REGISLEX_STATUS_COMPLETED);
+
+    regislex_deadline_t series;
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        memset(&series, 0, sizeof(series));
+        regislex_deadline_from_row(stmt, &series);
+
+        err = series_expand(db, &series, window_start, window_end, true, buf);
+        if (err == REGISLEX_ERROR_VALIDATION) {
+            /* A rule that no longer parses hides the series, not the whole view */
+            err = REGISLEX_OK;
+        }
+        if (err != REGISLEX_OK) break;
+    }
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        return err;
+    }
+
+    if (buf->count > 1) {
+        qsort(buf->items, (size_t)buf->count, sizeof(regislex_deadline_t), occurrence_compare);
+    }
+    return REGISLEX_OK;
+}
+
+/* Copy a deadline onto the end of a list */
+static regislex_error_t deadline_list_push(regislex_deadline_list_t* list, int* capacity,
+                                           const regislex_deadline_t* src) {
+    if (list->count >= *capacity) {
+        int new_capacity = *capacity ? *capacity * 2 : 50;
+        regislex_deadline_t** grown = (regislex_deadline_t**)platform_realloc(
+            list->deadlines, (size_t)new_capacity * sizeof(regislex_deadline_t*));
+        if (!grown) return REGISLEX_ERROR_OUT_OF_MEMORY;
+        list->deadlines = grown;
+        *capacity = new_capacity;
+    }
+
+    regislex_deadline_t* dl = deadline_alloc();
+    if (!dl) return REGISLEX_ERROR_OUT_OF_MEMORY;
+
+    *dl = *src;
+    dl->metadata = NULL;
+    dl->metadata_count = 0;
+    list->deadlines[list->count++] = dl;
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_deadline_occurrences(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* series_id,
+    const regislex_datetime_t* window_start,
+    const regislex_datetime_t* window_end,
+    regislex_deadline_list_t** out_list)
 {
-    if (!ctx || !trigger_date || !out_date) {
+    if (!ctx || !series_id || !window_start || !window_end || !out_list) {
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    (void)jurisdiction; /* TODO: Use for holiday lookup */
+    regislex_deadline_t* series = NULL;
+    regislex_error_t err = regislex_deadline_get(ctx, series_id, &series);
+    if (err != REGISLEX_OK) return err;
 
-    /* Copy trigger date as starting point */
-    memcpy(out_date, trigger_date, sizeof(regislex_datetime_t));
+    occurrence_buffer_t buf = { NULL, 0, 0 };
+    if (series->rrule[0]) {
+        err = series_expand(regislex_get_db(ctx), series, window_start, window_end, false, &buf);
+    } else if (regislex_datetime_compare(&series->due_date, window_start) >= 0 &&
+               regislex_datetime_compare(&series->due_date, window_end) <= 0) {
+        /* A one-off deadline is its own single occurrence */
+        err = occurrence_emit(&buf, series, &series->due_date, &series->due_date, NULL, false);
+    }
+    regislex_deadline_free(series);
 
-    if (!count_business_days) {
-        /* Simple calendar day addition */
-        out_date->day += days;
+    regislex_deadline_list_t* list = NULL;
+    if (err == REGISLEX_OK) {
+        list = (regislex_deadline_list_t*)platform_calloc(1, sizeof(regislex_deadline_list_t));
+        if (!list) err = REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    if (err == REGISLEX_OK && buf.count > 1) {
+        qsort(buf.items, (size_t)buf.count, sizeof(regislex_deadline_t), occurrence_compare);
+    }
+
+    int capacity = 0;
+    for (int i = 0; err == REGISLEX_OK && i < buf.count; i++) {
+        err = deadline_list_push(list, &capacity, &buf.items[i]);
+    }
+    platform_free(buf.items);
+
+    if (err != REGISLEX_OK) {
+        regislex_deadline_list_free(list);
+        return err;
+    }
+
+    list->total_count = list->count;
+    *out_list = list;
+    return REGISLEX_OK;
+}
 
-        /* Normalize (basic - would need full calendar logic in production) */
-        while (out_date->day > 31) {
-            out_date->day -= 30;
-            out_date->month++;
-            if (out_date->month > 12) {
-                out_date->month = 1;
-                out_date->year++;
+REGISLEX_API regislex_error_t regislex_deadline_exception_set(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* series_id,
+    const regislex_deadline_exception_t* exception)
+{
+    if (!ctx || !series_id || !exception) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!regislex_datetime_is_valid_date(&exception->occurrence_date) ||
+        (exception->due_date.year != 0 && !regislex_datetime_is_valid_date(&exception->due_date))) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+
+    regislex_deadline_t* series = NULL;
+    regislex_error_t err = regislex_deadline_get(ctx, series_id, &series);
+    if (err != REGISLEX_OK) return err;
+
+    if (!series->rrule[0]) {
+        regislex_deadline_free(series);
+        return REGISLEX_ERROR_VALIDATION;
+    }
+
+    /* Key by the series' time of day so each occurrence has one override row */
+    regislex_datetime_t occurrence = series->due_date;
+    regislex_datetime_from_days(regislex_datetime_to_days(&exception->occurrence_date), &occurrence);
+    regislex_deadline_free(series);
+
+    const char* sql =
+        "INSERT INTO deadline_exceptions "
+        "(deadline_id, occurrence_date, is_cancelled, is_completed, due_date, title) "
+        "VALUES (?, ?, ?, ?, ?, ?) "
+        "ON CONFLICT (deadline_id, occurrence_date) DO UPDATE SET "
+        "is_cancelled = excluded.is_cancelled, is_completed = excluded.is_completed, "
+        "due_date = excluded.due_date, title = excluded.title";
+
+    regislex_db_stmt_t* stmt = NULL;
+    err = regislex_db_prepare(regislex_get_db(ctx), sql, &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_uuid(stmt, 1, series_id);
+    regislex_db_bind_datetime(stmt, 2, &occurrence);
+    regislex_db_bind_int(stmt, 3, exception->is_cancelled ? 1 : 0);
+    regislex_db_bind_int(stmt, 4, exception->is_completed ? 1 : 0);
+    regislex_db_bind_datetime(stmt, 5, exception->due_date.year != 0 ? &exception->due_date : NULL);
+    regislex_db_bind_text(stmt, 6, exception->title[0] ? exception->title : NULL);
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+
+    return deadline_sync(ctx, series_id);
+}
+
+REGISLEX_API regislex_error_t regislex_deadline_exception_delete(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* series_id,
+    const regislex_datetime_t* occurrence_date)
+{
+    if (!ctx || !series_id || !occurrence_date) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!regislex_datetime_is_valid_date(occurrence_date)) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    /* Overrides are keyed by the series' time of day; match on the date alone */
+    const char* sql =
+        "DELETE FROM deadline_exceptions "
+        "WHERE deadline_id = ? AND substr(occurrence_date, 1, 10) = ?";
+
+    char day[16];
+    snprintf(day, sizeof(day), "%04d-%02d-%02d",
+             occurrence_date->year, occurrence_date->month, occurrence_date->day);
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_uuid(stmt, 1, series_id);
+    regislex_db_bind_text(stmt, 2, day);
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+    if (regislex_db_changes(db) == 0) {
+        return REGISLEX_ERROR_NOT_FOUND;
+    }
+
+    return deadline_sync(ctx, series_id);
+}
+
+/* ============================================================================
+ * Streaming Deadline Queries
+ * ============================================================================ */
+
+/*
+ * One-off deadlines stream from SQLite in due-date order; series are
+ * expanded over the same window up front and merged in as the stream
+ * advances.
+ */
+struct regislex_deadline_cursor {
+    regislex_db_stmt_t* stmt;
+    regislex_deadline_t row;            /* Reused for every row */
+    bool row_pending;                   /* row read but not yet returned */
+    occurrence_buffer_t occurrences;    /* Expanded series, in due-date order */
+    int occurrence_pos;
+};
+
+/* Prepare the open one-off deadline query for [window_start, window_end] */
+static regislex_error_t upcoming_prepare(regislex_db_context_t* db,
+                                         const regislex_datetime_t* window_start,
+                                         const regislex_datetime_t* window_end,
+                                         regislex_db_stmt_t** out_stmt) {
+    const char* sql =
+        "SELECT " REGISLEX_DEADLINE_COLUMNS " "
+        "FROM deadlines "
+        "WHERE due_date >= ? AND due_date <= ? "
+        "AND status != ? AND rrule IS NULL "
+        "ORDER BY due_date ASC";
+
+    regislex_error_t err = regislex_db_prepare(db, sql, out_stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_datetime(*out_stmt, 1, window_start);
+    regislex_db_bind_datetime(*out_stmt, 2, window_end);
+    regislex_db_bind_int(*out_stmt, 3, REGISLEX_STATUS_COMPLETED);
+    return REGISLEX_OK;
+}
+
+/* Open a merged cursor over the open deadlines due in [window_start, window_end] */
+static regislex_error_t deadline_cursor_open(regislex_db_context_t* db,
+                                             const regislex_datetime_t* window_start,
+                                             const regislex_datetime_t* window_end,
+                                             regislex_deadline_cursor_t** out_cursor) {
+    regislex_deadline_cursor_t* cursor = (regislex_deadline_cursor_t*)platform_calloc(
+        1, sizeof(regislex_deadline_cursor_t));
+    if (!cursor) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    regislex_error_t err = upcoming_expand_series(db, window_start, window_end, &cursor->occurrences);
+    if (err == REGISLEX_OK) {
+        err = upcoming_prepare(db, window_start, window_end, &cursor->stmt);
+    }
+    if (err != REGISLEX_OK) {
+        platform_free(cursor->occurrences.items);
+        platform_free(cursor);
+        return err;
+    }
+
+    *out_cursor = cursor;
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_deadline_upcoming_cursor(
+    regislex_context_t* ctx,
+    int days_ahead,
+    regislex_deadline_cursor_t** out_cursor)
+{
+    if (!ctx || !out_cursor || days_ahead < 0) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+    regislex_datetime_t future = now;
+    regislex_datetime_add_days(&future, days_ahead);
+
+    return deadline_cursor_open(regislex_get_db(ctx), &now, &future, out_cursor);
+}
+
+REGISLEX_API regislex_error_t regislex_deadline_cursor_next(
+    regislex_deadline_cursor_t* cursor,
+    const regislex_deadline_t** out_deadline)
+{
+    if (!cursor || !out_deadline) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (!cursor->row_pending && cursor->stmt) {
+        regislex_error_t err = regislex_db_step(cursor->stmt);
+        if (err == REGISLEX_OK) {
+            memset(&cursor->row, 0, sizeof(cursor->row));
+            regislex_deadline_from_row(cursor->stmt, &cursor->row);
+            cursor->row_pending = true;
+        } else {
+            /* Release the statement as soon as the result set is exhausted */
+            regislex_db_finalize(cursor->stmt);
+            cursor->stmt = NULL;
+            if (err != REGISLEX_ERROR_NOT_FOUND) {
+                return err;
             }
         }
-    } else {
-        /* Business day calculation */
-        int days_added = 0;
-        while (days_added < days) {
-            out_date->day++;
-
-            /* Normalize month overflow */
-            if (out_date->day > 28) { /* Simplified */
-                out_date->day = 1;
-                out_date->month++;
-                if (out_date->month > 12) {
-                    out_date->month = 1;
-                    out_date->year++;
-                }
-            }
+    }
 
-            /* Check if weekday (simplified - doesn't handle holidays) */
-            /* Would need proper day-of-week calculation */
-            bool is_business_day = true; /* Placeholder */
+    const occurrence_buffer_t* occ = &cursor->occurrences;
+    bool have_occurrence = cursor->occurrence_pos < occ->count;
+    if (!cursor->row_pending && !have_occurrence) {
+        return REGISLEX_ERROR_NOT_FOUND;
+    }
 
-            /* TODO: Check holiday table */
-            /* regislex_holiday_check(ctx, out_date, jurisdiction, &is_holiday); */
+    if (have_occurrence &&
+        (!cursor->row_pending ||
+         regislex_datetime_compare(&occ->items[cursor->occurrence_pos].due_date,
+                                   &cursor->row.due_date) < 0)) {
+        *out_deadline = &occ->items[cursor->occurrence_pos++];
+        return REGISLEX_OK;
+    }
 
-            if (is_business_day) {
-                days_added++;
-            }
+    cursor->row_pending = false;
+    *out_deadline = &cursor->row;
+    return REGISLEX_OK;
+}
+
+REGISLEX_API void regislex_deadline_cursor_close(regislex_deadline_cursor_t* cursor) {
+    if (!cursor) return;
+
+    if (cursor->stmt) {
+        regislex_db_finalize(cursor->stmt);
+    }
+    platform_free(cursor->occurrences.items);
+    platform_free(cursor);
+}
+
+REGISLEX_API regislex_error_t regislex_deadline_upcoming(
+    regislex_context_t* ctx,
+    int days_ahead,
+    regislex_deadline_list_t** out_list)
+{
+    if (!ctx || !out_list || days_ahead < 0) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_deadline_list_t* list = (regislex_deadline_list_t*)platform_calloc(1, sizeof(regislex_deadline_list_t));
+    if (!list) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    regislex_deadline_cursor_t* cursor = NULL;
+    regislex_error_t err = regislex_deadline_upcoming_cursor(ctx, days_ahead, &cursor);
+    if (err != REGISLEX_OK) {
+        platform_free(list);
+        return err;
+    }
+
+    int capacity = 0;
+    const regislex_deadline_t* dl = NULL;
+    while ((err = regislex_deadline_cursor_next(cursor, &dl)) == REGISLEX_OK) {
+        err = deadline_list_push(list, &capacity, dl);
+        if (err != REGISLEX_OK) break;
+    }
+    regislex_deadline_cursor_close(cursor);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        regislex_deadline_list_free(list);
+        return err;
+    }
+
+    list->total_count = list->count;
+    *out_list = list;
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_deadline_upcoming_foreach(
+    regislex_context_t* ctx,
+    int days_ahead,
+    regislex_deadline_visitor_t visitor,
+    void* user_data)
+{
+    if (!ctx || !visitor || days_ahead < 0) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_deadline_cursor_t* cursor = NULL;
+    regislex_error_t err = regislex_deadline_upcoming_cursor(ctx, days_ahead, &cursor);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    const regislex_deadline_t* dl = NULL;
+    while ((err = regislex_deadline_cursor_next(cursor, &dl)) == REGISLEX_OK) {
+        if (!visitor(dl, user_data)) {
+            break;
         }
     }
 
+    regislex_deadline_cursor_close(cursor);
+    return err == REGISLEX_ERROR_NOT_FOUND ? REGISLEX_OK : err;
+}
+
+REGISLEX_API regislex_error_t regislex_deadline_overdue(
+    regislex_context_t* ctx,
+    regislex_deadline_list_t** out_list)
+{
+    if (!ctx || !out_list) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_deadline_list_t* list = (regislex_deadline_list_t*)platform_calloc(1, sizeof(regislex_deadline_list_t));
+    if (!list) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* Series are expanded from their first occurrence, so open the window at day one */
+    regislex_datetime_t earliest = { 1, 1, 1, 0, 0, 0, 0 };
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    regislex_deadline_cursor_t* cursor = NULL;
+    regislex_error_t err = deadline_cursor_open(regislex_get_db(ctx), &earliest, &now, &cursor);
+    if (err != REGISLEX_OK) {
+        platform_free(list);
+        return err;
+    }
+
+    int capacity = 0;
+    const regislex_deadline_t* dl = NULL;
+    while ((err = regislex_deadline_cursor_next(cursor, &dl)) == REGISLEX_OK) {
+        /* The window ends on today's date; only what fell due before now is overdue */
+        if (regislex_datetime_compare(&dl->due_date, &now) >= 0) {
+            err = REGISLEX_ERROR_NOT_FOUND;
+            break;
+        }
+        err = deadline_list_push(list, &capacity, dl);
+        if (err != REGISLEX_OK) break;
+    }
+    regislex_deadline_cursor_close(cursor);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        regislex_deadline_list_free(list);
+        return err;
+    }
+
+    list->total_count = list->count;
+    *out_list = list;
     return REGISLEX_OK;
 }
 
+/* ============================================================================
+ * Due and Overdue Sweep
+ * ============================================================================ */
+
+/*
+ * One stream of sweep events. An event's time is when the deadline falls
+ * due, or DEADLINE_APPROACHING_DAYS earlier for APPROACHING, so both
+ * streams are ordered by event time.
+ */
+typedef struct {
+    regislex_event_type_t type;
+    regislex_deadline_cursor_t* cursor;
+    regislex_datetime_t after;          /* Due dates in (after, until] */
+    regislex_datetime_t until;
+    bool pending;                       /* The fields below hold the next event */
+    regislex_datetime_t at;
+    regislex_datetime_t due;
+    regislex_uuid_t id;
+    regislex_uuid_t case_id;
+} sweep_stream_t;
+
+/* Read the stream's next open deadline; NOT_FOUND when it is exhausted */
+static regislex_error_t sweep_stream_next(sweep_stream_t* stream) {
+    const regislex_deadline_t* dl = NULL;
+    regislex_error_t err;
+    while ((err = regislex_deadline_cursor_next(stream->cursor, &dl)) == REGISLEX_OK) {
+        /* The window is whole days at either end; keep the exact range */
+        if (regislex_datetime_compare(&dl->due_date, &stream->until) > 0) {
+            err = REGISLEX_ERROR_NOT_FOUND;
+            break;
+        }
+        if (regislex_datetime_compare(&dl->due_date, &stream->after) <= 0 ||
+            dl->status >= REGISLEX_STATUS_COMPLETED) {
+            continue;
+        }
+
+        stream->due = dl->due_date;
+        stream->at = dl->due_date;
+        if (stream->type == REGISLEX_EVENT_DEADLINE_APPROACHING) {
+            regislex_datetime_add_days(&stream->at, -DEADLINE_APPROACHING_DAYS);
+        }
+        stream->id = dl->id;
+        stream->case_id = dl->case_id;
+        stream->pending = true;
+        return REGISLEX_OK;
+    }
+    stream->pending = false;
+    return err;
+}
+
+static regislex_error_t sweep_stream_open(regislex_db_context_t* db, sweep_stream_t* stream) {
+    regislex_error_t err = deadline_cursor_open(db, &stream->after, &stream->until, &stream->cursor);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+    err = sweep_stream_next(stream);
+    return err == REGISLEX_ERROR_NOT_FOUND ? REGISLEX_OK : err;
+}
+
+/* Publish the stream's pending event; without a running event bus nothing listens */
+static regislex_error_t sweep_stream_publish(regislex_context_t* ctx, const sweep_stream_t* stream,
+                                             int* published) {
+    regislex_event_t event;
+    memset(&event, 0, sizeof(event));
+    event.type = stream->type;
+    event.case_id = stream->case_id;
+    event.subject_id = stream->id;
+
+    char due[32];
+    regislex_datetime_format(&stream->due, due, sizeof(due));
+    snprintf(event.data, sizeof(event.data), "{\"due_date\":\"%s\"}", due);
+
+    regislex_error_t err = regislex_event_publish(ctx, &event);
+    if (err == REGISLEX_ERROR_NOT_INITIALIZED) {
+        return REGISLEX_OK;
+    }
+    if (err == REGISLEX_OK) {
+        (*published)++;
+    }
+    return err;
+}
+
+static regislex_error_t sweep_store(regislex_db_context_t* db, const regislex_datetime_t* swept_until) {
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "INSERT OR REPLACE INTO deadline_sweep_state (id, swept_until) VALUES (1, ?)", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+    regislex_db_bind_datetime(stmt, 1, swept_until);
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+    return err == REGISLEX_ERROR_NOT_FOUND ? REGISLEX_OK : err;
+}
+
+REGISLEX_API regislex_error_t regislex_deadline_sweep(
+    regislex_context_t* ctx,
+    int* out_published)
+{
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    int published = 0;
+    if (out_published) *out_published = 0;
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "SELECT swept_until FROM deadline_sweep_state WHERE id = 1", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+    regislex_datetime_t swept;
+    memset(&swept, 0, sizeof(swept));
+    err = regislex_db_step(stmt);
+    if (err == REGISLEX_OK) {
+        regislex_db_column_datetime(stmt, 0, &swept);
+    }
+    regislex_db_finalize(stmt);
+
+    /* The first sweep only records where the next one starts */
+    if (err == REGISLEX_ERROR_NOT_FOUND) {
+        return sweep_store(db, &now);
+    }
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+    if (regislex_datetime_compare(&swept, &now) >= 0) {
+        return REGISLEX_OK;
+    }
+
+    sweep_stream_t streams[2];
+    memset(streams, 0, sizeof(streams));
+    streams[0].type = REGISLEX_EVENT_DEADLINE_PASSED;
+    streams[0].after = swept;
+    streams[0].until = now;
+    streams[1].type = REGISLEX_EVENT_DEADLINE_APPROACHING;
+    streams[1].after = swept;
+    streams[1].until = now;
+    regislex_datetime_add_days(&streams[1].after, DEADLINE_APPROACHING_DAYS);
+    regislex_datetime_add_days(&streams[1].until, DEADLINE_APPROACHING_DAYS);
+    /* After a long gap, what already fell due is only reported as passed */
+    if (regislex_datetime_compare(&streams[1].after, &now) < 0) {
+        streams[1].after = now;
+    }
+
+    err = sweep_stream_open(db, &streams[0]);
+    if (err == REGISLEX_OK) {
+        err = sweep_stream_open(db, &streams[1]);
+    }
+
+    /*
+     * Publish both streams in event-time order. The position only passes
+     * an event time once every event at that time is queued, so a sweep
+     * stopped by a full queue resumes at the first event not queued.
+     */
+    regislex_datetime_t queued_until = swept;
+    regislex_datetime_t last = swept;
+    while (err == REGISLEX_OK && (streams[0].pending || streams[1].pending)) {
+        sweep_stream_t* next = &streams[0];
+        if (!streams[0].pending ||
+            (streams[1].pending && regislex_datetime_compare(&streams[1].at, &streams[0].at) < 0)) {
+            next = &streams[1];
+        }
+
+        if (regislex_datetime_compare(&next->at, &last) > 0) {
+            queued_until = last;
+            last = next->at;
+        }
+        err = sweep_stream_publish(ctx, next, &published);
+        if (err == REGISLEX_OK) {
+            err = sweep_stream_next(next);
+            if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
+        }
+    }
+    if (err == REGISLEX_OK) {
+        queued_until = now;
+    }
+
+    regislex_deadline_cursor_close(streams[0].cursor);
+    regislex_deadline_cursor_close(streams[1].cursor);
+
+    if (regislex_datetime_compare(&queued_until, &swept) > 0) {
+        regislex_error_t store_err = sweep_store(db, &queued_until);
+        if (err == REGISLEX_OK) err = store_err;
+    }
+
+    if (out_published) *out_published = published;
+    return err;
+}
+
+REGISLEX_API regislex_error_t regislex_deadline_calculate(
+    regislex_context_t* ctx,
+    const regislex_datetime_t* trigger_date,
+    int days,
+    bool count_business_days,
+    const char* jurisdiction,
+    regislex_datetime_t* out_date)
+{
+    if (!ctx || !trigger_date || !out_date) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (!regislex_datetime_is_valid_date(trigger_date)) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    return regislex_court_calendar_deadline(NULL, jurisdiction, trigger_date, days,
+                                            count_business_days, false, out_date);
+}
+
 REGISLEX_API void regislex_deadline_free(regislex_deadline_t* deadline) {
     if (!deadline) return;
 
@@ -549,72 +1635,52 @@ REGISLEX_API void regislex_deadline_list_free(regislex_deadline_list_t* list) {
 }
 
 /* ============================================================================
- * Reminder Functions
+ * Deadline Metadata Functions
  * ============================================================================ */
 
-REGISLEX_API regislex_error_t regislex_reminder_add(
+REGISLEX_API regislex_error_t regislex_deadline_metadata_set(
     regislex_context_t* ctx,
     const regislex_uuid_t* deadline_id,
-    const regislex_reminder_t* reminder,
-    regislex_reminder_t** out_reminder)
+    const char* key,
+    regislex_metadata_type_t type,
+    const char* value)
 {
-    if (!ctx || !deadline_id || !reminder || !out_reminder) {
+    if (!ctx || !deadline_id || !key || !value) {
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_reminder_t* new_reminder = (regislex_reminder_t*)platform_calloc(1, sizeof(regislex_reminder_t));
-    if (!new_reminder) {
-        return REGISLEX_ERROR_OUT_OF_MEMORY;
-    }
-
-    memcpy(new_reminder, reminder, sizeof(regislex_reminder_t));
-    regislex_uuid_generate(&new_reminder->id);
-    memcpy(&new_reminder->deadline_id, deadline_id, sizeof(regislex_uuid_t));
-
-    regislex_datetime_now(&new_reminder->created_at);
-
-    regislex_db_context_t* db = NULL;
-
-    const char* sql =
-        "INSERT INTO reminders ("
-        "  id, deadline_id, user_id, type, minutes_before, is_sent,"
-        "  send_at, sent_at, message, is_active, created_at"
-        ") VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)";
-
-    regislex_db_stmt_t* stmt = NULL;
-    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
-    if (err != REGISLEX_OK) {
-        regislex_reminder_free(new_reminder);
-        return err;
-    }
-
-    int idx = 1;
-    regislex_db_bind_uuid(stmt, idx++, &new_reminder->id);
-    regislex_db_bind_uuid(stmt, idx++, &new_reminder->deadline_id);
-    regislex_db_bind_uuid(stmt, idx++, &new_reminder->user_id);
-    regislex_db_bind_int(stmt, idx++, new_reminder->type);
-    regislex_db_bind_int(stmt, idx++, new_reminder->minutes_before);
-    regislex_db_bind_int(stmt, idx++, new_reminder->is_sent ? 1 : 0);
-    regislex_db_bind_datetime(stmt, idx++, &new_reminder->send_at);
-    regislex_db_bind_datetime(stmt, idx++, &new_reminder->sent_at);
-    regislex_db_bind_text(stmt, idx++, new_reminder->message);
-    regislex_db_bind_int(stmt, idx++, new_reminder->is_active ? 1 : 0);
-    regislex_db_bind_datetime(stmt, idx++, &new_reminder->created_at);
+    regislex_metadata_t item;
+    item.key = (char*)key;
+    item.value = (char*)value;
+    item.type = type;
 
-    err = regislex_db_step(stmt);
-    regislex_db_finalize(stmt);
+    return regislex_db_metadata_set(regislex_get_db(ctx), "deadline_metadata", "deadline_id",
+                                    deadline_id, &item);
+}
 
-    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
-        regislex_reminder_free(new_reminder);
-        return err;
+REGISLEX_API regislex_error_t regislex_deadline_metadata_get(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* deadline_id,
+    regislex_metadata_t** out_metadata,
+    int* out_count)
+{
+    if (!ctx || !deadline_id || !out_metadata || !out_count) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    *out_reminder = new_reminder;
-    return REGISLEX_OK;
+    return regislex_db_metadata_load(regislex_get_db(ctx), "deadline_metadata", "deadline_id",
+                                     deadline_id, out_metadata, out_count);
 }
 
-REGISLEX_API void regislex_reminder_free(regislex_reminder_t* reminder) {
-    if (reminder) {
-        platform_free(reminder);
+REGISLEX_API regislex_error_t regislex_deadline_metadata_delete(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* deadline_id,
+    const char* key)
+{
+    if (!ctx || !deadline_id || !key) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
+
+    return regislex_db_metadata_delete(regislex_get_db(ctx), "deadline_metadata", "deadline_id",
+                                       deadline_id, key);
 }
@@ -0,0 +1,469 @@
+/**
+ * @file recurrence.c
+ * @brief Recurrence Rules (RFC 5545 RRULE subset)
+ *
+ * A rule is stored once per series and expanded on demand. The iterator
+ * jumps straight to the period containing the window start, so expanding
+ * a week of a ten-year daily series costs a week of work. Rules bounded
+ * by COUNT are walked from the series start, since the count depends on
+ * every earlier occurrence.
+ */
+
+#include "regislex/regislex.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char* const WEEKDAY_CODES[7] = { "SU", "MO", "TU", "WE", "TH", "FR", "SA" };
+
+/*
+ * The Gregorian calendar repeats every 400 years (4800 months), so a rule
+ * with this many empty periods in a row can never produce an occurrence,
+ * e.g. BYMONTHDAY=31 stepping through 30-day months only.
+ */
+#define RRULE_MAX_EMPTY_PERIODS 4800
+
+/* ============================================================================
+ * Parsing
+ * ============================================================================ */
+
+static int parse_weekday(const char* s) {
+    for (int i = 0; i < 7; i++) {
+        if (s[0] == WEEKDAY_CODES[i][0] && s[1] == WEEKDAY_CODES[i][1]) return i;
+    }
+    return -1;
+}
+
+/* Parses a strictly numeric, optionally signed value */
+static bool parse_int(const char* s, size_t len, int* out) {
+    if (len == 0 || len > 9) return false;
+
+    size_t i = 0;
+    int sign = 1;
+    if (s[0] == '+' || s[0] == '-') {
+        sign = s[0] == '-' ? -1 : 1;
+        i++;
+    }
+    if (i == len) return false;
+
+    int value = 0;
+    for (; i < len; i++) {
+        if (s[i] < '0' || s[i] > '9') return false;
+        value = value * 10 + (s[i] - '0');
+    }
+    *out = sign * value;
+    return true;
+}
+
+static regislex_error_t parse_until(const char* s, size_t len, regislex_datetime_t* out) {
+    memset(out, 0, sizeof(*out));
+
+    /* YYYYMMDD or YYYYMMDDTHHMMSS[Z] */
+    if (len != 8 && len != 15 && len != 16) return REGISLEX_ERROR_VALIDATION;
+    if (len > 8 && s[8] != 'T') return REGISLEX_ERROR_VALIDATION;
+    if (len == 16 && s[15] != 'Z') return REGISLEX_ERROR_VALIDATION;
+
+    if (!parse_int(s, 4, &out->year) || !parse_int(s + 4, 2, &out->month) ||
+        !parse_int(s + 6, 2, &out->day)) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+    if (len > 8) {
+        if (!parse_int(s + 9, 2, &out->hour) || !parse_int(s + 11, 2, &out->minute) ||
+            !parse_int(s + 13, 2, &out->second)) {
+            return REGISLEX_ERROR_VALIDATION;
+        }
+    } else {
+        out->hour = 23;
+        out->minute = 59;
+        out->second = 59;
+    }
+
+    return regislex_datetime_is_valid_date(out) ? REGISLEX_OK : REGISLEX_ERROR_VALIDATION;
+}
+
+static regislex_error_t parse_byday(const char* s, size_t len, regislex_rrule_t* rule) {
+    int entries = 0;
+
+    for (size_t start = 0; start < len; ) {
+        size_t end = start;
+        while (end < len && s[end] != ',') end++;
+
+        size_t n = end - start;
+        if (n < 2) return REGISLEX_ERROR_VALIDATION;
+
+        int weekday = parse_weekday(s + end - 2);
+        if (weekday < 0) return REGISLEX_ERROR_VALIDATION;
+
+        if (n > 2) {
+            int ordinal;
+            if (!parse_int(s + start, n - 2, &ordinal) || ordinal == 0 ||
+                ordinal < -5 || ordinal > 5) {
+                return REGISLEX_ERROR_VALIDATION;
+            }
+            rule->weekday_ordinal = ordinal;
+        }
+
+        rule->weekdays |= (uint8_t)(1u << weekday);
+        entries++;
+        start = end + 1;
+    }
+
+    /* An ordinal selects a single weekday of the month */
+    if (rule->weekday_ordinal != 0 && entries != 1) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_rrule_parse(const char* text, regislex_rrule_t* rule) {
+    if (!text || !rule) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    memset(rule, 0, sizeof(*rule));
+    rule->interval = 1;
+
+    if (strncmp(text, "RRULE:", 6) == 0) text += 6;
+
+    bool have_freq = false;
+    for (const char* p = text; *p; ) {
+        const char* end = strchr(p, ';');
+        size_t part_len = end ? (size_t)(end - p) : strlen(p);
+
+        const char* eq = memchr(p, '=', part_len);
+        if (!eq) return REGISLEX_ERROR_VALIDATION;
+
+        size_t name_len = (size_t)(eq - p);
+        const char* value = eq + 1;
+        size_t value_len = part_len - name_len - 1;
+        regislex_error_t err = REGISLEX_OK;
+
+        if (name_len == 4 && strncmp(p, "FREQ", 4) == 0) {
+            if (value_len == 5 && strncmp(value, "DAILY", 5) == 0) rule->freq = REGISLEX_RRULE_DAILY;
+            else if (value_len == 6 && strncmp(value, "WEEKLY", 6) == 0) rule->freq = REGISLEX_RRULE_WEEKLY;
+            else if (value_len == 7 && strncmp(value, "MONTHLY", 7) == 0) rule->freq = REGISLEX_RRULE_MONTHLY;
+            else if (value_len == 6 && strncmp(value, "YEARLY", 6) == 0) rule->freq = REGISLEX_RRULE_YEARLY;
+            else err = REGISLEX_ERROR_VALIDATION;
+            have_freq = true;
+        } else if (name_len == 8 && strncmp(p, "INTERVAL", 8) == 0) {
+            if (!parse_int(value, value_len, &rule->interval) || rule->interval < 1) {
+                err = REGISLEX_ERROR_VALIDATION;
+            }
+        } else if (name_len == 5 && strncmp(p, "COUNT", 5) == 0) {
+            if (!parse_int(value, value_len, &rule->count) || rule->count < 1) {
+                err = REGISLEX_ERROR_VALIDATION;
+            }
+        } else if (name_len == 5 && strncmp(p, "UNTIL", 5) == 0) {
+            err = parse_until(value, value_len, &rule->until);
+        } else if (name_len == 5 && strncmp(p, "BYDAY", 5) == 0) {
+            err = parse_byday(value, value_len, rule);
+        } else if (name_len == 10 && strncmp(p, "BYMONTHDAY", 10) == 0) {
+            if (!parse_int(value, value_len, &rule->month_day) || rule->month_day == 0 ||
+                rule->month_day < -31 || rule->month_day > 31) {
+                err = REGISLEX_ERROR_VALIDATION;
+            }
+        } else if (name_len == 4 && strncmp(p, "WKST", 4) == 0) {
+            /* Weeks always start on Monday, the RFC 5545 default */
+            if (value_len != 2 || strncmp(value, "MO", 2) != 0) err = REGISLEX_ERROR_VALIDATION;
+        } else {
+            err = REGISLEX_ERROR_VALIDATION;
+        }
+
+        if (err != REGISLEX_OK) return err;
+
+        p += part_len;
+        if (*p == ';') p++;
+    }
+
+    if (!have_freq) return REGISLEX_ERROR_VALIDATION;
+    if (rule->count > 0 && rule->until.year != 0) return REGISLEX_ERROR_VALIDATION;
+
+    /* Supported combinations of BY* parts per frequency */
+    switch (rule->freq) {
+        case REGISLEX_RRULE_DAILY:
+        case REGISLEX_RRULE_YEARLY:
+            if (rule->weekdays || rule->month_day) return REGISLEX_ERROR_VALIDATION;
+            break;
+        case REGISLEX_RRULE_WEEKLY:
+            if (rule->weekday_ordinal || rule->month_day) return REGISLEX_ERROR_VALIDATION;
+            break;
+        case REGISLEX_RRULE_MONTHLY:
+            if (rule->weekdays && (!rule->weekday_ordinal || rule->month_day)) {
+                return REGISLEX_ERROR_VALIDATION;
+            }
+            break;
+    }
+
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_rrule_format(const regislex_rrule_t* rule,
+                                                   char* buffer, size_t size) {
+    static const char* const FREQ_NAMES[] = { "DAILY", "WEEKLY", "MONTHLY", "YEARLY" };
+
+    if (!rule || !buffer || size == 0 || (int)rule->freq < 0 || rule->freq > REGISLEX_RRULE_YEARLY) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    size_t n = (size_t)snprintf(buffer, size, "FREQ=%s", FREQ_NAMES[rule->freq]);
+    if (rule->interval > 1 && n < size) {
+        n += (size_t)snprintf(buffer + n, size - n, ";INTERVAL=%d", rule->interval);
+    }
+    if (rule->count > 0 && n < size) {
+        n += (size_t)snprintf(buffer + n, size - n, ";COUNT=%d", rule->count);
+    }
+    if (rule->until.year != 0 && n < size) {
+        n += (size_t)snprintf(buffer + n, size - n, ";UNTIL=%04d%02d%02dT%02d%02d%02dZ",
+                              rule->until.year, rule->until.month, rule->until.day,
+                              rule->until.hour, rule->until.minute, rule->until.second);
+    }
+    if (rule->weekdays && n < size) {
+        n += (size_t)snprintf(buffer + n, size - n, ";BYDAY=");
+        bool first = true;
+        for (int d = 0; d < 7 && n < size; d++) {
+            if (!(rule->weekdays & (1u << d))) continue;
+            if (rule->weekday_ordinal) {
+                n += (size_t)snprintf(buffer + n, size - n, "%d", rule->weekday_ordinal);
+            }
+            n += (size_t)snprintf(buffer + n, size - n, "%s%s", first ? "" : ",", WEEKDAY_CODES[d]);
+            first = false;
+        }
+    }
+    if (rule->month_day && n < size) {
+        n += (size_t)snprintf(buffer + n, size - n, ";BYMONTHDAY=%d", rule->month_day);
+    }
+
+    return n < size ? REGISLEX_OK : REGISLEX_ERROR_INVALID_ARGUMENT;
+}
+
+/* ============================================================================
+ * Expansion
+ * ============================================================================ */
+
+static int64_t civil_days(int year, int month, int day) {
+    regislex_datetime_t dt;
+    memset(&dt, 0, sizeof(dt));
+    dt.year = year;
+    dt.month = month;
+    dt.day = day;
+    return regislex_datetime_to_days(&dt);
+}
+
+static int weekday_of(int64_t day) {
+    return (int)(((day + 4) % 7 + 7) % 7);
+}
+
+static int64_t floor_div(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+/* Total months since year 0 for a year and 1-based month */
+static int64_t month_index(int year, int month) {
+    return (int64_t)year * 12 + (month - 1);
+}
+
+/* First day of the iterator's current period */
+static int64_t period_start(const regislex_rrule_iter_t* it) {
+    const regislex_rrule_t* r = &it->rule;
+    int64_t start_day = regislex_datetime_to_days(&it->dtstart);
+
+    switch (r->freq) {
+        case REGISLEX_RRULE_DAILY:
+            return start_day + it->period * r->interval;
+        case REGISLEX_RRULE_WEEKLY: {
+            int64_t monday = start_day - (weekday_of(start_day) + 6) % 7;
+            return monday + it->period * 7 * r->interval;
+        }
+        case REGISLEX_RRULE_MONTHLY: {
+            int64_t m = month_index(it->dtstart.year, it->dtstart.month) + it->period * r->interval;
+            return civil_days((int)floor_div(m, 12), (int)(m - floor_div(m, 12) * 12) + 1, 1);
+        }
+        case REGISLEX_RRULE_YEARLY:
+        default:
+            return civil_days(it->dtstart.year + (int)(it->period * r->interval), 1, 1);
+    }
+}
+
+static void add_candidate(regislex_rrule_iter_t* it, int64_t day) {
+    it->candidates[it->candidate_count++] = day;
+}
+
+/* Fills the candidate days of the current period in ascending order */
+static void period_candidates(regislex_rrule_iter_t* it) {
+    const regislex_rrule_t* r = &it->rule;
+    int64_t base = period_start(it);
+
+    it->candidate_count = 0;
+    it->candidate_pos = 0;
+
+    switch (r->freq) {
+        case REGISLEX_RRULE_DAILY:
+            add_candidate(it, base);
+            break;
+
+        case REGISLEX_RRULE_WEEKLY: {
+            uint8_t days = r->weekdays ? r->weekdays
+                : (uint8_t)(1u << weekday_of(regislex_datetime_to_days(&it->dtstart)));
+            for (int k = 0; k < 7; k++) {
+                if (days & (1u << ((k + 1) % 7))) add_candidate(it, base + k);
+            }
+            break;
+        }
+
+        case REGISLEX_RRULE_MONTHLY: {
+            regislex_datetime_t first;
+            memset(&first, 0, sizeof(first));
+            regislex_datetime_from_days(base, &first);
+            int month_length = (int)(civil_days(first.month == 12 ? first.year + 1 : first.year,
+                                                first.month == 12 ? 1 : first.month + 1, 1) - base);
+
+            if (r->weekday_ordinal) {
+                int weekday = 0;
+                while (!(r->weekdays & (1u << weekday))) weekday++;
+
+                int64_t day;
+                if (r->weekday_ordinal > 0) {
+                    day = base + (weekday - weekday_of(base) + 7) % 7 + 7 * (r->weekday_ordinal - 1);
+                } else {
+                    int64_t last = base + month_length - 1;
+                    day = last - (weekday_of(last) - weekday + 7) % 7 - 7 * (-r->weekday_ordinal - 1);
+                }
+                if (day >= base && day < base + month_length) add_candidate(it, day);
+            } else {
+                int day = r->month_day ? r->month_day : it->dtstart.day;
+                if (day < 0) day = month_length + 1 + day;
+                if (day >= 1 && day <= month_length) add_candidate(it, base + day - 1);
+            }
+            break;
+        }
+
+        case REGISLEX_RRULE_YEARLY: {
+            regislex_datetime_t dt = it->dtstart;
+            dt.year = it->dtstart.year + (int)(it->period * r->interval);
+            if (regislex_datetime_is_valid_date(&dt)) add_candidate(it, regislex_datetime_to_days(&dt));
+            break;
+        }
+    }
+}
+
+REGISLEX_API regislex_error_t regislex_rrule_iter_init(
+    regislex_rrule_iter_t* iter,
+    const regislex_rrule_t* rule,
+    const regislex_datetime_t* dtstart,
+    const regislex_datetime_t* window_start)
+{
+    if (!iter || !rule || !dtstart || rule->interval < 1) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!regislex_datetime_is_valid_date(dtstart)) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+
+    memset(iter, 0, sizeof(*iter));
+    iter->rule = *rule;
+    iter->dtstart = *dtstart;
+    if (window_start) {
+        iter->window_start = *window_start;
+    }
+
+    /* Without COUNT, skip whole periods before the window */
+    if (rule->count == 0 && window_start && regislex_datetime_compare(window_start, dtstart) > 0) {
+        int64_t start_day = regislex_datetime_to_days(dtstart);
+        int64_t window_day = regislex_datetime_to_days(window_start);
+        int64_t skip = 0;
+
+        switch (rule->freq) {
+            case REGISLEX_RRULE_DAILY:
+                skip = floor_div(window_day - start_day, rule->interval);
+                break;
+            case REGISLEX_RRULE_WEEKLY: {
+                int64_t monday = start_day - (weekday_of(start_day) + 6) % 7;
+                skip = floor_div(window_day - monday, 7 * (int64_t)rule->interval);
+                break;
+            }
+            case REGISLEX_RRULE_MONTHLY:
+                skip = floor_div(month_index(window_start->year, window_start->month) -
+                                 month_index(dtstart->year, dtstart->month), rule->interval);
+                break;
+            case REGISLEX_RRULE_YEARLY:
+                skip = floor_div(window_start->year - dtstart->year, rule->interval);
+                break;
+        }
+        iter->period = skip > 0 ? skip : 0;
+    }
+
+    period_candidates(iter);
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_rrule_iter_next(
+    regislex_rrule_iter_t* iter,
+    const regislex_datetime_t* window_end,
+    regislex_datetime_t* out_occurrence)
+{
+    if (!iter || !out_occurrence) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    int64_t start_day = regislex_datetime_to_days(&iter->dtstart);
+    int64_t end_day = window_end ? regislex_datetime_to_days(window_end) : INT64_MAX;
+    int64_t until_day = iter->rule.until.year != 0
+        ? regislex_datetime_to_days(&iter->rule.until) : INT64_MAX;
+    int empty_periods = 0;
+
+    while (!iter->done) {
+        if (iter->candidate_pos >= iter->candidate_count) {
+            iter->period++;
+            int64_t next_start = period_start(iter);
+            if (next_start > until_day || empty_periods >= RRULE_MAX_EMPTY_PERIODS) {
+                iter->done = true;
+                break;
+            }
+            if (next_start > end_day) {
+                /* Resume here if the caller asks for a later window */
+                iter->period--;
+                return REGISLEX_ERROR_NOT_FOUND;
+            }
+            period_candidates(iter);
+            if (iter->candidate_count == 0) empty_periods++;
+            else empty_periods = 0;
+            continue;
+        }
+
+        int64_t day = iter->candidates[iter->candidate_pos];
+        if (day > end_day) {
+            return REGISLEX_ERROR_NOT_FOUND;
+        }
+        iter->candidate_pos++;
+
+        /* The first period may begin before the series does */
+        if (day < start_day) continue;
+
+        regislex_datetime_t occurrence = iter->dtstart;
+        regislex_datetime_from_days(day, &occurrence);
+
+        if (iter->rule.until.year != 0 && regislex_datetime_compare(&occurrence, &iter->rule.until) > 0) {
+            iter->done = true;
+            break;
+        }
+        if (iter->rule.count > 0 && iter->emitted >= iter->rule.count) {
+            iter->done = true;
+            break;
+        }
+        iter->emitted++;
+
+        if (regislex_datetime_compare(&occurrence, &iter->window_start) < 0) continue;
+        if (window_end && regislex_datetime_compare(&occurrence, window_end) > 0) {
+            /* Past the window but inside the day: hand it out next time */
+            iter->candidate_pos--;
+            iter->emitted--;
+            return REGISLEX_ERROR_NOT_FOUND;
+        }
+
+        *out_occurrence = occurrence;
+        return REGISLEX_OK;
+    }
+
+    return REGISLEX_ERROR_NOT_FOUND;
+}
@@ -1,64 +1,991 @@
 /**
  * @file reminder.c
- * @brief Deadline Reminder System
+ * @brief Deadline Reminders and Dispatcher
+ *
+ * Reminders live in the reminders table. The dispatcher loads those due
+ * within a short horizon into a min-heap keyed by fire time and sleeps on
+ * a condition variable until the earliest one fires, so nothing polls the
+ * database between horizons. An id map tracks each entry's heap slot,
+ * which makes rescheduling and cancelling a changed reminder O(log n).
+ *
+ * Due reminders are delivered in batches outside any transaction; the
+ * delivered ones are then marked sent together in a single transaction.
  */
 
 #include "regislex/regislex.h"
+#include "database/database.h"
 #include "platform/platform.h"
+#include "utils/id_map.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+#define REMINDER_DEFAULT_HORIZON_MINUTES  60
+#define REMINDER_DEFAULT_BATCH_SIZE       100
+#define REMINDER_DEFAULT_RETRY_SECONDS    60
+#define REMINDER_INITIAL_SLOTS            64
+
+#define REMINDER_COLUMNS \
+    "id, deadline_id, user_id, type, minutes_before, is_sent," \
+    " send_at, sent_at, message, is_active, created_at"
+
+/* ============================================================================
+ * Internal Structures
+ * ============================================================================ */
+
 typedef struct {
     regislex_uuid_t id;
-    regislex_uuid_t deadline_id;
-    regislex_uuid_t user_id;
-    regislex_datetime_t remind_at;
-    char message[512];
-    bool is_sent;
-    char notification_type[32];  /* email, sms, push, in_app */
-} regislex_reminder_t;
-
-regislex_error_t regislex_reminder_create(const char* deadline_id,
-                                           const char* user_id,
-                                           int days_before,
-                                           regislex_reminder_t** reminder) {
-    if (!deadline_id || !user_id || !reminder) return REGISLEX_ERROR_INVALID_ARGUMENT;
-
-    *reminder = (regislex_reminder_t*)platform_calloc(1, sizeof(regislex_reminder_t));
-    if (!*reminder) return REGISLEX_ERROR_OUT_OF_MEMORY;
-
-    regislex_uuid_generate(&(*reminder)->id);
-    regislex_uuid_parse(deadline_id, &(*reminder)->deadline_id);
-    regislex_uuid_parse(user_id, &(*reminder)->user_id);
-    strcpy((*reminder)->notification_type, "email");
-
-    /* Set remind_at based on days_before */
-    regislex_datetime_now(&(*reminder)->remind_at);
-    regislex_datetime_add_days(&(*reminder)->remind_at, days_before);
+    int64_t fire_ms;
+    int heap_index;         /* -1 while the entry is being delivered */
+    bool cancelled;
+} reminder_entry_t;
+
+typedef struct {
+    regislex_context_t* ctx;
+    regislex_reminder_handler_t handler;
+    void* user_data;
+    int64_t horizon_ms;
+    int batch_size;
+    int64_t retry_ms;
+
+    platform_mutex_t* mutex;
+    platform_cond_t* wake;
+    platform_thread_t* thread;
+    bool running;
+
+    int64_t horizon_end;    /* Entries firing before this are in the heap */
+
+    reminder_entry_t** heap;
+    int heap_count;
+    int heap_capacity;
+
+    regislex_id_map_t entries;  /* Every live entry, by reminder id */
+
+    reminder_entry_t** unmarked;    /* Delivered, waiting to be marked sent */
+    int unmarked_count;
+    int unmarked_capacity;
+} reminder_dispatcher_t;
+
+static reminder_dispatcher_t dispatcher;
+
+/* ============================================================================
+ * Heap and Id Map (caller holds dispatcher.mutex)
+ * ============================================================================ */
 
+static void heap_set(int index, reminder_entry_t* e) {
+    dispatcher.heap[index] = e;
+    e->heap_index = index;
+}
+
+static void heap_sift_up(int index) {
+    reminder_entry_t* e = dispatcher.heap[index];
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (dispatcher.heap[parent]->fire_ms <= e->fire_ms) break;
+        heap_set(index, dispatcher.heap[parent]);
+        index = parent;
+    }
+    heap_set(index, e);
+}
+
+static void heap_sift_down(int index) {
+    reminder_entry_t* e = dispatcher.heap[index];
+    for (;;) {
+        int child = index * 2 + 1;
+        if (child >= dispatcher.heap_count) break;
+        if (child + 1 < dispatcher.heap_count &&
+            dispatcher.heap[child + 1]->fire_ms < dispatcher.heap[child]->fire_ms) {
+            child++;
+        }
+        if (e->fire_ms <= dispatcher.heap[child]->fire_ms) break;
+        heap_set(index, dispatcher.heap[child]);
+        index = child;
+    }
+    heap_set(index, e);
+}
+
+static regislex_error_t heap_push(reminder_entry_t* e) {
+    if (dispatcher.heap_count >= dispatcher.heap_capacity) {
+        int new_capacity = dispatcher.heap_capacity ? dispatcher.heap_capacity * 2 : REMINDER_INITIAL_SLOTS;
+        reminder_entry_t** grown = (reminder_entry_t**)platform_realloc(
+            dispatcher.heap, (size_t)new_capacity * sizeof(reminder_entry_t*));
+        if (!grown) return REGISLEX_ERROR_OUT_OF_MEMORY;
+        dispatcher.heap = grown;
+        dispatcher.heap_capacity = new_capacity;
+    }
+
+    heap_set(dispatcher.heap_count++, e);
+    heap_sift_up(e->heap_index);
     return REGISLEX_OK;
 }
 
-void regislex_reminder_free(regislex_reminder_t* reminder) {
-    platform_free(reminder);
+static void heap_remove(reminder_entry_t* e) {
+    int index = e->heap_index;
+    reminder_entry_t* last = dispatcher.heap[--dispatcher.heap_count];
+    e->heap_index = -1;
+    if (last == e) return;
+
+    heap_set(index, last);
+    if (index > 0 && dispatcher.heap[(index - 1) / 2]->fire_ms > last->fire_ms) {
+        heap_sift_up(index);
+    } else {
+        heap_sift_down(index);
+    }
+}
+
+/* Drops an entry that is not in the heap */
+static void entry_release(reminder_entry_t* e) {
+    regislex_id_map_remove(&dispatcher.entries, e->id.value);
+    platform_free(e);
+}
+
+/*
+ * Puts a reminder on the heap, or moves it if it is already there.
+ * Reminders beyond the horizon are left for the next horizon load, and
+ * entries being delivered are left alone; delivery re-reads the row.
+ */
+static void dispatcher_schedule(const regislex_uuid_t* id, int64_t fire_ms) {
+    if (fire_ms >= dispatcher.horizon_end) {
+        reminder_entry_t* e = (reminder_entry_t*)regislex_id_map_get(&dispatcher.entries, id->value);
+        if (e && e->heap_index >= 0) {
+            heap_remove(e);
+            entry_release(e);
+        }
+        return;
+    }
+
+    reminder_entry_t* e = (reminder_entry_t*)regislex_id_map_get(&dispatcher.entries, id->value);
+    if (e) {
+        if (e->heap_index < 0) return;
+
+        int64_t old = e->fire_ms;
+        e->fire_ms = fire_ms;
+        if (fire_ms < old) heap_sift_up(e->heap_index);
+        else heap_sift_down(e->heap_index);
+        return;
+    }
+
+    e = (reminder_entry_t*)platform_calloc(1, sizeof(reminder_entry_t));
+    if (!e) return;
+    memcpy(&e->id, id, sizeof(regislex_uuid_t));
+    e->fire_ms = fire_ms;
+    e->heap_index = -1;
+
+    if (regislex_id_map_insert(&dispatcher.entries, e) != REGISLEX_OK) {
+        platform_free(e);
+        return;
+    }
+    if (heap_push(e) != REGISLEX_OK) {
+        entry_release(e);
+    }
+}
+
+static void dispatcher_cancel(const regislex_uuid_t* id) {
+    reminder_entry_t* e = (reminder_entry_t*)regislex_id_map_get(&dispatcher.entries, id->value);
+    if (!e) return;
+
+    if (e->heap_index >= 0) {
+        heap_remove(e);
+        entry_release(e);
+    } else {
+        e->cancelled = true;
+    }
+}
+
+typedef struct {
+    bool cancelled;
+    regislex_reminder_t reminder;   /* Only the id when cancelled */
+} reminder_change_t;
+
+/* The agenda always follows; the dispatcher only while running */
+static void reminder_change_run(void* data) {
+    const reminder_change_t* change = (const reminder_change_t*)data;
+    const regislex_reminder_t* r = &change->reminder;
+
+    if (change->cancelled) {
+        regislex_agenda_remove(&r->id);
+    } else {
+        regislex_agenda_apply_reminder(r);
+    }
+    if (!dispatcher.mutex) return;
+
+    platform_mutex_lock(dispatcher.mutex);
+    if (dispatcher.running) {
+        if (!change->cancelled && r->is_active && !r->is_sent) {
+            dispatcher_schedule(&r->id, regislex_datetime_to_seconds(&r->send_at) * 1000);
+        } else {
+            dispatcher_cancel(&r->id);
+        }
+        platform_cond_signal(dispatcher.wake);
+    }
+    platform_mutex_unlock(dispatcher.mutex);
+}
+
+/* Public-API hooks: apply a reminder change once it commits */
+static regislex_error_t reminder_changed(regislex_db_context_t* db, const regislex_uuid_t* id,
+                                         const regislex_reminder_t* r) {
+    reminder_change_t* change = (reminder_change_t*)platform_calloc(1, sizeof(reminder_change_t));
+    if (!change) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    change->cancelled = r == NULL;
+    if (r) {
+        change->reminder = *r;
+    } else {
+        change->reminder.id = *id;
+    }
+    return regislex_db_after_commit(db, reminder_change_run, change);
+}
+
+static regislex_error_t reminder_scheduled(regislex_db_context_t* db, const regislex_reminder_t* r) {
+    return reminder_changed(db, &r->id, r);
+}
+
+static regislex_error_t reminder_cancelled(regislex_db_context_t* db, const regislex_uuid_t* id) {
+    return reminder_changed(db, id, NULL);
+}
+
+typedef struct {
+    int count;
+    regislex_uuid_t ids[];
+} reminder_evict_t;
+
+/* Drop reminders deleted with their case from the agenda and the dispatcher */
+static void reminder_evict_run(void* data) {
+    const reminder_evict_t* evict = (const reminder_evict_t*)data;
+
+    for (int i = 0; i < evict->count; i++) {
+        regislex_agenda_remove(&evict->ids[i]);
+    }
+    if (!dispatcher.mutex) return;
+
+    platform_mutex_lock(dispatcher.mutex);
+    if (dispatcher.running) {
+        for (int i = 0; i < evict->count; i++) {
+            dispatcher_cancel(&evict->ids[i]);
+        }
+        platform_cond_signal(dispatcher.wake);
+    }
+    platform_mutex_unlock(dispatcher.mutex);
+}
+
+/* ============================================================================
+ * Row Mapping
+ * ============================================================================ */
+
+static void reminder_from_row(regislex_db_stmt_t* stmt, regislex_reminder_t* r) {
+    int col = 0;
+
+    regislex_db_column_uuid(stmt, col++, &r->id);
+    regislex_db_column_uuid(stmt, col++, &r->deadline_id);
+    regislex_db_column_uuid(stmt, col++, &r->user_id);
+    r->type = (regislex_reminder_type_t)regislex_db_column_int(stmt, col++);
+    r->minutes_before = (int)regislex_db_column_int(stmt, col++);
+    r->is_sent = regislex_db_column_int(stmt, col++) != 0;
+    regislex_db_column_datetime(stmt, col++, &r->send_at);
+    regislex_db_column_datetime(stmt, col++, &r->sent_at);
+
+    const char* message = regislex_db_column_text(stmt, col++);
+    if (message) strncpy(r->message, message, sizeof(r->message) - 1);
+
+    r->is_active = regislex_db_column_int(stmt, col++) != 0;
+    regislex_db_column_datetime(stmt, col++, &r->created_at);
+}
+
+static regislex_error_t reminder_collect(regislex_db_stmt_t* stmt,
+                                         regislex_reminder_t*** reminders, int* count) {
+    regislex_reminder_t** items = NULL;
+    int n = 0;
+    int capacity = 0;
+    regislex_error_t err;
+
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        if (n >= capacity) {
+            int new_capacity = capacity ? capacity * 2 : 16;
+            regislex_reminder_t** grown = (regislex_reminder_t**)platform_realloc(
+                items, (size_t)new_capacity * sizeof(regislex_reminder_t*));
+            if (!grown) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            items = grown;
+            capacity = new_capacity;
+        }
+
+        regislex_reminder_t* r = (regislex_reminder_t*)platform_calloc(1, sizeof(regislex_reminder_t));
+        if (!r) {
+            err = REGISLEX_ERROR_OUT_OF_MEMORY;
+            break;
+        }
+        reminder_from_row(stmt, r);
+        items[n++] = r;
+    }
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        regislex_reminder_list_free(items, n);
+        return err;
+    }
+
+    *reminders = items;
+    *count = n;
+    return REGISLEX_OK;
+}
+
+/* Stored times are UTC so send_at orders correctly as text */
+static void datetime_to_utc(regislex_datetime_t* dt) {
+    if (dt->timezone_offset != 0) {
+        regislex_datetime_from_seconds(regislex_datetime_to_seconds(dt), dt);
+    }
+}
+
+/* ============================================================================
+ * Dispatcher Thread
+ * ============================================================================ */
+
+/*
+ * Loads every unsent reminder due before the new horizon end. The end is
+ * published before the query so reminders written meanwhile are pushed
+ * by their writers; the id map drops the duplicates.
+ */
+static void dispatcher_load_horizon(int64_t now) {
+    platform_mutex_lock(dispatcher.mutex);
+    int64_t end = now + dispatcher.horizon_ms;
+    dispatcher.horizon_end = end;
+    platform_mutex_unlock(dispatcher.mutex);
+
+    regislex_datetime_t limit;
+    regislex_datetime_from_seconds(end / 1000, &limit);
+
+    regislex_db_stmt_t* stmt = NULL;
+    if (regislex_db_prepare(regislex_get_db(dispatcher.ctx),
+            "SELECT id, send_at FROM reminders"
+            " WHERE is_sent = 0 AND is_active = 1 AND send_at < ?"
+            " ORDER BY send_at", &stmt) != REGISLEX_OK) {
+        return;
+    }
+    regislex_db_bind_datetime(stmt, 1, &limit);
+
+    while (regislex_db_step(stmt) == REGISLEX_OK) {
+        regislex_uuid_t id;
+        regislex_datetime_t send_at;
+        regislex_db_column_uuid(stmt, 0, &id);
+        regislex_db_column_datetime(stmt, 1, &send_at);
+
+        platform_mutex_lock(dispatcher.mutex);
+        if (regislex_id_map_find(&dispatcher.entries, id.value) < 0) {
+            dispatcher_schedule(&id, regislex_datetime_to_seconds(&send_at) * 1000);
+        }
+        platform_mutex_unlock(dispatcher.mutex);
+    }
+
+    regislex_db_finalize(stmt);
+}
+
+/* Marks the unmarked entries sent in one transaction; caller holds no lock */
+static void dispatcher_mark_sent(reminder_entry_t** entries, int count, bool* marked) {
+    regislex_db_context_t* db = regislex_get_db(dispatcher.ctx);
+
+    regislex_db_transaction_t* tx = NULL;
+    if (regislex_db_begin(db, &tx) != REGISLEX_OK) return;
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "UPDATE reminders SET is_sent = 1, sent_at = ? WHERE id = ?", &stmt);
+
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    for (int i = 0; i < count && err == REGISLEX_OK; i++) {
+        regislex_db_reset(stmt);
+        regislex_db_bind_datetime(stmt, 1, &now);
+        regislex_db_bind_uuid(stmt, 2, &entries[i]->id);
+        err = regislex_db_step(stmt);
+        if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
+    }
+    regislex_db_finalize(stmt);
+
+    if (err == REGISLEX_OK && regislex_db_commit(tx) == REGISLEX_OK) {
+        for (int i = 0; i < count; i++) {
+            marked[i] = true;
+            regislex_agenda_remove(&entries[i]->id);
+        }
+    } else {
+        regislex_db_rollback(tx);
+    }
+}
+
+/* Caller holds dispatcher.mutex */
+static void unmarked_push(reminder_entry_t* e) {
+    if (dispatcher.unmarked_count >= dispatcher.unmarked_capacity) {
+        int new_capacity = dispatcher.unmarked_capacity ? dispatcher.unmarked_capacity * 2 : 16;
+        reminder_entry_t** grown = (reminder_entry_t**)platform_realloc(
+            dispatcher.unmarked, (size_t)new_capacity * sizeof(reminder_entry_t*));
+        if (!grown) {
+            entry_release(e);
+            return;
+        }
+        dispatcher.unmarked = grown;
+        dispatcher.unmarked_capacity = new_capacity;
+    }
+    dispatcher.unmarked[dispatcher.unmarked_count++] = e;
+}
+
+typedef enum {
+    DELIVERY_DROP = 0,
+    DELIVERY_REQUEUE,
+    DELIVERY_SENT
+} delivery_outcome_t;
+
+/*
+ * Delivers one batch. The entries have left the heap but stay in the id
+ * map, so a horizon load cannot queue them twice while in flight.
+ */
+static void dispatcher_deliver(reminder_entry_t** batch, int count,
+                               uint8_t* outcome, reminder_entry_t** sent, bool* marked) {
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_db_prepare(regislex_get_db(dispatcher.ctx),
+        "SELECT " REMINDER_COLUMNS " FROM reminders WHERE id = ?", &stmt);
+
+    int sent_count = 0;
+    for (int i = 0; i < count; i++) {
+        regislex_reminder_t r;
+        memset(&r, 0, sizeof(r));
+        outcome[i] = DELIVERY_DROP;
+
+        bool found = false;
+        if (stmt) {
+            regislex_db_reset(stmt);
+            regislex_db_bind_uuid(stmt, 1, &batch[i]->id);
+            if (regislex_db_step(stmt) == REGISLEX_OK) {
+                reminder_from_row(stmt, &r);
+                found = true;
+            }
+        } else {
+            /* Could not read the rows; try again later */
+            batch[i]->fire_ms = platform_time_ms() + dispatcher.retry_ms;
+            outcome[i] = DELIVERY_REQUEUE;
+            continue;
+        }
+
+        /* Deleted, deactivated or already sent since it was queued */
+        if (!found || r.is_sent || !r.is_active) continue;
+
+        int64_t fire_ms = regislex_datetime_to_seconds(&r.send_at) * 1000;
+        if (fire_ms > platform_time_ms()) {
+            batch[i]->fire_ms = fire_ms;
+            outcome[i] = DELIVERY_REQUEUE;
+        } else if (dispatcher.handler(dispatcher.ctx, &r, dispatcher.user_data) == REGISLEX_OK) {
+            outcome[i] = DELIVERY_SENT;
+            sent[sent_count] = batch[i];
+            marked[sent_count++] = false;
+        } else {
+            batch[i]->fire_ms = platform_time_ms() + dispatcher.retry_ms;
+            outcome[i] = DELIVERY_REQUEUE;
+        }
+    }
+    regislex_db_finalize(stmt);
+
+    if (sent_count > 0) {
+        dispatcher_mark_sent(sent, sent_count, marked);
+    }
+
+    platform_mutex_lock(dispatcher.mutex);
+    for (int i = 0; i < sent_count; i++) {
+        /* Sent but not yet recorded: only the marking is retried */
+        if (marked[i]) entry_release(sent[i]);
+        else unmarked_push(sent[i]);
+    }
+    for (int i = 0; i < count; i++) {
+        reminder_entry_t* e = batch[i];
+        if (outcome[i] == DELIVERY_DROP) {
+            entry_release(e);
+        } else if (outcome[i] == DELIVERY_REQUEUE) {
+            if (e->cancelled || e->fire_ms >= dispatcher.horizon_end || heap_push(e) != REGISLEX_OK) {
+                entry_release(e);
+            }
+        }
+    }
+    platform_mutex_unlock(dispatcher.mutex);
+}
+
+static void dispatcher_retry_unmarked(bool* marked) {
+    platform_mutex_lock(dispatcher.mutex);
+    int count = dispatcher.unmarked_count;
+    reminder_entry_t** entries = dispatcher.unmarked;
+    dispatcher.unmarked = NULL;
+    dispatcher.unmarked_count = 0;
+    dispatcher.unmarked_capacity = 0;
+    platform_mutex_unlock(dispatcher.mutex);
+
+    /* Retry in chunks of at most one batch */
+    for (int done = 0; done < count; ) {
+        int n = count - done < dispatcher.batch_size ? count - done : dispatcher.batch_size;
+        memset(marked, 0, (size_t)n * sizeof(bool));
+        dispatcher_mark_sent(entries + done, n, marked);
+
+        platform_mutex_lock(dispatcher.mutex);
+        for (int i = 0; i < n; i++) {
+            if (marked[i]) entry_release(entries[done + i]);
+            else unmarked_push(entries[done + i]);
+        }
+        platform_mutex_unlock(dispatcher.mutex);
+        done += n;
+    }
+
+    platform_free(entries);
+}
+
+static void* dispatcher_main(void* arg) {
+    (void)arg;
+
+    /* Per-batch scratch space, allocated once */
+    size_t n = (size_t)dispatcher.batch_size;
+    reminder_entry_t** batch = (reminder_entry_t**)platform_calloc(n, sizeof(reminder_entry_t*));
+    reminder_entry_t** sent = (reminder_entry_t**)platform_calloc(n, sizeof(reminder_entry_t*));
+    uint8_t* outcome = (uint8_t*)platform_calloc(n, sizeof(uint8_t));
+    bool* marked = (bool*)platform_calloc(n, sizeof(bool));
+    if (!batch || !sent || !outcome || !marked) {
+        platform_free(batch);
+        platform_free(sent);
+        platform_free(outcome);
+        platform_free(marked);
+        return NULL;
+    }
+
+    platform_mutex_lock(dispatcher.mutex);
+    while (dispatcher.running) {
+        int64_t now = platform_time_ms();
+
+        if (now >= dispatcher.horizon_end) {
+            platform_mutex_unlock(dispatcher.mutex);
+            dispatcher_load_horizon(now);
+            platform_mutex_lock(dispatcher.mutex);
+            continue;
+        }
+
+        if (dispatcher.unmarked_count > 0) {
+            platform_mutex_unlock(dispatcher.mutex);
+            dispatcher_retry_unmarked(marked);
+            platform_mutex_lock(dispatcher.mutex);
+        }
+
+        int count = 0;
+        while (count < dispatcher.batch_size && dispatcher.heap_count > 0 &&
+               dispatcher.heap[0]->fire_ms <= now) {
+            reminder_entry_t* e = dispatcher.heap[0];
+            heap_remove(e);
+            batch[count++] = e;
+        }
+
+        if (count > 0) {
+            platform_mutex_unlock(dispatcher.mutex);
+            dispatcher_deliver(batch, count, outcome, sent, marked);
+            platform_mutex_lock(dispatcher.mutex);
+            continue;
+        }
+
+        int64_t next = dispatcher.horizon_end;
+        if (dispatcher.heap_count > 0 && dispatcher.heap[0]->fire_ms < next) {
+            next = dispatcher.heap[0]->fire_ms;
+        }
+        int64_t wait = next - now;
+        if (dispatcher.unmarked_count > 0 && wait > dispatcher.retry_ms) {
+            wait = dispatcher.retry_ms;
+        }
+        platform_cond_timedwait(dispatcher.wake, dispatcher.mutex,
+                                wait > 0x7fffffff ? 0x7fffffff : (int)wait);
+    }
+    platform_mutex_unlock(dispatcher.mutex);
+
+    platform_free(batch);
+    platform_free(sent);
+    platform_free(outcome);
+    platform_free(marked);
+    return NULL;
+}
+
+static void dispatcher_clear(void) {
+    for (int i = 0; i < dispatcher.entries.capacity; i++) {
+        platform_free(dispatcher.entries.slots[i]);
+    }
+    regislex_id_map_free(&dispatcher.entries);
+    platform_free(dispatcher.heap);
+    platform_free(dispatcher.unmarked);
 }
 
-regislex_error_t regislex_reminder_set_message(regislex_reminder_t* reminder, const char* message) {
-    if (!reminder || !message) return REGISLEX_ERROR_INVALID_ARGUMENT;
-    strncpy(reminder->message, message, sizeof(reminder->message) - 1);
+REGISLEX_API regislex_error_t regislex_reminder_dispatcher_start(
+    regislex_context_t* ctx,
+    regislex_reminder_handler_t handler,
+    void* user_data,
+    const regislex_reminder_dispatcher_options_t* options)
+{
+    if (!ctx || !handler) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (dispatcher.mutex) {
+        return REGISLEX_ERROR_ALREADY_EXISTS;
+    }
+
+    memset(&dispatcher, 0, sizeof(dispatcher));
+    regislex_id_map_init(&dispatcher.entries, offsetof(reminder_entry_t, id.value));
+    dispatcher.ctx = ctx;
+    dispatcher.handler = handler;
+    dispatcher.user_data = user_data;
+
+    int horizon_minutes = options && options->horizon_minutes > 0
+        ? options->horizon_minutes : REMINDER_DEFAULT_HORIZON_MINUTES;
+    int retry_seconds = options && options->retry_seconds > 0
+        ? options->retry_seconds : REMINDER_DEFAULT_RETRY_SECONDS;
+    dispatcher.horizon_ms = (int64_t)horizon_minutes * 60000;
+    dispatcher.retry_ms = (int64_t)retry_seconds * 1000;
+    dispatcher.batch_size = options && options->batch_size > 0
+        ? options->batch_size : REMINDER_DEFAULT_BATCH_SIZE;
+
+    if (platform_mutex_create(&dispatcher.mutex) != PLATFORM_OK) {
+        dispatcher.mutex = NULL;
+        return REGISLEX_ERROR;
+    }
+    if (platform_cond_create(&dispatcher.wake) != PLATFORM_OK) {
+        platform_mutex_destroy(dispatcher.mutex);
+        dispatcher.mutex = NULL;
+        return REGISLEX_ERROR;
+    }
+
+    dispatcher.running = true;
+    if (platform_thread_create(&dispatcher.thread, dispatcher_main, NULL) != PLATFORM_OK) {
+        platform_cond_destroy(dispatcher.wake);
+        platform_mutex_destroy(dispatcher.mutex);
+        memset(&dispatcher, 0, sizeof(dispatcher));
+        return REGISLEX_ERROR;
+    }
+
     return REGISLEX_OK;
 }
 
-regislex_error_t regislex_reminder_mark_sent(regislex_reminder_t* reminder) {
-    if (!reminder) return REGISLEX_ERROR_INVALID_ARGUMENT;
-    reminder->is_sent = true;
+REGISLEX_API void regislex_reminder_dispatcher_stop(void) {
+    if (!dispatcher.mutex) return;
+
+    platform_mutex_lock(dispatcher.mutex);
+    dispatcher.running = false;
+    platform_cond_signal(dispatcher.wake);
+    platform_mutex_unlock(dispatcher.mutex);
+
+    platform_thread_join(dispatcher.thread, NULL);
+
+    dispatcher_clear();
+    platform_cond_destroy(dispatcher.wake);
+    platform_mutex_destroy(dispatcher.mutex);
+    memset(&dispatcher, 0, sizeof(dispatcher));
+}
+
+/* ============================================================================
+ * Reminder Functions
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_reminder_add(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* deadline_id,
+    const regislex_reminder_t* reminder,
+    regislex_reminder_t** out_reminder)
+{
+    if (!ctx || !deadline_id || !reminder || !out_reminder) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_reminder_t* new_reminder = (regislex_reminder_t*)platform_calloc(1, sizeof(regislex_reminder_t));
+    if (!new_reminder) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    memcpy(new_reminder, reminder, sizeof(regislex_reminder_t));
+    regislex_uuid_generate(&new_reminder->id);
+    memcpy(&new_reminder->deadline_id, deadline_id, sizeof(regislex_uuid_t));
+    datetime_to_utc(&new_reminder->send_at);
+
+    regislex_datetime_now(&new_reminder->created_at);
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    const char* sql =
+        "INSERT INTO reminders ("
+        "  id, deadline_id, user_id, type, minutes_before, is_sent,"
+        "  send_at, sent_at, message, is_active, created_at"
+        ") VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)";
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) {
+        regislex_reminder_free(new_reminder);
+        return err;
+    }
+
+    int idx = 1;
+    regislex_db_bind_uuid(stmt, idx++, &new_reminder->id);
+    regislex_db_bind_uuid(stmt, idx++, &new_reminder->deadline_id);
+    regislex_db_bind_uuid(stmt, idx++, &new_reminder->user_id);
+    regislex_db_bind_int(stmt, idx++, new_reminder->type);
+    regislex_db_bind_int(stmt, idx++, new_reminder->minutes_before);
+    regislex_db_bind_int(stmt, idx++, new_reminder->is_sent ? 1 : 0);
+    regislex_db_bind_datetime(stmt, idx++, &new_reminder->send_at);
+    regislex_db_bind_datetime(stmt, idx++, new_reminder->is_sent ? &new_reminder->sent_at : NULL);
+    regislex_db_bind_text(stmt, idx++, new_reminder->message);
+    regislex_db_bind_int(stmt, idx++, new_reminder->is_active ? 1 : 0);
+    regislex_db_bind_datetime(stmt, idx++, &new_reminder->created_at);
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        regislex_reminder_free(new_reminder);
+        return err;
+    }
+
+    err = reminder_scheduled(db, new_reminder);
+    if (err != REGISLEX_OK) {
+        regislex_reminder_free(new_reminder);
+        return err;
+    }
+
+    *out_reminder = new_reminder;
     return REGISLEX_OK;
 }
 
-bool regislex_reminder_is_due(const regislex_reminder_t* reminder) {
-    if (!reminder || reminder->is_sent) return false;
+REGISLEX_API regislex_error_t regislex_reminder_update(
+    regislex_context_t* ctx,
+    const regislex_reminder_t* reminder)
+{
+    if (!ctx || !reminder) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_reminder_t updated = *reminder;
+    datetime_to_utc(&updated.send_at);
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "UPDATE reminders SET type = ?, minutes_before = ?, send_at = ?,"
+        " message = ?, is_active = ? WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    int idx = 1;
+    regislex_db_bind_int(stmt, idx++, updated.type);
+    regislex_db_bind_int(stmt, idx++, updated.minutes_before);
+    regislex_db_bind_datetime(stmt, idx++, &updated.send_at);
+    regislex_db_bind_text(stmt, idx++, updated.message);
+    regislex_db_bind_int(stmt, idx++, updated.is_active ? 1 : 0);
+    regislex_db_bind_uuid(stmt, idx++, &updated.id);
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+    if (regislex_db_changes(db) == 0) {
+        return REGISLEX_ERROR_NOT_FOUND;
+    }
+
+    /* is_sent is not writable here; reschedule against the stored flag */
+    stmt = NULL;
+    err = regislex_db_prepare(db, "SELECT is_sent FROM reminders WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+    regislex_db_bind_uuid(stmt, 1, &updated.id);
+    if (regislex_db_step(stmt) == REGISLEX_OK) {
+        updated.is_sent = regislex_db_column_int(stmt, 0) != 0;
+    }
+    regislex_db_finalize(stmt);
+
+    return reminder_scheduled(db, &updated);
+}
+
+REGISLEX_API regislex_error_t regislex_reminder_remove(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* id)
+{
+    if (!ctx || !id) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, "DELETE FROM reminders WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+    regislex_db_bind_uuid(stmt, 1, id);
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+    if (regislex_db_changes(db) == 0) {
+        return REGISLEX_ERROR_NOT_FOUND;
+    }
+
+    return reminder_cancelled(db, id);
+}
+
+REGISLEX_API regislex_error_t regislex_reminder_evict_case(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* case_id)
+{
+    if (!ctx || !case_id) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "SELECT r.id FROM reminders r JOIN deadlines d ON d.id = r.deadline_id"
+        " WHERE d.case_id = ?", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+    regislex_db_bind_uuid(stmt, 1, case_id);
+
+    reminder_evict_t* evict = NULL;
+    int count = 0;
+    int capacity = 0;
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        if (count == capacity) {
+            int new_capacity = capacity ? capacity * 2 : 16;
+            reminder_evict_t* grown = (reminder_evict_t*)platform_realloc(
+                evict, sizeof(reminder_evict_t) + (size_t)new_capacity * sizeof(regislex_uuid_t));
+            if (!grown) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            evict = grown;
+            capacity = new_capacity;
+        }
+        regislex_db_column_uuid(stmt, 0, &evict->ids[count++]);
+    }
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        platform_free(evict);
+        return err;
+    }
+    if (!evict) {
+        return REGISLEX_OK;
+    }
+
+    evict->count = count;
+    return regislex_db_after_commit(db, reminder_evict_run, evict);
+}
+
+REGISLEX_API regislex_error_t regislex_reminder_list(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* deadline_id,
+    regislex_reminder_t*** reminders,
+    int* count)
+{
+    if (!ctx || !deadline_id || !reminders || !count) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    *reminders = NULL;
+    *count = 0;
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(ctx),
+        "SELECT " REMINDER_COLUMNS " FROM reminders WHERE deadline_id = ? ORDER BY send_at",
+        &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+    regislex_db_bind_uuid(stmt, 1, deadline_id);
+
+    err = reminder_collect(stmt, reminders, count);
+    regislex_db_finalize(stmt);
+    return err;
+}
+
+REGISLEX_API regislex_error_t regislex_reminder_pending(
+    regislex_context_t* ctx,
+    regislex_reminder_t*** reminders,
+    int* count)
+{
+    if (!ctx || !reminders || !count) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    *reminders = NULL;
+    *count = 0;
+
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(ctx),
+        "SELECT " REMINDER_COLUMNS " FROM reminders"
+        " WHERE is_sent = 0 AND is_active = 1 AND send_at <= ? ORDER BY send_at",
+        &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+    regislex_db_bind_datetime(stmt, 1, &now);
+
+    err = reminder_collect(stmt, reminders, count);
+    regislex_db_finalize(stmt);
+    return err;
+}
+
+REGISLEX_API regislex_error_t regislex_reminder_mark_sent(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* id)
+{
+    if (!ctx || !id) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
     regislex_datetime_t now;
     regislex_datetime_now(&now);
 
-    return regislex_datetime_compare(&now, &reminder->remind_at) >= 0;
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "UPDATE reminders SET is_sent = 1, sent_at = ? WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+    regislex_db_bind_datetime(stmt, 1, &now);
+    regislex_db_bind_uuid(stmt, 2, id);
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+    if (regislex_db_changes(db) == 0) {
+        return REGISLEX_ERROR_NOT_FOUND;
+    }
+
+    return reminder_cancelled(db, id);
+}
+
+REGISLEX_API void regislex_reminder_free(regislex_reminder_t* reminder) {
+    if (reminder) {
+        platform_free(reminder);
+    }
+}
+
+REGISLEX_API void regislex_reminder_list_free(regislex_reminder_t** reminders, int count) {
+    if (!reminders) return;
+    for (int i = 0; i < count; i++) {
+        regislex_reminder_free(reminders[i]);
+    }
+    platform_free(reminders);
 }
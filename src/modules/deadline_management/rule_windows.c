@@ -0,0 +1,448 @@
+/**
+ * @file rule_windows.c
+ * @brief Rule Deadline Window Index
+ *
+ * A deadline computed by the rules engine only depends on the court days
+ * between its anchor (the trigger date or the date of the rule it hangs
+ * off) and its due date. Each open rule deadline is indexed by that window
+ * in a per-jurisdiction AVL tree ordered by first day and augmented with
+ * the largest last day in every subtree, so the deadlines a holiday can
+ * move are found in O(log n + k) per holiday date instead of a rescan.
+ *
+ * The index holds no dates of its own: court_rules.c fills it at startup
+ * from the recorded trigger events and keeps it current whenever it
+ * writes rule deadlines; deadline.c drops the ones deleted or completed,
+ * including those that cascade with a deleted case.
+ */
+
+#include "regislex/regislex.h"
+#include "platform/platform.h"
+#include "utils/id_map.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * Internal Structures
+ * ============================================================================ */
+
+typedef struct window_tree window_tree_t;
+
+typedef struct window_node {
+    regislex_uuid_t deadline_id;
+    regislex_court_trigger_ref_t trigger;
+    int64_t first;              /* Epoch day, inclusive */
+    int64_t last;               /* Epoch day, inclusive */
+    int64_t max_last;           /* Largest last day in this subtree */
+    int height;
+    struct window_node* left;
+    struct window_node* right;
+    window_tree_t* tree;
+} window_node_t;
+
+struct window_tree {
+    char jurisdiction[128];
+    window_node_t* root;
+    int count;
+};
+
+static struct {
+    platform_mutex_t* mutex;
+
+    regislex_id_map_t trees;    /* Keyed by jurisdiction */
+    regislex_id_map_t nodes;    /* Keyed by deadline id */
+
+    int64_t first_day;          /* Span of every window indexed so far */
+    int64_t last_day;
+} windows;
+
+/* ============================================================================
+ * Jurisdiction Trees
+ * ============================================================================ */
+
+static window_tree_t* tree_get(const char* jurisdiction) {
+    window_tree_t* t = (window_tree_t*)regislex_id_map_get(&windows.trees, jurisdiction);
+    if (t) return t;
+
+    t = (window_tree_t*)platform_calloc(1, sizeof(window_tree_t));
+    if (!t) return NULL;
+
+    strncpy(t->jurisdiction, jurisdiction, sizeof(t->jurisdiction) - 1);
+    if (regislex_id_map_insert(&windows.trees, t) != REGISLEX_OK) {
+        platform_free(t);
+        return NULL;
+    }
+    return t;
+}
+
+/* ============================================================================
+ * Augmented AVL Tree
+ * ============================================================================ */
+
+static int node_height(const window_node_t* n) {
+    return n ? n->height : 0;
+}
+
+static void node_update(window_node_t* n) {
+    int hl = node_height(n->left);
+    int hr = node_height(n->right);
+    n->height = (hl > hr ? hl : hr) + 1;
+
+    n->max_last = n->last;
+    if (n->left && n->left->max_last > n->max_last) n->max_last = n->left->max_last;
+    if (n->right && n->right->max_last > n->max_last) n->max_last = n->right->max_last;
+}
+
+static window_node_t* rotate_right(window_node_t* n) {
+    window_node_t* l = n->left;
+    n->left = l->right;
+    l->right = n;
+    node_update(n);
+    node_update(l);
+    return l;
+}
+
+static window_node_t* rotate_left(window_node_t* n) {
+    window_node_t* r = n->right;
+    n->right = r->left;
+    r->left = n;
+    node_update(n);
+    node_update(r);
+    return r;
+}
+
+static window_node_t* node_balance(window_node_t* n) {
+    node_update(n);
+
+    int balance = node_height(n->left) - node_height(n->right);
+    if (balance > 1) {
+        if (node_height(n->left->left) < node_height(n->left->right)) {
+            n->left = rotate_left(n->left);
+        }
+        return rotate_right(n);
+    }
+    if (balance < -1) {
+        if (node_height(n->right->right) < node_height(n->right->left)) {
+            n->right = rotate_right(n->right);
+        }
+        return rotate_left(n);
+    }
+    return n;
+}
+
+/* Order by first day, then by id so equal starts stay distinct */
+static int node_compare(const window_node_t* a, const window_node_t* b) {
+    if (a->first != b->first) return a->first < b->first ? -1 : 1;
+    return strcmp(a->deadline_id.value, b->deadline_id.value);
+}
+
+static window_node_t* avl_insert(window_node_t* root, window_node_t* n) {
+    if (!root) {
+        n->left = NULL;
+        n->right = NULL;
+        node_update(n);
+        return n;
+    }
+
+    if (node_compare(n, root) < 0) {
+        root->left = avl_insert(root->left, n);
+    } else {
+        root->right = avl_insert(root->right, n);
+    }
+    return node_balance(root);
+}
+
+static window_node_t* avl_detach_min(window_node_t* root, window_node_t** out_min) {
+    if (!root->left) {
+        *out_min = root;
+        return root->right;
+    }
+    root->left = avl_detach_min(root->left, out_min);
+    return node_balance(root);
+}
+
+static window_node_t* avl_remove(window_node_t* root, window_node_t* n) {
+    if (!root) return NULL;
+
+    int cmp = node_compare(n, root);
+    if (cmp < 0) {
+        root->left = avl_remove(root->left, n);
+    } else if (cmp > 0) {
+        root->right = avl_remove(root->right, n);
+    } else {
+        if (!root->left) return root->right;
+        if (!root->right) return root->left;
+
+        window_node_t* successor = NULL;
+        window_node_t* right = avl_detach_min(root->right, &successor);
+        successor->left = root->left;
+        successor->right = right;
+        return node_balance(successor);
+    }
+    return node_balance(root);
+}
+
+/* ============================================================================
+ * Stabbing Queries
+ * ============================================================================ */
+
+typedef struct {
+    regislex_court_trigger_ref_t* items;
+    int count;
+    int capacity;
+    bool failed;
+} trigger_list_t;
+
+static void trigger_list_push(trigger_list_t* list, const regislex_court_trigger_ref_t* ref) {
+    if (list->failed) return;
+
+    if (list->count >= list->capacity) {
+        int capacity = list->capacity ? list->capacity * 2 : 8;
+        regislex_court_trigger_ref_t* items = (regislex_court_trigger_ref_t*)platform_realloc(
+            list->items, (size_t)capacity * sizeof(regislex_court_trigger_ref_t));
+        if (!items) {
+            list->failed = true;
+            return;
+        }
+        list->items = items;
+        list->capacity = capacity;
+    }
+    list->items[list->count++] = *ref;
+}
+
+/* Collect the triggers of every window containing day */
+static void tree_stab(const window_node_t* n, int64_t day, trigger_list_t* out) {
+    if (!n || n->max_last < day) return;
+
+    tree_stab(n->left, day, out);
+
+    if (n->first <= day) {
+        if (n->last >= day) trigger_list_push(out, &n->trigger);
+        tree_stab(n->right, day, out);
+    }
+}
+
+static int compare_triggers(const void* a, const void* b) {
+    const regislex_court_trigger_ref_t* ta = (const regislex_court_trigger_ref_t*)a;
+    const regislex_court_trigger_ref_t* tb = (const regislex_court_trigger_ref_t*)b;
+
+    int cmp = strcmp(ta->rule_set_id.value, tb->rule_set_id.value);
+    if (cmp != 0) return cmp;
+    cmp = strcmp(ta->case_id.value, tb->case_id.value);
+    return cmp != 0 ? cmp : strcmp(ta->event, tb->event);
+}
+
+/* ============================================================================
+ * Lifecycle
+ * ============================================================================ */
+
+static void index_clear(void) {
+    for (int i = 0; i < windows.nodes.capacity; i++) {
+        platform_free(windows.nodes.slots[i]);
+    }
+    for (int i = 0; i < windows.trees.capacity; i++) {
+        platform_free(windows.trees.slots[i]);
+    }
+    regislex_id_map_free(&windows.nodes);
+    regislex_id_map_free(&windows.trees);
+
+    regislex_id_map_init(&windows.nodes, offsetof(window_node_t, deadline_id.value));
+    regislex_id_map_init(&windows.trees, offsetof(window_tree_t, jurisdiction));
+    windows.first_day = INT64_MAX;
+    windows.last_day = INT64_MIN;
+}
+
+REGISLEX_API regislex_error_t regislex_rule_windows_init(void) {
+    if (windows.mutex == NULL) {
+        if (platform_mutex_create(&windows.mutex) != PLATFORM_OK) {
+            windows.mutex = NULL;
+            return REGISLEX_ERROR;
+        }
+    }
+
+    platform_mutex_lock(windows.mutex);
+    index_clear();
+    platform_mutex_unlock(windows.mutex);
+    return REGISLEX_OK;
+}
+
+REGISLEX_API void regislex_rule_windows_shutdown(void) {
+    if (!windows.mutex) return;
+
+    platform_mutex_lock(windows.mutex);
+    index_clear();
+    platform_mutex_unlock(windows.mutex);
+
+    platform_mutex_destroy(windows.mutex);
+    windows.mutex = NULL;
+}
+
+/* ============================================================================
+ * Index Maintenance
+ * ============================================================================ */
+
+/* Caller holds the mutex */
+static void index_remove(const char* id) {
+    window_node_t* n = (window_node_t*)regislex_id_map_remove(&windows.nodes, id);
+    if (!n) return;
+
+    n->tree->root = avl_remove(n->tree->root, n);
+    n->tree->count--;
+    platform_free(n);
+}
+
+REGISLEX_API regislex_error_t regislex_rule_window_set(
+    const regislex_uuid_t* deadline_id,
+    const char* jurisdiction,
+    const regislex_court_trigger_ref_t* trigger,
+    const regislex_datetime_t* first,
+    const regislex_datetime_t* last)
+{
+    if (!deadline_id || !trigger || !first || !last) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!windows.mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    window_node_t* n = (window_node_t*)platform_calloc(1, sizeof(window_node_t));
+    if (!n) return REGISLEX_ERROR_OUT_OF_MEMORY;
+
+    n->deadline_id = *deadline_id;
+    n->trigger = *trigger;
+    n->first = regislex_datetime_to_days(first);
+    n->last = regislex_datetime_to_days(last);
+    if (n->first > n->last) {
+        int64_t swap = n->first;
+        n->first = n->last;
+        n->last = swap;
+    }
+
+    platform_mutex_lock(windows.mutex);
+    index_remove(deadline_id->value);
+
+    regislex_error_t err = REGISLEX_ERROR_OUT_OF_MEMORY;
+    window_tree_t* t = tree_get(jurisdiction ? jurisdiction : "");
+    if (t) {
+        n->tree = t;
+        err = regislex_id_map_insert(&windows.nodes, n);
+    }
+    if (err == REGISLEX_OK) {
+        t->root = avl_insert(t->root, n);
+        t->count++;
+        if (n->first < windows.first_day) windows.first_day = n->first;
+        if (n->last > windows.last_day) windows.last_day = n->last;
+    }
+    platform_mutex_unlock(windows.mutex);
+
+    if (err != REGISLEX_OK) platform_free(n);
+    return err;
+}
+
+REGISLEX_API void regislex_rule_window_remove(const regislex_uuid_t* deadline_id) {
+    if (!deadline_id || !windows.mutex) return;
+
+    platform_mutex_lock(windows.mutex);
+    index_remove(deadline_id->value);
+    platform_mutex_unlock(windows.mutex);
+}
+
+REGISLEX_API void regislex_rule_window_move(
+    const regislex_uuid_t* deadline_id,
+    const regislex_datetime_t* due_date,
+    bool open)
+{
+    if (!deadline_id || !due_date || !windows.mutex) return;
+
+    platform_mutex_lock(windows.mutex);
+    window_node_t* n = (window_node_t*)regislex_id_map_get(&windows.nodes, deadline_id->value);
+    if (n && !open) {
+        index_remove(deadline_id->value);
+    } else if (n) {
+        /* Re-seat the node: its first day is the tree's key */
+        n->tree->root = avl_remove(n->tree->root, n);
+
+        int64_t due = regislex_datetime_to_days(due_date);
+        if (due < n->first) n->first = due;
+        if (due > n->last) n->last = due;
+        n->tree->root = avl_insert(n->tree->root, n);
+
+        if (n->first < windows.first_day) windows.first_day = n->first;
+        if (n->last > windows.last_day) windows.last_day = n->last;
+    }
+    platform_mutex_unlock(windows.mutex);
+}
+
+/* ============================================================================
+ * Public Functions
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_rule_windows_affected(
+    const regislex_holiday_t* holiday,
+    regislex_court_trigger_ref_t** triggers,
+    int* count)
+{
+    if (!holiday || !triggers || !count) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    *triggers = NULL;
+    *count = 0;
+    if (!windows.mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    trigger_list_t list = {NULL, 0, 0, false};
+
+    platform_mutex_lock(windows.mutex);
+    if (windows.nodes.used > 0) {
+        regislex_datetime_t edge;
+        memset(&edge, 0, sizeof(edge));
+        regislex_datetime_from_days(windows.first_day, &edge);
+        int first_year = edge.year;
+        regislex_datetime_from_days(windows.last_day, &edge);
+        int last_year = edge.year;
+
+        for (int i = 0; i < windows.trees.capacity; i++) {
+            const window_tree_t* t = (const window_tree_t*)windows.trees.slots[i];
+            if (!t || !t->root) continue;
+            if (holiday->jurisdiction[0] && strcmp(holiday->jurisdiction, t->jurisdiction) != 0) continue;
+
+            /* Observed dates may shift across the year boundary */
+            for (int year = first_year - 1; year <= last_year + 1; year++) {
+                regislex_datetime_t actual, observed;
+                if (regislex_holiday_occurrence(holiday, year, &actual, &observed) != REGISLEX_OK) continue;
+
+                int64_t a = regislex_datetime_to_days(&actual);
+                int64_t o = regislex_datetime_to_days(&observed);
+                tree_stab(t->root, a, &list);
+                if (o != a) tree_stab(t->root, o, &list);
+            }
+        }
+    }
+    platform_mutex_unlock(windows.mutex);
+
+    if (list.failed) {
+        platform_free(list.items);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* Many deadlines share a trigger; each chain is recomputed once */
+    if (list.count > 1) {
+        qsort(list.items, (size_t)list.count, sizeof(regislex_court_trigger_ref_t), compare_triggers);
+        int unique = 1;
+        for (int i = 1; i < list.count; i++) {
+            if (compare_triggers(&list.items[i], &list.items[unique - 1]) != 0) {
+                list.items[unique++] = list.items[i];
+            }
+        }
+        list.count = unique;
+    }
+
+    *triggers = list.items;
+    *count = list.count;
+    return REGISLEX_OK;
+}
+
+REGISLEX_API void regislex_court_trigger_refs_free(regislex_court_trigger_ref_t* triggers) {
+    platform_free(triggers);
+}
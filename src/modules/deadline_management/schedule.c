@@ -0,0 +1,541 @@
+/**
+ * @file schedule.c
+ * @brief Assignee Schedule Conflict Detection
+ *
+ * Each assignee's booked slots live in an AVL tree ordered by start time
+ * and augmented with the largest end time in every subtree, so a query
+ * skips any subtree that ends before the proposed slot begins and runs in
+ * O(log n + k). An id map finds a deadline's node for O(log n) updates.
+ *
+ * The trees are rebuilt from the database at startup in one streaming
+ * pass and kept current by the deadline create, update, complete and
+ * delete paths, and by case deletion for the deadlines that cascade.
+ */
+
+#include "regislex/regislex.h"
+#include "database/database.h"
+#include "platform/platform.h"
+#include "utils/id_map.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * Internal Structures
+ * ============================================================================ */
+
+typedef struct schedule_tree schedule_tree_t;
+
+typedef struct schedule_node {
+    regislex_uuid_t id;
+    int64_t start;              /* Epoch seconds, inclusive */
+    int64_t end;                /* Epoch seconds, exclusive */
+    int64_t max_end;            /* Largest end in this subtree */
+    int height;
+    struct schedule_node* left;
+    struct schedule_node* right;
+    schedule_tree_t* tree;
+} schedule_node_t;
+
+struct schedule_tree {
+    regislex_uuid_t assigned_to_id;
+    schedule_node_t* root;
+    int count;
+};
+
+static struct {
+    platform_mutex_t* mutex;
+
+    regislex_id_map_t trees;    /* Keyed by assignee */
+    regislex_id_map_t nodes;    /* Keyed by deadline id */
+} schedule;
+
+/* Booked interval of a deadline; false when it occupies no time slot */
+static bool deadline_slot(const regislex_deadline_t* dl, int64_t* start, int64_t* end) {
+    if (!dl->assigned_to_id.value[0] || dl->duration_minutes <= 0 || dl->is_all_day) {
+        return false;
+    }
+    if (dl->status == REGISLEX_STATUS_COMPLETED || dl->status == REGISLEX_STATUS_CANCELLED) {
+        return false;
+    }
+    /* A series books every occurrence; only one-off slots are tracked */
+    if (dl->rrule[0]) {
+        return false;
+    }
+
+    const regislex_datetime_t* from = dl->start_date.year != 0 ? &dl->start_date : &dl->due_date;
+    if (!regislex_datetime_is_valid_date(from)) {
+        return false;
+    }
+
+    *start = regislex_datetime_to_seconds(from);
+    *end = *start + (int64_t)dl->duration_minutes * 60;
+    return true;
+}
+
+/* ============================================================================
+ * Assignee Trees
+ * ============================================================================ */
+
+static schedule_tree_t* tree_get(const regislex_uuid_t* assigned_to_id) {
+    schedule_tree_t* t = (schedule_tree_t*)regislex_id_map_get(&schedule.trees, assigned_to_id->value);
+    if (t) return t;
+
+    t = (schedule_tree_t*)platform_calloc(1, sizeof(schedule_tree_t));
+    if (!t) return NULL;
+
+    t->assigned_to_id = *assigned_to_id;
+    if (regislex_id_map_insert(&schedule.trees, t) != REGISLEX_OK) {
+        platform_free(t);
+        return NULL;
+    }
+    return t;
+}
+
+/* ============================================================================
+ * Augmented AVL Tree
+ * ============================================================================ */
+
+static int node_height(const schedule_node_t* n) {
+    return n ? n->height : 0;
+}
+
+static void node_update(schedule_node_t* n) {
+    int hl = node_height(n->left);
+    int hr = node_height(n->right);
+    n->height = (hl > hr ? hl : hr) + 1;
+
+    n->max_end = n->end;
+    if (n->left && n->left->max_end > n->max_end) n->max_end = n->left->max_end;
+    if (n->right && n->right->max_end > n->max_end) n->max_end = n->right->max_end;
+}
+
+static schedule_node_t* rotate_right(schedule_node_t* n) {
+    schedule_node_t* l = n->left;
+    n->left = l->right;
+    l->right = n;
+    node_update(n);
+    node_update(l);
+    return l;
+}
+
+static schedule_node_t* rotate_left(schedule_node_t* n) {
+    schedule_node_t* r = n->right;
+    n->right = r->left;
+    r->left = n;
+    node_update(n);
+    node_update(r);
+    return r;
+}
+
+static schedule_node_t* node_balance(schedule_node_t* n) {
+    node_update(n);
+
+    int balance = node_height(n->left) - node_height(n->right);
+    if (balance > 1) {
+        if (node_height(n->left->left) < node_height(n->left->right)) {
+            n->left = rotate_left(n->left);
+        }
+        return rotate_right(n);
+    }
+    if (balance < -1) {
+        if (node_height(n->right->right) < node_height(n->right->left)) {
+            n->right = rotate_right(n->right);
+        }
+        return rotate_left(n);
+    }
+    return n;
+}
+
+/* Order by start, then by id so equal starts stay distinct */
+static int node_compare(const schedule_node_t* a, const schedule_node_t* b) {
+    if (a->start != b->start) return a->start < b->start ? -1 : 1;
+    return strcmp(a->id.value, b->id.value);
+}
+
+static schedule_node_t* avl_insert(schedule_node_t* root, schedule_node_t* n) {
+    if (!root) {
+        n->left = NULL;
+        n->right = NULL;
+        node_update(n);
+        return n;
+    }
+
+    if (node_compare(n, root) < 0) {
+        root->left = avl_insert(root->left, n);
+    } else {
+        root->right = avl_insert(root->right, n);
+    }
+    return node_balance(root);
+}
+
+static schedule_node_t* avl_detach_min(schedule_node_t* root, schedule_node_t** out_min) {
+    if (!root->left) {
+        *out_min = root;
+        return root->right;
+    }
+    root->left = avl_detach_min(root->left, out_min);
+    return node_balance(root);
+}
+
+static schedule_node_t* avl_remove(schedule_node_t* root, schedule_node_t* n) {
+    if (!root) return NULL;
+
+    int cmp = node_compare(n, root);
+    if (cmp < 0) {
+        root->left = avl_remove(root->left, n);
+    } else if (cmp > 0) {
+        root->right = avl_remove(root->right, n);
+    } else {
+        if (!root->left) return root->right;
+        if (!root->right) return root->left;
+
+        schedule_node_t* successor = NULL;
+        schedule_node_t* right = avl_detach_min(root->right, &successor);
+        successor->left = root->left;
+        successor->right = right;
+        return node_balance(successor);
+    }
+    return node_balance(root);
+}
+
+/* ============================================================================
+ * Index Maintenance
+ * ============================================================================ */
+
+static void index_remove(const char* id) {
+    schedule_node_t* n = (schedule_node_t*)regislex_id_map_remove(&schedule.nodes, id);
+    if (!n) return;
+
+    n->tree->root = avl_remove(n->tree->root, n);
+    n->tree->count--;
+    platform_free(n);
+}
+
+static regislex_error_t index_add(const regislex_uuid_t* id,
+                                  const regislex_uuid_t* assigned_to_id,
+                                  int64_t start, int64_t end) {
+    schedule_tree_t* t = tree_get(assigned_to_id);
+    if (!t) return REGISLEX_ERROR_OUT_OF_MEMORY;
+
+    schedule_node_t* n = (schedule_node_t*)platform_calloc(1, sizeof(schedule_node_t));
+    if (!n) return REGISLEX_ERROR_OUT_OF_MEMORY;
+
+    n->id = *id;
+    n->start = start;
+    n->end = end;
+    n->tree = t;
+
+    if (regislex_id_map_insert(&schedule.nodes, n) != REGISLEX_OK) {
+        platform_free(n);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    t->root = avl_insert(t->root, n);
+    t->count++;
+    return REGISLEX_OK;
+}
+
+static void index_clear(void) {
+    for (int i = 0; i < schedule.nodes.capacity; i++) {
+        platform_free(schedule.nodes.slots[i]);
+    }
+    for (int i = 0; i < schedule.trees.capacity; i++) {
+        platform_free(schedule.trees.slots[i]);
+    }
+    regislex_id_map_free(&schedule.nodes);
+    regislex_id_map_free(&schedule.trees);
+
+    regislex_id_map_init(&schedule.nodes, offsetof(schedule_node_t, id.value));
+    regislex_id_map_init(&schedule.trees, offsetof(schedule_tree_t, assigned_to_id.value));
+}
+
+REGISLEX_API regislex_error_t regislex_schedule_init(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (schedule.mutex == NULL) {
+        if (platform_mutex_create(&schedule.mutex) != PLATFORM_OK) {
+            schedule.mutex = NULL;
+            return REGISLEX_ERROR;
+        }
+    }
+
+    return regislex_schedule_rebuild(ctx);
+}
+
+REGISLEX_API void regislex_schedule_shutdown(void) {
+    if (!schedule.mutex) return;
+
+    platform_mutex_lock(schedule.mutex);
+    index_clear();
+    platform_mutex_unlock(schedule.mutex);
+
+    platform_mutex_destroy(schedule.mutex);
+    schedule.mutex = NULL;
+}
+
+REGISLEX_API regislex_error_t regislex_schedule_rebuild(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!schedule.mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    const char* sql =
+        "SELECT id, assigned_to_id, start_date, due_date, duration_minutes "
+        "FROM deadlines "
+        "WHERE duration_minutes > 0 AND assigned_to_id <> '' AND is_all_day = 0 "
+        "AND status NOT IN (?, ?) AND rrule IS NULL";
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(ctx), sql, &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_bind_int(stmt, 1, REGISLEX_STATUS_COMPLETED);
+    regislex_db_bind_int(stmt, 2, REGISLEX_STATUS_CANCELLED);
+
+    platform_mutex_lock(schedule.mutex);
+    index_clear();
+
+    regislex_deadline_t dl;
+    memset(&dl, 0, sizeof(dl));
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        regislex_db_column_uuid(stmt, 0, &dl.id);
+        regislex_db_column_uuid(stmt, 1, &dl.assigned_to_id);
+        regislex_db_column_datetime(stmt, 2, &dl.start_date);
+        regislex_db_column_datetime(stmt, 3, &dl.due_date);
+        dl.duration_minutes = (int)regislex_db_column_int(stmt, 4);
+
+        int64_t start, end;
+        if (!deadline_slot(&dl, &start, &end)) continue;
+
+        err = index_add(&dl.id, &dl.assigned_to_id, start, end);
+        if (err != REGISLEX_OK) break;
+    }
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        index_clear();
+        platform_mutex_unlock(schedule.mutex);
+        return err;
+    }
+
+    platform_mutex_unlock(schedule.mutex);
+    return REGISLEX_OK;
+}
+
+REGISLEX_API void regislex_schedule_apply(const regislex_deadline_t* deadline) {
+    if (!schedule.mutex || !deadline) return;
+
+    platform_mutex_lock(schedule.mutex);
+    index_remove(deadline->id.value);
+
+    int64_t start, end;
+    if (deadline_slot(deadline, &start, &end)) {
+        index_add(&deadline->id, &deadline->assigned_to_id, start, end);
+    }
+    platform_mutex_unlock(schedule.mutex);
+}
+
+REGISLEX_API void regislex_schedule_remove(const regislex_uuid_t* deadline_id) {
+    if (!schedule.mutex || !deadline_id) return;
+
+    platform_mutex_lock(schedule.mutex);
+    index_remove(deadline_id->value);
+    platform_mutex_unlock(schedule.mutex);
+}
+
+/* ============================================================================
+ * Conflict Queries
+ * ============================================================================ */
+
+typedef struct {
+    regislex_schedule_slot_t* items;
+    int count;
+    int capacity;
+    bool failed;
+} slot_list_t;
+
+static void slot_list_push(slot_list_t* list, const schedule_node_t* n) {
+    if (list->failed) return;
+
+    if (list->count >= list->capacity) {
+        int capacity = list->capacity ? list->capacity * 2 : 8;
+        regislex_schedule_slot_t* items = (regislex_schedule_slot_t*)platform_realloc(
+            list->items, (size_t)capacity * sizeof(regislex_schedule_slot_t));
+        if (!items) {
+            list->failed = true;
+            return;
+        }
+        list->items = items;
+        list->capacity = capacity;
+    }
+
+    regislex_schedule_slot_t* slot = &list->items[list->count++];
+    slot->deadline_id = n->id;
+    regislex_datetime_from_seconds(n->start, &slot->start);
+    regislex_datetime_from_seconds(n->end, &slot->end);
+}
+
+/* Collect nodes overlapping [start, end) in start order */
+static void tree_query(const schedule_node_t* n, int64_t start, int64_t end,
+                       const char* exclude_id, slot_list_t* out) {
+    if (!n || n->max_end <= start) return;
+
+    tree_query(n->left, start, end, exclude_id, out);
+
+    if (n->start < end) {
+        if (n->end > start && (!exclude_id || strcmp(n->id.value, exclude_id) != 0)) {
+            slot_list_push(out, n);
+        }
+        tree_query(n->right, start, end, exclude_id, out);
+    }
+}
+
+REGISLEX_API regislex_error_t regislex_schedule_conflicts(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* assigned_to_id,
+    const regislex_datetime_t* start,
+    int duration_minutes,
+    const regislex_uuid_t* exclude_id,
+    regislex_schedule_slot_t** out_slots,
+    int* out_count)
+{
+    if (!ctx || !assigned_to_id || !start || !out_slots || !out_count || duration_minutes <= 0) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!regislex_datetime_is_valid_date(start)) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+    if (!schedule.mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    int64_t from = regislex_datetime_to_seconds(start);
+    int64_t to = from + (int64_t)duration_minutes * 60;
+
+    slot_list_t list = { NULL, 0, 0, false };
+
+    platform_mutex_lock(schedule.mutex);
+    const schedule_tree_t* t = (const schedule_tree_t*)regislex_id_map_get(&schedule.trees, assigned_to_id->value);
+    if (t) {
+        tree_query(t->root, from, to, exclude_id ? exclude_id->value : NULL, &list);
+    }
+    platform_mutex_unlock(schedule.mutex);
+
+    if (list.failed) {
+        platform_free(list.items);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    *out_slots = list.items;
+    *out_count = list.count;
+    return REGISLEX_OK;
+}
+
+typedef struct {
+    regislex_schedule_conflict_t* items;
+    int count;
+    int capacity;
+} conflict_list_t;
+
+static void tree_flatten(schedule_node_t* n, schedule_node_t** out, int* count) {
+    if (!n) return;
+    tree_flatten(n->left, out, count);
+    out[(*count)++] = n;
+    tree_flatten(n->right, out, count);
+}
+
+/* Sweep one assignee's slots in start order; each slot is compared only
+ * with the later slots that begin before it ends */
+static regislex_error_t tree_scan(const schedule_tree_t* t, schedule_node_t** sorted,
+                                  conflict_list_t* out) {
+    int n = 0;
+    tree_flatten(t->root, sorted, &n);
+
+    for (int i = 0; i < n; i++) {
+        for (int j = i + 1; j < n && sorted[j]->start < sorted[i]->end; j++) {
+            if (out->count >= out->capacity) {
+                int capacity = out->capacity ? out->capacity * 2 : 16;
+                regislex_schedule_conflict_t* items = (regislex_schedule_conflict_t*)platform_realloc(
+                    out->items, (size_t)capacity * sizeof(regislex_schedule_conflict_t));
+                if (!items) return REGISLEX_ERROR_OUT_OF_MEMORY;
+                out->items = items;
+                out->capacity = capacity;
+            }
+
+            regislex_schedule_conflict_t* c = &out->items[out->count++];
+            c->assigned_to_id = t->assigned_to_id;
+            c->first_id = sorted[i]->id;
+            c->second_id = sorted[j]->id;
+            regislex_datetime_from_seconds(sorted[j]->start, &c->overlap_start);
+            regislex_datetime_from_seconds(sorted[i]->end < sorted[j]->end ? sorted[i]->end : sorted[j]->end,
+                                  &c->overlap_end);
+        }
+    }
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_schedule_scan(
+    regislex_context_t* ctx,
+    regislex_schedule_conflict_t** out_conflicts,
+    int* out_count)
+{
+    if (!ctx || !out_conflicts || !out_count) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!schedule.mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    conflict_list_t list = { NULL, 0, 0 };
+    regislex_error_t err = REGISLEX_OK;
+
+    platform_mutex_lock(schedule.mutex);
+
+    int largest = 0;
+    for (int i = 0; i < schedule.trees.capacity; i++) {
+        const schedule_tree_t* t = (const schedule_tree_t*)schedule.trees.slots[i];
+        if (t && t->count > largest) {
+            largest = t->count;
+        }
+    }
+
+    schedule_node_t** sorted = NULL;
+    if (largest > 0) {
+        sorted = (schedule_node_t**)platform_malloc((size_t)largest * sizeof(schedule_node_t*));
+        if (!sorted) err = REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    for (int i = 0; i < schedule.trees.capacity && err == REGISLEX_OK; i++) {
+        const schedule_tree_t* t = (const schedule_tree_t*)schedule.trees.slots[i];
+        if (t && t->count > 1) {
+            err = tree_scan(t, sorted, &list);
+        }
+    }
+
+    platform_mutex_unlock(schedule.mutex);
+    platform_free(sorted);
+
+    if (err != REGISLEX_OK) {
+        platform_free(list.items);
+        return err;
+    }
+
+    *out_conflicts = list.items;
+    *out_count = list.count;
+    return REGISLEX_OK;
+}
+
+REGISLEX_API void regislex_schedule_slots_free(regislex_schedule_slot_t* slots) {
+    platform_free(slots);
+}
+
+REGISLEX_API void regislex_schedule_conflicts_free(regislex_schedule_conflict_t* conflicts) {
+    platform_free(conflicts);
+}
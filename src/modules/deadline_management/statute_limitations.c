@@ -1,115 +1,938 @@
 /**
  * @file statute_limitations.c
  * @brief Statute of Limitations Calculator
+ *
+ * Rules are stored in statute_rules and compiled into an index hashed by
+ * (claim_type, jurisdiction). Each key holds its variants: a standard
+ * rule running from accrual and, where the jurisdiction has one, a
+ * discovery-rule variant with an optional repose limit. Lookups fall back
+ * to the "federal" rule when the jurisdiction has none.
+ *
+ * The index is an immutable, reference-counted snapshot; a reload swaps
+ * in a new one and the old one is freed by its last reader, so a long
+ * sweep never blocks rule changes. A rule change reloads once it commits,
+ * so the index never shows a rule a caller's transaction rolls back.
  */
 
 #include "regislex/regislex.h"
+#include "database/database.h"
 #include "platform/platform.h"
+#include <stdlib.h>
 #include <string.h>
 
+#define STATUTE_FALLBACK_JURISDICTION  "federal"
+
+#define STATUTE_COLUMNS \
+    "id, name, description, claim_type, jurisdiction, case_type, limitation_months," \
+    " limitation_days, accrual, repose_months, tolling_allowed, max_tolling_days," \
+    " tolling_conditions, statute_reference, notes, effective_date, expiration_date," \
+    " is_active, created_at, updated_at"
+
+/* ============================================================================
+ * Internal Structures
+ * ============================================================================ */
+
 typedef struct {
-    char claim_type[128];
-    char jurisdiction[64];
-    int years;
-    int months;
-    int days;
-    char notes[512];
-} statute_rule_t;
-
-/* Common statute of limitations rules (simplified) */
-static statute_rule_t statute_rules[] = {
-    {"personal_injury", "federal", 2, 0, 0, "Federal tort claims"},
-    {"personal_injury", "CA", 2, 0, 0, "California personal injury"},
-    {"personal_injury", "NY", 3, 0, 0, "New York personal injury"},
-    {"personal_injury", "TX", 2, 0, 0, "Texas personal injury"},
-    {"contract_written", "federal", 4, 0, 0, "Written contracts"},
-    {"contract_written", "CA", 4, 0, 0, "California written contracts"},
-    {"contract_oral", "CA", 2, 0, 0, "California oral contracts"},
-    {"malpractice_medical", "CA", 3, 0, 0, "California medical malpractice"},
-    {"malpractice_legal", "CA", 4, 0, 0, "California legal malpractice"},
-    {"fraud", "CA", 3, 0, 0, "California fraud claims"},
-    {"property_damage", "CA", 3, 0, 0, "California property damage"},
-    {"wrongful_death", "CA", 2, 0, 0, "California wrongful death"},
-    {NULL, NULL, 0, 0, 0, NULL}
-};
-
-regislex_error_t regislex_sol_calculate(const char* claim_type,
-                                         const char* jurisdiction,
-                                         const regislex_datetime_t* incident_date,
-                                         regislex_datetime_t* deadline) {
-    if (!claim_type || !jurisdiction || !incident_date || !deadline) {
-        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    regislex_uuid_t id;
+    int64_t effective_day;      /* First accrual day the rule covers */
+    int64_t expiration_day;     /* Last accrual day the rule covers */
+    int limitation_months;
+    int limitation_days;
+    int repose_months;
+    int max_tolling_days;
+    bool tolling_allowed;
+    regislex_accrual_rule_t accrual;
+} statute_variant_t;
+
+typedef struct {
+    char* claim_type;
+    char* jurisdiction;
+    uint32_t hash;
+    int first;                  /* Variants are variants[first..first+count) */
+    int count;
+} statute_key_t;
+
+typedef struct {
+    statute_key_t* keys;
+    int key_count;
+    int* slots;                 /* Key indexes, -1 when empty */
+    int slot_capacity;
+    statute_variant_t* variants;
+    int variant_count;
+    int refs;
+} statute_index_t;
+
+static platform_mutex_t* statute_mutex = NULL;
+static statute_index_t* statute_index = NULL;
+
+/* ============================================================================
+ * Period Arithmetic
+ * ============================================================================ */
+
+static int64_t add_months_to_day(int64_t day, int months) {
+    regislex_datetime_t dt;
+    memset(&dt, 0, sizeof(dt));
+    regislex_datetime_from_days(day, &dt);
+    regislex_datetime_add_months(&dt, months);
+    return regislex_datetime_to_days(&dt);
+}
+
+static int64_t variant_expiry(const statute_variant_t* v, int64_t accrual_day,
+                              bool has_discovery, int64_t discovery_day, int tolled_days) {
+    int64_t start = accrual_day;
+    if (v->accrual == REGISLEX_ACCRUAL_DISCOVERY && has_discovery && discovery_day > accrual_day) {
+        start = discovery_day;
     }
 
-    /* Find matching rule */
-    const statute_rule_t* rule = NULL;
-    for (int i = 0; statute_rules[i].claim_type[0] != '\0'; i++) {
-        if (strcmp(statute_rules[i].claim_type, claim_type) == 0 &&
-            strcmp(statute_rules[i].jurisdiction, jurisdiction) == 0) {
-            rule = &statute_rules[i];
-            break;
+    int64_t end = add_months_to_day(start, v->limitation_months) + v->limitation_days;
+
+    if (v->tolling_allowed && tolled_days > 0) {
+        end += (v->max_tolling_days > 0 && tolled_days > v->max_tolling_days)
+            ? v->max_tolling_days : tolled_days;
+    }
+
+    /* Repose runs from accrual and is not extended by discovery or tolling */
+    if (v->repose_months > 0) {
+        int64_t repose = add_months_to_day(accrual_day, v->repose_months);
+        if (end > repose) end = repose;
+    }
+
+    return end;
+}
+
+/* ============================================================================
+ * Rule Index
+ * ============================================================================ */
+
+static uint32_t key_hash(const char* claim_type, const char* jurisdiction) {
+    uint32_t hash = 2166136261u;
+    for (const char* p = claim_type; *p; p++) {
+        hash ^= (uint8_t)*p;
+        hash *= 16777619u;
+    }
+    hash ^= 0x1f;
+    hash *= 16777619u;
+    for (const char* p = jurisdiction; *p; p++) {
+        hash ^= (uint8_t)*p;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static void index_free(statute_index_t* idx) {
+    if (!idx) return;
+    for (int i = 0; i < idx->key_count; i++) {
+        platform_free(idx->keys[i].claim_type);
+        platform_free(idx->keys[i].jurisdiction);
+    }
+    platform_free(idx->keys);
+    platform_free(idx->slots);
+    platform_free(idx->variants);
+    platform_free(idx);
+}
+
+static const statute_key_t* index_find(const statute_index_t* idx,
+                                       const char* claim_type, const char* jurisdiction) {
+    if (idx->slot_capacity == 0) return NULL;
+
+    uint32_t hash = key_hash(claim_type, jurisdiction);
+    uint32_t mask = (uint32_t)idx->slot_capacity - 1;
+    uint32_t i = hash & mask;
+    while (idx->slots[i] >= 0) {
+        const statute_key_t* k = &idx->keys[idx->slots[i]];
+        if (k->hash == hash && strcmp(k->claim_type, claim_type) == 0 &&
+            strcmp(k->jurisdiction, jurisdiction) == 0) {
+            return k;
+        }
+        i = (i + 1) & mask;
+    }
+    return NULL;
+}
+
+/*
+ * Picks the variant covering the accrual day, preferring the discovery
+ * rule when the discovery date is known.
+ */
+static const statute_variant_t* key_variant(const statute_index_t* idx, const statute_key_t* k,
+                                            int64_t accrual_day, bool has_discovery) {
+    const statute_variant_t* standard = NULL;
+    const statute_variant_t* discovery = NULL;
+
+    for (int i = k->first; i < k->first + k->count; i++) {
+        const statute_variant_t* v = &idx->variants[i];
+        if (accrual_day < v->effective_day || accrual_day > v->expiration_day) continue;
+        if (v->accrual == REGISLEX_ACCRUAL_DISCOVERY) {
+            if (!discovery) discovery = v;
+        } else if (!standard) {
+            standard = v;
         }
     }
 
-    if (!rule) {
-        /* Try federal/default */
-        for (int i = 0; statute_rules[i].claim_type[0] != '\0'; i++) {
-            if (strcmp(statute_rules[i].claim_type, claim_type) == 0 &&
-                strcmp(statute_rules[i].jurisdiction, "federal") == 0) {
-                rule = &statute_rules[i];
+    if (has_discovery && discovery) return discovery;
+    return standard ? standard : discovery;
+}
+
+static const statute_variant_t* index_lookup(const statute_index_t* idx,
+                                             const char* claim_type, const char* jurisdiction,
+                                             int64_t accrual_day, bool has_discovery) {
+    const statute_key_t* k = index_find(idx, claim_type, jurisdiction);
+    const statute_variant_t* v = k ? key_variant(idx, k, accrual_day, has_discovery) : NULL;
+    if (v) return v;
+
+    k = index_find(idx, claim_type, STATUTE_FALLBACK_JURISDICTION);
+    return k ? key_variant(idx, k, accrual_day, has_discovery) : NULL;
+}
+
+static char* copy_text(const char* text) {
+    return platform_strdup(text ? text : "");
+}
+
+static regislex_error_t index_build(regislex_db_context_t* db, statute_index_t** out) {
+    statute_index_t* idx = (statute_index_t*)platform_calloc(1, sizeof(statute_index_t));
+    if (!idx) return REGISLEX_ERROR_OUT_OF_MEMORY;
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "SELECT id, claim_type, jurisdiction, limitation_months, limitation_days, accrual,"
+        " repose_months, tolling_allowed, max_tolling_days, effective_date, expiration_date"
+        " FROM statute_rules WHERE is_active = 1"
+        " ORDER BY claim_type, jurisdiction, accrual, effective_date DESC", &stmt);
+    if (err != REGISLEX_OK) {
+        platform_free(idx);
+        return err;
+    }
+
+    int variant_capacity = 0;
+    int key_capacity = 0;
+
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        const char* claim_type = regislex_db_column_text(stmt, 1);
+        const char* jurisdiction = regislex_db_column_text(stmt, 2);
+        if (!claim_type) claim_type = "";
+        if (!jurisdiction) jurisdiction = "";
+
+        if (idx->variant_count >= variant_capacity) {
+            int new_capacity = variant_capacity ? variant_capacity * 2 : 32;
+            statute_variant_t* grown = (statute_variant_t*)platform_realloc(
+                idx->variants, (size_t)new_capacity * sizeof(statute_variant_t));
+            if (!grown) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
                 break;
             }
+            idx->variants = grown;
+            variant_capacity = new_capacity;
         }
+
+        /* Rows arrive grouped by key; start a new key when it changes */
+        statute_key_t* k = idx->key_count > 0 ? &idx->keys[idx->key_count - 1] : NULL;
+        if (!k || strcmp(k->claim_type, claim_type) != 0 || strcmp(k->jurisdiction, jurisdiction) != 0) {
+            if (idx->key_count >= key_capacity) {
+                int new_capacity = key_capacity ? key_capacity * 2 : 16;
+                statute_key_t* grown = (statute_key_t*)platform_realloc(
+                    idx->keys, (size_t)new_capacity * sizeof(statute_key_t));
+                if (!grown) {
+                    err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                    break;
+                }
+                idx->keys = grown;
+                key_capacity = new_capacity;
+            }
+
+            k = &idx->keys[idx->key_count];
+            k->claim_type = copy_text(claim_type);
+            k->jurisdiction = copy_text(jurisdiction);
+            k->hash = key_hash(claim_type, jurisdiction);
+            k->first = idx->variant_count;
+            k->count = 0;
+            idx->key_count++;
+            if (!k->claim_type || !k->jurisdiction) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+        }
+
+        statute_variant_t* v = &idx->variants[idx->variant_count++];
+        memset(v, 0, sizeof(*v));
+        regislex_db_column_uuid(stmt, 0, &v->id);
+        v->limitation_months = (int)regislex_db_column_int(stmt, 3);
+        v->limitation_days = (int)regislex_db_column_int(stmt, 4);
+        v->accrual = (regislex_accrual_rule_t)regislex_db_column_int(stmt, 5);
+        v->repose_months = (int)regislex_db_column_int(stmt, 6);
+        v->tolling_allowed = regislex_db_column_int(stmt, 7) != 0;
+        v->max_tolling_days = (int)regislex_db_column_int(stmt, 8);
+
+        regislex_datetime_t date;
+        regislex_db_column_datetime(stmt, 9, &date);
+        v->effective_day = regislex_datetime_is_valid_date(&date)
+            ? regislex_datetime_to_days(&date) : INT64_MIN;
+        regislex_db_column_datetime(stmt, 10, &date);
+        v->expiration_day = regislex_datetime_is_valid_date(&date)
+            ? regislex_datetime_to_days(&date) : INT64_MAX;
+
+        k->count++;
     }
 
-    if (!rule) {
-        return REGISLEX_ERROR_NOT_FOUND;
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        index_free(idx);
+        return err;
+    }
+
+    int capacity = 16;
+    while (capacity < idx->key_count * 2) capacity *= 2;
+
+    idx->slots = (int*)platform_malloc((size_t)capacity * sizeof(int));
+    if (!idx->slots) {
+        index_free(idx);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    for (int i = 0; i < capacity; i++) idx->slots[i] = -1;
+    idx->slot_capacity = capacity;
+
+    uint32_t mask = (uint32_t)capacity - 1;
+    for (int k = 0; k < idx->key_count; k++) {
+        uint32_t i = idx->keys[k].hash & mask;
+        while (idx->slots[i] >= 0) {
+            i = (i + 1) & mask;
+        }
+        idx->slots[i] = k;
+    }
+
+    *out = idx;
+    return REGISLEX_OK;
+}
+
+static statute_index_t* index_acquire(void) {
+    if (!statute_mutex) return NULL;
+
+    platform_mutex_lock(statute_mutex);
+    statute_index_t* idx = statute_index;
+    if (idx) idx->refs++;
+    platform_mutex_unlock(statute_mutex);
+    return idx;
+}
+
+static void index_release(statute_index_t* idx) {
+    platform_mutex_lock(statute_mutex);
+    idx->refs--;
+    bool retired = idx->refs == 0 && idx != statute_index;
+    platform_mutex_unlock(statute_mutex);
+
+    if (retired) index_free(idx);
+}
+
+/* ============================================================================
+ * Initialization
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_statute_init(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (statute_mutex == NULL) {
+        if (platform_mutex_create(&statute_mutex) != PLATFORM_OK) {
+            return REGISLEX_ERROR;
+        }
+    }
+
+    return regislex_statute_reload(ctx);
+}
+
+REGISLEX_API void regislex_statute_shutdown(void) {
+    if (!statute_mutex) return;
+
+    platform_mutex_lock(statute_mutex);
+    statute_index_t* idx = statute_index;
+    statute_index = NULL;
+    platform_mutex_unlock(statute_mutex);
+
+    index_free(idx);
+    platform_mutex_destroy(statute_mutex);
+    statute_mutex = NULL;
+}
+
+REGISLEX_API regislex_error_t regislex_statute_reload(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!statute_mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    statute_index_t* idx = NULL;
+    regislex_error_t err = index_build(regislex_get_db(ctx), &idx);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    platform_mutex_lock(statute_mutex);
+    statute_index_t* old = statute_index;
+    statute_index = idx;
+    bool retired = old && old->refs == 0;
+    platform_mutex_unlock(statute_mutex);
+
+    if (retired) index_free(old);
+    return REGISLEX_OK;
+}
+
+static void statute_reload_run(void* data) {
+    regislex_statute_reload(*(regislex_context_t**)data);
+}
+
+/*
+ * Reloads the index once a rule change commits. Outside a transaction the
+ * change is already durable, so the reload runs now and reports its error.
+ */
+static regislex_error_t statute_changed(regislex_context_t* ctx) {
+    regislex_db_context_t* db = regislex_get_db(ctx);
+    if (!regislex_db_in_transaction(db)) {
+        return regislex_statute_reload(ctx);
+    }
+
+    regislex_context_t** data = (regislex_context_t**)platform_malloc(sizeof(regislex_context_t*));
+    if (!data) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    *data = ctx;
+    return regislex_db_after_commit(db, statute_reload_run, data);
+}
+
+/* ============================================================================
+ * Rule Functions
+ * ============================================================================ */
+
+static void statute_from_row(regislex_db_stmt_t* stmt, regislex_statute_rule_t* r) {
+    int col = 0;
+
+    regislex_db_column_uuid(stmt, col++, &r->id);
+
+    const char* name = regislex_db_column_text(stmt, col++);
+    if (name) strncpy(r->name, name, sizeof(r->name) - 1);
+
+    const char* description = regislex_db_column_text(stmt, col++);
+    if (description) strncpy(r->description, description, sizeof(r->description) - 1);
+
+    const char* claim_type = regislex_db_column_text(stmt, col++);
+    if (claim_type) strncpy(r->claim_type, claim_type, sizeof(r->claim_type) - 1);
+
+    const char* jurisdiction = regislex_db_column_text(stmt, col++);
+    if (jurisdiction) strncpy(r->jurisdiction, jurisdiction, sizeof(r->jurisdiction) - 1);
+
+    r->case_type = (regislex_case_type_t)regislex_db_column_int(stmt, col++);
+    r->limitation_months = (int)regislex_db_column_int(stmt, col++);
+    r->limitation_days = (int)regislex_db_column_int(stmt, col++);
+    r->accrual = (regislex_accrual_rule_t)regislex_db_column_int(stmt, col++);
+    r->repose_months = (int)regislex_db_column_int(stmt, col++);
+    r->tolling_allowed = regislex_db_column_int(stmt, col++) != 0;
+    r->max_tolling_days = (int)regislex_db_column_int(stmt, col++);
+
+    const char* tolling_conditions = regislex_db_column_text(stmt, col++);
+    if (tolling_conditions) strncpy(r->tolling_conditions, tolling_conditions, sizeof(r->tolling_conditions) - 1);
+
+    const char* statute_reference = regislex_db_column_text(stmt, col++);
+    if (statute_reference) strncpy(r->statute_reference, statute_reference, sizeof(r->statute_reference) - 1);
+
+    const char* notes = regislex_db_column_text(stmt, col++);
+    if (notes) strncpy(r->notes, notes, sizeof(r->notes) - 1);
+
+    regislex_db_column_datetime(stmt, col++, &r->effective_date);
+    regislex_db_column_datetime(stmt, col++, &r->expiration_date);
+    r->is_active = regislex_db_column_int(stmt, col++) != 0;
+    regislex_db_column_datetime(stmt, col++, &r->created_at);
+    regislex_db_column_datetime(stmt, col++, &r->updated_at);
+}
+
+static regislex_error_t statute_validate(const regislex_statute_rule_t* rule) {
+    if (rule->name[0] == '\0' || rule->claim_type[0] == '\0') {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+    if (rule->limitation_months < 0 || rule->limitation_days < 0 ||
+        rule->limitation_months + rule->limitation_days == 0) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+    if (rule->accrual != REGISLEX_ACCRUAL_INCIDENT && rule->accrual != REGISLEX_ACCRUAL_DISCOVERY) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+    if (rule->repose_months < 0 || rule->max_tolling_days < 0) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+    return REGISLEX_OK;
+}
+
+static void variant_from_rule(const regislex_statute_rule_t* r, statute_variant_t* v) {
+    memset(v, 0, sizeof(*v));
+    memcpy(&v->id, &r->id, sizeof(regislex_uuid_t));
+    v->limitation_months = r->limitation_months;
+    v->limitation_days = r->limitation_days;
+    v->accrual = r->accrual;
+    v->repose_months = r->repose_months;
+    v->tolling_allowed = r->tolling_allowed;
+    v->max_tolling_days = r->max_tolling_days;
+}
+
+REGISLEX_API regislex_error_t regislex_statute_rule_create(
+    regislex_context_t* ctx,
+    const regislex_statute_rule_t* rule,
+    regislex_statute_rule_t** out_rule)
+{
+    if (!ctx || !rule || !out_rule) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_error_t err = statute_validate(rule);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_statute_rule_t* new_rule = (regislex_statute_rule_t*)platform_calloc(1, sizeof(regislex_statute_rule_t));
+    if (!new_rule) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
     }
 
-    /* Calculate deadline */
-    memcpy(deadline, incident_date, sizeof(regislex_datetime_t));
+    memcpy(new_rule, rule, sizeof(regislex_statute_rule_t));
+    regislex_uuid_generate(&new_rule->id);
+    regislex_datetime_now(&new_rule->created_at);
+    new_rule->updated_at = new_rule->created_at;
+
+    const char* sql =
+        "INSERT INTO statute_rules (" STATUTE_COLUMNS ") "
+        "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)";
 
-    if (rule->years > 0) {
-        deadline->year += rule->years;
+    regislex_db_stmt_t* stmt = NULL;
+    err = regislex_db_prepare(regislex_get_db(ctx), sql, &stmt);
+    if (err != REGISLEX_OK) {
+        regislex_statute_rule_free(new_rule);
+        return err;
     }
-    if (rule->months > 0) {
-        regislex_datetime_add_months(deadline, rule->months);
+
+    int idx = 1;
+    regislex_db_bind_uuid(stmt, idx++, &new_rule->id);
+    regislex_db_bind_text(stmt, idx++, new_rule->name);
+    regislex_db_bind_text(stmt, idx++, new_rule->description);
+    regislex_db_bind_text(stmt, idx++, new_rule->claim_type);
+    regislex_db_bind_text(stmt, idx++, new_rule->jurisdiction);
+    regislex_db_bind_int(stmt, idx++, new_rule->case_type);
+    regislex_db_bind_int(stmt, idx++, new_rule->limitation_months);
+    regislex_db_bind_int(stmt, idx++, new_rule->limitation_days);
+    regislex_db_bind_int(stmt, idx++, new_rule->accrual);
+    regislex_db_bind_int(stmt, idx++, new_rule->repose_months);
+    regislex_db_bind_int(stmt, idx++, new_rule->tolling_allowed ? 1 : 0);
+    regislex_db_bind_int(stmt, idx++, new_rule->max_tolling_days);
+    regislex_db_bind_text(stmt, idx++, new_rule->tolling_conditions);
+    regislex_db_bind_text(stmt, idx++, new_rule->statute_reference);
+    regislex_db_bind_text(stmt, idx++, new_rule->notes);
+    regislex_db_bind_datetime(stmt, idx++,
+        regislex_datetime_is_valid_date(&new_rule->effective_date) ? &new_rule->effective_date : NULL);
+    regislex_db_bind_datetime(stmt, idx++,
+        regislex_datetime_is_valid_date(&new_rule->expiration_date) ? &new_rule->expiration_date : NULL);
+    regislex_db_bind_int(stmt, idx++, new_rule->is_active ? 1 : 0);
+    regislex_db_bind_datetime(stmt, idx++, &new_rule->created_at);
+    regislex_db_bind_datetime(stmt, idx++, &new_rule->updated_at);
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        regislex_statute_rule_free(new_rule);
+        return err;
     }
-    if (rule->days > 0) {
-        regislex_datetime_add_days(deadline, rule->days);
+
+    err = statute_changed(ctx);
+    if (err != REGISLEX_OK) {
+        regislex_statute_rule_free(new_rule);
+        return err;
     }
 
+    *out_rule = new_rule;
     return REGISLEX_OK;
 }
 
-regislex_error_t regislex_sol_get_period(const char* claim_type,
-                                          const char* jurisdiction,
-                                          int* years, int* months, int* days) {
-    if (!claim_type || !jurisdiction) return REGISLEX_ERROR_INVALID_ARGUMENT;
+REGISLEX_API regislex_error_t regislex_statute_rule_delete(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* rule_id)
+{
+    if (!ctx || !rule_id) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, "DELETE FROM statute_rules WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+    regislex_db_bind_uuid(stmt, 1, rule_id);
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+    if (regislex_db_changes(db) == 0) {
+        return REGISLEX_ERROR_NOT_FOUND;
+    }
+
+    return statute_changed(ctx);
+}
+
+REGISLEX_API regislex_error_t regislex_statute_rules_get(
+    regislex_context_t* ctx,
+    const char* jurisdiction,
+    regislex_case_type_t case_type,
+    regislex_statute_rule_t*** rules,
+    int* count)
+{
+    if (!ctx || !rules || !count) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    *rules = NULL;
+    *count = 0;
+
+    const char* sql = jurisdiction
+        ? "SELECT " STATUTE_COLUMNS " FROM statute_rules"
+          " WHERE case_type = ? AND jurisdiction IN (?, '" STATUTE_FALLBACK_JURISDICTION "')"
+          " ORDER BY claim_type, jurisdiction, accrual"
+        : "SELECT " STATUTE_COLUMNS " FROM statute_rules"
+          " WHERE case_type = ? ORDER BY claim_type, jurisdiction, accrual";
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(ctx), sql, &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    regislex_db_bind_int(stmt, 1, case_type);
+    if (jurisdiction) {
+        regislex_db_bind_text(stmt, 2, jurisdiction);
+    }
+
+    regislex_statute_rule_t** items = NULL;
+    int n = 0;
+    int capacity = 0;
+
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        if (n >= capacity) {
+            int new_capacity = capacity ? capacity * 2 : 16;
+            regislex_statute_rule_t** grown = (regislex_statute_rule_t**)platform_realloc(
+                items, (size_t)new_capacity * sizeof(regislex_statute_rule_t*));
+            if (!grown) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            items = grown;
+            capacity = new_capacity;
+        }
 
-    for (int i = 0; statute_rules[i].claim_type[0] != '\0'; i++) {
-        if (strcmp(statute_rules[i].claim_type, claim_type) == 0 &&
-            strcmp(statute_rules[i].jurisdiction, jurisdiction) == 0) {
-            if (years) *years = statute_rules[i].years;
-            if (months) *months = statute_rules[i].months;
-            if (days) *days = statute_rules[i].days;
-            return REGISLEX_OK;
+        regislex_statute_rule_t* r = (regislex_statute_rule_t*)platform_calloc(1, sizeof(regislex_statute_rule_t));
+        if (!r) {
+            err = REGISLEX_ERROR_OUT_OF_MEMORY;
+            break;
         }
+        statute_from_row(stmt, r);
+        items[n++] = r;
+    }
+
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        regislex_statute_rule_list_free(items, n);
+        return err;
+    }
+
+    *rules = items;
+    *count = n;
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_statute_calculate(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* rule_id,
+    const regislex_datetime_t* accrual_date,
+    regislex_datetime_t* out_expiration)
+{
+    if (!ctx || !rule_id || !accrual_date || !out_expiration) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
+    if (!regislex_datetime_is_valid_date(accrual_date)) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(ctx),
+        "SELECT " STATUTE_COLUMNS " FROM statute_rules WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+    regislex_db_bind_uuid(stmt, 1, rule_id);
+
+    regislex_statute_rule_t rule;
+    memset(&rule, 0, sizeof(rule));
+    err = regislex_db_step(stmt);
+    if (err == REGISLEX_OK) {
+        statute_from_row(stmt, &rule);
+    }
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    statute_variant_t v;
+    variant_from_rule(&rule, &v);
 
-    return REGISLEX_ERROR_NOT_FOUND;
+    *out_expiration = *accrual_date;
+    regislex_datetime_from_days(
+        variant_expiry(&v, regislex_datetime_to_days(accrual_date), false, 0, 0), out_expiration);
+    return REGISLEX_OK;
 }
 
-int regislex_sol_days_remaining(const char* claim_type,
-                                 const char* jurisdiction,
-                                 const regislex_datetime_t* incident_date) {
-    regislex_datetime_t deadline;
-    if (regislex_sol_calculate(claim_type, jurisdiction, incident_date, &deadline) != REGISLEX_OK) {
-        return -1;
+/* ============================================================================
+ * Claim Functions
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_statute_claim_set(
+    regislex_context_t* ctx,
+    const regislex_statute_claim_t* claim)
+{
+    if (!ctx || !claim) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (claim->claim_type[0] == '\0' || claim->tolled_days < 0 ||
+        !regislex_datetime_is_valid_date(&claim->accrual_date)) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(ctx),
+        "INSERT INTO case_claims (case_id, claim_type, jurisdiction, accrual_day, discovery_day, tolled_days)"
+        " VALUES (?, ?, ?, ?, ?, ?)"
+        " ON CONFLICT (case_id, claim_type) DO UPDATE SET jurisdiction = excluded.jurisdiction,"
+        "  accrual_day = excluded.accrual_day, discovery_day = excluded.discovery_day,"
+        "  tolled_days = excluded.tolled_days", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+
+    int idx = 1;
+    regislex_db_bind_uuid(stmt, idx++, &claim->case_id);
+    regislex_db_bind_text(stmt, idx++, claim->claim_type);
+    regislex_db_bind_text(stmt, idx++, claim->jurisdiction);
+    regislex_db_bind_int(stmt, idx++, regislex_datetime_to_days(&claim->accrual_date));
+    if (regislex_datetime_is_valid_date(&claim->discovery_date)) {
+        regislex_db_bind_int(stmt, idx++, regislex_datetime_to_days(&claim->discovery_date));
+    } else {
+        regislex_db_bind_null(stmt, idx++);
     }
+    regislex_db_bind_int(stmt, idx++, claim->tolled_days);
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_statute_claim_delete(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* case_id,
+    const char* claim_type)
+{
+    if (!ctx || !case_id || !claim_type) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "DELETE FROM case_claims WHERE case_id = ? AND claim_type = ?", &stmt);
+    if (err != REGISLEX_OK) {
+        return err;
+    }
+    regislex_db_bind_uuid(stmt, 1, case_id);
+    regislex_db_bind_text(stmt, 2, claim_type);
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+    return regislex_db_changes(db) > 0 ? REGISLEX_OK : REGISLEX_ERROR_NOT_FOUND;
+}
+
+REGISLEX_API regislex_error_t regislex_statute_evaluate(
+    regislex_context_t* ctx,
+    const regislex_statute_claim_t* claim,
+    regislex_datetime_t* out_expiration,
+    regislex_uuid_t* out_rule_id)
+{
+    if (!ctx || !claim || !out_expiration) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!regislex_datetime_is_valid_date(&claim->accrual_date)) {
+        return REGISLEX_ERROR_VALIDATION;
+    }
+
+    statute_index_t* idx = index_acquire();
+    if (!idx) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    int64_t accrual_day = regislex_datetime_to_days(&claim->accrual_date);
+    bool has_discovery = regislex_datetime_is_valid_date(&claim->discovery_date);
+    int64_t discovery_day = has_discovery ? regislex_datetime_to_days(&claim->discovery_date) : 0;
+
+    const statute_variant_t* v = index_lookup(idx, claim->claim_type, claim->jurisdiction,
+                                              accrual_day, has_discovery);
+    regislex_error_t err = REGISLEX_ERROR_NOT_FOUND;
+    if (v) {
+        memset(out_expiration, 0, sizeof(*out_expiration));
+        regislex_datetime_from_days(
+            variant_expiry(v, accrual_day, has_discovery, discovery_day, claim->tolled_days),
+            out_expiration);
+        if (out_rule_id) memcpy(out_rule_id, &v->id, sizeof(regislex_uuid_t));
+        err = REGISLEX_OK;
+    }
+
+    index_release(idx);
+    return err;
+}
+
+/* ============================================================================
+ * Portfolio Sweep
+ * ============================================================================ */
+
+static int exposure_compare(const void* a, const void* b) {
+    const regislex_statute_exposure_t* x = (const regislex_statute_exposure_t*)a;
+    const regislex_statute_exposure_t* y = (const regislex_statute_exposure_t*)b;
+    if (x->days_remaining != y->days_remaining) {
+        return x->days_remaining < y->days_remaining ? -1 : 1;
+    }
+    int c = strcmp(x->case_id.value, y->case_id.value);
+    return c != 0 ? c : strcmp(x->claim_type, y->claim_type);
+}
+
+REGISLEX_API regislex_error_t regislex_statute_sweep(
+    regislex_context_t* ctx,
+    int days_ahead,
+    regislex_statute_exposure_t** exposures,
+    int* count)
+{
+    if (!ctx || !exposures || !count || days_ahead < 0) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    *exposures = NULL;
+    *count = 0;
+
+    statute_index_t* idx = index_acquire();
+    if (!idx) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    /* One pass over the integer-dated claim projection; a case whose
+     * complaint is filed has stopped the clock. */
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(ctx),
+        "SELECT cc.case_id, cc.claim_type, cc.jurisdiction, cc.accrual_day,"
+        " cc.discovery_day, cc.tolled_days"
+        " FROM case_claims cc JOIN cases c ON c.id = cc.case_id"
+        " WHERE c.status < ? AND c.filed_date IS NULL", &stmt);
+    if (err != REGISLEX_OK) {
+        index_release(idx);
+        return err;
+    }
+    regislex_db_bind_int(stmt, 1, REGISLEX_STATUS_COMPLETED);
 
     regislex_datetime_t now;
     regislex_datetime_now(&now);
+    int64_t today = regislex_datetime_to_days(&now);
+    int64_t limit = today + days_ahead;
+
+    regislex_statute_exposure_t* items = NULL;
+    int n = 0;
+    int capacity = 0;
+
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        const char* claim_type = regislex_db_column_text(stmt, 1);
+        const char* jurisdiction = regislex_db_column_text(stmt, 2);
+        int64_t accrual_day = regislex_db_column_int(stmt, 3);
+        bool has_discovery = !regislex_db_column_is_null(stmt, 4);
+        int64_t discovery_day = regislex_db_column_int(stmt, 4);
+        int tolled_days = (int)regislex_db_column_int(stmt, 5);
+
+        const statute_variant_t* v = index_lookup(idx, claim_type ? claim_type : "",
+                                                  jurisdiction ? jurisdiction : "",
+                                                  accrual_day, has_discovery);
+        if (!v) continue;
+
+        int64_t expiry = variant_expiry(v, accrual_day, has_discovery, discovery_day, tolled_days);
+        if (expiry > limit) continue;
+
+        if (n >= capacity) {
+            int new_capacity = capacity ? capacity * 2 : 64;
+            regislex_statute_exposure_t* grown = (regislex_statute_exposure_t*)platform_realloc(
+                items, (size_t)new_capacity * sizeof(regislex_statute_exposure_t));
+            if (!grown) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            items = grown;
+            capacity = new_capacity;
+        }
+
+        regislex_statute_exposure_t* e = &items[n++];
+        memset(e, 0, sizeof(*e));
+        regislex_db_column_uuid(stmt, 0, &e->case_id);
+        if (claim_type) strncpy(e->claim_type, claim_type, sizeof(e->claim_type) - 1);
+        memcpy(&e->rule_id, &v->id, sizeof(regislex_uuid_t));
+        regislex_datetime_from_days(expiry, &e->expiration);
+        e->days_remaining = (int)(expiry - today);
+    }
+
+    regislex_db_finalize(stmt);
+    index_release(idx);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        platform_free(items);
+        return err;
+    }
+
+    if (n > 1) {
+        qsort(items, (size_t)n, sizeof(regislex_statute_exposure_t), exposure_compare);
+    }
+
+    *exposures = items;
+    *count = n;
+    return REGISLEX_OK;
+}
+
+/* ============================================================================
+ * Cleanup
+ * ============================================================================ */
+
+REGISLEX_API void regislex_statute_rule_free(regislex_statute_rule_t* rule) {
+    if (rule) {
+        platform_free(rule);
+    }
+}
+
+REGISLEX_API void regislex_statute_rule_list_free(regislex_statute_rule_t** rules, int count) {
+    if (!rules) return;
+    for (int i = 0; i < count; i++) {
+        regislex_statute_rule_free(rules[i]);
+    }
+    platform_free(rules);
+}
 
-    return regislex_datetime_diff_days(&now, &deadline);
+REGISLEX_API void regislex_statute_exposures_free(regislex_statute_exposure_t* exposures) {
+    platform_free(exposures);
 }
@@ -4,9 +4,79 @@
  */
 
 #include "regislex/regislex.h"
+#include "database/database.h"
 #include "platform/platform.h"
+#include <stdio.h>
 #include <string.h>
 
+/* ============================================================================
+ * Internal Helper Functions
+ * ============================================================================ */
+
+regislex_error_t regislex_document_from_row(regislex_db_stmt_t* stmt,
+                                            regislex_document_t* doc) {
+    if (!stmt || !doc) return REGISLEX_ERROR_INVALID_ARGUMENT;
+
+    int col = 0;
+
+    regislex_db_column_uuid(stmt, col++, &doc->id);
+    regislex_db_column_uuid(stmt, col++, &doc->case_id);
+    regislex_db_column_uuid(stmt, col++, &doc->matter_id);
+    regislex_db_column_uuid(stmt, col++, &doc->folder_id);
+
+    const char* name = regislex_db_column_text(stmt, col++);
+    if (name) strncpy(doc->name, name, sizeof(doc->name) - 1);
+
+    const char* display_name = regislex_db_column_text(stmt, col++);
+    if (display_name) strncpy(doc->display_name, display_name, sizeof(doc->display_name) - 1);
+
+    const char* description = regislex_db_column_text(stmt, col++);
+    if (description) strncpy(doc->description, description, sizeof(doc->description) - 1);
+
+    doc->type = (regislex_doc_type_t)regislex_db_column_int(stmt, col++);
+    doc->status = (regislex_doc_status_t)regislex_db_column_int(stmt, col++);
+    doc->access_level = (regislex_access_level_t)regislex_db_column_int(stmt, col++);
+    doc->current_version = (int)regislex_db_column_int(stmt, col++);
+
+    const char* file_name = regislex_db_column_text(stmt, col++);
+    if (file_name) strncpy(doc->file_name, file_name, sizeof(doc->file_name) - 1);
+
+    const char* mime_type = regislex_db_column_text(stmt, col++);
+    if (mime_type) strncpy(doc->mime_type, mime_type, sizeof(doc->mime_type) - 1);
+
+    doc->file_size = (size_t)regislex_db_column_int(stmt, col++);
+
+    const char* storage_path = regislex_db_column_text(stmt, col++);
+    if (storage_path) strncpy(doc->storage_path, storage_path, sizeof(doc->storage_path) - 1);
+
+    const char* checksum = regislex_db_column_text(stmt, col++);
+    if (checksum) strncpy(doc->checksum, checksum, sizeof(doc->checksum) - 1);
+
+    const char* tags = regislex_db_column_text(stmt, col++);
+    if (tags) strncpy(doc->tags, tags, sizeof(doc->tags) - 1);
+
+    const char* bates = regislex_db_column_text(stmt, col++);
+    if (bates) strncpy(doc->bates_number, bates, sizeof(doc->bates_number) - 1);
+
+    const char* exhibit = regislex_db_column_text(stmt, col++);
+    if (exhibit) strncpy(doc->exhibit_number, exhibit, sizeof(doc->exhibit_number) - 1);
+
+    regislex_db_column_datetime(stmt, col++, &doc->filed_date);
+
+    doc->is_locked = regislex_db_column_int(stmt, col++) != 0;
+    regislex_db_column_uuid(stmt, col++, &doc->locked_by);
+    regislex_db_column_datetime(stmt, col++, &doc->locked_at);
+    doc->is_encrypted = regislex_db_column_int(stmt, col++) != 0;
+    doc->ocr_processed = regislex_db_column_int(stmt, col++) != 0;
+
+    regislex_db_column_datetime(stmt, col++, &doc->created_at);
+    regislex_db_column_datetime(stmt, col++, &doc->updated_at);
+    regislex_db_column_uuid(stmt, col++, &doc->created_by);
+    regislex_db_column_uuid(stmt, col++, &doc->updated_by);
+
+    return REGISLEX_OK;
+}
+
 /* ============================================================================
  * Document Functions
  * ============================================================================ */
@@ -17,7 +87,7 @@ regislex_error_t regislex_document_create(
     const char* file_path,
     regislex_document_t** out_document
 ) {
-    (void)ctx; (void)file_path;
+    (void)file_path;
     if (!document || !out_document) return REGISLEX_ERROR_INVALID_ARGUMENT;
 
     *out_document = (regislex_document_t*)platform_calloc(1, sizeof(regislex_document_t));
@@ -29,6 +99,15 @@ regislex_error_t regislex_document_create(
     (*out_document)->updated_at = (*out_document)->created_at;
     (*out_document)->current_version = 1;
 
+    /* Let trigger-driven workflows react to the upload */
+    regislex_event_t event;
+    memset(&event, 0, sizeof(event));
+    event.type = REGISLEX_EVENT_DOCUMENT_UPLOADED;
+    memcpy(&event.case_id, &(*out_document)->case_id, sizeof(regislex_uuid_t));
+    memcpy(&event.subject_id, &(*out_document)->id, sizeof(regislex_uuid_t));
+    snprintf(event.data, sizeof(event.data), "{\"type\":%d}", (*out_document)->type);
+    if (ctx) regislex_event_publish(ctx, &event);
+
     return REGISLEX_OK;
 }
 
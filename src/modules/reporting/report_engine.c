@@ -311,6 +311,39 @@ void regislex_dashboard_free(regislex_dashboard_t* dashboard) {
  * Scheduled Report Functions
  * ============================================================================ */
 
+/*
+ * Scheduled reports are not stored yet, so the cron scheduler's copy is
+ * the only record of a schedule; it lasts until shutdown.
+ */
+static regislex_error_t scheduled_report_cron(const regislex_scheduled_report_t* scheduled,
+                                              regislex_cron_t* cron, int* period) {
+    const char* expr = NULL;
+    *period = 1;
+
+    switch (scheduled->frequency) {
+        case REGISLEX_SCHEDULE_DAILY:     expr = "@daily"; break;
+        case REGISLEX_SCHEDULE_WEEKLY:    expr = "@weekly"; break;
+        case REGISLEX_SCHEDULE_BIWEEKLY:  expr = "@weekly"; *period = 2; break;
+        case REGISLEX_SCHEDULE_MONTHLY:   expr = "@monthly"; break;
+        case REGISLEX_SCHEDULE_QUARTERLY: expr = "0 0 1 1,4,7,10 *"; break;
+        case REGISLEX_SCHEDULE_YEARLY:    expr = "@yearly"; break;
+        case REGISLEX_SCHEDULE_CUSTOM:    expr = scheduled->cron_expression; break;
+        default:                          return REGISLEX_ERROR_NOT_FOUND;
+    }
+    return regislex_cron_compile(expr, cron) == REGISLEX_OK
+        ? REGISLEX_OK : REGISLEX_ERROR_INVALID_ARGUMENT;
+}
+
+static void scheduled_report_set_next_run(regislex_scheduled_report_t* scheduled,
+                                          const regislex_cron_t* cron, int period) {
+    int64_t next_ms = platform_time_ms();
+    for (int i = 0; i < period; i++) {
+        if (regislex_cron_next(cron, next_ms, &next_ms) != REGISLEX_OK) return;
+    }
+
+    regislex_datetime_from_seconds(next_ms / 1000, &scheduled->next_run);
+}
+
 regislex_error_t regislex_scheduled_report_create(
     regislex_context_t* ctx,
     const regislex_scheduled_report_t* scheduled,
@@ -319,6 +352,11 @@ regislex_error_t regislex_scheduled_report_create(
     (void)ctx;
     if (!scheduled || !out_scheduled) return REGISLEX_ERROR_INVALID_ARGUMENT;
 
+    regislex_cron_t cron;
+    int period;
+    regislex_error_t err = scheduled_report_cron(scheduled, &cron, &period);
+    if (err == REGISLEX_ERROR_INVALID_ARGUMENT) return err;
+
     *out_scheduled = (regislex_scheduled_report_t*)platform_calloc(1, sizeof(regislex_scheduled_report_t));
     if (!*out_scheduled) return REGISLEX_ERROR_OUT_OF_MEMORY;
 
@@ -326,6 +364,13 @@ regislex_error_t regislex_scheduled_report_create(
     regislex_uuid_generate(&(*out_scheduled)->id);
     regislex_datetime_now(&(*out_scheduled)->created_at);
 
+    if (err == REGISLEX_OK) {
+        scheduled_report_set_next_run(*out_scheduled, &cron, period);
+        if (scheduled->is_active) {
+            regislex_cron_scheduler_set_report(&(*out_scheduled)->id, &cron, period);
+        }
+    }
+
     return REGISLEX_OK;
 }
 
@@ -333,16 +378,28 @@ regislex_error_t regislex_scheduled_report_update(
     regislex_context_t* ctx,
     const regislex_scheduled_report_t* scheduled
 ) {
-    (void)ctx; (void)scheduled;
-    return REGISLEX_ERROR_NOT_FOUND;
+    (void)ctx;
+    if (!scheduled) return REGISLEX_ERROR_INVALID_ARGUMENT;
+
+    regislex_cron_t cron;
+    int period;
+    regislex_error_t err = scheduled_report_cron(scheduled, &cron, &period);
+    if (err == REGISLEX_ERROR_INVALID_ARGUMENT) return err;
+
+    if (err == REGISLEX_OK && scheduled->is_active) {
+        err = regislex_cron_scheduler_set_report(&scheduled->id, &cron, period);
+        return err == REGISLEX_ERROR_NOT_INITIALIZED ? REGISLEX_ERROR_NOT_FOUND : err;
+    }
+    return regislex_cron_scheduler_remove_report(&scheduled->id);
 }
 
 regislex_error_t regislex_scheduled_report_delete(
     regislex_context_t* ctx,
     const regislex_uuid_t* id
 ) {
-    (void)ctx; (void)id;
-    return REGISLEX_ERROR_NOT_FOUND;
+    (void)ctx;
+    if (!id) return REGISLEX_ERROR_INVALID_ARGUMENT;
+    return regislex_cron_scheduler_remove_report(id);
 }
 
 regislex_error_t regislex_scheduled_report_list(
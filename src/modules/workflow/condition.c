@@ -0,0 +1,550 @@
+/**
+ * @file condition.c
+ * @brief Workflow Condition Expressions
+ *
+ * Conditions are compiled once into bytecode for a small stack machine.
+ * Field names are resolved to environment slots and constant names to
+ * their values at compile time, and operand types are checked then too,
+ * so evaluation is a single pass over the code with a fixed-size stack
+ * and no allocation, lookups or type errors.
+ *
+ * && and || compile to conditional jumps, so the right-hand side is only
+ * evaluated when it can change the result.
+ */
+
+#include "regislex/regislex.h"
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define COND_CASE_FIELDS \
+    ((1u << REGISLEX_COND_FIELD_CASE_PRIORITY) | (1u << REGISLEX_COND_FIELD_CASE_STATUS) | \
+     (1u << REGISLEX_COND_FIELD_CASE_TYPE) | (1u << REGISLEX_COND_FIELD_CASE_NUMBER))
+
+#define COND_DEADLINE_FIELDS \
+    ((1u << REGISLEX_COND_FIELD_DEADLINE_DAYS_LEFT) | (1u << REGISLEX_COND_FIELD_DEADLINE_PRIORITY) | \
+     (1u << REGISLEX_COND_FIELD_DEADLINE_STATUS))
+
+#define COND_EVENT_FIELDS \
+    ((1u << REGISLEX_COND_FIELD_EVENT_TYPE) | (1u << REGISLEX_COND_FIELD_EVENT_NAME))
+
+/* ============================================================================
+ * Instruction Set
+ * ============================================================================ */
+
+typedef enum {
+    OP_END = 0,
+    OP_PUSH_NUMBER,     /* index: push numbers[index] */
+    OP_PUSH_TEXT,       /* offset (2 bytes): push text + offset */
+    OP_LOAD,            /* field: push the field's value */
+    OP_EQ,
+    OP_NE,
+    OP_LT,
+    OP_LE,
+    OP_GT,
+    OP_GE,
+    OP_TEXT_EQ,
+    OP_TEXT_NE,
+    OP_NOT,
+    OP_JUMP_FALSE,      /* target (2 bytes): jump if the top is false, else pop it */
+    OP_JUMP_TRUE        /* target (2 bytes): jump if the top is true, else pop it */
+} cond_op_t;
+
+typedef enum {
+    TYPE_NUMBER,
+    TYPE_TEXT,
+    TYPE_BOOL
+} cond_type_t;
+
+typedef struct {
+    const char* name;
+    regislex_cond_field_t field;
+    cond_type_t type;
+} cond_field_def_t;
+
+static const cond_field_def_t COND_FIELDS[] = {
+    { "case.priority",      REGISLEX_COND_FIELD_CASE_PRIORITY,      TYPE_NUMBER },
+    { "case.status",        REGISLEX_COND_FIELD_CASE_STATUS,        TYPE_NUMBER },
+    { "case.type",          REGISLEX_COND_FIELD_CASE_TYPE,          TYPE_NUMBER },
+    { "case.number",        REGISLEX_COND_FIELD_CASE_NUMBER,        TYPE_TEXT },
+    { "deadline.days_left", REGISLEX_COND_FIELD_DEADLINE_DAYS_LEFT, TYPE_NUMBER },
+    { "deadline.priority",  REGISLEX_COND_FIELD_DEADLINE_PRIORITY,  TYPE_NUMBER },
+    { "deadline.status",    REGISLEX_COND_FIELD_DEADLINE_STATUS,    TYPE_NUMBER },
+    { "event.type",         REGISLEX_COND_FIELD_EVENT_TYPE,         TYPE_NUMBER },
+    { "event.name",         REGISLEX_COND_FIELD_EVENT_NAME,         TYPE_TEXT }
+};
+
+typedef struct {
+    const char* name;
+    int value;
+} cond_constant_t;
+
+static const cond_constant_t COND_CONSTANTS[] = {
+    /* regislex_priority_t */
+    { "LOW", REGISLEX_PRIORITY_LOW },
+    { "NORMAL", REGISLEX_PRIORITY_NORMAL },
+    { "HIGH", REGISLEX_PRIORITY_HIGH },
+    { "URGENT", REGISLEX_PRIORITY_URGENT },
+    { "CRITICAL", REGISLEX_PRIORITY_CRITICAL },
+
+    /* regislex_status_t */
+    { "DRAFT", REGISLEX_STATUS_DRAFT },
+    { "ACTIVE", REGISLEX_STATUS_ACTIVE },
+    { "PENDING", REGISLEX_STATUS_PENDING },
+    { "ON_HOLD", REGISLEX_STATUS_ON_HOLD },
+    { "COMPLETED", REGISLEX_STATUS_COMPLETED },
+    { "CLOSED", REGISLEX_STATUS_CLOSED },
+    { "ARCHIVED", REGISLEX_STATUS_ARCHIVED },
+    { "CANCELLED", REGISLEX_STATUS_CANCELLED },
+
+    /* regislex_case_type_t */
+    { "CIVIL", REGISLEX_CASE_TYPE_CIVIL },
+    { "CRIMINAL", REGISLEX_CASE_TYPE_CRIMINAL },
+    { "ADMINISTRATIVE", REGISLEX_CASE_TYPE_ADMINISTRATIVE },
+    { "REGULATORY", REGISLEX_CASE_TYPE_REGULATORY },
+    { "APPELLATE", REGISLEX_CASE_TYPE_APPELLATE },
+    { "BANKRUPTCY", REGISLEX_CASE_TYPE_BANKRUPTCY },
+    { "FAMILY", REGISLEX_CASE_TYPE_FAMILY },
+    { "PROBATE", REGISLEX_CASE_TYPE_PROBATE },
+    { "TAX", REGISLEX_CASE_TYPE_TAX },
+    { "IMMIGRATION", REGISLEX_CASE_TYPE_IMMIGRATION },
+    { "INTELLECTUAL_PROPERTY", REGISLEX_CASE_TYPE_INTELLECTUAL_PROPERTY },
+    { "EMPLOYMENT", REGISLEX_CASE_TYPE_EMPLOYMENT },
+    { "ENVIRONMENTAL", REGISLEX_CASE_TYPE_ENVIRONMENTAL },
+    { "CONTRACT", REGISLEX_CASE_TYPE_CONTRACT },
+    { "TORT", REGISLEX_CASE_TYPE_TORT },
+    { "OTHER", REGISLEX_CASE_TYPE_OTHER },
+
+    /* regislex_event_type_t */
+    { "CASE_CREATED", REGISLEX_EVENT_CASE_CREATED },
+    { "CASE_UPDATED", REGISLEX_EVENT_CASE_UPDATED },
+    { "CASE_STATUS_CHANGED", REGISLEX_EVENT_CASE_STATUS_CHANGED },
+    { "CASE_ASSIGNED", REGISLEX_EVENT_CASE_ASSIGNED },
+    { "DEADLINE_APPROACHING", REGISLEX_EVENT_DEADLINE_APPROACHING },
+    { "DEADLINE_PASSED", REGISLEX_EVENT_DEADLINE_PASSED },
+    { "DOCUMENT_UPLOADED", REGISLEX_EVENT_DOCUMENT_UPLOADED },
+    { "DOCUMENT_SIGNED", REGISLEX_EVENT_DOCUMENT_SIGNED },
+    { "PARTY_ADDED", REGISLEX_EVENT_PARTY_ADDED },
+    { "PAYMENT_RECEIVED", REGISLEX_EVENT_PAYMENT_RECEIVED },
+    { "TASK_COMPLETED", REGISLEX_EVENT_TASK_COMPLETED },
+    { "CUSTOM", REGISLEX_EVENT_CUSTOM }
+};
+
+/* ============================================================================
+ * Compiler
+ * ============================================================================ */
+
+typedef struct {
+    const char* p;
+    regislex_cond_program_t* program;
+    int depth;              /* Stack depth at this point of the code */
+    int nesting;            /* Open parentheses and negations */
+    bool failed;
+} cond_compiler_t;
+
+static void skip_space(cond_compiler_t* c) {
+    while (isspace((unsigned char)*c->p)) c->p++;
+}
+
+static bool accept(cond_compiler_t* c, const char* token) {
+    skip_space(c);
+    size_t len = strlen(token);
+    if (strncmp(c->p, token, len) != 0) return false;
+    c->p += len;
+    return true;
+}
+
+static void emit(cond_compiler_t* c, int byte) {
+    if (c->program->length >= REGISLEX_COND_MAX_CODE) {
+        c->failed = true;
+        return;
+    }
+    c->program->code[c->program->length++] = (uint8_t)byte;
+}
+
+static void emit_u16(cond_compiler_t* c, int value) {
+    emit(c, value >> 8);
+    emit(c, value & 0xff);
+}
+
+static void push(cond_compiler_t* c) {
+    if (++c->depth > REGISLEX_COND_MAX_STACK) c->failed = true;
+}
+
+static void emit_number(cond_compiler_t* c, int64_t value) {
+    regislex_cond_program_t* program = c->program;
+    if (program->number_count >= REGISLEX_COND_MAX_NUMBERS) {
+        c->failed = true;
+        return;
+    }
+    program->numbers[program->number_count] = value;
+    emit(c, OP_PUSH_NUMBER);
+    emit(c, program->number_count++);
+    push(c);
+}
+
+/* Emits a jump with its target left open; returns where to patch it */
+static int emit_jump(cond_compiler_t* c, cond_op_t op) {
+    emit(c, op);
+    int at = c->program->length;
+    emit_u16(c, 0);
+    return at;
+}
+
+static void patch_jump(cond_compiler_t* c, int at) {
+    if (c->failed) return;
+    c->program->code[at] = (uint8_t)(c->program->length >> 8);
+    c->program->code[at + 1] = (uint8_t)(c->program->length & 0xff);
+}
+
+static cond_type_t parse_or(cond_compiler_t* c);
+
+static cond_type_t parse_text(cond_compiler_t* c) {
+    char quote = *c->p++;
+    const char* start = c->p;
+    while (*c->p && *c->p != quote) c->p++;
+    if (*c->p != quote) {
+        c->failed = true;
+        return TYPE_TEXT;
+    }
+
+    regislex_cond_program_t* program = c->program;
+    size_t len = (size_t)(c->p - start);
+    c->p++;
+    if ((size_t)program->text_used + len + 1 > sizeof(program->text)) {
+        c->failed = true;
+        return TYPE_TEXT;
+    }
+
+    memcpy(program->text + program->text_used, start, len);
+    program->text[program->text_used + len] = '\0';
+    emit(c, OP_PUSH_TEXT);
+    emit_u16(c, program->text_used);
+    program->text_used += (int)len + 1;
+    push(c);
+    return TYPE_TEXT;
+}
+
+static cond_type_t parse_name(cond_compiler_t* c) {
+    const char* start = c->p;
+    while (isalnum((unsigned char)*c->p) || *c->p == '_' || *c->p == '.') c->p++;
+    size_t len = (size_t)(c->p - start);
+
+    if (len == 4 && strncmp(start, "true", 4) == 0) {
+        emit_number(c, 1);
+        return TYPE_BOOL;
+    }
+    if (len == 5 && strncmp(start, "false", 5) == 0) {
+        emit_number(c, 0);
+        return TYPE_BOOL;
+    }
+
+    for (size_t i = 0; i < sizeof(COND_FIELDS) / sizeof(COND_FIELDS[0]); i++) {
+        if (strlen(COND_FIELDS[i].name) == len && strncmp(COND_FIELDS[i].name, start, len) == 0) {
+            emit(c, OP_LOAD);
+            emit(c, COND_FIELDS[i].field);
+            c->program->fields |= 1u << COND_FIELDS[i].field;
+            push(c);
+            return COND_FIELDS[i].type;
+        }
+    }
+
+    for (size_t i = 0; i < sizeof(COND_CONSTANTS) / sizeof(COND_CONSTANTS[0]); i++) {
+        if (strlen(COND_CONSTANTS[i].name) == len && strncmp(COND_CONSTANTS[i].name, start, len) == 0) {
+            emit_number(c, COND_CONSTANTS[i].value);
+            return TYPE_NUMBER;
+        }
+    }
+
+    c->failed = true;
+    return TYPE_NUMBER;
+}
+
+static cond_type_t parse_operand(cond_compiler_t* c) {
+    skip_space(c);
+
+    if (*c->p == '(') {
+        if (++c->nesting > REGISLEX_COND_MAX_STACK) {
+            c->failed = true;
+            return TYPE_BOOL;
+        }
+        c->p++;
+        cond_type_t type = parse_or(c);
+        if (!accept(c, ")")) c->failed = true;
+        c->nesting--;
+        return type;
+    }
+    if (*c->p == '"' || *c->p == '\'') {
+        return parse_text(c);
+    }
+    if (isdigit((unsigned char)*c->p) || (*c->p == '-' && isdigit((unsigned char)c->p[1]))) {
+        char* end = NULL;
+        long long value = strtoll(c->p, &end, 10);
+        c->p = end;
+        emit_number(c, value);
+        return TYPE_NUMBER;
+    }
+    if (isalpha((unsigned char)*c->p) || *c->p == '_') {
+        return parse_name(c);
+    }
+
+    c->failed = true;
+    return TYPE_NUMBER;
+}
+
+static cond_type_t parse_comparison(cond_compiler_t* c) {
+    cond_type_t left = parse_operand(c);
+
+    /* Longer operators first, so "<=" is not read as "<" */
+    static const struct { const char* token; cond_op_t op; } OPERATORS[] = {
+        { "==", OP_EQ }, { "!=", OP_NE }, { "<=", OP_LE },
+        { ">=", OP_GE }, { "<", OP_LT }, { ">", OP_GT }
+    };
+
+    cond_op_t op = OP_END;
+    for (size_t i = 0; i < sizeof(OPERATORS) / sizeof(OPERATORS[0]); i++) {
+        if (accept(c, OPERATORS[i].token)) {
+            op = OPERATORS[i].op;
+            break;
+        }
+    }
+    if (op == OP_END) return left;
+
+    cond_type_t right = parse_operand(c);
+    bool equality = op == OP_EQ || op == OP_NE;
+    if (left != right || (left != TYPE_NUMBER && !equality)) {
+        c->failed = true;
+    } else if (left == TYPE_TEXT) {
+        op = op == OP_EQ ? OP_TEXT_EQ : OP_TEXT_NE;
+    }
+
+    emit(c, op);
+    c->depth--;
+    return TYPE_BOOL;
+}
+
+static cond_type_t parse_not(cond_compiler_t* c) {
+    skip_space(c);
+    if (c->p[0] == '!' && c->p[1] != '=') {
+        if (++c->nesting > REGISLEX_COND_MAX_STACK) {
+            c->failed = true;
+            return TYPE_BOOL;
+        }
+        c->p++;
+        if (parse_not(c) != TYPE_BOOL) c->failed = true;
+        emit(c, OP_NOT);
+        c->nesting--;
+        return TYPE_BOOL;
+    }
+    return parse_comparison(c);
+}
+
+static cond_type_t parse_and(cond_compiler_t* c) {
+    cond_type_t type = parse_not(c);
+    while (accept(c, "&&")) {
+        if (type != TYPE_BOOL) c->failed = true;
+        int jump = emit_jump(c, OP_JUMP_FALSE);
+        c->depth--;
+        type = parse_not(c);
+        if (type != TYPE_BOOL) c->failed = true;
+        patch_jump(c, jump);
+    }
+    return type;
+}
+
+static cond_type_t parse_or(cond_compiler_t* c) {
+    cond_type_t type = parse_and(c);
+    while (accept(c, "||")) {
+        if (type != TYPE_BOOL) c->failed = true;
+        int jump = emit_jump(c, OP_JUMP_TRUE);
+        c->depth--;
+        type = parse_and(c);
+        if (type != TYPE_BOOL) c->failed = true;
+        patch_jump(c, jump);
+    }
+    return type;
+}
+
+/* ============================================================================
+ * Virtual Machine
+ * ============================================================================ */
+
+typedef struct {
+    int64_t number;
+    const char* text;
+    bool missing;       /* Field without a value */
+} cond_value_t;
+
+/* ============================================================================
+ * Condition Expression Functions
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_cond_compile(const char* source, regislex_cond_program_t* out) {
+    if (!source || !out) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    memset(out, 0, sizeof(*out));
+    cond_compiler_t c;
+    memset(&c, 0, sizeof(c));
+    c.p = source;
+    c.program = out;
+
+    cond_type_t type = parse_or(&c);
+    skip_space(&c);
+    emit(&c, OP_END);
+
+    if (c.failed || type != TYPE_BOOL || *c.p) {
+        memset(out, 0, sizeof(*out));
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    return REGISLEX_OK;
+}
+
+REGISLEX_API bool regislex_cond_eval(const regislex_cond_program_t* program, const regislex_cond_env_t* env) {
+    if (!program || !env || program->length == 0) return false;
+
+    cond_value_t stack[REGISLEX_COND_MAX_STACK];
+    int sp = 0;
+    const uint8_t* code = program->code;
+    int pc = 0;
+
+    for (;;) {
+        cond_op_t op = (cond_op_t)code[pc++];
+        switch (op) {
+            case OP_END:
+                return sp > 0 && stack[sp - 1].number != 0;
+
+            case OP_PUSH_NUMBER:
+                stack[sp].number = program->numbers[code[pc++]];
+                stack[sp].text = NULL;
+                stack[sp].missing = false;
+                sp++;
+                break;
+
+            case OP_PUSH_TEXT:
+                stack[sp].number = 0;
+                stack[sp].text = program->text + ((code[pc] << 8) | code[pc + 1]);
+                stack[sp].missing = false;
+                pc += 2;
+                sp++;
+                break;
+
+            case OP_LOAD: {
+                int field = code[pc++];
+                stack[sp].number = env->numbers[field];
+                stack[sp].text = env->texts[field] ? env->texts[field] : "";
+                stack[sp].missing = !((env->present >> field) & 1);
+                sp++;
+                break;
+            }
+
+            case OP_EQ:
+            case OP_NE:
+            case OP_LT:
+            case OP_LE:
+            case OP_GT:
+            case OP_GE:
+            case OP_TEXT_EQ:
+            case OP_TEXT_NE: {
+                cond_value_t* a = &stack[sp - 2];
+                const cond_value_t* b = &stack[sp - 1];
+                bool result = false;
+                if (!a->missing && !b->missing) {
+                    switch (op) {
+                        case OP_EQ:      result = a->number == b->number; break;
+                        case OP_NE:      result = a->number != b->number; break;
+                        case OP_LT:      result = a->number < b->number; break;
+                        case OP_LE:      result = a->number <= b->number; break;
+                        case OP_GT:      result = a->number > b->number; break;
+                        case OP_GE:      result = a->number >= b->number; break;
+                        case OP_TEXT_EQ: result = strcmp(a->text, b->text) == 0; break;
+                        default:         result = strcmp(a->text, b->text) != 0; break;
+                    }
+                }
+                a->number = result;
+                a->missing = false;
+                sp--;
+                break;
+            }
+
+            case OP_NOT:
+                stack[sp - 1].number = !stack[sp - 1].number;
+                break;
+
+            case OP_JUMP_FALSE:
+            case OP_JUMP_TRUE: {
+                bool value = stack[sp - 1].number != 0;
+                if (value == (op == OP_JUMP_TRUE)) {
+                    pc = (code[pc] << 8) | code[pc + 1];
+                } else {
+                    pc += 2;
+                    sp--;
+                }
+                break;
+            }
+
+            default:
+                return false;
+        }
+    }
+}
+
+REGISLEX_API regislex_error_t regislex_cond_env_load(
+    regislex_context_t* ctx,
+    uint32_t fields,
+    const regislex_uuid_t* case_id,
+    const regislex_uuid_t* deadline_id,
+    const regislex_event_t* event,
+    regislex_cond_env_t* env)
+{
+    if (!ctx || !env) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    memset(env, 0, sizeof(*env));
+
+    if ((fields & COND_CASE_FIELDS) && case_id && case_id->value[0]) {
+        regislex_case_t* c = NULL;
+        regislex_error_t err = regislex_case_get(ctx, case_id, &c);
+        if (err == REGISLEX_OK) {
+            env->numbers[REGISLEX_COND_FIELD_CASE_PRIORITY] = c->priority;
+            env->numbers[REGISLEX_COND_FIELD_CASE_STATUS] = c->status;
+            env->numbers[REGISLEX_COND_FIELD_CASE_TYPE] = c->type;
+            strncpy(env->case_number, c->case_number, sizeof(env->case_number) - 1);
+            env->texts[REGISLEX_COND_FIELD_CASE_NUMBER] = env->case_number;
+            env->present |= COND_CASE_FIELDS;
+            regislex_case_free(c);
+        } else if (err != REGISLEX_ERROR_NOT_FOUND) {
+            return err;
+        }
+    }
+
+    if ((fields & COND_DEADLINE_FIELDS) && deadline_id && deadline_id->value[0]) {
+        regislex_deadline_t* d = NULL;
+        regislex_error_t err = regislex_deadline_get(ctx, deadline_id, &d);
+        if (err == REGISLEX_OK) {
+            regislex_datetime_t today;
+            regislex_datetime_now(&today);
+            env->numbers[REGISLEX_COND_FIELD_DEADLINE_DAYS_LEFT] =
+                regislex_datetime_to_days(&d->due_date) - regislex_datetime_to_days(&today);
+            env->numbers[REGISLEX_COND_FIELD_DEADLINE_PRIORITY] = d->priority;
+            env->numbers[REGISLEX_COND_FIELD_DEADLINE_STATUS] = d->status;
+            env->present |= COND_DEADLINE_FIELDS;
+            regislex_deadline_free(d);
+        } else if (err != REGISLEX_ERROR_NOT_FOUND) {
+            return err;
+        }
+    }
+
+    if (event) {
+        const char* name = event->type == REGISLEX_EVENT_CUSTOM
+            ? event->name : regislex_event_name(event->type);
+        env->numbers[REGISLEX_COND_FIELD_EVENT_TYPE] = event->type;
+        strncpy(env->event_name, name ? name : "", sizeof(env->event_name) - 1);
+        env->texts[REGISLEX_COND_FIELD_EVENT_NAME] = env->event_name;
+        env->present |= COND_EVENT_FIELDS;
+    }
+
+    return REGISLEX_OK;
+}
@@ -0,0 +1,2446 @@
+/**
+ * @file executor.c
+ * @brief Asynchronous Workflow Executor
+ *
+ * Submitted runs execute on a fixed pool of worker threads, never on the
+ * caller's. Each workflow keeps a FIFO of runs waiting to start; a
+ * workflow sits on the ready list only while it has a waiting run and a
+ * free slot under its parallel limit, and is re-queued at the tail after
+ * each start, so one busy workflow cannot starve the others.
+ *
+ * Runs are durable. A run is a workflow_runs row from submission on, and
+ * each step commits its side effects in the same transaction that
+ * advances the run's step, so a run interrupted by a crash resumes after
+ * its last committed step. A DELAY or APPROVAL step ends in a
+ * workflow_timers row and the run leaves memory; only timers due within
+ * the horizon are held, in a min-heap the idle workers sleep on. A waiting
+ * run keeps its slot, so a non-parallel workflow stays exclusive across
+ * the wait.
+ *
+ * Only queued, resumable and executing runs are in memory, indexed by id
+ * for cancellation. Starting the executor rebuilds that state from the
+ * runs still active in the database.
+ *
+ * A workflow's definition is loaded once and kept with its scheduling
+ * state, its action parameters resolved to typed fields and its CONDITION
+ * expressions compiled. The workflow and action functions drop the cached
+ * copy once their change to the workflow commits. A run keeps the
+ * definition version it started on: a superseded definition stays loaded
+ * while started runs of its version remain. A run that resumes after its
+ * version is gone, e.g. after a restart, continues after its last action in
+ * the current definition, and fails if that action was removed.
+ *
+ * Run events (steps with their durations and errors, and status changes)
+ * are appended to an in-memory buffer and stored by a worker in one
+ * transaction per batch, when the batch fills or its oldest event has
+ * waited EXECUTOR_EVENT_FLUSH_MS. Events are a log, not run state: a
+ * crash loses at most the unflushed batch.
+ */
+
+#include "regislex/regislex.h"
+#include "database/database.h"
+#include "platform/platform.h"
+#include "utils/id_map.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define EXECUTOR_DEFAULT_WORKERS      4
+#define EXECUTOR_DEFAULT_QUEUE_LIMIT  10000
+#define EXECUTOR_TIMER_HORIZON_MS     (60 * 60 * 1000)
+#define EXECUTOR_LOAD_RETRY_MS        1000
+#define EXECUTOR_INITIAL_SLOTS        64
+#define EXECUTOR_EVENT_BATCH          256
+#define EXECUTOR_EVENT_FLUSH_MS       500
+#define EXECUTOR_EVENT_LIMIT          65536
+
+#define RUN_COLUMNS \
+    "id, workflow_id, case_id, triggered_by, trigger_data, status," \
+    " current_action_id, current_step, error_message," \
+    " started_at, completed_at, created_at"
+
+#define EVENT_COLUMNS \
+    "id, run_id, type, occurred_ms, step, action_id, action_type," \
+    " duration_ms, error_code, message"
+
+/* ============================================================================
+ * Internal Structures
+ * ============================================================================ */
+
+typedef enum {
+    RUN_PENDING = 0,    /* In its workflow's FIFO, holding no slot */
+    RUN_RESUMABLE,      /* Holds a slot, waiting for a worker */
+    RUN_EXECUTING       /* On a worker */
+} run_state_t;
+
+typedef struct exec_flow exec_flow_t;
+
+/* A step with its action's parameters resolved to typed fields */
+typedef struct {
+    const regislex_action_t* action;
+    const char* title;                  /* NULL when not given */
+    const char* description;
+    regislex_priority_t priority;
+    bool has_due;
+    int days_from_now;
+    regislex_uuid_t approver_id;
+    regislex_cond_program_t* condition; /* CONDITION steps whose expression compiled */
+    regislex_error_t condition_error;
+    int skip;                           /* Steps a false condition skips; -1 for the rest */
+} flow_step_t;
+
+/* A workflow's definition as the executor runs it, shared between runs */
+typedef struct {
+    regislex_workflow_t* workflow;
+    flow_step_t* steps;                 /* One per action, in sequence order */
+    int version;
+    int limit;
+    int holders;                        /* The cache, and each run or submission using it */
+} flow_def_t;
+
+/* A definition version that started runs execute */
+typedef struct flow_version {
+    int version;
+    int runs;                           /* Started runs pinned to it */
+    flow_def_t* def;                    /* Superseded definition kept for them, or NULL */
+    struct flow_version* next;
+} flow_version_t;
+
+typedef struct exec_run {
+    regislex_uuid_t id;
+    exec_flow_t* flow;
+    run_state_t state;
+    bool cancel_requested;
+    bool resume_requested;      /* Timer resolved while its worker was still parking it */
+    struct exec_run* prev;      /* Links for whichever list the run is on */
+    struct exec_run* next;
+} exec_run_t;
+
+typedef struct {
+    exec_run_t* head;
+    exec_run_t* tail;
+} run_list_t;
+
+struct exec_flow {
+    regislex_uuid_t workflow_id;
+    int limit;              /* Runs allowed to hold a slot at once; 0 = unlimited */
+    int admitted;           /* Runs holding a slot, including waiting ones */
+    run_list_t pending;
+    bool ready;             /* On the ready list */
+    exec_flow_t* next_ready;
+    flow_def_t* def;        /* Cached definition, or NULL until the next run loads it */
+    flow_version_t* versions;
+};
+
+typedef struct {
+    regislex_uuid_t run_id;
+    int64_t fire_ms;
+} timer_entry_t;
+
+typedef struct {
+    char name[64];
+    char value[256];
+    bool dirty;
+} run_var_t;
+
+/* A run as seen by the worker executing it */
+typedef struct {
+    regislex_uuid_t id;
+    regislex_uuid_t case_id;
+    regislex_workflow_status_t status;
+    int step;
+    int version;                /* Definition version; 0 until the run starts */
+    regislex_uuid_t action_id;  /* Last action checkpointed */
+    run_var_t* vars;
+    int var_count;
+    int var_capacity;
+} run_exec_t;
+
+typedef enum {
+    OUTCOME_FINISHED,       /* This worker moved the run to a final status */
+    OUTCOME_WAITING,        /* Parked on a timer row */
+    OUTCOME_DROPPED,        /* Already final, e.g. cancelled while queued to resume */
+    OUTCOME_DELETED,        /* The row is gone with its workflow */
+    OUTCOME_FAULTED,        /* The row could not be read or closed */
+    OUTCOME_STOPPED         /* Executor stopping */
+} run_outcome_t;
+
+typedef struct {
+    regislex_context_t* ctx;
+    int worker_count;
+    int max_active_runs;
+    int queue_limit;
+
+    platform_mutex_t* mutex;
+    platform_cond_t* wake;
+    platform_thread_t** workers;
+    int started;
+    bool running;
+
+    regislex_id_map_t flows;    /* Keyed by workflow id; never shrinks */
+    uint64_t def_epoch;         /* Advanced by each invalidation */
+
+    regislex_id_map_t runs;     /* Keyed by run id over the runs in memory */
+
+    exec_flow_t* ready_head;
+    exec_flow_t* ready_tail;
+    run_list_t resumable;
+    int pending_count;
+    int admitted;
+
+    int64_t horizon_end;        /* Timers firing before this are on the heap */
+    int64_t load_retry_ms;
+    bool loading;
+
+    timer_entry_t* heap;
+    int heap_count;
+    int heap_capacity;
+
+    regislex_run_event_t* events;   /* Appended, not yet stored */
+    int event_count;
+    int event_capacity;
+    int64_t event_flush_due;        /* When the oldest buffered event must be stored */
+    int64_t event_retry_ms;         /* No flush before this after a failed one */
+    bool flushing;
+    const regislex_run_event_t* flush_batch;    /* Being stored while flushing */
+    int flush_count;
+    platform_cond_t* flushed;
+} workflow_executor_t;
+
+static workflow_executor_t executor;
+
+/* ============================================================================
+ * Lists, Maps and Timer Heap (caller holds executor.mutex)
+ * ============================================================================ */
+
+static void list_push(run_list_t* list, exec_run_t* r) {
+    r->next = NULL;
+    r->prev = list->tail;
+    if (list->tail) list->tail->next = r;
+    else list->head = r;
+    list->tail = r;
+}
+
+static void list_unlink(run_list_t* list, exec_run_t* r) {
+    if (r->prev) r->prev->next = r->next;
+    else list->head = r->next;
+    if (r->next) r->next->prev = r->prev;
+    else list->tail = r->prev;
+    r->prev = NULL;
+    r->next = NULL;
+}
+
+static exec_run_t* list_pop(run_list_t* list) {
+    exec_run_t* r = list->head;
+    if (r) list_unlink(list, r);
+    return r;
+}
+
+/* Drops a run that is on no list */
+static void run_forget(exec_run_t* r) {
+    regislex_id_map_remove(&executor.runs, r->id.value);
+    platform_free(r);
+}
+
+static exec_flow_t* flow_find(const regislex_uuid_t* workflow_id) {
+    return (exec_flow_t*)regislex_id_map_get(&executor.flows, workflow_id->value);
+}
+
+/* Finds or creates the scheduling state for a workflow */
+static exec_flow_t* flow_get(const regislex_uuid_t* workflow_id) {
+    exec_flow_t* f = flow_find(workflow_id);
+    if (f) return f;
+
+    f = (exec_flow_t*)platform_calloc(1, sizeof(exec_flow_t));
+    if (!f) return NULL;
+    memcpy(&f->workflow_id, workflow_id, sizeof(regislex_uuid_t));
+
+    if (regislex_id_map_insert(&executor.flows, f) != REGISLEX_OK) {
+        platform_free(f);
+        return NULL;
+    }
+    return f;
+}
+
+static int flow_limit(bool allow_parallel, int max_parallel_runs) {
+    if (!allow_parallel) return 1;
+    return max_parallel_runs > 0 ? max_parallel_runs : 0;
+}
+
+static bool flow_has_slot(const exec_flow_t* f) {
+    return f->limit == 0 || f->admitted < f->limit;
+}
+
+/* Puts a workflow at the tail of the ready list if it can start a run */
+static void flow_mark_ready(exec_flow_t* f) {
+    if (f->ready || !f->pending.head || !flow_has_slot(f)) return;
+
+    f->ready = true;
+    f->next_ready = NULL;
+    if (executor.ready_tail) executor.ready_tail->next_ready = f;
+    else executor.ready_head = f;
+    executor.ready_tail = f;
+}
+
+static void heap_sift_up(int index) {
+    timer_entry_t e = executor.heap[index];
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (executor.heap[parent].fire_ms <= e.fire_ms) break;
+        executor.heap[index] = executor.heap[parent];
+        index = parent;
+    }
+    executor.heap[index] = e;
+}
+
+static void heap_sift_down(int index) {
+    timer_entry_t e = executor.heap[index];
+    for (;;) {
+        int child = index * 2 + 1;
+        if (child >= executor.heap_count) break;
+        if (child + 1 < executor.heap_count &&
+            executor.heap[child + 1].fire_ms < executor.heap[child].fire_ms) {
+            child++;
+        }
+        if (e.fire_ms <= executor.heap[child].fire_ms) break;
+        executor.heap[index] = executor.heap[child];
+        index = child;
+    }
+    executor.heap[index] = e;
+}
+
+static regislex_error_t heap_push(const regislex_uuid_t* run_id, int64_t fire_ms) {
+    if (executor.heap_count >= executor.heap_capacity) {
+        int new_capacity = executor.heap_capacity ? executor.heap_capacity * 2 : EXECUTOR_INITIAL_SLOTS;
+        timer_entry_t* grown = (timer_entry_t*)platform_realloc(
+            executor.heap, (size_t)new_capacity * sizeof(timer_entry_t));
+        if (!grown) return REGISLEX_ERROR_OUT_OF_MEMORY;
+        executor.heap = grown;
+        executor.heap_capacity = new_capacity;
+    }
+
+    timer_entry_t* e = &executor.heap[executor.heap_count++];
+    memcpy(&e->run_id, run_id, sizeof(regislex_uuid_t));
+    e->fire_ms = fire_ms;
+    heap_sift_up(executor.heap_count - 1);
+    return REGISLEX_OK;
+}
+
+static timer_entry_t heap_pop(void) {
+    timer_entry_t top = executor.heap[0];
+    executor.heap[0] = executor.heap[--executor.heap_count];
+    if (executor.heap_count > 0) heap_sift_down(0);
+    return top;
+}
+
+/* Picks the next run for a worker: resumed runs first, then new starts */
+static exec_run_t* take_work(void) {
+    exec_run_t* r = list_pop(&executor.resumable);
+    if (r) return r;
+
+    if (executor.max_active_runs > 0 && executor.admitted >= executor.max_active_runs) {
+        return NULL;
+    }
+
+    while (executor.ready_head) {
+        exec_flow_t* f = executor.ready_head;
+        executor.ready_head = f->next_ready;
+        if (!executor.ready_head) executor.ready_tail = NULL;
+        f->ready = false;
+        f->next_ready = NULL;
+
+        if (!f->pending.head || !flow_has_slot(f)) continue;
+
+        r = list_pop(&f->pending);
+        executor.pending_count--;
+        f->admitted++;
+        executor.admitted++;
+        flow_mark_ready(f);
+        return r;
+    }
+
+    return NULL;
+}
+
+/*
+ * Queues a waiting run whose timer was resolved. A run still being parked
+ * by its worker is flagged instead; the worker queues it when done.
+ */
+static void resume_run(const regislex_uuid_t* run_id, const regislex_uuid_t* workflow_id) {
+    if (!executor.mutex) return;
+
+    platform_mutex_lock(executor.mutex);
+    if (executor.running) {
+        exec_run_t* held = (exec_run_t*)regislex_id_map_get(&executor.runs, run_id->value);
+        if (held) {
+            held->resume_requested = true;
+        } else {
+            exec_run_t* r = (exec_run_t*)platform_calloc(1, sizeof(exec_run_t));
+            exec_flow_t* f = r ? flow_get(workflow_id) : NULL;
+            if (r) memcpy(&r->id, run_id, sizeof(regislex_uuid_t));
+            if (f && regislex_id_map_insert(&executor.runs, r) == REGISLEX_OK) {
+                r->flow = f;
+                r->state = RUN_RESUMABLE;
+                list_push(&executor.resumable, r);
+                platform_cond_signal(executor.wake);
+            } else {
+                /* Left active in the database; the next start picks it up */
+                platform_free(r);
+            }
+        }
+    }
+    platform_mutex_unlock(executor.mutex);
+}
+
+/* ============================================================================
+ * Run Event Log
+ * ============================================================================ */
+
+/* Stores a batch of events in one transaction */
+static regislex_error_t events_store(
+    regislex_db_context_t* db,
+    const regislex_run_event_t* events,
+    int count)
+{
+    regislex_db_transaction_t* tx = NULL;
+    regislex_error_t err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) return err;
+
+    /* Events of a run deleted with its workflow are dropped, not the batch */
+    regislex_db_stmt_t* stmt = NULL;
+    err = regislex_db_prepare(db,
+        "INSERT INTO workflow_run_events ("
+        "  run_id, type, occurred_ms, step, action_id, action_type, duration_ms, error_code, message"
+        ") SELECT ?, ?, ?, ?, ?, ?, ?, ?, ? WHERE EXISTS (SELECT 1 FROM workflow_runs WHERE id = ?)", &stmt);
+
+    for (int i = 0; i < count && err == REGISLEX_OK; i++) {
+        const regislex_run_event_t* ev = &events[i];
+        if (i > 0) regislex_db_reset(stmt);
+
+        regislex_db_bind_uuid(stmt, 1, &ev->run_id);
+        regislex_db_bind_int(stmt, 2, ev->type);
+        regislex_db_bind_int(stmt, 3, ev->occurred_ms);
+        regislex_db_bind_int(stmt, 4, ev->step);
+        regislex_db_bind_uuid(stmt, 5, &ev->action_id);
+        if (ev->action_id.value[0] != '\0') regislex_db_bind_int(stmt, 6, ev->action_type);
+        else regislex_db_bind_null(stmt, 6);
+        regislex_db_bind_int(stmt, 7, ev->duration_ms);
+        regislex_db_bind_int(stmt, 8, ev->error);
+        regislex_db_bind_text(stmt, 9, ev->message[0] ? ev->message : NULL);
+        regislex_db_bind_uuid(stmt, 10, &ev->run_id);
+
+        err = regislex_db_step(stmt);
+        if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
+    }
+    regislex_db_finalize(stmt);
+
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+    }
+    return err;
+}
+
+/* Appends an event to the buffer (caller holds executor.mutex) */
+static void event_push(const regislex_run_event_t* ev) {
+    if (executor.event_count >= executor.event_capacity) {
+        if (executor.event_capacity >= EXECUTOR_EVENT_LIMIT) {
+            /* Storage has been failing for a while; keep the oldest events */
+            return;
+        }
+        int new_capacity = executor.event_capacity ? executor.event_capacity * 2 : EXECUTOR_EVENT_BATCH;
+        regislex_run_event_t* grown = (regislex_run_event_t*)platform_realloc(
+            executor.events, (size_t)new_capacity * sizeof(regislex_run_event_t));
+        if (!grown) return;
+        executor.events = grown;
+        executor.event_capacity = new_capacity;
+    }
+
+    if (executor.event_count == 0) {
+        executor.event_flush_due = ev->occurred_ms + EXECUTOR_EVENT_FLUSH_MS;
+    }
+    executor.events[executor.event_count++] = *ev;
+    if (executor.event_count == EXECUTOR_EVENT_BATCH) {
+        platform_cond_signal(executor.wake);
+    }
+}
+
+/*
+ * Stores the buffered events. Entered and left with the mutex held; a
+ * failed batch goes back ahead of newer events and is retried later.
+ */
+static void events_flush(void) {
+    regislex_run_event_t* batch = executor.events;
+    int count = executor.event_count;
+    executor.events = NULL;
+    executor.event_count = 0;
+    executor.event_capacity = 0;
+    executor.flushing = true;
+    executor.flush_batch = batch;
+    executor.flush_count = count;
+    platform_mutex_unlock(executor.mutex);
+
+    regislex_error_t err = events_store(regislex_get_db(executor.ctx), batch, count);
+
+    platform_mutex_lock(executor.mutex);
+    executor.flush_batch = NULL;
+    executor.flush_count = 0;
+    if (err != REGISLEX_OK && count + executor.event_count <= EXECUTOR_EVENT_LIMIT) {
+        regislex_run_event_t* merged = (regislex_run_event_t*)platform_realloc(
+            batch, (size_t)(count + executor.event_count) * sizeof(regislex_run_event_t));
+        if (merged) {
+            if (executor.event_count > 0) {
+                memcpy(merged + count, executor.events,
+                       (size_t)executor.event_count * sizeof(regislex_run_event_t));
+            }
+            platform_free(executor.events);
+            executor.events = merged;
+            executor.event_count += count;
+            executor.event_capacity = executor.event_count;
+            batch = NULL;
+        }
+    }
+    if (err != REGISLEX_OK) {
+        executor.event_retry_ms = platform_time_ms() + EXECUTOR_LOAD_RETRY_MS;
+    }
+    platform_free(batch);
+
+    executor.flushing = false;
+    platform_cond_broadcast(executor.flushed);
+}
+
+/* Returns when the buffer is next due for a flush, or INT64_MAX if never */
+static int64_t events_flush_at(void) {
+    if (executor.flushing || executor.event_count == 0) return INT64_MAX;
+
+    int64_t at = executor.event_count >= EXECUTOR_EVENT_BATCH
+        ? executor.event_retry_ms : executor.event_flush_due;
+    return at > executor.event_retry_ms ? at : executor.event_retry_ms;
+}
+
+/*
+ * Records a run event. Without a running executor there is no buffer or
+ * flusher, so the event is stored at once.
+ */
+static void event_record(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* run_id,
+    regislex_run_event_type_t type,
+    int step,
+    const regislex_action_t* action,
+    int duration_ms,
+    regislex_error_t error,
+    const char* message)
+{
+    regislex_run_event_t ev;
+    memset(&ev, 0, sizeof(ev));
+    memcpy(&ev.run_id, run_id, sizeof(regislex_uuid_t));
+    ev.type = type;
+    ev.occurred_ms = platform_time_ms();
+    ev.step = step;
+    if (action) {
+        memcpy(&ev.action_id, &action->id, sizeof(regislex_uuid_t));
+        ev.action_type = action->type;
+    }
+    ev.duration_ms = duration_ms;
+    ev.error = error;
+    if (message) strncpy(ev.message, message, sizeof(ev.message) - 1);
+
+    if (executor.mutex) {
+        platform_mutex_lock(executor.mutex);
+        event_push(&ev);
+        platform_mutex_unlock(executor.mutex);
+    } else {
+        events_store(regislex_get_db(ctx), &ev, 1);
+    }
+}
+
+static regislex_run_event_type_t status_event(regislex_workflow_status_t status) {
+    switch (status) {
+        case REGISLEX_WORKFLOW_COMPLETED: return REGISLEX_RUN_EVENT_COMPLETED;
+        case REGISLEX_WORKFLOW_CANCELLED: return REGISLEX_RUN_EVENT_CANCELLED;
+        default:                          return REGISLEX_RUN_EVENT_FAILED;
+    }
+}
+
+/* ============================================================================
+ * Run Storage (called without executor.mutex)
+ * ============================================================================ */
+
+static regislex_error_t run_var_set(run_exec_t* rx, const char* name, const char* value) {
+    run_var_t* var = NULL;
+    for (int i = 0; i < rx->var_count; i++) {
+        if (strcmp(rx->vars[i].name, name) == 0) {
+            var = &rx->vars[i];
+            break;
+        }
+    }
+
+    if (!var) {
+        if (strlen(name) >= sizeof(var->name)) return REGISLEX_ERROR_INVALID_ARGUMENT;
+        if (rx->var_count >= rx->var_capacity) {
+            int new_capacity = rx->var_capacity ? rx->var_capacity * 2 : 8;
+            run_var_t* grown = (run_var_t*)platform_realloc(
+                rx->vars, (size_t)new_capacity * sizeof(run_var_t));
+            if (!grown) return REGISLEX_ERROR_OUT_OF_MEMORY;
+            rx->vars = grown;
+            rx->var_capacity = new_capacity;
+        }
+        var = &rx->vars[rx->var_count++];
+        memset(var, 0, sizeof(*var));
+        strcpy(var->name, name);
+    }
+
+    strncpy(var->value, value ? value : "", sizeof(var->value) - 1);
+    var->value[sizeof(var->value) - 1] = '\0';
+    var->dirty = true;
+    return REGISLEX_OK;
+}
+
+static regislex_error_t run_load(regislex_db_context_t* db, run_exec_t* rx) {
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "SELECT case_id, status, current_step, workflow_version, current_action_id"
+        " FROM workflow_runs WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_uuid(stmt, 1, &rx->id);
+    err = regislex_db_step(stmt);
+    if (err == REGISLEX_OK) {
+        regislex_db_column_uuid(stmt, 0, &rx->case_id);
+        rx->status = (regislex_workflow_status_t)regislex_db_column_int(stmt, 1);
+        rx->step = (int)regislex_db_column_int(stmt, 2);
+        rx->version = (int)regislex_db_column_int(stmt, 3);
+        regislex_db_column_uuid(stmt, 4, &rx->action_id);
+    }
+    regislex_db_finalize(stmt);
+    if (err != REGISLEX_OK) return err;
+
+    err = regislex_db_prepare(db,
+        "SELECT name, value FROM workflow_run_variables WHERE run_id = ?", &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_uuid(stmt, 1, &rx->id);
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        const char* name = regislex_db_column_text(stmt, 0);
+        if (!name) continue;
+        err = run_var_set(rx, name, regislex_db_column_text(stmt, 1));
+        if (err != REGISLEX_OK) break;
+        rx->vars[rx->var_count - 1].dirty = false;
+    }
+    regislex_db_finalize(stmt);
+
+    return err == REGISLEX_ERROR_NOT_FOUND ? REGISLEX_OK : err;
+}
+
+/*
+ * Records that a run has reached a step, with any variables the step set.
+ * The caller owns the transaction, which also holds the step's effects.
+ */
+static regislex_error_t run_checkpoint(
+    regislex_db_context_t* db,
+    run_exec_t* rx,
+    int step,
+    const regislex_action_t* action)
+{
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "UPDATE workflow_runs SET current_step = ?, current_action_id = ?, workflow_version = ?,"
+        "  started_at = coalesce(started_at, ?), updated_at = ? "
+        "WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_int(stmt, 1, step);
+    regislex_db_bind_uuid(stmt, 2, &action->id);
+    regislex_db_bind_int(stmt, 3, rx->version);
+    regislex_db_bind_datetime(stmt, 4, &now);
+    regislex_db_bind_datetime(stmt, 5, &now);
+    regislex_db_bind_uuid(stmt, 6, &rx->id);
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) return err;
+
+    stmt = NULL;
+    for (int i = 0; i < rx->var_count; i++) {
+        if (!rx->vars[i].dirty) continue;
+
+        if (!stmt) {
+            err = regislex_db_prepare(db,
+                "INSERT INTO workflow_run_variables (run_id, name, value) VALUES (?, ?, ?)"
+                " ON CONFLICT (run_id, name) DO UPDATE SET value = excluded.value", &stmt);
+            if (err != REGISLEX_OK) return err;
+        } else {
+            regislex_db_reset(stmt);
+        }
+
+        regislex_db_bind_uuid(stmt, 1, &rx->id);
+        regislex_db_bind_text(stmt, 2, rx->vars[i].name);
+        regislex_db_bind_text(stmt, 3, rx->vars[i].value);
+        err = regislex_db_step(stmt);
+        if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) break;
+        err = REGISLEX_OK;
+    }
+    regislex_db_finalize(stmt);
+
+    return err == REGISLEX_ERROR_NOT_FOUND ? REGISLEX_OK : err;
+}
+
+static regislex_error_t timer_insert(
+    regislex_db_context_t* db,
+    const regislex_uuid_t* run_id,
+    regislex_action_type_t kind,
+    int64_t fire_ms)
+{
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "INSERT INTO workflow_timers (run_id, kind, fire_ms, created_at) VALUES (?, ?, ?, ?)", &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_uuid(stmt, 1, run_id);
+    regislex_db_bind_int(stmt, 2, kind);
+    if (fire_ms >= 0) regislex_db_bind_int(stmt, 3, fire_ms);
+    else regislex_db_bind_null(stmt, 3);
+    regislex_db_bind_datetime(stmt, 4, &now);
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    return err == REGISLEX_ERROR_NOT_FOUND ? REGISLEX_OK : err;
+}
+
+/*
+ * Moves an active run to a final status. Only the caller that makes the
+ * move sees *closed set, and so only one caller releases the run's slot.
+ */
+static regislex_error_t run_close(
+    regislex_db_context_t* db,
+    const regislex_uuid_t* run_id,
+    regislex_workflow_status_t status,
+    const char* message,
+    bool* closed)
+{
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "UPDATE workflow_runs SET status = ?, error_message = ?, completed_at = ?, updated_at = ? "
+        "WHERE id = ? AND status = ?", &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_int(stmt, 1, status);
+    regislex_db_bind_text(stmt, 2, message);
+    regislex_db_bind_datetime(stmt, 3, &now);
+    regislex_db_bind_datetime(stmt, 4, &now);
+    regislex_db_bind_uuid(stmt, 5, run_id);
+    regislex_db_bind_int(stmt, 6, REGISLEX_WORKFLOW_ACTIVE);
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) return err;
+
+    *closed = regislex_db_changes(db) > 0;
+    return REGISLEX_OK;
+}
+
+/* ============================================================================
+ * Workflow Definitions
+ * ============================================================================ */
+
+static void def_free(flow_def_t* def) {
+    if (!def) return;
+    if (def->steps) {
+        for (int i = 0; i < def->workflow->action_count; i++) {
+            platform_free(def->steps[i].condition);
+        }
+        platform_free(def->steps);
+    }
+    regislex_workflow_free(def->workflow);
+    platform_free(def);
+}
+
+/* Drops one reference (caller holds executor.mutex) */
+static void def_release(flow_def_t* def) {
+    if (--def->holders == 0) def_free(def);
+}
+
+/*
+ * Version pins (caller holds executor.mutex). A pin that cannot be
+ * recorded only means the run may resume on the current definition.
+ */
+static flow_version_t* version_find(const exec_flow_t* f, int version) {
+    for (flow_version_t* v = f->versions; v; v = v->next) {
+        if (v->version == version) return v;
+    }
+    return NULL;
+}
+
+static void version_pin(exec_flow_t* f, int version) {
+    if (version <= 0) return;
+
+    flow_version_t* v = version_find(f, version);
+    if (!v) {
+        v = (flow_version_t*)platform_calloc(1, sizeof(flow_version_t));
+        if (!v) return;
+        v->version = version;
+        v->next = f->versions;
+        f->versions = v;
+    }
+    v->runs++;
+}
+
+static void version_unpin(exec_flow_t* f, int version) {
+    flow_version_t** link = &f->versions;
+    while (*link && (*link)->version != version) {
+        link = &(*link)->next;
+    }
+
+    flow_version_t* v = *link;
+    if (!v || --v->runs > 0) return;
+    *link = v->next;
+    if (v->def) def_release(v->def);
+    platform_free(v);
+}
+
+static void versions_clear(exec_flow_t* f) {
+    while (f->versions) {
+        flow_version_t* v = f->versions;
+        f->versions = v->next;
+        if (v->def) def_release(v->def);
+        platform_free(v);
+    }
+}
+
+/* Returns a finished run's slot to its workflow and the global pool */
+static void admission_release(const regislex_uuid_t* workflow_id, int version) {
+    exec_flow_t* f = flow_find(workflow_id);
+    if (f) version_unpin(f, version);
+    if (f && f->admitted > 0) {
+        f->admitted--;
+        /* Every pinned run holds a slot */
+        if (f->admitted == 0) versions_clear(f);
+        flow_mark_ready(f);
+    }
+    if (executor.admitted > 0) executor.admitted--;
+    platform_cond_signal(executor.wake);
+}
+
+/*
+ * What a run resolved or cancelled from outside the executor does once the
+ * change commits: resume, or log its end and free its slot. Inside a
+ * caller's transaction the change is not durable until the caller commits,
+ * and a rollback must leave the run parked with its slot.
+ */
+typedef struct {
+    regislex_context_t* ctx;
+    regislex_uuid_t run_id;
+    regislex_uuid_t workflow_id;
+    int version;
+    int step;
+    bool resume;
+    bool release;
+    regislex_run_event_type_t type;
+    char message[];
+} run_settle_t;
+
+static void run_settle_run(void* data) {
+    run_settle_t* settle = (run_settle_t*)data;
+
+    if (settle->resume) {
+        resume_run(&settle->run_id, &settle->workflow_id);
+        return;
+    }
+    event_record(settle->ctx, &settle->run_id, settle->type, settle->step, NULL, 0, REGISLEX_OK,
+                 settle->message[0] ? settle->message : NULL);
+    if (settle->release && executor.mutex) {
+        platform_mutex_lock(executor.mutex);
+        admission_release(&settle->workflow_id, settle->version);
+        platform_mutex_unlock(executor.mutex);
+    }
+}
+
+/* Queues the settle for the commit of the transaction the caller holds */
+static regislex_error_t run_settle(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* run_id,
+    const regislex_uuid_t* workflow_id,
+    int version,
+    int step,
+    bool resume,
+    bool release,
+    regislex_run_event_type_t type,
+    const char* message)
+{
+    size_t message_len = message ? strlen(message) : 0;
+    run_settle_t* settle = (run_settle_t*)platform_calloc(1, sizeof(run_settle_t) + message_len + 1);
+    if (!settle) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    settle->ctx = ctx;
+    memcpy(&settle->run_id, run_id, sizeof(regislex_uuid_t));
+    memcpy(&settle->workflow_id, workflow_id, sizeof(regislex_uuid_t));
+    settle->version = version;
+    settle->step = step;
+    settle->resume = resume;
+    settle->release = release;
+    settle->type = type;
+    if (message_len > 0) memcpy(settle->message, message, message_len);
+    return regislex_db_after_commit(regislex_get_db(ctx), run_settle_run, settle);
+}
+
+/*
+ * Cancels an active run in the database, dropping any timer it waits on.
+ * The run logs its end and frees any slot it held once the cancel commits.
+ */
+static regislex_error_t run_cancel_stored(regislex_context_t* ctx, const regislex_uuid_t* run_id) {
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_transaction_t* tx = NULL;
+    regislex_error_t err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_uuid_t workflow_id = {{0}};
+    bool started = false;
+    int step = 0;
+    int version = 0;
+    err = regislex_db_prepare(db,
+        "SELECT workflow_id, status, started_at IS NOT NULL, current_step, workflow_version"
+        " FROM workflow_runs WHERE id = ?", &stmt);
+    if (err == REGISLEX_OK) {
+        regislex_db_bind_uuid(stmt, 1, run_id);
+        err = regislex_db_step(stmt);
+        if (err == REGISLEX_OK) {
+            regislex_db_column_uuid(stmt, 0, &workflow_id);
+            if (regislex_db_column_int(stmt, 1) != REGISLEX_WORKFLOW_ACTIVE) {
+                err = REGISLEX_ERROR_INVALID_STATE;
+            }
+            started = regislex_db_column_int(stmt, 2) != 0;
+            step = (int)regislex_db_column_int(stmt, 3);
+            version = (int)regislex_db_column_int(stmt, 4);
+        }
+        regislex_db_finalize(stmt);
+    }
+
+    if (err == REGISLEX_OK) {
+        err = regislex_db_prepare(db, "DELETE FROM workflow_timers WHERE run_id = ?", &stmt);
+        if (err == REGISLEX_OK) {
+            regislex_db_bind_uuid(stmt, 1, run_id);
+            err = regislex_db_step(stmt);
+            regislex_db_finalize(stmt);
+            if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
+        }
+    }
+
+    bool closed = false;
+    if (err == REGISLEX_OK) {
+        err = run_close(db, run_id, REGISLEX_WORKFLOW_CANCELLED, NULL, &closed);
+    }
+    if (err == REGISLEX_OK && closed) {
+        err = run_settle(ctx, run_id, &workflow_id, version, step, false, started,
+                         REGISLEX_RUN_EVENT_CANCELLED, NULL);
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        return err;
+    }
+    return REGISLEX_OK;
+}
+
+/*
+ * Resolves each action's parameters once, so running a step reads typed
+ * fields and CONDITION steps evaluate a compiled program. Takes ownership
+ * of the workflow.
+ */
+static regislex_error_t def_build(regislex_workflow_t* wf, flow_def_t** out) {
+    flow_def_t* def = (flow_def_t*)platform_calloc(1, sizeof(flow_def_t));
+    if (!def) {
+        regislex_workflow_free(wf);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    def->workflow = wf;
+    def->version = wf->version;
+    def->limit = flow_limit(wf->allow_parallel, wf->max_parallel_runs);
+
+    if (wf->action_count > 0) {
+        def->steps = (flow_step_t*)platform_calloc(wf->action_count, sizeof(flow_step_t));
+        if (!def->steps) {
+            def_free(def);
+            return REGISLEX_ERROR_OUT_OF_MEMORY;
+        }
+    }
+
+    for (int i = 0; i < wf->action_count; i++) {
+        const regislex_action_t* action = wf->actions[i];
+        flow_step_t* step = &def->steps[i];
+        const char* expression = NULL;
+
+        step->action = action;
+        step->skip = -1;
+
+        for (int p = 0; p < action->param_count; p++) {
+            const char* type = action->params[p].type;
+            const char* value = action->params[p].value;
+
+            if (strcmp(type, "title") == 0) {
+                step->title = value;
+            } else if (strcmp(type, "description") == 0) {
+                step->description = value;
+            } else if (strcmp(type, "priority") == 0) {
+                step->priority = (regislex_priority_t)atoi(value);
+            } else if (strcmp(type, "days_from_now") == 0) {
+                step->has_due = true;
+                step->days_from_now = atoi(value);
+            } else if (strcmp(type, "approver_id") == 0) {
+                strncpy(step->approver_id.value, value, sizeof(step->approver_id.value) - 1);
+            } else if (strcmp(type, "expression") == 0) {
+                expression = value;
+            } else if (strcmp(type, "skip") == 0) {
+                step->skip = atoi(value);
+            }
+        }
+
+        if (action->type != REGISLEX_ACTION_CONDITION) continue;
+
+        /* A condition that does not compile fails its step, not the definition */
+        if (!expression) {
+            step->condition_error = REGISLEX_ERROR_INVALID_ARGUMENT;
+            continue;
+        }
+        step->condition = (regislex_cond_program_t*)platform_malloc(sizeof(regislex_cond_program_t));
+        if (!step->condition) {
+            def_free(def);
+            return REGISLEX_ERROR_OUT_OF_MEMORY;
+        }
+        step->condition_error = regislex_cond_compile(expression, step->condition);
+        if (step->condition_error != REGISLEX_OK) {
+            platform_free(step->condition);
+            step->condition = NULL;
+        }
+    }
+
+    *out = def;
+    return REGISLEX_OK;
+}
+
+/*
+ * Returns a workflow's definition with a reference for the caller, from
+ * the cache or else loaded and cached. A load that overlaps an
+ * invalidation is used once but not cached, since it may predate the
+ * change. Called without executor.mutex.
+ */
+static regislex_error_t def_acquire(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* workflow_id,
+    flow_def_t** out)
+{
+    platform_mutex_lock(executor.mutex);
+    exec_flow_t* f = flow_find(workflow_id);
+    if (f && f->def) {
+        f->def->holders++;
+        *out = f->def;
+        platform_mutex_unlock(executor.mutex);
+        return REGISLEX_OK;
+    }
+    uint64_t epoch = executor.def_epoch;
+    platform_mutex_unlock(executor.mutex);
+
+    regislex_workflow_t* wf = NULL;
+    regislex_error_t err = regislex_workflow_get(ctx, workflow_id, &wf);
+    if (err != REGISLEX_OK) return err;
+
+    flow_def_t* def = NULL;
+    err = def_build(wf, &def);
+    if (err != REGISLEX_OK) return err;
+
+    platform_mutex_lock(executor.mutex);
+    def->holders = 1;
+    if (epoch == executor.def_epoch) {
+        f = flow_get(workflow_id);
+        if (f && !f->def) {
+            f->def = def;
+            def->holders++;
+        }
+    }
+    platform_mutex_unlock(executor.mutex);
+
+    *out = def;
+    return REGISLEX_OK;
+}
+
+/*
+ * Returns with a reference the definition a run executes: its own version
+ * while that is still loaded, else the current one. Called without
+ * executor.mutex.
+ */
+static regislex_error_t def_acquire_version(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* workflow_id,
+    int version,
+    flow_def_t** out)
+{
+    if (version > 0) {
+        platform_mutex_lock(executor.mutex);
+        exec_flow_t* f = flow_find(workflow_id);
+        flow_def_t* def = NULL;
+        if (f && f->def && f->def->version == version) {
+            def = f->def;
+        } else if (f) {
+            flow_version_t* v = version_find(f, version);
+            if (v) def = v->def;
+        }
+        if (def) {
+            def->holders++;
+            *out = def;
+            platform_mutex_unlock(executor.mutex);
+            return REGISLEX_OK;
+        }
+        platform_mutex_unlock(executor.mutex);
+    }
+    return def_acquire(ctx, workflow_id, out);
+}
+
+/*
+ * Moves a started run onto a newer definition after its last action. A
+ * CONDITION is evaluated again, since what it skips may have changed.
+ * Returns false when the action is no longer in the definition.
+ */
+static bool run_rebase(run_exec_t* rx, const flow_def_t* def) {
+    for (int i = 0; i < def->workflow->action_count; i++) {
+        const regislex_action_t* action = def->steps[i].action;
+        if (strcmp(action->id.value, rx->action_id.value) != 0) continue;
+
+        rx->step = action->type == REGISLEX_ACTION_CONDITION ? i : i + 1;
+        rx->version = def->version;
+        return true;
+    }
+    return false;
+}
+
+/* ============================================================================
+ * Action Execution
+ * ============================================================================ */
+
+static const char* run_var_get(const run_exec_t* rx, const char* name) {
+    for (int i = 0; i < rx->var_count; i++) {
+        if (strcmp(rx->vars[i].name, name) == 0) return rx->vars[i].value;
+    }
+    return NULL;
+}
+
+/*
+ * Evaluates a CONDITION step's "expression" against the run's case and
+ * the deadline it created, if any. When the condition is false the run
+ * skips the number of following steps given by "skip", or all of them.
+ */
+static regislex_error_t condition_next_step(
+    regislex_context_t* ctx,
+    const run_exec_t* rx,
+    const flow_step_t* fs,
+    int step,
+    int step_count,
+    int* next)
+{
+    if (!fs->condition) return fs->condition_error;
+
+    regislex_uuid_t deadline_id = {{0}};
+    const char* deadline = run_var_get(rx, "deadline_id");
+    if (deadline) strncpy(deadline_id.value, deadline, sizeof(deadline_id.value) - 1);
+
+    regislex_cond_env_t env;
+    regislex_error_t err = regislex_cond_env_load(
+        ctx, fs->condition->fields, &rx->case_id, &deadline_id, NULL, &env);
+    if (err != REGISLEX_OK) return err;
+
+    *next = step + 1;
+    if (!regislex_cond_eval(fs->condition, &env)) {
+        int skipped = fs->skip;
+        if (skipped < 0 || skipped > step_count) skipped = step_count;
+        *next = step + 1 + skipped;
+        if (*next > step_count) *next = step_count;
+    }
+    return REGISLEX_OK;
+}
+
+/* Runs one action inside the step's transaction */
+static regislex_error_t execute_action(
+    regislex_context_t* ctx,
+    run_exec_t* rx,
+    const flow_step_t* fs)
+{
+    regislex_error_t err = REGISLEX_OK;
+
+    switch (fs->action->type) {
+        case REGISLEX_ACTION_SEND_EMAIL:
+            /* TODO: Implement email sending */
+            /* Would integrate with SMTP or email service API */
+            break;
+
+        case REGISLEX_ACTION_SEND_SMS:
+            /* TODO: Implement SMS sending */
+            /* Would integrate with SMS gateway API */
+            break;
+
+        case REGISLEX_ACTION_CREATE_TASK: {
+            /* Create a task from action parameters */
+            regislex_task_t task = {0};
+
+            if (fs->title) strncpy(task.title, fs->title, sizeof(task.title) - 1);
+            if (fs->description) strncpy(task.description, fs->description, sizeof(task.description) - 1);
+            task.priority = fs->priority;
+            task.status = REGISLEX_TASK_PENDING;
+            memcpy(&task.case_id, &rx->case_id, sizeof(regislex_uuid_t));
+            memcpy(&task.workflow_run_id, &rx->id, sizeof(regislex_uuid_t));
+
+            regislex_task_t* new_task = NULL;
+            err = regislex_task_create(ctx, &task, &new_task);
+            if (err == REGISLEX_OK) {
+                err = run_var_set(rx, "task_id", new_task->id.value);
+            }
+            if (new_task) regislex_task_free(new_task);
+            break;
+        }
+
+        case REGISLEX_ACTION_CREATE_DEADLINE: {
+            /* Create a deadline from action parameters */
+            regislex_deadline_t dl = {0};
+
+            if (fs->title) strncpy(dl.title, fs->title, sizeof(dl.title) - 1);
+            if (fs->has_due) {
+                regislex_datetime_now(&dl.due_date);
+                regislex_datetime_add_days(&dl.due_date, fs->days_from_now);
+            }
+
+            dl.status = REGISLEX_STATUS_PENDING;
+            memcpy(&dl.case_id, &rx->case_id, sizeof(regislex_uuid_t));
+
+            regislex_deadline_t* new_dl = NULL;
+            err = regislex_deadline_create(ctx, &dl, &new_dl);
+            if (err == REGISLEX_OK) {
+                err = run_var_set(rx, "deadline_id", new_dl->id.value);
+            }
+            if (new_dl) regislex_deadline_free(new_dl);
+            break;
+        }
+
+        case REGISLEX_ACTION_UPDATE_STATUS:
+            /* Update case/matter status */
+            /* TODO: Implement status update */
+            break;
+
+        case REGISLEX_ACTION_ASSIGN_USER:
+            /* Assign case/task to user */
+            /* TODO: Implement user assignment */
+            break;
+
+        case REGISLEX_ACTION_ADD_NOTE:
+            /* Add note to case/matter */
+            /* TODO: Implement note addition */
+            break;
+
+        case REGISLEX_ACTION_WEBHOOK: {
+            /* Call external webhook */
+            /* TODO: Implement HTTP POST to webhook URL */
+            break;
+        }
+
+        case REGISLEX_ACTION_DELAY:
+            /* Timed delays park the run; see run_step */
+            break;
+
+        case REGISLEX_ACTION_CONDITION:
+            /* Branching moves the run's step; see run_step */
+            break;
+
+        case REGISLEX_ACTION_APPROVAL: {
+            /* Open an approval task; the run waits until it is decided */
+            regislex_task_t task = {0};
+
+            strncpy(task.title, fs->title ? fs->title : fs->action->name, sizeof(task.title) - 1);
+            if (fs->description) strncpy(task.description, fs->description, sizeof(task.description) - 1);
+            memcpy(&task.case_id, &rx->case_id, sizeof(regislex_uuid_t));
+            memcpy(&task.workflow_run_id, &rx->id, sizeof(regislex_uuid_t));
+
+            regislex_task_t* new_task = NULL;
+            err = regislex_task_create(ctx, &task, &new_task);
+            if (err == REGISLEX_OK) {
+                err = regislex_task_request_approval(ctx, &new_task->id, &fs->approver_id);
+            }
+            if (err == REGISLEX_OK) {
+                err = run_var_set(rx, "approval_task_id", new_task->id.value);
+            }
+            if (new_task) regislex_task_free(new_task);
+            break;
+        }
+
+        case REGISLEX_ACTION_NOTIFY:
+            /* Send in-app notification */
+            /* TODO: Implement notification system */
+            break;
+
+        case REGISLEX_ACTION_GENERATE_REPORT:
+            /* Generate a report */
+            /* TODO: Integrate with reporting module */
+            break;
+
+        case REGISLEX_ACTION_CREATE_DOCUMENT:
+            /* Generate document from template */
+            /* TODO: Integrate with document management module */
+            break;
+
+        case REGISLEX_ACTION_CUSTOM_SCRIPT:
+            /* Execute custom script/plugin */
+            /* TODO: Implement plugin system */
+            break;
+
+        default:
+            err = REGISLEX_ERROR_UNSUPPORTED;
+            break;
+    }
+
+    return err;
+}
+
+/*
+ * Executes one step and checkpoints it in a single transaction. A step
+ * that waits (a timed DELAY, or an APPROVAL) also writes its timer row
+ * and sets *fire_ms: the wake time, or -1 to wait without a timeout.
+ */
+static regislex_error_t run_step(
+    regislex_context_t* ctx,
+    run_exec_t* rx,
+    const flow_step_t* fs,
+    int step,
+    int step_count,
+    bool* waits,
+    int64_t* fire_ms)
+{
+    const regislex_action_t* action = fs->action;
+    regislex_db_context_t* db = regislex_get_db(ctx);
+    *waits = false;
+
+    regislex_db_transaction_t* tx = NULL;
+    regislex_error_t err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) return err;
+
+    int next = step + 1;
+    if (action->type == REGISLEX_ACTION_DELAY && action->delay_minutes > 0) {
+        *waits = true;
+        *fire_ms = platform_time_ms() + (int64_t)action->delay_minutes * 60000;
+    } else if (action->type == REGISLEX_ACTION_CONDITION) {
+        err = condition_next_step(ctx, rx, fs, step, step_count, &next);
+    } else {
+        err = execute_action(ctx, rx, fs);
+        if (err == REGISLEX_OK && action->type == REGISLEX_ACTION_APPROVAL) {
+            /* The step completes when the approval is decided */
+            *waits = true;
+            *fire_ms = action->timeout_minutes > 0
+                ? platform_time_ms() + (int64_t)action->timeout_minutes * 60000 : -1;
+            next = step;
+        }
+    }
+
+    if (err == REGISLEX_OK) {
+        err = run_checkpoint(db, rx, next, action);
+    }
+    if (err == REGISLEX_OK && *waits) {
+        err = timer_insert(db, &rx->id, action->type, *fire_ms);
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        *waits = false;
+        return err;
+    }
+
+    rx->step = next;
+    for (int i = 0; i < rx->var_count; i++) {
+        rx->vars[i].dirty = false;
+    }
+    return REGISLEX_OK;
+}
+
+/* Closes a run from its worker and logs the move */
+static run_outcome_t run_finish(
+    regislex_context_t* ctx,
+    const run_exec_t* rx,
+    regislex_workflow_status_t status,
+    regislex_error_t error,
+    const char* message,
+    bool* closed)
+{
+    if (run_close(regislex_get_db(ctx), &rx->id, status, message, closed) != REGISLEX_OK) {
+        return OUTCOME_FAULTED;
+    }
+    if (*closed) {
+        event_record(ctx, &rx->id, status_event(status), rx->step, NULL, 0, error, message);
+    }
+    return OUTCOME_FINISHED;
+}
+
+/*
+ * Executes a run until it finishes, waits on a timer, or the executor
+ * stops. Entered and left with the mutex held; on return the run is either
+ * queued again or gone from memory.
+ */
+static void run_execute(exec_run_t* r) {
+    regislex_context_t* ctx = executor.ctx;
+    regislex_db_context_t* db = regislex_get_db(ctx);
+    regislex_uuid_t workflow_id = r->flow->workflow_id;
+    bool resumed = r->state == RUN_RESUMABLE;
+    r->state = RUN_EXECUTING;
+
+    run_exec_t rx;
+    memset(&rx, 0, sizeof(rx));
+    memcpy(&rx.id, &r->id, sizeof(regislex_uuid_t));
+    platform_mutex_unlock(executor.mutex);
+
+    run_outcome_t outcome = OUTCOME_STOPPED;
+    bool closed = false;
+    int64_t fire_ms = -1;
+    flow_def_t* def = NULL;
+
+    regislex_error_t err = run_load(db, &rx);
+    if (err == REGISLEX_ERROR_NOT_FOUND) {
+        outcome = OUTCOME_DELETED;
+    } else if (err != REGISLEX_OK) {
+        outcome = OUTCOME_FAULTED;
+    } else if (rx.status != REGISLEX_WORKFLOW_ACTIVE) {
+        outcome = OUTCOME_DROPPED;
+    } else if ((err = def_acquire_version(ctx, &workflow_id, rx.version, &def)) != REGISLEX_OK) {
+        outcome = run_finish(ctx, &rx, REGISLEX_WORKFLOW_FAILED, err,
+                             "Workflow could not be loaded", &closed);
+    } else if (rx.action_id.value[0] != '\0' && def->version != rx.version &&
+               !run_rebase(&rx, def)) {
+        outcome = run_finish(ctx, &rx, REGISLEX_WORKFLOW_FAILED, REGISLEX_ERROR_NOT_FOUND,
+                             "Workflow definition changed", &closed);
+    } else {
+        /* A new run takes the current version; a rebased one moves its pin */
+        int pinned = rx.version;
+        if (rx.action_id.value[0] == '\0') {
+            pinned = 0;
+            rx.version = def->version;
+        }
+        if (rx.version != pinned) {
+            platform_mutex_lock(executor.mutex);
+            version_unpin(r->flow, pinned);
+            version_pin(r->flow, rx.version);
+            platform_mutex_unlock(executor.mutex);
+        }
+
+        event_record(ctx, &rx.id, resumed ? REGISLEX_RUN_EVENT_RESUMED : REGISLEX_RUN_EVENT_STARTED,
+                     rx.step, NULL, 0, REGISLEX_OK, NULL);
+
+        for (;;) {
+            platform_mutex_lock(executor.mutex);
+            bool running = executor.running;
+            bool cancel = r->cancel_requested;
+            platform_mutex_unlock(executor.mutex);
+
+            if (!running) {
+                outcome = OUTCOME_STOPPED;
+                break;
+            }
+            if (cancel) {
+                outcome = run_finish(ctx, &rx, REGISLEX_WORKFLOW_CANCELLED, REGISLEX_OK, NULL, &closed);
+                break;
+            }
+
+            int step_count = def->workflow->action_count;
+            int step = rx.step;
+            while (step < step_count && !def->steps[step].action->is_active) {
+                step++;
+            }
+            if (step >= step_count) {
+                outcome = run_finish(ctx, &rx, REGISLEX_WORKFLOW_COMPLETED, REGISLEX_OK, NULL, &closed);
+                break;
+            }
+
+            const regislex_action_t* action = def->steps[step].action;
+            bool waits = false;
+            uint64_t began = platform_monotonic_ns();
+            err = run_step(ctx, &rx, &def->steps[step], step, step_count, &waits, &fire_ms);
+            int duration_ms = (int)((platform_monotonic_ns() - began) / 1000000);
+
+            if (err != REGISLEX_OK) {
+                /* Sized for a run event's message, so the name is cut short */
+                char message[sizeof(((regislex_run_event_t*)0)->message)];
+                snprintf(message, sizeof(message),
+                         "Action %d (%.200s) failed with error %d", step, action->name, err);
+                event_record(ctx, &rx.id, REGISLEX_RUN_EVENT_STEP_FAILED, step, action,
+                             duration_ms, err, message);
+                rx.step = step;
+                outcome = run_finish(ctx, &rx, REGISLEX_WORKFLOW_FAILED, err, message, &closed);
+                break;
+            }
+            event_record(ctx, &rx.id,
+                         waits ? REGISLEX_RUN_EVENT_STEP_WAITING : REGISLEX_RUN_EVENT_STEP_COMPLETED,
+                         step, action, duration_ms, REGISLEX_OK, NULL);
+            if (waits) {
+                outcome = OUTCOME_WAITING;
+                break;
+            }
+        }
+    }
+
+    platform_free(rx.vars);
+
+    /*
+     * A storage error must not leave the slot held by a run no worker has:
+     * fail the run if the row can be written now, and release the slot
+     * either way. A run left active resumes at the next start.
+     */
+    if (outcome == OUTCOME_FAULTED &&
+        run_close(db, &rx.id, REGISLEX_WORKFLOW_FAILED, "Run storage failed", &closed) == REGISLEX_OK &&
+        closed) {
+        event_record(ctx, &rx.id, REGISLEX_RUN_EVENT_FAILED, rx.step, NULL, 0,
+                     REGISLEX_ERROR_DATABASE, "Run storage failed");
+    }
+
+    platform_mutex_lock(executor.mutex);
+    if (def) def_release(def);
+
+    if (outcome == OUTCOME_WAITING && r->cancel_requested) {
+        /* Cancelled while the step was parking; cancel the stored run instead */
+        run_forget(r);
+        platform_mutex_unlock(executor.mutex);
+        run_cancel_stored(ctx, &rx.id);
+        platform_mutex_lock(executor.mutex);
+        return;
+    }
+
+    switch (outcome) {
+        case OUTCOME_FINISHED:
+            if (closed) admission_release(&workflow_id, rx.version);
+            run_forget(r);
+            break;
+
+        case OUTCOME_DELETED:
+        case OUTCOME_FAULTED:
+            admission_release(&workflow_id, rx.version);
+            run_forget(r);
+            break;
+
+        case OUTCOME_WAITING:
+            if (fire_ms >= 0 && fire_ms < executor.horizon_end) {
+                heap_push(&rx.id, fire_ms);
+                platform_cond_signal(executor.wake);
+            }
+            if (r->resume_requested) {
+                r->resume_requested = false;
+                r->state = RUN_RESUMABLE;
+                list_push(&executor.resumable, r);
+                platform_cond_signal(executor.wake);
+            } else {
+                run_forget(r);
+            }
+            break;
+
+        case OUTCOME_DROPPED:
+        case OUTCOME_STOPPED:
+            run_forget(r);
+            break;
+    }
+}
+
+/* ============================================================================
+ * Timers
+ * ============================================================================ */
+
+/* Loads the timers firing in [from, to) onto the heap */
+static void timers_load(int64_t from, int64_t to) {
+    regislex_db_context_t* db = regislex_get_db(executor.ctx);
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "SELECT run_id, fire_ms FROM workflow_timers"
+        " WHERE fire_ms IS NOT NULL AND fire_ms >= ? AND fire_ms < ?", &stmt);
+
+    timer_entry_t* loaded = NULL;
+    int count = 0;
+    int capacity = 0;
+    if (err == REGISLEX_OK) {
+        regislex_db_bind_int(stmt, 1, from);
+        regislex_db_bind_int(stmt, 2, to);
+        while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+            if (count >= capacity) {
+                int new_capacity = capacity ? capacity * 2 : EXECUTOR_INITIAL_SLOTS;
+                timer_entry_t* grown = (timer_entry_t*)platform_realloc(
+                    loaded, (size_t)new_capacity * sizeof(timer_entry_t));
+                if (!grown) {
+                    err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                    break;
+                }
+                loaded = grown;
+                capacity = new_capacity;
+            }
+            memset(&loaded[count], 0, sizeof(timer_entry_t));
+            regislex_db_column_uuid(stmt, 0, &loaded[count].run_id);
+            loaded[count].fire_ms = regislex_db_column_int(stmt, 1);
+            count++;
+        }
+        regislex_db_finalize(stmt);
+    }
+
+    platform_mutex_lock(executor.mutex);
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        /* Try the same window again shortly */
+        executor.horizon_end = from;
+        executor.load_retry_ms = platform_time_ms() + EXECUTOR_LOAD_RETRY_MS;
+    } else {
+        for (int i = 0; i < count; i++) {
+            heap_push(&loaded[i].run_id, loaded[i].fire_ms);
+        }
+    }
+    executor.loading = false;
+    platform_mutex_unlock(executor.mutex);
+
+    platform_free(loaded);
+}
+
+/*
+ * Claims a due timer. Deleting the row is the claim, so a timer fires at
+ * most once even when the heap holds it twice or the run was cancelled
+ * meanwhile. An expired DELAY resumes the run; an expired APPROVAL fails it.
+ */
+static void timer_fire(const regislex_uuid_t* run_id, int64_t now) {
+    regislex_db_context_t* db = regislex_get_db(executor.ctx);
+
+    regislex_db_transaction_t* tx = NULL;
+    if (regislex_db_begin(db, &tx) != REGISLEX_OK) return;
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_uuid_t workflow_id = {{0}};
+    int kind = -1;
+    int step = 0;
+    int version = 0;
+    regislex_error_t err = regislex_db_prepare(db,
+        "SELECT t.kind, r.workflow_id, r.current_step, r.workflow_version FROM workflow_timers t"
+        " JOIN workflow_runs r ON r.id = t.run_id"
+        " WHERE t.run_id = ? AND t.fire_ms <= ?", &stmt);
+    if (err == REGISLEX_OK) {
+        regislex_db_bind_uuid(stmt, 1, run_id);
+        regislex_db_bind_int(stmt, 2, now);
+        err = regislex_db_step(stmt);
+        if (err == REGISLEX_OK) {
+            kind = (int)regislex_db_column_int(stmt, 0);
+            regislex_db_column_uuid(stmt, 1, &workflow_id);
+            step = (int)regislex_db_column_int(stmt, 2);
+            version = (int)regislex_db_column_int(stmt, 3);
+        }
+        regislex_db_finalize(stmt);
+    }
+
+    bool closed = false;
+    if (err == REGISLEX_OK) {
+        err = regislex_db_prepare(db, "DELETE FROM workflow_timers WHERE run_id = ?", &stmt);
+        if (err == REGISLEX_OK) {
+            regislex_db_bind_uuid(stmt, 1, run_id);
+            err = regislex_db_step(stmt);
+            regislex_db_finalize(stmt);
+            if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
+        }
+    }
+    if (err == REGISLEX_OK && kind == REGISLEX_ACTION_APPROVAL) {
+        err = run_close(db, run_id, REGISLEX_WORKFLOW_FAILED, "Approval timed out", &closed);
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        /* NOT_FOUND: no longer due or already claimed */
+        regislex_db_rollback(tx);
+        return;
+    }
+
+    if (kind == REGISLEX_ACTION_APPROVAL) {
+        if (closed) {
+            event_record(executor.ctx, run_id, REGISLEX_RUN_EVENT_FAILED, step, NULL, 0,
+                         REGISLEX_ERROR_TIMEOUT, "Approval timed out");
+            platform_mutex_lock(executor.mutex);
+            admission_release(&workflow_id, version);
+            platform_mutex_unlock(executor.mutex);
+        }
+    } else {
+        resume_run(run_id, &workflow_id);
+    }
+}
+
+/* ============================================================================
+ * Workers
+ * ============================================================================ */
+
+static void* executor_worker(void* arg) {
+    (void)arg;
+
+    platform_mutex_lock(executor.mutex);
+    while (executor.running) {
+        int64_t now = platform_time_ms();
+
+        if (now >= executor.horizon_end && now >= executor.load_retry_ms && !executor.loading) {
+            int64_t from = executor.horizon_end;
+            executor.horizon_end = now + EXECUTOR_TIMER_HORIZON_MS;
+            executor.loading = true;
+
+            int64_t to = executor.horizon_end;
+            platform_mutex_unlock(executor.mutex);
+            timers_load(from, to);
+            platform_mutex_lock(executor.mutex);
+            continue;
+        }
+
+        if (events_flush_at() <= now) {
+            events_flush();
+            continue;
+        }
+
+        if (executor.heap_count > 0 && executor.heap[0].fire_ms <= now) {
+            timer_entry_t due = heap_pop();
+            platform_mutex_unlock(executor.mutex);
+            timer_fire(&due.run_id, now);
+            platform_mutex_lock(executor.mutex);
+            continue;
+        }
+
+        exec_run_t* r = take_work();
+        if (r) {
+            /* Hand any remaining work to another idle worker */
+            if (executor.resumable.head || executor.ready_head) {
+                platform_cond_signal(executor.wake);
+            }
+            run_execute(r);
+            continue;
+        }
+
+        int64_t next = executor.horizon_end > executor.load_retry_ms
+            ? executor.horizon_end : executor.load_retry_ms;
+        if (executor.heap_count > 0 && executor.heap[0].fire_ms < next) {
+            next = executor.heap[0].fire_ms;
+        }
+        int64_t flush_at = events_flush_at();
+        if (flush_at < next) next = flush_at;
+        int64_t wait = next - now;
+        if (wait > 0) {
+            platform_cond_timedwait(executor.wake, executor.mutex,
+                                    wait > 0x7fffffff ? 0x7fffffff : (int)wait);
+        }
+    }
+    platform_mutex_unlock(executor.mutex);
+
+    return NULL;
+}
+
+/*
+ * Rebuilds the queues from the runs still active in the database: runs
+ * never started are queued again in submission order, started runs
+ * without a timer resume where they stopped, and waiting runs only take
+ * up their slot.
+ */
+static regislex_error_t executor_recover(void) {
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(executor.ctx),
+        "SELECT r.id, r.workflow_id, r.started_at IS NOT NULL, t.run_id IS NOT NULL,"
+        "  w.allow_parallel, w.max_parallel_runs, r.workflow_version"
+        " FROM workflow_runs r"
+        " JOIN workflows w ON w.id = r.workflow_id"
+        " LEFT JOIN workflow_timers t ON t.run_id = r.id"
+        " WHERE r.status = ? ORDER BY r.created_at, r.id", &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_int(stmt, 1, REGISLEX_WORKFLOW_ACTIVE);
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        regislex_uuid_t workflow_id = {{0}};
+        regislex_db_column_uuid(stmt, 1, &workflow_id);
+        bool started = regislex_db_column_int(stmt, 2) != 0;
+        bool waiting = regislex_db_column_int(stmt, 3) != 0;
+
+        exec_flow_t* f = flow_get(&workflow_id);
+        if (!f) {
+            err = REGISLEX_ERROR_OUT_OF_MEMORY;
+            break;
+        }
+        f->limit = flow_limit(regislex_db_column_int(stmt, 4) != 0,
+                              (int)regislex_db_column_int(stmt, 5));
+
+        if (started) {
+            f->admitted++;
+            executor.admitted++;
+            version_pin(f, (int)regislex_db_column_int(stmt, 6));
+            if (waiting) continue;
+        }
+
+        exec_run_t* r = (exec_run_t*)platform_calloc(1, sizeof(exec_run_t));
+        if (!r) {
+            err = REGISLEX_ERROR_OUT_OF_MEMORY;
+            break;
+        }
+        regislex_db_column_uuid(stmt, 0, &r->id);
+        r->flow = f;
+        err = regislex_id_map_insert(&executor.runs, r);
+        if (err != REGISLEX_OK) {
+            platform_free(r);
+            break;
+        }
+
+        if (started) {
+            r->state = RUN_RESUMABLE;
+            list_push(&executor.resumable, r);
+        } else {
+            r->state = RUN_PENDING;
+            list_push(&f->pending, r);
+            executor.pending_count++;
+            flow_mark_ready(f);
+        }
+    }
+    regislex_db_finalize(stmt);
+
+    return err == REGISLEX_ERROR_NOT_FOUND ? REGISLEX_OK : err;
+}
+
+static void executor_clear(void) {
+    for (int i = 0; i < executor.runs.capacity; i++) {
+        platform_free(executor.runs.slots[i]);
+    }
+    for (int i = 0; i < executor.flows.capacity; i++) {
+        exec_flow_t* f = (exec_flow_t*)executor.flows.slots[i];
+        if (!f) continue;
+        versions_clear(f);
+        def_free(f->def);
+        platform_free(f);
+    }
+    regislex_id_map_free(&executor.runs);
+    regislex_id_map_free(&executor.flows);
+    platform_free(executor.heap);
+    platform_free(executor.events);
+    platform_free(executor.workers);
+}
+
+/* ============================================================================
+ * Executor Functions
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_workflow_executor_start(
+    regislex_context_t* ctx,
+    const regislex_workflow_executor_options_t* options)
+{
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (executor.mutex) {
+        return REGISLEX_ERROR_ALREADY_EXISTS;
+    }
+
+    memset(&executor, 0, sizeof(executor));
+    regislex_id_map_init(&executor.flows, offsetof(exec_flow_t, workflow_id.value));
+    regislex_id_map_init(&executor.runs, offsetof(exec_run_t, id.value));
+    executor.ctx = ctx;
+    executor.worker_count = options && options->worker_count > 0
+        ? options->worker_count : EXECUTOR_DEFAULT_WORKERS;
+    executor.max_active_runs = options && options->max_active_runs > 0
+        ? options->max_active_runs : 0;
+    executor.queue_limit = options && options->queue_limit > 0
+        ? options->queue_limit : EXECUTOR_DEFAULT_QUEUE_LIMIT;
+    executor.horizon_end = INT64_MIN;
+    executor.load_retry_ms = INT64_MIN;
+
+    executor.workers = (platform_thread_t**)platform_calloc(
+        executor.worker_count, sizeof(platform_thread_t*));
+    if (!executor.workers) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    regislex_error_t err = executor_recover();
+    if (err != REGISLEX_OK) {
+        executor_clear();
+        memset(&executor, 0, sizeof(executor));
+        return err;
+    }
+
+    if (platform_mutex_create(&executor.mutex) != PLATFORM_OK) {
+        executor_clear();
+        memset(&executor, 0, sizeof(executor));
+        return REGISLEX_ERROR;
+    }
+    if (platform_cond_create(&executor.wake) != PLATFORM_OK) {
+        platform_mutex_destroy(executor.mutex);
+        executor_clear();
+        memset(&executor, 0, sizeof(executor));
+        return REGISLEX_ERROR;
+    }
+    if (platform_cond_create(&executor.flushed) != PLATFORM_OK) {
+        platform_cond_destroy(executor.wake);
+        platform_mutex_destroy(executor.mutex);
+        executor_clear();
+        memset(&executor, 0, sizeof(executor));
+        return REGISLEX_ERROR;
+    }
+
+    executor.running = true;
+    for (int i = 0; i < executor.worker_count; i++) {
+        if (platform_thread_create(&executor.workers[i], executor_worker, NULL) != PLATFORM_OK) {
+            regislex_workflow_executor_stop();
+            return REGISLEX_ERROR;
+        }
+        executor.started++;
+    }
+
+    return REGISLEX_OK;
+}
+
+REGISLEX_API void regislex_workflow_executor_stop(void) {
+    if (!executor.mutex) return;
+
+    platform_mutex_lock(executor.mutex);
+    executor.running = false;
+    platform_cond_broadcast(executor.wake);
+    platform_mutex_unlock(executor.mutex);
+
+    for (int i = 0; i < executor.started; i++) {
+        platform_thread_join(executor.workers[i], NULL);
+    }
+
+    /* Store the events the workers left buffered */
+    platform_mutex_lock(executor.mutex);
+    if (executor.event_count > 0) events_flush();
+    platform_mutex_unlock(executor.mutex);
+
+    executor_clear();
+    platform_cond_destroy(executor.flushed);
+    platform_cond_destroy(executor.wake);
+    platform_mutex_destroy(executor.mutex);
+    memset(&executor, 0, sizeof(executor));
+}
+
+REGISLEX_API void regislex_workflow_executor_invalidate(const regislex_uuid_t* workflow_id) {
+    if (!workflow_id || !executor.mutex) return;
+
+    platform_mutex_lock(executor.mutex);
+    executor.def_epoch++;
+    exec_flow_t* f = flow_find(workflow_id);
+    if (f && f->def) {
+        /* Kept for the started runs of its version */
+        flow_version_t* v = version_find(f, f->def->version);
+        if (v && !v->def) v->def = f->def;
+        else def_release(f->def);
+        f->def = NULL;
+    }
+    platform_mutex_unlock(executor.mutex);
+}
+
+REGISLEX_API regislex_error_t regislex_workflow_submit(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* workflow_id,
+    const regislex_uuid_t* case_id,
+    const char* trigger_data,
+    regislex_uuid_t* out_run_id)
+{
+    return regislex_workflow_submit_trigger(ctx, NULL, workflow_id, case_id, trigger_data, out_run_id);
+}
+
+/* Queue a run; over_limit admits it past the queue limit */
+static regislex_error_t run_submit(regislex_context_t* ctx,
+                                   const regislex_uuid_t* trigger_id,
+                                   const regislex_uuid_t* workflow_id,
+                                   const regislex_uuid_t* case_id,
+                                   const char* trigger_data,
+                                   bool over_limit,
+                                   regislex_uuid_t* out_run_id) {
+    if (!ctx || !workflow_id || !out_run_id) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!executor.mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    flow_def_t* def = NULL;
+    regislex_error_t err = def_acquire(ctx, workflow_id, &def);
+    if (err != REGISLEX_OK) return err;
+
+    bool active = def->workflow->status == REGISLEX_WORKFLOW_ACTIVE;
+    int limit = def->limit;
+    platform_mutex_lock(executor.mutex);
+    def_release(def);
+    platform_mutex_unlock(executor.mutex);
+    if (!active) {
+        return REGISLEX_ERROR_INVALID_STATE;
+    }
+
+    exec_run_t* r = (exec_run_t*)platform_calloc(1, sizeof(exec_run_t));
+    if (!r) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    regislex_uuid_generate(&r->id);
+
+    /* Reserve a queue place before writing the row */
+    platform_mutex_lock(executor.mutex);
+    if (!executor.running) {
+        err = REGISLEX_ERROR_NOT_INITIALIZED;
+    } else if (executor.pending_count >= executor.queue_limit && !over_limit) {
+        err = REGISLEX_ERROR_QUOTA_EXCEEDED;
+    } else {
+        executor.pending_count++;
+    }
+    platform_mutex_unlock(executor.mutex);
+
+    if (err != REGISLEX_OK) {
+        platform_free(r);
+        return err;
+    }
+
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    regislex_db_stmt_t* stmt = NULL;
+    err = regislex_db_prepare(regislex_get_db(ctx),
+        "INSERT INTO workflow_runs ("
+        "  id, workflow_id, case_id, triggered_by, trigger_data, status, current_step,"
+        "  created_at, updated_at"
+        ") VALUES (?, ?, ?, ?, ?, ?, 0, ?, ?)", &stmt);
+    if (err == REGISLEX_OK) {
+        regislex_db_bind_uuid(stmt, 1, &r->id);
+        regislex_db_bind_uuid(stmt, 2, workflow_id);
+        regislex_db_bind_uuid(stmt, 3, case_id);
+        regislex_db_bind_uuid(stmt, 4, trigger_id);
+        regislex_db_bind_text(stmt, 5, trigger_data);
+        regislex_db_bind_int(stmt, 6, REGISLEX_WORKFLOW_ACTIVE);
+        regislex_db_bind_datetime(stmt, 7, &now);
+        regislex_db_bind_datetime(stmt, 8, &now);
+        err = regislex_db_step(stmt);
+        regislex_db_finalize(stmt);
+        if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
+    }
+
+    platform_mutex_lock(executor.mutex);
+    exec_flow_t* flow = NULL;
+    if (err == REGISLEX_OK) {
+        flow = flow_get(workflow_id);
+        err = flow ? regislex_id_map_insert(&executor.runs, r) : REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    if (err != REGISLEX_OK) {
+        executor.pending_count--;
+        platform_mutex_unlock(executor.mutex);
+        platform_free(r);
+        return err;
+    }
+
+    /* The stored settings apply from this run on */
+    flow->limit = limit;
+    r->flow = flow;
+    r->state = RUN_PENDING;
+    list_push(&flow->pending, r);
+    flow_mark_ready(flow);
+    platform_cond_signal(executor.wake);
+
+    memcpy(out_run_id, &r->id, sizeof(regislex_uuid_t));
+    platform_mutex_unlock(executor.mutex);
+
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_workflow_submit_trigger(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* trigger_id,
+    const regislex_uuid_t* workflow_id,
+    const regislex_uuid_t* case_id,
+    const char* trigger_data,
+    regislex_uuid_t* out_run_id)
+{
+    return run_submit(ctx, trigger_id, workflow_id, case_id, trigger_data, false, out_run_id);
+}
+
+REGISLEX_API regislex_error_t regislex_workflow_submit_backlog(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* trigger_id,
+    const regislex_uuid_t* workflow_id,
+    const regislex_uuid_t* case_id,
+    const char* trigger_data,
+    regislex_uuid_t* out_run_id)
+{
+    return run_submit(ctx, trigger_id, workflow_id, case_id, trigger_data, true, out_run_id);
+}
+
+REGISLEX_API regislex_error_t regislex_workflow_approval_resolve(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* run_id,
+    bool approved,
+    const char* reason)
+{
+    if (!ctx || !run_id) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_transaction_t* tx = NULL;
+    regislex_error_t err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_uuid_t workflow_id = {{0}};
+    int step = 0;
+    int version = 0;
+    err = regislex_db_prepare(db,
+        "SELECT r.workflow_id, r.current_step, r.workflow_version FROM workflow_timers t"
+        " JOIN workflow_runs r ON r.id = t.run_id"
+        " WHERE t.run_id = ? AND t.kind = ? AND r.status = ?", &stmt);
+    if (err == REGISLEX_OK) {
+        regislex_db_bind_uuid(stmt, 1, run_id);
+        regislex_db_bind_int(stmt, 2, REGISLEX_ACTION_APPROVAL);
+        regislex_db_bind_int(stmt, 3, REGISLEX_WORKFLOW_ACTIVE);
+        err = regislex_db_step(stmt);
+        if (err == REGISLEX_OK) {
+            regislex_db_column_uuid(stmt, 0, &workflow_id);
+            step = (int)regislex_db_column_int(stmt, 1);
+            version = (int)regislex_db_column_int(stmt, 2);
+        }
+        regislex_db_finalize(stmt);
+        if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_ERROR_INVALID_STATE;
+    }
+
+    if (err == REGISLEX_OK) {
+        err = regislex_db_prepare(db, "DELETE FROM workflow_timers WHERE run_id = ?", &stmt);
+        if (err == REGISLEX_OK) {
+            regislex_db_bind_uuid(stmt, 1, run_id);
+            err = regislex_db_step(stmt);
+            regislex_db_finalize(stmt);
+            if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
+        }
+    }
+
+    bool closed = false;
+    char message[256];
+    if (err == REGISLEX_OK && approved) {
+        regislex_datetime_t now;
+        regislex_datetime_now(&now);
+        err = regislex_db_prepare(db,
+            "UPDATE workflow_runs SET current_step = current_step + 1, updated_at = ? WHERE id = ?", &stmt);
+        if (err == REGISLEX_OK) {
+            regislex_db_bind_datetime(stmt, 1, &now);
+            regislex_db_bind_uuid(stmt, 2, run_id);
+            err = regislex_db_step(stmt);
+            regislex_db_finalize(stmt);
+            if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
+        }
+    } else if (err == REGISLEX_OK) {
+        snprintf(message, sizeof(message), "Approval rejected%s%s",
+                 reason && reason[0] ? ": " : "", reason ? reason : "");
+        err = run_close(db, run_id, REGISLEX_WORKFLOW_FAILED, message, &closed);
+    }
+
+    /* Resume or release only once the resolution is durable */
+    if (err == REGISLEX_OK && (approved || closed)) {
+        err = run_settle(ctx, run_id, &workflow_id, version, step, approved, closed,
+                         REGISLEX_RUN_EVENT_FAILED, approved ? NULL : message);
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        return err;
+    }
+    return REGISLEX_OK;
+}
+
+/* ============================================================================
+ * Workflow Run Functions
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_workflow_execute(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* workflow_id,
+    const regislex_uuid_t* case_id,
+    const char* trigger_data,
+    regislex_workflow_run_t** out_run)
+{
+    if (!ctx || !workflow_id || !out_run) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_uuid_t run_id;
+    regislex_error_t err = regislex_workflow_submit(ctx, workflow_id, case_id, trigger_data, &run_id);
+    if (err != REGISLEX_OK) return err;
+
+    return regislex_workflow_run_get(ctx, &run_id, out_run);
+}
+
+REGISLEX_API regislex_error_t regislex_workflow_run_get(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* run_id,
+    regislex_workflow_run_t** out_run)
+{
+    if (!ctx || !run_id || !out_run) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(ctx),
+        "SELECT " RUN_COLUMNS " FROM workflow_runs WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_uuid(stmt, 1, run_id);
+
+    err = regislex_db_step(stmt);
+    if (err != REGISLEX_OK) {
+        regislex_db_finalize(stmt);
+        return err;
+    }
+
+    regislex_workflow_run_t* run = (regislex_workflow_run_t*)platform_calloc(1, sizeof(regislex_workflow_run_t));
+    if (!run) {
+        regislex_db_finalize(stmt);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    int col = 0;
+    regislex_db_column_uuid(stmt, col++, &run->id);
+    regislex_db_column_uuid(stmt, col++, &run->workflow_id);
+    regislex_db_column_uuid(stmt, col++, &run->case_id);
+    regislex_db_column_uuid(stmt, col++, &run->triggered_by);
+
+    const char* trigger_data = regislex_db_column_text(stmt, col++);
+    if (trigger_data) strncpy(run->trigger_data, trigger_data, sizeof(run->trigger_data) - 1);
+
+    run->status = (regislex_workflow_status_t)regislex_db_column_int(stmt, col++);
+    regislex_db_column_uuid(stmt, col++, &run->current_action_id);
+    run->current_step = (int)regislex_db_column_int(stmt, col++);
+
+    const char* message = regislex_db_column_text(stmt, col++);
+    if (message) strncpy(run->error_message, message, sizeof(run->error_message) - 1);
+
+    regislex_db_column_datetime(stmt, col++, &run->started_at);
+    regislex_db_column_datetime(stmt, col++, &run->completed_at);
+    regislex_db_column_datetime(stmt, col++, &run->created_at);
+    regislex_db_finalize(stmt);
+
+    *out_run = run;
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_workflow_run_variable_get(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* run_id,
+    const char* name,
+    char* value,
+    size_t value_size)
+{
+    if (!ctx || !run_id || !name || !value || value_size == 0) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(ctx),
+        "SELECT value FROM workflow_run_variables WHERE run_id = ? AND name = ?", &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_uuid(stmt, 1, run_id);
+    regislex_db_bind_text(stmt, 2, name);
+
+    err = regislex_db_step(stmt);
+    if (err == REGISLEX_OK) {
+        const char* stored = regislex_db_column_text(stmt, 0);
+        strncpy(value, stored ? stored : "", value_size - 1);
+        value[value_size - 1] = '\0';
+    }
+    regislex_db_finalize(stmt);
+
+    return err;
+}
+
+static regislex_error_t event_list_push(regislex_run_event_list_t* list, int* capacity,
+                                        const regislex_run_event_t* ev) {
+    if (list->count >= *capacity) {
+        int new_capacity = *capacity ? *capacity * 2 : 32;
+        regislex_run_event_t* grown = (regislex_run_event_t*)platform_realloc(
+            list->events, (size_t)new_capacity * sizeof(regislex_run_event_t));
+        if (!grown) return REGISLEX_ERROR_OUT_OF_MEMORY;
+        list->events = grown;
+        *capacity = new_capacity;
+    }
+    list->events[list->count++] = *ev;
+    return REGISLEX_OK;
+}
+
+static bool event_matches(const regislex_run_event_t* ev, const regislex_run_event_filter_t* filter) {
+    if (!filter) return true;
+    if (filter->run_id && strcmp(ev->run_id.value, filter->run_id->value) != 0) return false;
+    if (filter->since_ms && ev->occurred_ms < filter->since_ms) return false;
+    if (filter->until_ms && ev->occurred_ms >= filter->until_ms) return false;
+    return true;
+}
+
+/*
+ * Appends the events not stored yet, the batch being flushed first, up
+ * to the filter's limit. Their ids are 0 until they are stored.
+ */
+static regislex_error_t events_append_unstored(const regislex_run_event_filter_t* filter,
+                                               regislex_run_event_list_t* list, int* capacity) {
+    regislex_error_t err = REGISLEX_OK;
+    int limit = filter && filter->limit > 0 ? filter->limit : INT32_MAX;
+
+    platform_mutex_lock(executor.mutex);
+    const regislex_run_event_t* sources[2] = { executor.flush_batch, executor.events };
+    int counts[2] = { executor.flush_count, executor.event_count };
+    for (int s = 0; s < 2 && err == REGISLEX_OK; s++) {
+        for (int i = 0; i < counts[s] && list->count < limit && err == REGISLEX_OK; i++) {
+            if (event_matches(&sources[s][i], filter)) {
+                err = event_list_push(list, capacity, &sources[s][i]);
+            }
+        }
+    }
+    platform_mutex_unlock(executor.mutex);
+
+    return err;
+}
+
+REGISLEX_API regislex_error_t regislex_workflow_run_events(
+    regislex_context_t* ctx,
+    const regislex_run_event_filter_t* filter,
+    regislex_run_event_list_t** out_list)
+{
+    if (!ctx || !out_list) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    /* Storing a batch inside the caller's transaction would tie the log to
+     * its outcome, so buffered events are then read from memory instead */
+    bool in_transaction = regislex_db_in_transaction(regislex_get_db(ctx));
+    if (executor.mutex && !in_transaction) {
+        platform_mutex_lock(executor.mutex);
+        while (executor.flushing) {
+            platform_cond_wait(executor.flushed, executor.mutex);
+        }
+        if (executor.event_count > 0) events_flush();
+        platform_mutex_unlock(executor.mutex);
+    }
+
+    char sql[512] = "SELECT " EVENT_COLUMNS " FROM workflow_run_events";
+    char where_clause[256] = "";
+
+    if (filter) {
+        if (filter->run_id) {
+            strcat(where_clause, where_clause[0] ? " AND " : " WHERE ");
+            strcat(where_clause, "run_id = ?");
+        }
+        if (filter->since_ms) {
+            strcat(where_clause, where_clause[0] ? " AND " : " WHERE ");
+            strcat(where_clause, "occurred_ms >= ?");
+        }
+        if (filter->until_ms) {
+            strcat(where_clause, where_clause[0] ? " AND " : " WHERE ");
+            strcat(where_clause, "occurred_ms < ?");
+        }
+    }
+
+    strcat(sql, where_clause);
+    strcat(sql, " ORDER BY id");
+
+    if (filter && filter->limit > 0) {
+        char pagination[32];
+        snprintf(pagination, sizeof(pagination), " LIMIT %d", filter->limit);
+        strcat(sql, pagination);
+    }
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(ctx), sql, &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    int idx = 1;
+    if (filter && filter->run_id) regislex_db_bind_uuid(stmt, idx++, filter->run_id);
+    if (filter && filter->since_ms) regislex_db_bind_int(stmt, idx++, filter->since_ms);
+    if (filter && filter->until_ms) regislex_db_bind_int(stmt, idx++, filter->until_ms);
+
+    regislex_run_event_list_t* list = (regislex_run_event_list_t*)platform_calloc(1, sizeof(regislex_run_event_list_t));
+    if (!list) {
+        regislex_db_finalize(stmt);
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+
+    int capacity = 0;
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        regislex_run_event_t row;
+        memset(&row, 0, sizeof(row));
+        err = event_list_push(list, &capacity, &row);
+        if (err != REGISLEX_OK) break;
+
+        regislex_run_event_t* ev = &list->events[list->count - 1];
+
+        int col = 0;
+        ev->id = regislex_db_column_int(stmt, col++);
+        regislex_db_column_uuid(stmt, col++, &ev->run_id);
+        ev->type = (regislex_run_event_type_t)regislex_db_column_int(stmt, col++);
+        ev->occurred_ms = regislex_db_column_int(stmt, col++);
+        ev->step = (int)regislex_db_column_int(stmt, col++);
+        regislex_db_column_uuid(stmt, col++, &ev->action_id);
+        ev->action_type = (regislex_action_type_t)regislex_db_column_int(stmt, col++);
+        ev->duration_ms = (int)regislex_db_column_int(stmt, col++);
+        ev->error = (regislex_error_t)regislex_db_column_int(stmt, col++);
+
+        const char* message = regislex_db_column_text(stmt, col++);
+        if (message) strncpy(ev->message, message, sizeof(ev->message) - 1);
+    }
+    regislex_db_finalize(stmt);
+
+    if (err == REGISLEX_ERROR_NOT_FOUND && executor.mutex && in_transaction) {
+        err = events_append_unstored(filter, list, &capacity);
+        if (err == REGISLEX_OK) err = REGISLEX_ERROR_NOT_FOUND;
+    }
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        regislex_run_event_list_free(list);
+        return err;
+    }
+
+    *out_list = list;
+    return REGISLEX_OK;
+}
+
+REGISLEX_API void regislex_run_event_list_free(regislex_run_event_list_t* list) {
+    if (!list) return;
+
+    platform_free(list->events);
+    platform_free(list);
+}
+
+REGISLEX_API regislex_error_t regislex_workflow_run_cancel(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* run_id)
+{
+    if (!ctx || !run_id) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (executor.mutex) {
+        platform_mutex_lock(executor.mutex);
+        exec_run_t* r = (exec_run_t*)regislex_id_map_get(&executor.runs, run_id->value);
+        if (r && r->state == RUN_EXECUTING) {
+            /* The worker stops before the next action */
+            r->cancel_requested = true;
+            platform_mutex_unlock(executor.mutex);
+            return REGISLEX_OK;
+        }
+        if (r && r->state == RUN_PENDING) {
+            list_unlink(&r->flow->pending, r);
+            executor.pending_count--;
+            run_forget(r);
+        } else if (r) {
+            list_unlink(&executor.resumable, r);
+            run_forget(r);
+        }
+        platform_mutex_unlock(executor.mutex);
+    }
+
+    return run_cancel_stored(ctx, run_id);
+}
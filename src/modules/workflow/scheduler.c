@@ -0,0 +1,527 @@
+/**
+ * @file scheduler.c
+ * @brief Cron Scheduler
+ *
+ * SCHEDULED triggers, scheduled reports and the minute tick (deadline
+ * due/overdue sweep and agenda series roll) share one min-heap keyed by
+ * next fire time, with an id map giving each entry's heap slot. A single
+ * thread sleeps on a condition variable until the earliest entry is due,
+ * so idle schedules cost nothing but their heap slot.
+ *
+ * A due entry is moved to its next fire time before it fires, so it never
+ * leaves the heap and may be changed or removed while its fire is running.
+ * The next fire time is computed from the later of the due time and now,
+ * which skips occurrences missed while the thread was held up.
+ */
+
+#include "regislex/regislex.h"
+#include "database/database.h"
+#include "platform/platform.h"
+#include "utils/id_map.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#define SCHEDULER_INITIAL_SLOTS  64
+#define SCHEDULER_SWEEP_ID       "deadline-sweep"
+#define SCHEDULER_SWEEP_CRON     "* * * * *"
+
+/* ============================================================================
+ * Internal Structures
+ * ============================================================================ */
+
+typedef enum {
+    SCHEDULE_TRIGGER,
+    SCHEDULE_REPORT,
+    SCHEDULE_SWEEP
+} schedule_kind_t;
+
+typedef struct {
+    regislex_uuid_t id;
+    regislex_uuid_t workflow_id;    /* Triggers only */
+    schedule_kind_t kind;
+    regislex_cron_t cron;
+    int period;
+    int matches;                /* Matches since the last fire */
+    int64_t fire_ms;
+    int heap_index;
+    bool seen;                  /* Found by the current reload */
+} schedule_entry_t;
+
+/* A scheduled trigger as loaded by a reload */
+typedef struct {
+    regislex_uuid_t id;
+    regislex_uuid_t workflow_id;
+    regislex_cron_t cron;
+} schedule_row_t;
+
+typedef struct {
+    regislex_context_t* ctx;
+
+    platform_mutex_t* mutex;
+    platform_cond_t* wake;
+    platform_thread_t* thread;
+    bool running;
+
+    schedule_entry_t** heap;
+    int heap_count;
+    int heap_capacity;
+
+    regislex_id_map_t entries;  /* Keyed by id over every entry */
+
+    uint64_t reload_seq;        /* Last reload started */
+    uint64_t loaded_seq;        /* Reload the triggers came from */
+} cron_scheduler_t;
+
+static cron_scheduler_t scheduler;
+
+/* ============================================================================
+ * Heap and Id Map (caller holds scheduler.mutex)
+ * ============================================================================ */
+
+static void heap_set(int index, schedule_entry_t* e) {
+    scheduler.heap[index] = e;
+    e->heap_index = index;
+}
+
+static void heap_sift_up(int index) {
+    schedule_entry_t* e = scheduler.heap[index];
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (scheduler.heap[parent]->fire_ms <= e->fire_ms) break;
+        heap_set(index, scheduler.heap[parent]);
+        index = parent;
+    }
+    heap_set(index, e);
+}
+
+static void heap_sift_down(int index) {
+    schedule_entry_t* e = scheduler.heap[index];
+    for (;;) {
+        int child = index * 2 + 1;
+        if (child >= scheduler.heap_count) break;
+        if (child + 1 < scheduler.heap_count &&
+            scheduler.heap[child + 1]->fire_ms < scheduler.heap[child]->fire_ms) {
+            child++;
+        }
+        if (e->fire_ms <= scheduler.heap[child]->fire_ms) break;
+        heap_set(index, scheduler.heap[child]);
+        index = child;
+    }
+    heap_set(index, e);
+}
+
+static void heap_update(schedule_entry_t* e, int64_t fire_ms) {
+    int64_t old = e->fire_ms;
+    e->fire_ms = fire_ms;
+    if (fire_ms < old) heap_sift_up(e->heap_index);
+    else heap_sift_down(e->heap_index);
+}
+
+static regislex_error_t heap_push(schedule_entry_t* e) {
+    if (scheduler.heap_count >= scheduler.heap_capacity) {
+        int new_capacity = scheduler.heap_capacity ? scheduler.heap_capacity * 2 : SCHEDULER_INITIAL_SLOTS;
+        schedule_entry_t** grown = (schedule_entry_t**)platform_realloc(
+            scheduler.heap, (size_t)new_capacity * sizeof(schedule_entry_t*));
+        if (!grown) return REGISLEX_ERROR_OUT_OF_MEMORY;
+        scheduler.heap = grown;
+        scheduler.heap_capacity = new_capacity;
+    }
+
+    heap_set(scheduler.heap_count++, e);
+    heap_sift_up(e->heap_index);
+    return REGISLEX_OK;
+}
+
+static void heap_remove(schedule_entry_t* e) {
+    int index = e->heap_index;
+    schedule_entry_t* last = scheduler.heap[--scheduler.heap_count];
+    e->heap_index = -1;
+    if (last == e) return;
+
+    heap_set(index, last);
+    if (index > 0 && scheduler.heap[(index - 1) / 2]->fire_ms > last->fire_ms) {
+        heap_sift_up(index);
+    } else {
+        heap_sift_down(index);
+    }
+}
+
+/* Drops an entry that is no longer in the heap */
+static void entry_release(schedule_entry_t* e) {
+    regislex_id_map_remove(&scheduler.entries, e->id.value);
+    platform_free(e);
+}
+
+/*
+ * Adds an entry, or reschedules the existing one with the same id when its
+ * schedule changed. Returns NOT_FOUND, removing any existing entry, when
+ * the schedule never fires.
+ */
+static regislex_error_t schedule_set(schedule_kind_t kind, const regislex_uuid_t* id,
+                                     const regislex_uuid_t* workflow_id,
+                                     const regislex_cron_t* cron, int period) {
+    schedule_entry_t* e = (schedule_entry_t*)regislex_id_map_get(&scheduler.entries, id->value);
+    if (e) {
+        e->seen = true;
+        if (memcmp(&e->cron, cron, sizeof(regislex_cron_t)) == 0 && e->period == period) {
+            return REGISLEX_OK;
+        }
+    }
+
+    int64_t fire_ms = 0;
+    regislex_error_t err = regislex_cron_next(cron, platform_time_ms(), &fire_ms);
+    if (err != REGISLEX_OK) {
+        if (e) {
+            heap_remove(e);
+            entry_release(e);
+        }
+        return err;
+    }
+
+    if (e) {
+        memcpy(&e->cron, cron, sizeof(regislex_cron_t));
+        e->period = period;
+        e->matches = 0;
+        heap_update(e, fire_ms);
+        return REGISLEX_OK;
+    }
+
+    e = (schedule_entry_t*)platform_calloc(1, sizeof(schedule_entry_t));
+    if (!e) return REGISLEX_ERROR_OUT_OF_MEMORY;
+    memcpy(&e->id, id, sizeof(regislex_uuid_t));
+    if (workflow_id) memcpy(&e->workflow_id, workflow_id, sizeof(regislex_uuid_t));
+    e->kind = kind;
+    memcpy(&e->cron, cron, sizeof(regislex_cron_t));
+    e->period = period;
+    e->fire_ms = fire_ms;
+    e->heap_index = -1;
+    e->seen = true;
+
+    err = regislex_id_map_insert(&scheduler.entries, e);
+    if (err != REGISLEX_OK) {
+        platform_free(e);
+        return err;
+    }
+    err = heap_push(e);
+    if (err != REGISLEX_OK) {
+        entry_release(e);
+    }
+    return err;
+}
+
+/* ============================================================================
+ * Trigger Loading
+ * ============================================================================ */
+
+/* Loads and compiles the active SCHEDULED triggers of active workflows */
+static regislex_error_t triggers_load(regislex_context_t* ctx, schedule_row_t** out_rows, int* out_count) {
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(ctx),
+        "SELECT t.id, t.workflow_id, t.schedule_cron"
+        " FROM workflow_triggers t JOIN workflows w ON w.id = t.workflow_id"
+        " WHERE t.type = ? AND t.is_active = 1 AND w.status = ?", &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_int(stmt, 1, REGISLEX_TRIGGER_SCHEDULED);
+    regislex_db_bind_int(stmt, 2, REGISLEX_WORKFLOW_ACTIVE);
+
+    schedule_row_t* rows = NULL;
+    int count = 0;
+    int capacity = 0;
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        const char* expr = regislex_db_column_text(stmt, 2);
+        regislex_cron_t cron;
+        if (!expr || regislex_cron_compile(expr, &cron) != REGISLEX_OK) continue;
+
+        if (count >= capacity) {
+            int new_capacity = capacity ? capacity * 2 : SCHEDULER_INITIAL_SLOTS;
+            schedule_row_t* grown = (schedule_row_t*)platform_realloc(
+                rows, (size_t)new_capacity * sizeof(schedule_row_t));
+            if (!grown) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            rows = grown;
+            capacity = new_capacity;
+        }
+
+        schedule_row_t* row = &rows[count++];
+        memset(row, 0, sizeof(*row));
+        regislex_db_column_uuid(stmt, 0, &row->id);
+        regislex_db_column_uuid(stmt, 1, &row->workflow_id);
+        row->cron = cron;
+    }
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        platform_free(rows);
+        return err;
+    }
+
+    *out_rows = rows;
+    *out_count = count;
+    return REGISLEX_OK;
+}
+
+/* Replaces the scheduled triggers with rows (caller holds scheduler.mutex) */
+static void triggers_apply(const schedule_row_t* rows, int count) {
+    for (int i = 0; i < scheduler.heap_count; i++) {
+        scheduler.heap[i]->seen = false;
+    }
+
+    for (int i = 0; i < count; i++) {
+        schedule_set(SCHEDULE_TRIGGER, &rows[i].id, &rows[i].workflow_id, &rows[i].cron, 1);
+    }
+
+    /* Sweep the triggers that are gone, then restore the heap order */
+    int kept = 0;
+    for (int i = 0; i < scheduler.heap_count; i++) {
+        schedule_entry_t* e = scheduler.heap[i];
+        if (e->kind == SCHEDULE_TRIGGER && !e->seen) {
+            entry_release(e);
+        } else {
+            heap_set(kept++, e);
+        }
+    }
+    scheduler.heap_count = kept;
+    for (int i = kept / 2 - 1; i >= 0; i--) {
+        heap_sift_down(i);
+    }
+}
+
+/* ============================================================================
+ * Scheduler Thread
+ * ============================================================================ */
+
+static void schedule_fire(schedule_kind_t kind, const regislex_uuid_t* id,
+                          const regislex_uuid_t* workflow_id, int64_t fire_ms) {
+    if (kind == SCHEDULE_REPORT) {
+        regislex_report_t* report = NULL;
+        if (regislex_scheduled_report_run_now(scheduler.ctx, id, &report) == REGISLEX_OK) {
+            regislex_report_free(report);
+        }
+        return;
+    }
+    if (kind == SCHEDULE_SWEEP) {
+        /* A failed sweep leaves its position alone; the next one covers the gap */
+        regislex_deadline_sweep(scheduler.ctx, NULL);
+        regislex_agenda_roll(scheduler.ctx);
+        return;
+    }
+
+    /*
+     * A full executor queue drops this occurrence; the trigger fires again
+     * at its next one rather than holding up every other schedule.
+     */
+    char trigger_data[64];
+    snprintf(trigger_data, sizeof(trigger_data), "{\"scheduled_ms\":%lld}", (long long)fire_ms);
+
+    regislex_uuid_t run_id;
+    regislex_workflow_submit_trigger(scheduler.ctx, id, workflow_id, NULL, trigger_data, &run_id);
+}
+
+static void* scheduler_thread(void* arg) {
+    (void)arg;
+
+    platform_mutex_lock(scheduler.mutex);
+    while (scheduler.running) {
+        if (scheduler.heap_count == 0) {
+            platform_cond_wait(scheduler.wake, scheduler.mutex);
+            continue;
+        }
+
+        int64_t now = platform_time_ms();
+        schedule_entry_t* e = scheduler.heap[0];
+        int64_t wait = e->fire_ms - now;
+        if (wait > 0) {
+            platform_cond_timedwait(scheduler.wake, scheduler.mutex,
+                                    wait > 0x7fffffff ? 0x7fffffff : (int)wait);
+            continue;
+        }
+
+        schedule_kind_t kind = e->kind;
+        regislex_uuid_t id = e->id;
+        regislex_uuid_t workflow_id = e->workflow_id;
+        int64_t fire_ms = e->fire_ms;
+        bool fire = ++e->matches >= e->period;
+        if (fire) e->matches = 0;
+
+        int64_t next_ms = 0;
+        if (regislex_cron_next(&e->cron, fire_ms > now ? fire_ms : now, &next_ms) == REGISLEX_OK) {
+            heap_update(e, next_ms);
+        } else {
+            heap_remove(e);
+            entry_release(e);
+        }
+
+        if (fire) {
+            platform_mutex_unlock(scheduler.mutex);
+            schedule_fire(kind, &id, &workflow_id, fire_ms);
+            platform_mutex_lock(scheduler.mutex);
+        }
+    }
+    platform_mutex_unlock(scheduler.mutex);
+
+    return NULL;
+}
+
+static void scheduler_clear(void) {
+    for (int i = 0; i < scheduler.heap_count; i++) {
+        platform_free(scheduler.heap[i]);
+    }
+    platform_free(scheduler.heap);
+    regislex_id_map_free(&scheduler.entries);
+}
+
+/* ============================================================================
+ * Cron Scheduler Functions
+ * ============================================================================ */
+
+REGISLEX_API regislex_error_t regislex_cron_scheduler_start(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (scheduler.mutex) {
+        return REGISLEX_ERROR_ALREADY_EXISTS;
+    }
+
+    schedule_row_t* rows = NULL;
+    int count = 0;
+    regislex_error_t err = triggers_load(ctx, &rows, &count);
+    if (err != REGISLEX_OK) return err;
+
+    memset(&scheduler, 0, sizeof(scheduler));
+    regislex_id_map_init(&scheduler.entries, offsetof(schedule_entry_t, id.value));
+    scheduler.ctx = ctx;
+
+    if (platform_mutex_create(&scheduler.mutex) != PLATFORM_OK) {
+        platform_free(rows);
+        memset(&scheduler, 0, sizeof(scheduler));
+        return REGISLEX_ERROR;
+    }
+    if (platform_cond_create(&scheduler.wake) != PLATFORM_OK) {
+        platform_free(rows);
+        platform_mutex_destroy(scheduler.mutex);
+        memset(&scheduler, 0, sizeof(scheduler));
+        return REGISLEX_ERROR;
+    }
+
+    triggers_apply(rows, count);
+    platform_free(rows);
+
+    regislex_cron_t sweep_cron;
+    regislex_uuid_t sweep_id;
+    memset(&sweep_id, 0, sizeof(sweep_id));
+    strncpy(sweep_id.value, SCHEDULER_SWEEP_ID, sizeof(sweep_id.value) - 1);
+    err = regislex_cron_compile(SCHEDULER_SWEEP_CRON, &sweep_cron);
+    if (err == REGISLEX_OK) {
+        err = schedule_set(SCHEDULE_SWEEP, &sweep_id, NULL, &sweep_cron, 1);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_cron_scheduler_stop();
+        return err;
+    }
+
+    scheduler.running = true;
+    if (platform_thread_create(&scheduler.thread, scheduler_thread, NULL) != PLATFORM_OK) {
+        scheduler.thread = NULL;
+        regislex_cron_scheduler_stop();
+        return REGISLEX_ERROR;
+    }
+
+    return REGISLEX_OK;
+}
+
+REGISLEX_API void regislex_cron_scheduler_stop(void) {
+    if (!scheduler.mutex) return;
+
+    platform_mutex_lock(scheduler.mutex);
+    scheduler.running = false;
+    platform_cond_broadcast(scheduler.wake);
+    platform_mutex_unlock(scheduler.mutex);
+
+    if (scheduler.thread) {
+        platform_thread_join(scheduler.thread, NULL);
+    }
+
+    scheduler_clear();
+    platform_cond_destroy(scheduler.wake);
+    platform_mutex_destroy(scheduler.mutex);
+    memset(&scheduler, 0, sizeof(scheduler));
+}
+
+REGISLEX_API regislex_error_t regislex_cron_scheduler_reload(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!scheduler.mutex) {
+        return REGISLEX_OK;
+    }
+
+    platform_mutex_lock(scheduler.mutex);
+    uint64_t seq = ++scheduler.reload_seq;
+    platform_mutex_unlock(scheduler.mutex);
+
+    schedule_row_t* rows = NULL;
+    int count = 0;
+    regislex_error_t err = triggers_load(ctx, &rows, &count);
+    if (err != REGISLEX_OK) return err;
+
+    /* A reload that started later has seen every change this one has */
+    platform_mutex_lock(scheduler.mutex);
+    if (scheduler.running && seq > scheduler.loaded_seq) {
+        triggers_apply(rows, count);
+        scheduler.loaded_seq = seq;
+        platform_cond_signal(scheduler.wake);
+    }
+    platform_mutex_unlock(scheduler.mutex);
+
+    platform_free(rows);
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_cron_scheduler_set_report(
+    const regislex_uuid_t* id,
+    const regislex_cron_t* cron,
+    int period)
+{
+    if (!id || !cron || period < 1) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!scheduler.mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    regislex_error_t err = REGISLEX_ERROR_NOT_INITIALIZED;
+    platform_mutex_lock(scheduler.mutex);
+    if (scheduler.running) {
+        err = schedule_set(SCHEDULE_REPORT, id, NULL, cron, period);
+        platform_cond_signal(scheduler.wake);
+    }
+    platform_mutex_unlock(scheduler.mutex);
+
+    return err;
+}
+
+REGISLEX_API regislex_error_t regislex_cron_scheduler_remove_report(const regislex_uuid_t* id) {
+    if (!id) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!scheduler.mutex) {
+        return REGISLEX_ERROR_NOT_FOUND;
+    }
+
+    regislex_error_t err = REGISLEX_ERROR_NOT_FOUND;
+    platform_mutex_lock(scheduler.mutex);
+    schedule_entry_t* e = scheduler.running
+        ? (schedule_entry_t*)regislex_id_map_get(&scheduler.entries, id->value) : NULL;
+    if (e && e->kind == SCHEDULE_REPORT) {
+        heap_remove(e);
+        entry_release(e);
+        err = REGISLEX_OK;
+    }
+    platform_mutex_unlock(scheduler.mutex);
+
+    return err;
+}
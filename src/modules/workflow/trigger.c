@@ -1,83 +1,581 @@
 /**
  * @file trigger.c
- * @brief Workflow Trigger System
+ * @brief Workflow Event Bus
+ *
+ * Modules publish typed events; workflows subscribe to them through EVENT
+ * triggers. The active EVENT triggers of active workflows are indexed by
+ * event name in an open-addressed map, so an event nobody listens for is
+ * dropped after one lookup and dispatch only touches the matching
+ * triggers.
+ *
+ * A trigger's condition is compiled when the index is built and checked
+ * by the dispatcher before the run is submitted. CONDITION triggers are
+ * indexed under a wildcard route that every event also visits. The fields
+ * the conditions of an event's routes read are loaded once per event.
+ *
+ * Published events wait in a bounded ring for a single dispatcher thread,
+ * which submits one run per matching trigger to the executor; publishers
+ * never wait on the database or the executor. When the executor's queue
+ * is full the dispatcher retries, so the backlog builds up here and
+ * publishers see QUOTA_EXCEEDED. An event published inside a transaction
+ * is checked against the limit then, and queued at commit even past the
+ * limit: once committed it is never dropped. Stopping the bus refuses new
+ * events and hands the queued ones to the executor past its queue limit
+ * before it returns; the executor stores each run it accepts.
+ *
+ * An index is never changed once built. A reload builds its replacement
+ * from the database without holding the bus lock and swaps it in; the
+ * dispatcher holds a reference to the index it dispatches from, and the
+ * last holder frees a replaced index.
  */
 
 #include "regislex/regislex.h"
+#include "database/database.h"
 #include "platform/platform.h"
+#include "utils/id_map.h"
+#include <stddef.h>
+#include <stdio.h>
 #include <string.h>
 
-typedef enum {
-    TRIGGER_TYPE_MANUAL,
-    TRIGGER_TYPE_SCHEDULE,
-    TRIGGER_TYPE_EVENT,
-    TRIGGER_TYPE_CONDITION
-} trigger_type_t;
+#define EVENT_BUS_DEFAULT_QUEUE_LIMIT  10000
+#define EVENT_BUS_INITIAL_QUEUE        64
+#define EVENT_BUS_RETRY_MS             100
+
+/* Route of CONDITION triggers; trigger_valid keeps '*' out of event names */
+#define EVENT_BUS_ANY_EVENT            "*"
+
+/* ============================================================================
+ * Internal Structures
+ * ============================================================================ */
 
 typedef struct {
-    regislex_uuid_t id;
+    regislex_uuid_t trigger_id;
     regislex_uuid_t workflow_id;
-    trigger_type_t type;
-    char event_name[128];
-    char schedule[64];  /* cron expression */
-    char condition[512];
-    bool is_active;
-} regislex_trigger_t;
+    regislex_cond_program_t* condition;     /* NULL when the trigger has none */
+} trigger_ref_t;
+
+/* The triggers listening for one event name */
+typedef struct {
+    char name[128];
+    trigger_ref_t* refs;
+    int count;
+    int capacity;
+    uint32_t fields;            /* Fields the refs' conditions read */
+} event_route_t;
+
+typedef struct {
+    regislex_id_map_t routes;   /* Keyed by event name */
+    int holders;                /* The bus, plus a dispatch in progress */
+} trigger_index_t;
+
+typedef struct {
+    regislex_context_t* ctx;
+    int queue_limit;
+
+    platform_mutex_t* mutex;
+    platform_cond_t* wake;
+    platform_thread_t* thread;
+    bool running;
+    bool draining;              /* Stopping: refuse events, dispatch the queued ones */
+
+    regislex_event_t* queue;    /* Ring of events waiting for dispatch */
+    int queue_capacity;
+    int queue_head;
+    int queue_count;
+
+    trigger_index_t* index;
+    uint64_t reload_seq;        /* Last reload started */
+    uint64_t index_seq;         /* Reload the current index came from */
+} event_bus_t;
+
+static event_bus_t bus;
+
+/* Indexed by regislex_event_type_t, up to CUSTOM */
+static const char* const EVENT_NAMES[] = {
+    "case.created",
+    "case.updated",
+    "case.status_changed",
+    "case.assigned",
+    "deadline.approaching",
+    "deadline.passed",
+    "document.uploaded",
+    "document.signed",
+    "party.added",
+    "payment.received",
+    "task.completed"
+};
+
+/* ============================================================================
+ * Trigger Index
+ * ============================================================================ */
+
+static void index_free(trigger_index_t* index) {
+    if (!index) return;
 
-regislex_error_t regislex_trigger_create(trigger_type_t type, regislex_trigger_t** trigger) {
-    if (!trigger) return REGISLEX_ERROR_INVALID_ARGUMENT;
+    for (int i = 0; i < index->routes.capacity; i++) {
+        event_route_t* route = (event_route_t*)index->routes.slots[i];
+        if (!route) continue;
+        for (int j = 0; j < route->count; j++) {
+            platform_free(route->refs[j].condition);
+        }
+        platform_free(route->refs);
+        platform_free(route);
+    }
+    regislex_id_map_free(&index->routes);
+    platform_free(index);
+}
+
+static const event_route_t* index_find(const trigger_index_t* index, const char* name) {
+    return index ? (const event_route_t*)regislex_id_map_get(&index->routes, name) : NULL;
+}
 
-    *trigger = (regislex_trigger_t*)platform_calloc(1, sizeof(regislex_trigger_t));
-    if (!*trigger) return REGISLEX_ERROR_OUT_OF_MEMORY;
+/* Adds a trigger to the route for name; the index takes the condition */
+static regislex_error_t index_add(trigger_index_t* index, const char* name,
+                                  const regislex_uuid_t* trigger_id,
+                                  const regislex_uuid_t* workflow_id,
+                                  regislex_cond_program_t* condition) {
+    event_route_t* route = (event_route_t*)index_find(index, name);
+    if (!route) {
+        route = (event_route_t*)platform_calloc(1, sizeof(event_route_t));
+        if (!route) return REGISLEX_ERROR_OUT_OF_MEMORY;
+        strncpy(route->name, name, sizeof(route->name) - 1);
 
-    regislex_uuid_generate(&(*trigger)->id);
-    (*trigger)->type = type;
-    (*trigger)->is_active = true;
+        if (regislex_id_map_insert(&index->routes, route) != REGISLEX_OK) {
+            platform_free(route);
+            return REGISLEX_ERROR_OUT_OF_MEMORY;
+        }
+    }
+
+    if (route->count >= route->capacity) {
+        int new_capacity = route->capacity ? route->capacity * 2 : 4;
+        trigger_ref_t* grown = (trigger_ref_t*)platform_realloc(
+            route->refs, (size_t)new_capacity * sizeof(trigger_ref_t));
+        if (!grown) return REGISLEX_ERROR_OUT_OF_MEMORY;
+        route->refs = grown;
+        route->capacity = new_capacity;
+    }
 
+    trigger_ref_t* ref = &route->refs[route->count++];
+    memcpy(&ref->trigger_id, trigger_id, sizeof(regislex_uuid_t));
+    memcpy(&ref->workflow_id, workflow_id, sizeof(regislex_uuid_t));
+    ref->condition = condition;
+    if (condition) route->fields |= condition->fields;
     return REGISLEX_OK;
 }
 
-void regislex_trigger_free(regislex_trigger_t* trigger) {
-    platform_free(trigger);
+/* Compiles a trigger's condition; NULL in *out when it has none */
+static regislex_error_t condition_load(const char* source, regislex_cond_program_t** out) {
+    *out = NULL;
+    if (!source || !source[0]) return REGISLEX_OK;
+
+    regislex_cond_program_t* program = (regislex_cond_program_t*)platform_malloc(sizeof(regislex_cond_program_t));
+    if (!program) return REGISLEX_ERROR_OUT_OF_MEMORY;
+
+    regislex_error_t err = regislex_cond_compile(source, program);
+    if (err != REGISLEX_OK) {
+        platform_free(program);
+        return err;
+    }
+    *out = program;
+    return REGISLEX_OK;
 }
 
-regislex_error_t regislex_trigger_set_event(regislex_trigger_t* trigger, const char* event) {
-    if (!trigger || !event) return REGISLEX_ERROR_INVALID_ARGUMENT;
-    trigger->type = TRIGGER_TYPE_EVENT;
-    strncpy(trigger->event_name, event, sizeof(trigger->event_name) - 1);
+/* Builds an index of the active EVENT and CONDITION triggers of active workflows */
+static regislex_error_t index_load(regislex_context_t* ctx, trigger_index_t** out_index) {
+    trigger_index_t* index = (trigger_index_t*)platform_calloc(1, sizeof(trigger_index_t));
+    if (!index) return REGISLEX_ERROR_OUT_OF_MEMORY;
+    regislex_id_map_init(&index->routes, offsetof(event_route_t, name));
+    index->holders = 1;
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(ctx),
+        "SELECT t.id, t.workflow_id, t.type, t.event_type, t.event_name, t.event_filter"
+        " FROM workflow_triggers t JOIN workflows w ON w.id = t.workflow_id"
+        " WHERE t.type IN (?, ?) AND t.is_active = 1 AND w.status = ?", &stmt);
+    if (err != REGISLEX_OK) {
+        index_free(index);
+        return err;
+    }
+
+    regislex_db_bind_int(stmt, 1, REGISLEX_TRIGGER_EVENT);
+    regislex_db_bind_int(stmt, 2, REGISLEX_TRIGGER_CONDITION);
+    regislex_db_bind_int(stmt, 3, REGISLEX_WORKFLOW_ACTIVE);
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        regislex_uuid_t trigger_id = {{0}};
+        regislex_uuid_t workflow_id = {{0}};
+        regislex_db_column_uuid(stmt, 0, &trigger_id);
+        regislex_db_column_uuid(stmt, 1, &workflow_id);
+
+        bool any_event = regislex_db_column_int(stmt, 2) == REGISLEX_TRIGGER_CONDITION;
+        const char* name = EVENT_BUS_ANY_EVENT;
+        if (!any_event) {
+            regislex_event_type_t type = (regislex_event_type_t)regislex_db_column_int(stmt, 3);
+            name = type == REGISLEX_EVENT_CUSTOM
+                ? regislex_db_column_text(stmt, 4) : regislex_event_name(type);
+            /* The wildcard route is not an event name */
+            if (name && strchr(name, '*')) continue;
+        }
+        if (!name || !name[0]) continue;
+
+        /* Triggers are validated when stored; one that no longer compiles is left out */
+        regislex_cond_program_t* condition = NULL;
+        err = condition_load(regislex_db_column_text(stmt, 5), &condition);
+        if (err == REGISLEX_ERROR_INVALID_ARGUMENT ||
+            (err == REGISLEX_OK && !condition && any_event)) {
+            err = REGISLEX_OK;
+            continue;
+        }
+        if (err == REGISLEX_OK) {
+            err = index_add(index, name, &trigger_id, &workflow_id, condition);
+            if (err != REGISLEX_OK) platform_free(condition);
+        }
+        if (err != REGISLEX_OK) break;
+    }
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND) {
+        index_free(index);
+        return err;
+    }
+
+    *out_index = index;
     return REGISLEX_OK;
 }
 
-regislex_error_t regislex_trigger_set_schedule(regislex_trigger_t* trigger, const char* cron) {
-    if (!trigger || !cron) return REGISLEX_ERROR_INVALID_ARGUMENT;
-    trigger->type = TRIGGER_TYPE_SCHEDULE;
-    strncpy(trigger->schedule, cron, sizeof(trigger->schedule) - 1);
+/* ============================================================================
+ * Dispatch
+ * ============================================================================ */
+
+/* Names go into trigger_data unescaped, so they are kept plain */
+static bool event_name_valid(const char* name) {
+    if (!name[0]) return false;
+    for (const char* p = name; *p; p++) {
+        char c = *p;
+        bool plain = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                     (c >= '0' && c <= '9') || c == '.' || c == '_' || c == '-';
+        if (!plain) return false;
+    }
+    return true;
+}
+
+/* Waits before retrying a full executor queue; true once the bus is stopping */
+static bool dispatch_wait_retry(void) {
+    platform_mutex_lock(bus.mutex);
+    if (!bus.draining) {
+        platform_cond_timedwait(bus.wake, bus.mutex, EVENT_BUS_RETRY_MS);
+    }
+    bool draining = bus.draining;
+    platform_mutex_unlock(bus.mutex);
+    return draining;
+}
+
+static void dispatch_event(const trigger_index_t* index, const regislex_event_t* event) {
+    const event_route_t* routes[2] = {
+        index_find(index, event->name),
+        index_find(index, EVENT_BUS_ANY_EVENT)
+    };
+
+    char trigger_data[sizeof(event->name) + sizeof(event->subject_id.value) + sizeof(event->data) + 64];
+    snprintf(trigger_data, sizeof(trigger_data),
+             "{\"event\":\"%s\",\"subject_id\":\"%s\",\"data\":%s}",
+             event->name, event->subject_id.value, event->data[0] ? event->data : "null");
+
+    const regislex_uuid_t* case_id = event->case_id.value[0] ? &event->case_id : NULL;
+    bool deadline_event = event->type == REGISLEX_EVENT_DEADLINE_APPROACHING ||
+                          event->type == REGISLEX_EVENT_DEADLINE_PASSED;
+
+    /* Conditions of both routes see the same fields, loaded on first use */
+    regislex_cond_env_t env;
+    bool env_loaded = false;
+    bool env_ok = false;
+
+    /*
+     * A workflow paused or deleted since the index was built refuses the
+     * run, as does a stopped executor; those runs are not retried. While
+     * the bus stops, runs go in past the executor's queue limit.
+     */
+    for (int r = 0; r < 2; r++) {
+        if (!routes[r]) continue;
+        for (int i = 0; i < routes[r]->count; i++) {
+            const trigger_ref_t* ref = &routes[r]->refs[i];
+            if (ref->condition) {
+                if (!env_loaded) {
+                    uint32_t fields = (routes[0] ? routes[0]->fields : 0) |
+                                      (routes[1] ? routes[1]->fields : 0);
+                    env_ok = regislex_cond_env_load(bus.ctx, fields, case_id,
+                                                    deadline_event ? &event->subject_id : NULL,
+                                                    event, &env) == REGISLEX_OK;
+                    env_loaded = true;
+                }
+                if (!env_ok || !regislex_cond_eval(ref->condition, &env)) continue;
+            }
+
+            regislex_uuid_t run_id;
+            bool draining = false;
+            for (;;) {
+                regislex_error_t err = draining
+                    ? regislex_workflow_submit_backlog(bus.ctx, &ref->trigger_id, &ref->workflow_id,
+                                                       case_id, trigger_data, &run_id)
+                    : regislex_workflow_submit_trigger(bus.ctx, &ref->trigger_id, &ref->workflow_id,
+                                                       case_id, trigger_data, &run_id);
+                if (err != REGISLEX_ERROR_QUOTA_EXCEEDED) break;
+                draining = dispatch_wait_retry();
+            }
+        }
+    }
+}
+
+/* Drops a hold on an index (caller holds bus.mutex) */
+static void index_release(trigger_index_t* index) {
+    if (index && --index->holders == 0) {
+        index_free(index);
+    }
+}
+
+static void* bus_dispatcher(void* arg) {
+    (void)arg;
+
+    regislex_event_t event;
+
+    platform_mutex_lock(bus.mutex);
+    while (bus.running) {
+        if (bus.queue_count == 0) {
+            if (bus.draining) break;
+            platform_cond_wait(bus.wake, bus.mutex);
+            continue;
+        }
+
+        memcpy(&event, &bus.queue[bus.queue_head], sizeof(event));
+        bus.queue_head = (bus.queue_head + 1) % bus.queue_capacity;
+        bus.queue_count--;
+
+        /* Routes as of dispatch, so a trigger removed meanwhile is skipped */
+        trigger_index_t* index = bus.index;
+        index->holders++;
+
+        platform_mutex_unlock(bus.mutex);
+        dispatch_event(index, &event);
+        platform_mutex_lock(bus.mutex);
+
+        index_release(index);
+    }
+    platform_mutex_unlock(bus.mutex);
+
+    return NULL;
+}
+
+/*
+ * Makes room for one more event. The ring only grows up to the queue
+ * limit, except for committed events, which the limit does not refuse.
+ */
+static regislex_error_t queue_reserve(bool committed) {
+    if (bus.queue_count >= bus.queue_limit && !committed) return REGISLEX_ERROR_QUOTA_EXCEEDED;
+    if (bus.queue_count < bus.queue_capacity) return REGISLEX_OK;
+
+    int new_capacity = bus.queue_capacity ? bus.queue_capacity * 2 : EVENT_BUS_INITIAL_QUEUE;
+    if (new_capacity > bus.queue_limit && bus.queue_count < bus.queue_limit) {
+        new_capacity = bus.queue_limit;
+    }
+
+    regislex_event_t* grown = (regislex_event_t*)platform_malloc(
+        (size_t)new_capacity * sizeof(regislex_event_t));
+    if (!grown) return REGISLEX_ERROR_OUT_OF_MEMORY;
+
+    for (int i = 0; i < bus.queue_count; i++) {
+        memcpy(&grown[i], &bus.queue[(bus.queue_head + i) % bus.queue_capacity],
+               sizeof(regislex_event_t));
+    }
+    platform_free(bus.queue);
+    bus.queue = grown;
+    bus.queue_capacity = new_capacity;
+    bus.queue_head = 0;
     return REGISLEX_OK;
 }
 
-regislex_error_t regislex_trigger_set_condition(regislex_trigger_t* trigger, const char* condition) {
-    if (!trigger || !condition) return REGISLEX_ERROR_INVALID_ARGUMENT;
-    trigger->type = TRIGGER_TYPE_CONDITION;
-    strncpy(trigger->condition, condition, sizeof(trigger->condition) - 1);
+static void bus_clear(void) {
+    platform_free(bus.queue);
+    index_free(bus.index);
+}
+
+/* ============================================================================
+ * Event Bus Functions
+ * ============================================================================ */
+
+REGISLEX_API const char* regislex_event_name(regislex_event_type_t type) {
+    if ((int)type < 0 || (size_t)type >= sizeof(EVENT_NAMES) / sizeof(EVENT_NAMES[0])) {
+        return NULL;
+    }
+    return EVENT_NAMES[type];
+}
+
+REGISLEX_API regislex_error_t regislex_event_bus_start(
+    regislex_context_t* ctx,
+    const regislex_event_bus_options_t* options)
+{
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (bus.mutex) {
+        return REGISLEX_ERROR_ALREADY_EXISTS;
+    }
+
+    memset(&bus, 0, sizeof(bus));
+    bus.ctx = ctx;
+    bus.queue_limit = options && options->queue_limit > 0
+        ? options->queue_limit : EVENT_BUS_DEFAULT_QUEUE_LIMIT;
+
+    regislex_error_t err = index_load(ctx, &bus.index);
+    if (err != REGISLEX_OK) {
+        memset(&bus, 0, sizeof(bus));
+        return err;
+    }
+
+    if (platform_mutex_create(&bus.mutex) != PLATFORM_OK) {
+        bus_clear();
+        memset(&bus, 0, sizeof(bus));
+        return REGISLEX_ERROR;
+    }
+    if (platform_cond_create(&bus.wake) != PLATFORM_OK) {
+        platform_mutex_destroy(bus.mutex);
+        bus_clear();
+        memset(&bus, 0, sizeof(bus));
+        return REGISLEX_ERROR;
+    }
+
+    bus.running = true;
+    if (platform_thread_create(&bus.thread, bus_dispatcher, NULL) != PLATFORM_OK) {
+        bus.thread = NULL;
+        regislex_event_bus_stop();
+        return REGISLEX_ERROR;
+    }
+
     return REGISLEX_OK;
 }
 
-bool regislex_trigger_evaluate(const regislex_trigger_t* trigger, const void* context) {
-    if (!trigger || !trigger->is_active) return false;
-    (void)context;
-
-    switch (trigger->type) {
-        case TRIGGER_TYPE_MANUAL:
-            return true;
-        case TRIGGER_TYPE_SCHEDULE:
-            /* TODO: Evaluate cron expression */
-            return false;
-        case TRIGGER_TYPE_EVENT:
-            /* TODO: Check if event matches */
-            return false;
-        case TRIGGER_TYPE_CONDITION:
-            /* TODO: Evaluate condition expression */
-            return false;
-    }
-    return false;
+REGISLEX_API void regislex_event_bus_stop(void) {
+    if (!bus.mutex) return;
+
+    /* The dispatcher exits once the queue is empty */
+    platform_mutex_lock(bus.mutex);
+    bus.draining = true;
+    platform_cond_broadcast(bus.wake);
+    platform_mutex_unlock(bus.mutex);
+
+    if (bus.thread) {
+        platform_thread_join(bus.thread, NULL);
+    }
+
+    platform_mutex_lock(bus.mutex);
+    bus.running = false;
+    platform_mutex_unlock(bus.mutex);
+
+    bus_clear();
+    platform_cond_destroy(bus.wake);
+    platform_mutex_destroy(bus.mutex);
+    memset(&bus, 0, sizeof(bus));
+}
+
+/* Queue an event whose name is already resolved */
+static regislex_error_t bus_enqueue(const regislex_event_t* event, const char* name, bool committed) {
+    if (!bus.mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    regislex_error_t err = REGISLEX_OK;
+    platform_mutex_lock(bus.mutex);
+    if (!bus.running || bus.draining) {
+        err = REGISLEX_ERROR_NOT_INITIALIZED;
+    } else if (index_find(bus.index, name) || index_find(bus.index, EVENT_BUS_ANY_EVENT)) {
+        err = queue_reserve(committed);
+        if (err == REGISLEX_OK) {
+            regislex_event_t* queued = &bus.queue[(bus.queue_head + bus.queue_count) % bus.queue_capacity];
+            memcpy(queued, event, sizeof(regislex_event_t));
+            memset(queued->name, 0, sizeof(queued->name));
+            strncpy(queued->name, name, sizeof(queued->name) - 1);
+            bus.queue_count++;
+            platform_cond_signal(bus.wake);
+        }
+    }
+    platform_mutex_unlock(bus.mutex);
+
+    return err;
+}
+
+/* The publisher was told the event is queued, so a failed allocation is waited out */
+static void bus_enqueue_committed(void* data) {
+    const regislex_event_t* event = (const regislex_event_t*)data;
+    while (bus_enqueue(event, event->name, true) == REGISLEX_ERROR_OUT_OF_MEMORY) {
+        platform_sleep_ms(EVENT_BUS_RETRY_MS);
+    }
+}
+
+REGISLEX_API regislex_error_t regislex_event_publish(
+    regislex_context_t* ctx,
+    const regislex_event_t* event)
+{
+    if (!ctx || !event) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    const char* name = event->type == REGISLEX_EVENT_CUSTOM
+        ? event->name : regislex_event_name(event->type);
+    if (!name || !event_name_valid(name)) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!bus.mutex) {
+        return REGISLEX_ERROR_NOT_INITIALIZED;
+    }
+
+    /* Inside a transaction the event waits for the commit; a rollback drops it */
+    regislex_db_context_t* db = regislex_get_db(ctx);
+    if (regislex_db_in_transaction(db)) {
+        /* A full queue is reported now, while the publisher can still roll back */
+        platform_mutex_lock(bus.mutex);
+        bool full = bus.queue_count >= bus.queue_limit;
+        platform_mutex_unlock(bus.mutex);
+        if (full) {
+            return REGISLEX_ERROR_QUOTA_EXCEEDED;
+        }
+
+        regislex_event_t* deferred = (regislex_event_t*)platform_malloc(sizeof(regislex_event_t));
+        if (!deferred) {
+            return REGISLEX_ERROR_OUT_OF_MEMORY;
+        }
+        memcpy(deferred, event, sizeof(regislex_event_t));
+        memset(deferred->name, 0, sizeof(deferred->name));
+        strncpy(deferred->name, name, sizeof(deferred->name) - 1);
+        return regislex_db_after_commit(db, bus_enqueue_committed, deferred);
+    }
+
+    return bus_enqueue(event, name, false);
+}
+
+REGISLEX_API regislex_error_t regislex_event_bus_reload(regislex_context_t* ctx) {
+    if (!ctx) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+    if (!bus.mutex) {
+        return REGISLEX_OK;
+    }
+
+    platform_mutex_lock(bus.mutex);
+    uint64_t seq = ++bus.reload_seq;
+    platform_mutex_unlock(bus.mutex);
+
+    trigger_index_t* index = NULL;
+    regislex_error_t err = index_load(ctx, &index);
+    if (err != REGISLEX_OK) return err;
+
+    /* A reload that started later has seen every change this one has */
+    platform_mutex_lock(bus.mutex);
+    if (bus.running && seq > bus.index_seq) {
+        trigger_index_t* old = bus.index;
+        bus.index = index;
+        bus.index_seq = seq;
+        index = old;
+    }
+    index_release(index);
+    platform_mutex_unlock(bus.mutex);
+
+    return REGISLEX_OK;
 }
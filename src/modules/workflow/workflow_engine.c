@@ -13,19 +13,19 @@
 #include <stdlib.h>
 #include <string.h>
 
-/* ============================================================================
- * Internal Structures
- * ============================================================================ */
+#define WORKFLOW_COLUMNS \
+    "id, name, description, category, status, version," \
+    " run_once, allow_parallel, max_parallel_runs, timeout_minutes," \
+    " created_at, updated_at, created_by"
 
-/* Workflow execution context */
-typedef struct {
-    regislex_context_t* ctx;
-    regislex_workflow_t* workflow;
-    regislex_workflow_run_t* run;
-    char* trigger_data;
-    int current_action_index;
-    bool cancelled;
-} workflow_exec_ctx_t;
+#define ACTION_COLUMNS \
+    "id, workflow_id, name, description, type, sequence_order," \
+    " delay_minutes, timeout_minutes, retry_count, retry_delay_minutes," \
+    " is_active, created_at, updated_at"
+
+#define TRIGGER_COLUMNS \
+    "id, workflow_id, name, type, event_type, event_name, event_filter," \
+    " schedule_cron, webhook_secret, is_active, created_at, updated_at"
 
 /* ============================================================================
  * Internal Helper Functions
@@ -39,10 +39,6 @@ static regislex_task_t* task_alloc(void) {
     return (regislex_task_t*)platform_calloc(1, sizeof(regislex_task_t));
 }
 
-static regislex_workflow_run_t* workflow_run_alloc(void) {
-    return (regislex_workflow_run_t*)platform_calloc(1, sizeof(regislex_workflow_run_t));
-}
-
 static regislex_error_t workflow_from_row(regislex_db_stmt_t* stmt, regislex_workflow_t* wf) {
     if (!stmt || !wf) return REGISLEX_ERROR_INVALID_ARGUMENT;
 
@@ -63,6 +59,7 @@ static regislex_error_t workflow_from_row(regislex_db_stmt_t* stmt, regislex_wor
     wf->version = (int)regislex_db_column_int(stmt, col++);
     wf->run_once = regislex_db_column_int(stmt, col++) != 0;
     wf->allow_parallel = regislex_db_column_int(stmt, col++) != 0;
+    wf->max_parallel_runs = (int)regislex_db_column_int(stmt, col++);
     wf->timeout_minutes = (int)regislex_db_column_int(stmt, col++);
 
     regislex_db_column_datetime(stmt, col++, &wf->created_at);
@@ -72,194 +69,383 @@ static regislex_error_t workflow_from_row(regislex_db_stmt_t* stmt, regislex_wor
     return REGISLEX_OK;
 }
 
-static regislex_error_t task_from_row(regislex_db_stmt_t* stmt, regislex_task_t* task) {
-    if (!stmt || !task) return REGISLEX_ERROR_INVALID_ARGUMENT;
-
+static void action_from_row(regislex_db_stmt_t* stmt, regislex_action_t* action) {
     int col = 0;
 
-    regislex_db_column_uuid(stmt, col++, &task->id);
-    regislex_db_column_uuid(stmt, col++, &task->case_id);
-    regislex_db_column_uuid(stmt, col++, &task->matter_id);
-    regislex_db_column_uuid(stmt, col++, &task->workflow_run_id);
-    regislex_db_column_uuid(stmt, col++, &task->parent_task_id);
+    regislex_db_column_uuid(stmt, col++, &action->id);
+    regislex_db_column_uuid(stmt, col++, &action->workflow_id);
 
-    const char* title = regislex_db_column_text(stmt, col++);
-    if (title) strncpy(task->title, title, sizeof(task->title) - 1);
+    const char* name = regislex_db_column_text(stmt, col++);
+    if (name) strncpy(action->name, name, sizeof(action->name) - 1);
 
     const char* desc = regislex_db_column_text(stmt, col++);
-    if (desc) strncpy(task->description, desc, sizeof(task->description) - 1);
+    if (desc) strncpy(action->description, desc, sizeof(action->description) - 1);
+
+    action->type = (regislex_action_type_t)regislex_db_column_int(stmt, col++);
+    action->sequence_order = (int)regislex_db_column_int(stmt, col++);
+    action->delay_minutes = (int)regislex_db_column_int(stmt, col++);
+    action->timeout_minutes = (int)regislex_db_column_int(stmt, col++);
+    action->retry_count = (int)regislex_db_column_int(stmt, col++);
+    action->retry_delay_minutes = (int)regislex_db_column_int(stmt, col++);
+    action->is_active = regislex_db_column_int(stmt, col++) != 0;
+
+    regislex_db_column_datetime(stmt, col++, &action->created_at);
+    regislex_db_column_datetime(stmt, col++, &action->updated_at);
+}
 
-    task->status = (regislex_task_status_t)regislex_db_column_int(stmt, col++);
-    task->priority = (regislex_priority_t)regislex_db_column_int(stmt, col++);
+static void trigger_from_row(regislex_db_stmt_t* stmt, regislex_trigger_t* trigger) {
+    int col = 0;
 
-    regislex_db_column_uuid(stmt, col++, &task->assigned_to_id);
-    regislex_db_column_uuid(stmt, col++, &task->assigned_by);
+    regislex_db_column_uuid(stmt, col++, &trigger->id);
+    regislex_db_column_uuid(stmt, col++, &trigger->workflow_id);
 
-    regislex_db_column_datetime(stmt, col++, &task->due_date);
+    const char* name = regislex_db_column_text(stmt, col++);
+    if (name) strncpy(trigger->name, name, sizeof(trigger->name) - 1);
 
-    task->estimated_minutes = (int)regislex_db_column_int(stmt, col++);
-    task->actual_minutes = (int)regislex_db_column_int(stmt, col++);
-    task->percent_complete = (int)regislex_db_column_int(stmt, col++);
+    trigger->type = (regislex_trigger_type_t)regislex_db_column_int(stmt, col++);
+    trigger->event_type = (regislex_event_type_t)regislex_db_column_int(stmt, col++);
 
-    const char* notes = regislex_db_column_text(stmt, col++);
-    if (notes) strncpy(task->completion_notes, notes, sizeof(task->completion_notes) - 1);
+    const char* event_name = regislex_db_column_text(stmt, col++);
+    if (event_name) strncpy(trigger->event_name, event_name, sizeof(trigger->event_name) - 1);
 
-    task->requires_approval = regislex_db_column_int(stmt, col++) != 0;
-    regislex_db_column_uuid(stmt, col++, &task->approver_id);
-    regislex_db_column_datetime(stmt, col++, &task->approved_at);
+    const char* filter = regislex_db_column_text(stmt, col++);
+    if (filter) strncpy(trigger->event_filter, filter, sizeof(trigger->event_filter) - 1);
 
-    regislex_db_column_datetime(stmt, col++, &task->started_at);
-    regislex_db_column_datetime(stmt, col++, &task->completed_at);
-    regislex_db_column_datetime(stmt, col++, &task->created_at);
-    regislex_db_column_datetime(stmt, col++, &task->updated_at);
-    regislex_db_column_uuid(stmt, col++, &task->created_by);
+    const char* cron = regislex_db_column_text(stmt, col++);
+    if (cron) strncpy(trigger->schedule_cron, cron, sizeof(trigger->schedule_cron) - 1);
 
-    return REGISLEX_OK;
+    const char* secret = regislex_db_column_text(stmt, col++);
+    if (secret) strncpy(trigger->webhook_secret, secret, sizeof(trigger->webhook_secret) - 1);
+
+    trigger->is_active = regislex_db_column_int(stmt, col++) != 0;
+
+    regislex_db_column_datetime(stmt, col++, &trigger->created_at);
+    regislex_db_column_datetime(stmt, col++, &trigger->updated_at);
 }
 
-/* Execute a single workflow action */
-static regislex_error_t execute_action(
-    workflow_exec_ctx_t* exec_ctx,
-    regislex_action_t* action)
-{
-    if (!exec_ctx || !action) return REGISLEX_ERROR_INVALID_ARGUMENT;
+static regislex_error_t workflow_load_triggers(regislex_db_context_t* db, regislex_workflow_t* wf) {
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "SELECT " TRIGGER_COLUMNS " FROM workflow_triggers"
+        " WHERE workflow_id = ? ORDER BY created_at, id", &stmt);
+    if (err != REGISLEX_OK) return err;
 
-    regislex_error_t err = REGISLEX_OK;
+    regislex_db_bind_uuid(stmt, 1, &wf->id);
 
-    /* Log action start */
-    char log_entry[512];
-    snprintf(log_entry, sizeof(log_entry),
-             "Executing action: %s (type: %d)\n", action->name, action->type);
+    int capacity = 0;
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        if (wf->trigger_count >= capacity) {
+            capacity = capacity ? capacity * 2 : 4;
+            regislex_trigger_t** grown = (regislex_trigger_t**)platform_realloc(
+                wf->triggers, (size_t)capacity * sizeof(regislex_trigger_t*));
+            if (!grown) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            wf->triggers = grown;
+        }
 
-    /* Append to execution log */
-    if (exec_ctx->run) {
-        strncat(exec_ctx->run->execution_log, log_entry,
-                sizeof(exec_ctx->run->execution_log) - strlen(exec_ctx->run->execution_log) - 1);
+        regislex_trigger_t* trigger = (regislex_trigger_t*)platform_calloc(1, sizeof(regislex_trigger_t));
+        if (!trigger) {
+            err = REGISLEX_ERROR_OUT_OF_MEMORY;
+            break;
+        }
+        trigger_from_row(stmt, trigger);
+        wf->triggers[wf->trigger_count++] = trigger;
     }
+    regislex_db_finalize(stmt);
 
-    switch (action->type) {
-        case REGISLEX_ACTION_SEND_EMAIL:
-            /* TODO: Implement email sending */
-            /* Would integrate with SMTP or email service API */
-            break;
+    return err == REGISLEX_ERROR_NOT_FOUND ? REGISLEX_OK : err;
+}
 
-        case REGISLEX_ACTION_SEND_SMS:
-            /* TODO: Implement SMS sending */
-            /* Would integrate with SMS gateway API */
-            break;
+/*
+ * A CUSTOM event trigger has to name the event it listens for, a
+ * scheduled trigger needs a cron expression that compiles, and a
+ * condition trigger a condition that compiles. An event trigger's
+ * condition is optional.
+ */
+static bool trigger_valid(const regislex_trigger_t* trigger) {
+    if (trigger->type == REGISLEX_TRIGGER_SCHEDULED) {
+        regislex_cron_t cron;
+        return regislex_cron_compile(trigger->schedule_cron, &cron) == REGISLEX_OK;
+    }
+    if (trigger->type == REGISLEX_TRIGGER_CONDITION ||
+        (trigger->type == REGISLEX_TRIGGER_EVENT && trigger->event_filter[0])) {
+        regislex_cond_program_t program;
+        if (regislex_cond_compile(trigger->event_filter, &program) != REGISLEX_OK) return false;
+    }
+    /* '*' names the event bus's wildcard route */
+    return trigger->type != REGISLEX_TRIGGER_EVENT ||
+           trigger->event_type != REGISLEX_EVENT_CUSTOM ||
+           (trigger->event_name[0] != '\0' && !strchr(trigger->event_name, '*'));
+}
 
-        case REGISLEX_ACTION_CREATE_TASK: {
-            /* Create a task from action parameters */
-            regislex_task_t task = {0};
-
-            /* Parse parameters to populate task */
-            for (int i = 0; i < action->param_count; i++) {
-                if (strcmp(action->params[i].type, "title") == 0) {
-                    strncpy(task.title, action->params[i].value, sizeof(task.title) - 1);
-                } else if (strcmp(action->params[i].type, "description") == 0) {
-                    strncpy(task.description, action->params[i].value, sizeof(task.description) - 1);
-                } else if (strcmp(action->params[i].type, "priority") == 0) {
-                    task.priority = (regislex_priority_t)atoi(action->params[i].value);
-                }
-            }
+/* A CONDITION step needs an "expression" parameter that compiles */
+static bool action_valid(const regislex_action_t* action) {
+    if (action->param_count < 0 || (action->param_count > 0 && !action->params)) {
+        return false;
+    }
+    if (action->type != REGISLEX_ACTION_CONDITION) {
+        return true;
+    }
+
+    for (int i = 0; i < action->param_count; i++) {
+        if (strcmp(action->params[i].type, "expression") == 0) {
+            regislex_cond_program_t program;
+            return regislex_cond_compile(action->params[i].value, &program) == REGISLEX_OK;
+        }
+    }
+    return false;
+}
+
+static void triggers_reload(void* data) {
+    regislex_context_t* ctx = *(regislex_context_t**)data;
+    regislex_event_bus_reload(ctx);
+    regislex_cron_scheduler_reload(ctx);
+}
+
+/* Brings the event bus and the cron scheduler up to date once the change commits */
+static regislex_error_t triggers_changed(regislex_context_t* ctx) {
+    regislex_context_t** data = (regislex_context_t**)platform_malloc(sizeof(regislex_context_t*));
+    if (!data) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    *data = ctx;
+    return regislex_db_after_commit(regislex_get_db(ctx), triggers_reload, data);
+}
+
+static void definition_invalidate(void* data) {
+    regislex_workflow_executor_invalidate((const regislex_uuid_t*)data);
+}
+
+/* Drops the executor's cached definition once the change commits */
+static regislex_error_t definition_changed(regislex_db_context_t* db, const regislex_uuid_t* workflow_id) {
+    regislex_uuid_t* data = (regislex_uuid_t*)platform_malloc(sizeof(regislex_uuid_t));
+    if (!data) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    memcpy(data, workflow_id, sizeof(regislex_uuid_t));
+    return regislex_db_after_commit(db, definition_invalidate, data);
+}
+
+/* Gives a workflow a new definition version after its actions change */
+static regislex_error_t workflow_bump_version(regislex_db_context_t* db, const regislex_uuid_t* workflow_id) {
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "UPDATE workflows SET version = version + 1, updated_at = ? WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_datetime(stmt, 1, &now);
+    regislex_db_bind_uuid(stmt, 2, workflow_id);
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) return err;
+
+    return definition_changed(db, workflow_id);
+}
+
+static regislex_error_t action_workflow_id(
+    regislex_db_context_t* db,
+    const regislex_uuid_t* action_id,
+    regislex_uuid_t* workflow_id)
+{
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "SELECT workflow_id FROM workflow_actions WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_uuid(stmt, 1, action_id);
+    err = regislex_db_step(stmt);
+    if (err == REGISLEX_OK) {
+        regislex_db_column_uuid(stmt, 0, workflow_id);
+    }
+    regislex_db_finalize(stmt);
+    return err;
+}
+
+/*
+ * Loads a workflow's actions in sequence order, then their parameters with
+ * a single query ordered the same way, so each parameter row belongs to
+ * the current action or one further along.
+ */
+static regislex_error_t workflow_load_actions(regislex_db_context_t* db, regislex_workflow_t* wf) {
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "SELECT " ACTION_COLUMNS " FROM workflow_actions"
+        " WHERE workflow_id = ? ORDER BY sequence_order, id", &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_uuid(stmt, 1, &wf->id);
 
-            task.status = REGISLEX_TASK_PENDING;
-            if (exec_ctx->run) {
-                memcpy(&task.workflow_run_id, &exec_ctx->run->id, sizeof(regislex_uuid_t));
+    int capacity = 0;
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        if (wf->action_count >= capacity) {
+            capacity = capacity ? capacity * 2 : 8;
+            regislex_action_t** grown = (regislex_action_t**)platform_realloc(
+                wf->actions, (size_t)capacity * sizeof(regislex_action_t*));
+            if (!grown) {
+                err = REGISLEX_ERROR_OUT_OF_MEMORY;
+                break;
             }
+            wf->actions = grown;
+        }
 
-            regislex_task_t* new_task = NULL;
-            err = regislex_task_create(exec_ctx->ctx, &task, &new_task);
-            if (new_task) regislex_task_free(new_task);
+        regislex_action_t* action = (regislex_action_t*)platform_calloc(1, sizeof(regislex_action_t));
+        if (!action) {
+            err = REGISLEX_ERROR_OUT_OF_MEMORY;
             break;
         }
+        action_from_row(stmt, action);
+        wf->actions[wf->action_count++] = action;
+    }
+    regislex_db_finalize(stmt);
+    if (err != REGISLEX_ERROR_NOT_FOUND) return err;
+    if (wf->action_count == 0) return REGISLEX_OK;
 
-        case REGISLEX_ACTION_CREATE_DEADLINE: {
-            /* Create a deadline from action parameters */
-            regislex_deadline_t dl = {0};
-
-            for (int i = 0; i < action->param_count; i++) {
-                if (strcmp(action->params[i].type, "title") == 0) {
-                    strncpy(dl.title, action->params[i].value, sizeof(dl.title) - 1);
-                } else if (strcmp(action->params[i].type, "days_from_now") == 0) {
-                    int days = atoi(action->params[i].value);
-                    regislex_datetime_now(&dl.due_date);
-                    dl.due_date.day += days;
-                }
-            }
+    err = regislex_db_prepare(db,
+        "SELECT p.action_id, p.type, p.value"
+        " FROM workflow_action_params p JOIN workflow_actions a ON a.id = p.action_id"
+        " WHERE a.workflow_id = ? ORDER BY a.sequence_order, a.id, p.position", &stmt);
+    if (err != REGISLEX_OK) return err;
 
-            dl.status = REGISLEX_STATUS_PENDING;
+    regislex_db_bind_uuid(stmt, 1, &wf->id);
 
-            regislex_deadline_t* new_dl = NULL;
-            err = regislex_deadline_create(exec_ctx->ctx, &dl, &new_dl);
-            if (new_dl) regislex_deadline_free(new_dl);
-            break;
+    int current = 0;
+    while ((err = regislex_db_step(stmt)) == REGISLEX_OK) {
+        const char* action_id = regislex_db_column_text(stmt, 0);
+        if (!action_id) continue;
+        while (current < wf->action_count &&
+               strcmp(wf->actions[current]->id.value, action_id) != 0) {
+            current++;
         }
+        if (current >= wf->action_count) break;
 
-        case REGISLEX_ACTION_UPDATE_STATUS:
-            /* Update case/matter status */
-            /* TODO: Implement status update */
+        regislex_action_t* action = wf->actions[current];
+        regislex_action_param_t* grown = (regislex_action_param_t*)platform_realloc(
+            action->params, (size_t)(action->param_count + 1) * sizeof(regislex_action_param_t));
+        if (!grown) {
+            err = REGISLEX_ERROR_OUT_OF_MEMORY;
             break;
+        }
+        action->params = grown;
+
+        regislex_action_param_t* param = &action->params[action->param_count++];
+        memset(param, 0, sizeof(*param));
+        const char* type = regislex_db_column_text(stmt, 1);
+        if (type) strncpy(param->type, type, sizeof(param->type) - 1);
+        const char* value = regislex_db_column_text(stmt, 2);
+        if (value) strncpy(param->value, value, sizeof(param->value) - 1);
+    }
+    regislex_db_finalize(stmt);
 
-        case REGISLEX_ACTION_ASSIGN_USER:
-            /* Assign case/task to user */
-            /* TODO: Implement user assignment */
-            break;
+    return (err == REGISLEX_ERROR_NOT_FOUND || err == REGISLEX_OK) ? REGISLEX_OK : err;
+}
 
-        case REGISLEX_ACTION_ADD_NOTE:
-            /* Add note to case/matter */
-            /* TODO: Implement note addition */
-            break;
+/* Replaces an action's stored parameters; the caller owns the transaction */
+static regislex_error_t action_store_params(regislex_db_context_t* db, const regislex_action_t* action) {
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "DELETE FROM workflow_action_params WHERE action_id = ?", &stmt);
+    if (err != REGISLEX_OK) return err;
 
-        case REGISLEX_ACTION_WEBHOOK: {
-            /* Call external webhook */
-            /* TODO: Implement HTTP POST to webhook URL */
-            break;
+    regislex_db_bind_uuid(stmt, 1, &action->id);
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) return err;
+    if (action->param_count <= 0 || !action->params) return REGISLEX_OK;
+
+    err = regislex_db_prepare(db,
+        "INSERT INTO workflow_action_params (action_id, position, type, value)"
+        " VALUES (?, ?, ?, ?)", &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    for (int i = 0; i < action->param_count; i++) {
+        regislex_db_reset(stmt);
+        regislex_db_bind_uuid(stmt, 1, &action->id);
+        regislex_db_bind_int(stmt, 2, i);
+        regislex_db_bind_text(stmt, 3, action->params[i].type);
+        regislex_db_bind_text(stmt, 4, action->params[i].value);
+
+        err = regislex_db_step(stmt);
+        if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) break;
+        err = REGISLEX_OK;
+    }
+    regislex_db_finalize(stmt);
+
+    return err;
+}
+
+/* Copies an action, including its parameter array */
+static regislex_action_t* action_dup(const regislex_action_t* action) {
+    regislex_action_t* copy = (regislex_action_t*)platform_calloc(1, sizeof(regislex_action_t));
+    if (!copy) return NULL;
+
+    memcpy(copy, action, sizeof(regislex_action_t));
+    copy->params = NULL;
+    copy->param_count = 0;
+    copy->conditions = NULL;
+    copy->condition_count = 0;
+
+    if (action->param_count > 0 && action->params) {
+        copy->params = (regislex_action_param_t*)platform_calloc(
+            action->param_count, sizeof(regislex_action_param_t));
+        if (!copy->params) {
+            platform_free(copy);
+            return NULL;
         }
+        memcpy(copy->params, action->params, (size_t)action->param_count * sizeof(regislex_action_param_t));
+        copy->param_count = action->param_count;
+    }
 
-        case REGISLEX_ACTION_DELAY:
-            /* Wait for specified time */
-            if (action->delay_minutes > 0) {
-                platform_sleep_ms(action->delay_minutes * 60 * 1000);
-            }
-            break;
+    return copy;
+}
 
-        case REGISLEX_ACTION_CONDITION:
-            /* Evaluate condition and branch */
-            /* TODO: Implement condition evaluation */
-            break;
+regislex_error_t regislex_task_from_row(regislex_db_stmt_t* stmt, regislex_task_t* task) {
+    if (!stmt || !task) return REGISLEX_ERROR_INVALID_ARGUMENT;
 
-        case REGISLEX_ACTION_APPROVAL:
-            /* Wait for approval */
-            /* TODO: Implement approval workflow */
-            break;
+    int col = 0;
 
-        case REGISLEX_ACTION_NOTIFY:
-            /* Send in-app notification */
-            /* TODO: Implement notification system */
-            break;
+    regislex_db_column_uuid(stmt, col++, &task->id);
+    regislex_db_column_uuid(stmt, col++, &task->case_id);
+    regislex_db_column_uuid(stmt, col++, &task->matter_id);
+    regislex_db_column_uuid(stmt, col++, &task->workflow_run_id);
+    regislex_db_column_uuid(stmt, col++, &task->parent_task_id);
 
-        case REGISLEX_ACTION_GENERATE_REPORT:
-            /* Generate a report */
-            /* TODO: Integrate with reporting module */
-            break;
+    const char* title = regislex_db_column_text(stmt, col++);
+    if (title) strncpy(task->title, title, sizeof(task->title) - 1);
 
-        case REGISLEX_ACTION_CREATE_DOCUMENT:
-            /* Generate document from template */
-            /* TODO: Integrate with document management module */
-            break;
+    const char* desc = regislex_db_column_text(stmt, col++);
+    if (desc) strncpy(task->description, desc, sizeof(task->description) - 1);
 
-        case REGISLEX_ACTION_CUSTOM_SCRIPT:
-            /* Execute custom script/plugin */
-            /* TODO: Implement plugin system */
-            break;
+    task->status = (regislex_task_status_t)regislex_db_column_int(stmt, col++);
+    task->priority = (regislex_priority_t)regislex_db_column_int(stmt, col++);
 
-        default:
-            err = REGISLEX_ERROR_UNSUPPORTED;
-            break;
-    }
+    regislex_db_column_uuid(stmt, col++, &task->assigned_to_id);
+    regislex_db_column_uuid(stmt, col++, &task->assigned_by);
 
-    return err;
+    regislex_db_column_datetime(stmt, col++, &task->due_date);
+
+    task->estimated_minutes = (int)regislex_db_column_int(stmt, col++);
+    task->actual_minutes = (int)regislex_db_column_int(stmt, col++);
+    task->percent_complete = (int)regislex_db_column_int(stmt, col++);
+
+    const char* notes = regislex_db_column_text(stmt, col++);
+    if (notes) strncpy(task->completion_notes, notes, sizeof(task->completion_notes) - 1);
+
+    task->requires_approval = regislex_db_column_int(stmt, col++) != 0;
+    regislex_db_column_uuid(stmt, col++, &task->approver_id);
+    regislex_db_column_datetime(stmt, col++, &task->approved_at);
+
+    regislex_db_column_datetime(stmt, col++, &task->started_at);
+    regislex_db_column_datetime(stmt, col++, &task->completed_at);
+    regislex_db_column_datetime(stmt, col++, &task->created_at);
+    regislex_db_column_datetime(stmt, col++, &task->updated_at);
+    regislex_db_column_uuid(stmt, col++, &task->created_by);
+
+    return REGISLEX_OK;
 }
 
 /* ============================================================================
@@ -292,14 +478,14 @@ REGISLEX_API regislex_error_t regislex_workflow_create(
     regislex_datetime_now(&new_wf->created_at);
     memcpy(&new_wf->updated_at, &new_wf->created_at, sizeof(regislex_datetime_t));
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
     const char* sql =
         "INSERT INTO workflows ("
         "  id, name, description, category, status, version,"
-        "  run_once, allow_parallel, timeout_minutes,"
+        "  run_once, allow_parallel, max_parallel_runs, timeout_minutes,"
         "  created_at, updated_at, created_by"
-        ") VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)";
+        ") VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)";
 
     regislex_db_stmt_t* stmt = NULL;
     regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
@@ -317,10 +503,11 @@ REGISLEX_API regislex_error_t regislex_workflow_create(
     regislex_db_bind_int(stmt, idx++, new_wf->version);
     regislex_db_bind_int(stmt, idx++, new_wf->run_once ? 1 : 0);
     regislex_db_bind_int(stmt, idx++, new_wf->allow_parallel ? 1 : 0);
+    regislex_db_bind_int(stmt, idx++, new_wf->max_parallel_runs);
     regislex_db_bind_int(stmt, idx++, new_wf->timeout_minutes);
     regislex_db_bind_datetime(stmt, idx++, &new_wf->created_at);
     regislex_db_bind_datetime(stmt, idx++, &new_wf->updated_at);
-    regislex_db_bind_uuid(stmt, idx++, &new_wf->created_by);
+    regislex_db_bind_uuid_ref(stmt, idx++, &new_wf->created_by);
 
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
@@ -343,13 +530,10 @@ REGISLEX_API regislex_error_t regislex_workflow_get(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
     const char* sql =
-        "SELECT id, name, description, category, status, version,"
-        "  run_once, allow_parallel, timeout_minutes,"
-        "  created_at, updated_at, created_by "
-        "FROM workflows WHERE id = ?";
+        "SELECT " WORKFLOW_COLUMNS " FROM workflows WHERE id = ?";
 
     regislex_db_stmt_t* stmt = NULL;
     regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
@@ -372,7 +556,14 @@ REGISLEX_API regislex_error_t regislex_workflow_get(
     workflow_from_row(stmt, wf);
     regislex_db_finalize(stmt);
 
-    /* TODO: Load triggers and actions */
+    err = workflow_load_actions(db, wf);
+    if (err == REGISLEX_OK) {
+        err = workflow_load_triggers(db, wf);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_workflow_free(wf);
+        return err;
+    }
 
     *out_workflow = wf;
     return REGISLEX_OK;
@@ -386,13 +577,13 @@ REGISLEX_API regislex_error_t regislex_workflow_update(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
     const char* sql =
         "UPDATE workflows SET "
         "  name = ?, description = ?, category = ?, status = ?,"
-        "  run_once = ?, allow_parallel = ?, timeout_minutes = ?,"
-        "  updated_at = ? "
+        "  run_once = ?, allow_parallel = ?, max_parallel_runs = ?, timeout_minutes = ?,"
+        "  version = version + 1, updated_at = ? "
         "WHERE id = ?";
 
     regislex_db_stmt_t* stmt = NULL;
@@ -409,14 +600,20 @@ REGISLEX_API regislex_error_t regislex_workflow_update(
     regislex_db_bind_int(stmt, idx++, workflow->status);
     regislex_db_bind_int(stmt, idx++, workflow->run_once ? 1 : 0);
     regislex_db_bind_int(stmt, idx++, workflow->allow_parallel ? 1 : 0);
+    regislex_db_bind_int(stmt, idx++, workflow->max_parallel_runs);
     regislex_db_bind_int(stmt, idx++, workflow->timeout_minutes);
     regislex_db_bind_datetime(stmt, idx++, &now);
     regislex_db_bind_uuid(stmt, idx++, &workflow->id);
 
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) return err;
 
-    return (err == REGISLEX_ERROR_NOT_FOUND) ? REGISLEX_OK : err;
+    err = definition_changed(db, &workflow->id);
+    if (err != REGISLEX_OK) return err;
+
+    /* The status decides whether the workflow's triggers are live */
+    return triggers_changed(ctx);
 }
 
 REGISLEX_API regislex_error_t regislex_workflow_delete(
@@ -427,10 +624,9 @@ REGISLEX_API regislex_error_t regislex_workflow_delete(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
-    /* Delete associated triggers and actions first (cascade) */
-    /* The database schema should handle this with ON DELETE CASCADE */
+    /* Actions, parameters and triggers go with the workflow (ON DELETE CASCADE) */
 
     const char* sql = "DELETE FROM workflows WHERE id = ?";
 
@@ -442,8 +638,11 @@ REGISLEX_API regislex_error_t regislex_workflow_delete(
 
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) return err;
 
-    return (err == REGISLEX_ERROR_NOT_FOUND) ? REGISLEX_OK : err;
+    err = definition_changed(db, id);
+    if (err != REGISLEX_OK) return err;
+    return triggers_changed(ctx);
 }
 
 REGISLEX_API regislex_error_t regislex_workflow_list(
@@ -456,21 +655,15 @@ REGISLEX_API regislex_error_t regislex_workflow_list(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
     char sql[1024];
     if (category) {
         snprintf(sql, sizeof(sql),
-            "SELECT id, name, description, category, status, version,"
-            "  run_once, allow_parallel, timeout_minutes,"
-            "  created_at, updated_at, created_by "
-            "FROM workflows WHERE category = ? ORDER BY name");
+            "SELECT " WORKFLOW_COLUMNS " FROM workflows WHERE category = ? ORDER BY name");
     } else {
         strcpy(sql,
-            "SELECT id, name, description, category, status, version,"
-            "  run_once, allow_parallel, timeout_minutes,"
-            "  created_at, updated_at, created_by "
-            "FROM workflows ORDER BY name");
+            "SELECT " WORKFLOW_COLUMNS " FROM workflows ORDER BY name");
     }
 
     regislex_db_stmt_t* stmt = NULL;
@@ -530,7 +723,7 @@ REGISLEX_API regislex_error_t regislex_workflow_activate(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
     const char* sql = "UPDATE workflows SET status = ?, updated_at = ? WHERE id = ?";
 
@@ -547,8 +740,11 @@ REGISLEX_API regislex_error_t regislex_workflow_activate(
 
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) return err;
 
-    return (err == REGISLEX_ERROR_NOT_FOUND) ? REGISLEX_OK : err;
+    err = definition_changed(db, id);
+    if (err != REGISLEX_OK) return err;
+    return triggers_changed(ctx);
 }
 
 REGISLEX_API regislex_error_t regislex_workflow_pause(
@@ -559,7 +755,7 @@ REGISLEX_API regislex_error_t regislex_workflow_pause(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
     const char* sql = "UPDATE workflows SET status = ?, updated_at = ? WHERE id = ?";
 
@@ -576,113 +772,11 @@ REGISLEX_API regislex_error_t regislex_workflow_pause(
 
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) return err;
 
-    return (err == REGISLEX_ERROR_NOT_FOUND) ? REGISLEX_OK : err;
-}
-
-REGISLEX_API regislex_error_t regislex_workflow_execute(
-    regislex_context_t* ctx,
-    const regislex_uuid_t* workflow_id,
-    const regislex_uuid_t* case_id,
-    const char* trigger_data,
-    regislex_workflow_run_t** out_run)
-{
-    if (!ctx || !workflow_id || !out_run) {
-        return REGISLEX_ERROR_INVALID_ARGUMENT;
-    }
-
-    /* Get workflow */
-    regislex_workflow_t* workflow = NULL;
-    regislex_error_t err = regislex_workflow_get(ctx, workflow_id, &workflow);
+    err = definition_changed(db, id);
     if (err != REGISLEX_OK) return err;
-
-    /* Check if workflow is active */
-    if (workflow->status != REGISLEX_WORKFLOW_ACTIVE) {
-        regislex_workflow_free(workflow);
-        return REGISLEX_ERROR_INVALID_STATE;
-    }
-
-    /* Create workflow run */
-    regislex_workflow_run_t* run = workflow_run_alloc();
-    if (!run) {
-        regislex_workflow_free(workflow);
-        return REGISLEX_ERROR_OUT_OF_MEMORY;
-    }
-
-    regislex_uuid_generate(&run->id);
-    memcpy(&run->workflow_id, workflow_id, sizeof(regislex_uuid_t));
-    if (case_id) {
-        memcpy(&run->case_id, case_id, sizeof(regislex_uuid_t));
-    }
-    if (trigger_data) {
-        strncpy(run->trigger_data, trigger_data, sizeof(run->trigger_data) - 1);
-    }
-
-    run->status = REGISLEX_WORKFLOW_ACTIVE;
-    run->current_step = 0;
-    regislex_datetime_now(&run->started_at);
-    regislex_datetime_now(&run->created_at);
-
-    /* Create execution context */
-    workflow_exec_ctx_t exec_ctx = {0};
-    exec_ctx.ctx = ctx;
-    exec_ctx.workflow = workflow;
-    exec_ctx.run = run;
-    exec_ctx.trigger_data = trigger_data ? platform_strdup(trigger_data) : NULL;
-
-    /* Execute actions in sequence */
-    for (int i = 0; i < workflow->action_count && !exec_ctx.cancelled; i++) {
-        regislex_action_t* action = workflow->actions[i];
-        run->current_step = i + 1;
-
-        err = execute_action(&exec_ctx, action);
-        if (err != REGISLEX_OK) {
-            run->status = REGISLEX_WORKFLOW_FAILED;
-            snprintf(run->error_message, sizeof(run->error_message),
-                    "Action %d (%s) failed with error %d", i, action->name, err);
-            break;
-        }
-    }
-
-    /* Mark completion */
-    if (run->status == REGISLEX_WORKFLOW_ACTIVE) {
-        run->status = REGISLEX_WORKFLOW_COMPLETED;
-    }
-    regislex_datetime_now(&run->completed_at);
-
-    /* Cleanup */
-    if (exec_ctx.trigger_data) {
-        platform_free(exec_ctx.trigger_data);
-    }
-    regislex_workflow_free(workflow);
-
-    *out_run = run;
-    return REGISLEX_OK;
-}
-
-REGISLEX_API regislex_error_t regislex_workflow_run_get(
-    regislex_context_t* ctx,
-    const regislex_uuid_t* run_id,
-    regislex_workflow_run_t** out_run)
-{
-    if (!ctx || !run_id || !out_run) {
-        return REGISLEX_ERROR_INVALID_ARGUMENT;
-    }
-
-    /* TODO: Load from database */
-    return REGISLEX_ERROR_NOT_FOUND;
-}
-
-REGISLEX_API regislex_error_t regislex_workflow_run_cancel(
-    regislex_context_t* ctx,
-    const regislex_uuid_t* run_id)
-{
-    if (!ctx || !run_id) {
-        return REGISLEX_ERROR_INVALID_ARGUMENT;
-    }
-
-    /* TODO: Cancel running workflow */
-    return REGISLEX_OK;
+    return triggers_changed(ctx);
 }
 
 REGISLEX_API void regislex_workflow_free(regislex_workflow_t* workflow) {
@@ -724,20 +818,61 @@ REGISLEX_API regislex_error_t regislex_trigger_add(
     if (!ctx || !workflow_id || !trigger || !out_trigger) {
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
+    if (!trigger_valid(trigger)) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
 
     regislex_trigger_t* new_trigger = (regislex_trigger_t*)platform_calloc(1, sizeof(regislex_trigger_t));
     if (!new_trigger) {
         return REGISLEX_ERROR_OUT_OF_MEMORY;
     }
 
+    /* Conditions are not stored with the trigger */
     memcpy(new_trigger, trigger, sizeof(regislex_trigger_t));
+    new_trigger->conditions = NULL;
+    new_trigger->condition_count = 0;
     regislex_uuid_generate(&new_trigger->id);
     memcpy(&new_trigger->workflow_id, workflow_id, sizeof(regislex_uuid_t));
 
     regislex_datetime_now(&new_trigger->created_at);
     memcpy(&new_trigger->updated_at, &new_trigger->created_at, sizeof(regislex_datetime_t));
 
-    /* TODO: Insert into database */
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(regislex_get_db(ctx),
+        "INSERT INTO workflow_triggers (" TRIGGER_COLUMNS ")"
+        " VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)", &stmt);
+    if (err != REGISLEX_OK) {
+        regislex_trigger_free(new_trigger);
+        return err;
+    }
+
+    int idx = 1;
+    regislex_db_bind_uuid(stmt, idx++, &new_trigger->id);
+    regislex_db_bind_uuid(stmt, idx++, &new_trigger->workflow_id);
+    regislex_db_bind_text(stmt, idx++, new_trigger->name);
+    regislex_db_bind_int(stmt, idx++, new_trigger->type);
+    regislex_db_bind_int(stmt, idx++, new_trigger->event_type);
+    regislex_db_bind_text(stmt, idx++, new_trigger->event_name);
+    regislex_db_bind_text(stmt, idx++, new_trigger->event_filter);
+    regislex_db_bind_text(stmt, idx++, new_trigger->schedule_cron);
+    regislex_db_bind_text(stmt, idx++, new_trigger->webhook_secret);
+    regislex_db_bind_int(stmt, idx++, new_trigger->is_active ? 1 : 0);
+    regislex_db_bind_datetime(stmt, idx++, &new_trigger->created_at);
+    regislex_db_bind_datetime(stmt, idx++, &new_trigger->updated_at);
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        regislex_trigger_free(new_trigger);
+        return err;
+    }
+
+    err = triggers_changed(ctx);
+    if (err != REGISLEX_OK) {
+        regislex_trigger_free(new_trigger);
+        return err;
+    }
 
     *out_trigger = new_trigger;
     return REGISLEX_OK;
@@ -750,9 +885,46 @@ REGISLEX_API regislex_error_t regislex_trigger_update(
     if (!ctx || !trigger) {
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
+    if (!trigger_valid(trigger)) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
 
-    /* TODO: Update in database */
-    return REGISLEX_OK;
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db,
+        "UPDATE workflow_triggers SET "
+        "  name = ?, type = ?, event_type = ?, event_name = ?, event_filter = ?,"
+        "  schedule_cron = ?, webhook_secret = ?, is_active = ?, updated_at = ? "
+        "WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    int idx = 1;
+    regislex_db_bind_text(stmt, idx++, trigger->name);
+    regislex_db_bind_int(stmt, idx++, trigger->type);
+    regislex_db_bind_int(stmt, idx++, trigger->event_type);
+    regislex_db_bind_text(stmt, idx++, trigger->event_name);
+    regislex_db_bind_text(stmt, idx++, trigger->event_filter);
+    regislex_db_bind_text(stmt, idx++, trigger->schedule_cron);
+    regislex_db_bind_text(stmt, idx++, trigger->webhook_secret);
+    regislex_db_bind_int(stmt, idx++, trigger->is_active ? 1 : 0);
+    regislex_db_bind_datetime(stmt, idx++, &now);
+    regislex_db_bind_uuid(stmt, idx++, &trigger->id);
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+    if (regislex_db_changes(db) == 0) {
+        return REGISLEX_ERROR_NOT_FOUND;
+    }
+
+    return triggers_changed(ctx);
 }
 
 REGISLEX_API regislex_error_t regislex_trigger_remove(
@@ -763,8 +935,25 @@ REGISLEX_API regislex_error_t regislex_trigger_remove(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    /* TODO: Delete from database */
-    return REGISLEX_OK;
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, "DELETE FROM workflow_triggers WHERE id = ?", &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_bind_uuid(stmt, 1, id);
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+    if (regislex_db_changes(db) == 0) {
+        return REGISLEX_ERROR_NOT_FOUND;
+    }
+
+    return triggers_changed(ctx);
 }
 
 REGISLEX_API void regislex_trigger_free(regislex_trigger_t* trigger) {
@@ -790,20 +979,69 @@ REGISLEX_API regislex_error_t regislex_action_add(
     if (!ctx || !workflow_id || !action || !out_action) {
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
+    if (!action_valid(action)) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
 
-    regislex_action_t* new_action = (regislex_action_t*)platform_calloc(1, sizeof(regislex_action_t));
+    regislex_action_t* new_action = action_dup(action);
     if (!new_action) {
         return REGISLEX_ERROR_OUT_OF_MEMORY;
     }
 
-    memcpy(new_action, action, sizeof(regislex_action_t));
     regislex_uuid_generate(&new_action->id);
     memcpy(&new_action->workflow_id, workflow_id, sizeof(regislex_uuid_t));
 
     regislex_datetime_now(&new_action->created_at);
     memcpy(&new_action->updated_at, &new_action->created_at, sizeof(regislex_datetime_t));
 
-    /* TODO: Insert into database */
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_transaction_t* tx = NULL;
+    regislex_error_t err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) {
+        regislex_action_free(new_action);
+        return err;
+    }
+
+    regislex_db_stmt_t* stmt = NULL;
+    err = regislex_db_prepare(db,
+        "INSERT INTO workflow_actions (" ACTION_COLUMNS ")"
+        " VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)", &stmt);
+    if (err == REGISLEX_OK) {
+        int idx = 1;
+        regislex_db_bind_uuid(stmt, idx++, &new_action->id);
+        regislex_db_bind_uuid(stmt, idx++, &new_action->workflow_id);
+        regislex_db_bind_text(stmt, idx++, new_action->name);
+        regislex_db_bind_text(stmt, idx++, new_action->description);
+        regislex_db_bind_int(stmt, idx++, new_action->type);
+        regislex_db_bind_int(stmt, idx++, new_action->sequence_order);
+        regislex_db_bind_int(stmt, idx++, new_action->delay_minutes);
+        regislex_db_bind_int(stmt, idx++, new_action->timeout_minutes);
+        regislex_db_bind_int(stmt, idx++, new_action->retry_count);
+        regislex_db_bind_int(stmt, idx++, new_action->retry_delay_minutes);
+        regislex_db_bind_int(stmt, idx++, new_action->is_active ? 1 : 0);
+        regislex_db_bind_datetime(stmt, idx++, &new_action->created_at);
+        regislex_db_bind_datetime(stmt, idx++, &new_action->updated_at);
+
+        err = regislex_db_step(stmt);
+        regislex_db_finalize(stmt);
+        if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
+    }
+
+    if (err == REGISLEX_OK) {
+        err = action_store_params(db, new_action);
+    }
+    if (err == REGISLEX_OK) {
+        err = workflow_bump_version(db, workflow_id);
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        regislex_action_free(new_action);
+        return err;
+    }
 
     *out_action = new_action;
     return REGISLEX_OK;
@@ -816,8 +1054,65 @@ REGISLEX_API regislex_error_t regislex_action_update(
     if (!ctx || !action) {
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
+    if (!action_valid(action)) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_transaction_t* tx = NULL;
+    regislex_error_t err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    regislex_db_stmt_t* stmt = NULL;
+    err = regislex_db_prepare(db,
+        "UPDATE workflow_actions SET "
+        "  name = ?, description = ?, type = ?, sequence_order = ?,"
+        "  delay_minutes = ?, timeout_minutes = ?, retry_count = ?, retry_delay_minutes = ?,"
+        "  is_active = ?, updated_at = ? "
+        "WHERE id = ?", &stmt);
+    if (err == REGISLEX_OK) {
+        int idx = 1;
+        regislex_db_bind_text(stmt, idx++, action->name);
+        regislex_db_bind_text(stmt, idx++, action->description);
+        regislex_db_bind_int(stmt, idx++, action->type);
+        regislex_db_bind_int(stmt, idx++, action->sequence_order);
+        regislex_db_bind_int(stmt, idx++, action->delay_minutes);
+        regislex_db_bind_int(stmt, idx++, action->timeout_minutes);
+        regislex_db_bind_int(stmt, idx++, action->retry_count);
+        regislex_db_bind_int(stmt, idx++, action->retry_delay_minutes);
+        regislex_db_bind_int(stmt, idx++, action->is_active ? 1 : 0);
+        regislex_db_bind_datetime(stmt, idx++, &now);
+        regislex_db_bind_uuid(stmt, idx++, &action->id);
+
+        err = regislex_db_step(stmt);
+        regislex_db_finalize(stmt);
+        if (err == REGISLEX_ERROR_NOT_FOUND) {
+            err = regislex_db_changes(db) == 0 ? REGISLEX_ERROR_NOT_FOUND : REGISLEX_OK;
+        }
+    }
+
+    regislex_uuid_t workflow_id = {{0}};
+    if (err == REGISLEX_OK) {
+        err = action_store_params(db, action);
+    }
+    if (err == REGISLEX_OK) {
+        err = action_workflow_id(db, &action->id, &workflow_id);
+    }
+    if (err == REGISLEX_OK) {
+        err = workflow_bump_version(db, &workflow_id);
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        return err;
+    }
 
-    /* TODO: Update in database */
     return REGISLEX_OK;
 }
 
@@ -829,7 +1124,37 @@ REGISLEX_API regislex_error_t regislex_action_remove(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    /* TODO: Delete from database */
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    regislex_db_transaction_t* tx = NULL;
+    regislex_error_t err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_uuid_t workflow_id = {{0}};
+    err = action_workflow_id(db, id, &workflow_id);
+
+    /* Parameters go with the action (ON DELETE CASCADE) */
+    regislex_db_stmt_t* stmt = NULL;
+    if (err == REGISLEX_OK) {
+        err = regislex_db_prepare(db, "DELETE FROM workflow_actions WHERE id = ?", &stmt);
+    }
+    if (err == REGISLEX_OK) {
+        regislex_db_bind_uuid(stmt, 1, id);
+        err = regislex_db_step(stmt);
+        regislex_db_finalize(stmt);
+        if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
+    }
+    if (err == REGISLEX_OK) {
+        err = workflow_bump_version(db, &workflow_id);
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        return err;
+    }
+
     return REGISLEX_OK;
 }
 
@@ -851,6 +1176,61 @@ REGISLEX_API void regislex_action_free(regislex_action_t* action) {
  * Task Functions
  * ============================================================================ */
 
+/* Publish TASK_COMPLETED for trigger-driven workflows, tagged with the task's case */
+static void task_publish_completed(regislex_context_t* ctx, const regislex_uuid_t* id) {
+    regislex_event_t event;
+    memset(&event, 0, sizeof(event));
+    event.type = REGISLEX_EVENT_TASK_COMPLETED;
+    memcpy(&event.subject_id, id, sizeof(regislex_uuid_t));
+
+    regislex_db_stmt_t* stmt = NULL;
+    if (regislex_db_prepare(regislex_get_db(ctx),
+            "SELECT case_id FROM tasks WHERE id = ?", &stmt) == REGISLEX_OK) {
+        regislex_db_bind_uuid(stmt, 1, id);
+        if (regislex_db_step(stmt) == REGISLEX_OK) {
+            regislex_db_column_uuid(stmt, 0, &event.case_id);
+        }
+        regislex_db_finalize(stmt);
+    }
+
+    regislex_event_publish(ctx, &event);
+}
+
+typedef struct {
+    regislex_context_t* ctx;
+    regislex_uuid_t id;
+    bool completed;         /* Publish TASK_COMPLETED as well */
+} task_sync_t;
+
+/* Re-read a committed task so the agenda sees the stored row */
+static void task_sync_run(void* data) {
+    const task_sync_t* sync = (const task_sync_t*)data;
+
+    regislex_task_t* stored = NULL;
+    if (regislex_task_get(sync->ctx, &sync->id, &stored) == REGISLEX_OK) {
+        regislex_agenda_apply_task(stored);
+        regislex_task_free(stored);
+    } else {
+        regislex_agenda_remove(&sync->id);
+    }
+
+    if (sync->completed) {
+        task_publish_completed(sync->ctx, &sync->id);
+    }
+}
+
+/* Bring the agenda up to date, and publish a completion, once the task change commits */
+static regislex_error_t task_sync(regislex_context_t* ctx, const regislex_uuid_t* id, bool completed) {
+    task_sync_t* sync = (task_sync_t*)platform_malloc(sizeof(task_sync_t));
+    if (!sync) {
+        return REGISLEX_ERROR_OUT_OF_MEMORY;
+    }
+    sync->ctx = ctx;
+    sync->id = *id;
+    sync->completed = completed;
+    return regislex_db_after_commit(regislex_get_db(ctx), task_sync_run, sync);
+}
+
 REGISLEX_API regislex_error_t regislex_task_create(
     regislex_context_t* ctx,
     const regislex_task_t* task,
@@ -877,7 +1257,7 @@ REGISLEX_API regislex_error_t regislex_task_create(
     regislex_datetime_now(&new_task->created_at);
     memcpy(&new_task->updated_at, &new_task->created_at, sizeof(regislex_datetime_t));
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
     const char* sql =
         "INSERT INTO tasks ("
@@ -898,34 +1278,37 @@ REGISLEX_API regislex_error_t regislex_task_create(
 
     int idx = 1;
     regislex_db_bind_uuid(stmt, idx++, &new_task->id);
-    regislex_db_bind_uuid(stmt, idx++, &new_task->case_id);
+    regislex_db_bind_uuid_ref(stmt, idx++, &new_task->case_id);
     regislex_db_bind_uuid(stmt, idx++, &new_task->matter_id);
     regislex_db_bind_uuid(stmt, idx++, &new_task->workflow_run_id);
-    regislex_db_bind_uuid(stmt, idx++, &new_task->parent_task_id);
+    regislex_db_bind_uuid_ref(stmt, idx++, &new_task->parent_task_id);
     regislex_db_bind_text(stmt, idx++, new_task->title);
     regislex_db_bind_text(stmt, idx++, new_task->description);
     regislex_db_bind_int(stmt, idx++, new_task->status);
     regislex_db_bind_int(stmt, idx++, new_task->priority);
-    regislex_db_bind_uuid(stmt, idx++, &new_task->assigned_to_id);
-    regislex_db_bind_uuid(stmt, idx++, &new_task->assigned_by);
+    regislex_db_bind_uuid_ref(stmt, idx++, &new_task->assigned_to_id);
+    regislex_db_bind_uuid_ref(stmt, idx++, &new_task->assigned_by);
     regislex_db_bind_datetime(stmt, idx++, &new_task->due_date);
     regislex_db_bind_int(stmt, idx++, new_task->estimated_minutes);
     regislex_db_bind_int(stmt, idx++, new_task->actual_minutes);
     regislex_db_bind_int(stmt, idx++, new_task->percent_complete);
     regislex_db_bind_text(stmt, idx++, new_task->completion_notes);
     regislex_db_bind_int(stmt, idx++, new_task->requires_approval ? 1 : 0);
-    regislex_db_bind_uuid(stmt, idx++, &new_task->approver_id);
+    regislex_db_bind_uuid_ref(stmt, idx++, &new_task->approver_id);
     regislex_db_bind_datetime(stmt, idx++, &new_task->approved_at);
     regislex_db_bind_datetime(stmt, idx++, &new_task->started_at);
     regislex_db_bind_datetime(stmt, idx++, &new_task->completed_at);
     regislex_db_bind_datetime(stmt, idx++, &new_task->created_at);
     regislex_db_bind_datetime(stmt, idx++, &new_task->updated_at);
-    regislex_db_bind_uuid(stmt, idx++, &new_task->created_by);
+    regislex_db_bind_uuid_ref(stmt, idx++, &new_task->created_by);
 
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
 
-    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+    if (err == REGISLEX_ERROR_NOT_FOUND || err == REGISLEX_OK) {
+        err = task_sync(ctx, &new_task->id, false);
+    }
+    if (err != REGISLEX_OK) {
         regislex_task_free(new_task);
         return err;
     }
@@ -943,7 +1326,7 @@ REGISLEX_API regislex_error_t regislex_task_get(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
     const char* sql =
         "SELECT id, case_id, matter_id, workflow_run_id, parent_task_id,"
@@ -972,7 +1355,7 @@ REGISLEX_API regislex_error_t regislex_task_get(
         return REGISLEX_ERROR_OUT_OF_MEMORY;
     }
 
-    task_from_row(stmt, task);
+    regislex_task_from_row(stmt, task);
     regislex_db_finalize(stmt);
 
     *out_task = task;
@@ -987,7 +1370,7 @@ REGISLEX_API regislex_error_t regislex_task_update(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
     const char* sql =
         "UPDATE tasks SET "
@@ -1009,7 +1392,7 @@ REGISLEX_API regislex_error_t regislex_task_update(
     regislex_db_bind_text(stmt, idx++, task->description);
     regislex_db_bind_int(stmt, idx++, task->status);
     regislex_db_bind_int(stmt, idx++, task->priority);
-    regislex_db_bind_uuid(stmt, idx++, &task->assigned_to_id);
+    regislex_db_bind_uuid_ref(stmt, idx++, &task->assigned_to_id);
     regislex_db_bind_datetime(stmt, idx++, &task->due_date);
     regislex_db_bind_int(stmt, idx++, task->estimated_minutes);
     regislex_db_bind_int(stmt, idx++, task->actual_minutes);
@@ -1021,7 +1404,11 @@ REGISLEX_API regislex_error_t regislex_task_update(
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
 
-    return (err == REGISLEX_ERROR_NOT_FOUND) ? REGISLEX_OK : err;
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+
+    return task_sync(ctx, &task->id, false);
 }
 
 REGISLEX_API regislex_error_t regislex_task_start(
@@ -1032,7 +1419,7 @@ REGISLEX_API regislex_error_t regislex_task_start(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
     const char* sql =
         "UPDATE tasks SET status = ?, started_at = ?, updated_at = ? WHERE id = ?";
@@ -1052,7 +1439,11 @@ REGISLEX_API regislex_error_t regislex_task_start(
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
 
-    return (err == REGISLEX_ERROR_NOT_FOUND) ? REGISLEX_OK : err;
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+
+    return task_sync(ctx, task_id, false);
 }
 
 REGISLEX_API regislex_error_t regislex_task_complete(
@@ -1065,7 +1456,7 @@ REGISLEX_API regislex_error_t regislex_task_complete(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
     const char* sql =
         "UPDATE tasks SET "
@@ -1090,7 +1481,10 @@ REGISLEX_API regislex_error_t regislex_task_complete(
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
 
-    return (err == REGISLEX_ERROR_NOT_FOUND) ? REGISLEX_OK : err;
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+    return task_sync(ctx, task_id, regislex_db_changes(db) > 0);
 }
 
 REGISLEX_API regislex_error_t regislex_task_assign(
@@ -1102,7 +1496,7 @@ REGISLEX_API regislex_error_t regislex_task_assign(
         return REGISLEX_ERROR_INVALID_ARGUMENT;
     }
 
-    regislex_db_context_t* db = NULL;
+    regislex_db_context_t* db = regislex_get_db(ctx);
 
     const char* sql =
         "UPDATE tasks SET assigned_to_id = ?, updated_at = ? WHERE id = ?";
@@ -1114,14 +1508,151 @@ REGISLEX_API regislex_error_t regislex_task_assign(
     regislex_datetime_t now;
     regislex_datetime_now(&now);
 
-    regislex_db_bind_uuid(stmt, 1, user_id);
+    regislex_db_bind_uuid_ref(stmt, 1, user_id);
     regislex_db_bind_datetime(stmt, 2, &now);
     regislex_db_bind_uuid(stmt, 3, task_id);
 
     err = regislex_db_step(stmt);
     regislex_db_finalize(stmt);
 
-    return (err == REGISLEX_ERROR_NOT_FOUND) ? REGISLEX_OK : err;
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+
+    return task_sync(ctx, task_id, false);
+}
+
+REGISLEX_API regislex_error_t regislex_task_request_approval(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* task_id,
+    const regislex_uuid_t* approver_id)
+{
+    if (!ctx || !task_id || !approver_id) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    const char* sql =
+        "UPDATE tasks SET status = ?, requires_approval = 1, approver_id = ?, updated_at = ? "
+        "WHERE id = ?";
+
+    regislex_db_stmt_t* stmt = NULL;
+    regislex_error_t err = regislex_db_prepare(db, sql, &stmt);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+
+    regislex_db_bind_int(stmt, 1, REGISLEX_TASK_WAITING_APPROVAL);
+    regislex_db_bind_uuid_ref(stmt, 2, approver_id);
+    regislex_db_bind_datetime(stmt, 3, &now);
+    regislex_db_bind_uuid(stmt, 4, task_id);
+
+    err = regislex_db_step(stmt);
+    regislex_db_finalize(stmt);
+
+    if (err != REGISLEX_ERROR_NOT_FOUND && err != REGISLEX_OK) {
+        return err;
+    }
+    if (regislex_db_changes(db) == 0) {
+        return REGISLEX_ERROR_NOT_FOUND;
+    }
+
+    return task_sync(ctx, task_id, false);
+}
+
+/*
+ * Records the decision on a task waiting for approval, then passes it to
+ * the workflow run that opened the task, if any. Both happen in one
+ * transaction, so a task is never decided while its run stays parked.
+ */
+static regislex_error_t task_decide(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* task_id,
+    bool approved,
+    const char* notes)
+{
+    if (!ctx || !task_id) {
+        return REGISLEX_ERROR_INVALID_ARGUMENT;
+    }
+
+    regislex_db_context_t* db = regislex_get_db(ctx);
+
+    const char* sql = approved
+        ? "UPDATE tasks SET status = ?, completion_notes = ?, approved_at = ?, updated_at = ? "
+          "WHERE id = ? AND status = ?"
+        : "UPDATE tasks SET status = ?, completion_notes = ?, completed_at = ?, updated_at = ? "
+          "WHERE id = ? AND status = ?";
+
+    regislex_db_transaction_t* tx = NULL;
+    regislex_error_t err = regislex_db_begin(db, &tx);
+    if (err != REGISLEX_OK) return err;
+
+    regislex_db_stmt_t* stmt = NULL;
+    err = regislex_db_prepare(db, sql, &stmt);
+    if (err == REGISLEX_OK) {
+        regislex_datetime_t now;
+        regislex_datetime_now(&now);
+
+        regislex_db_bind_int(stmt, 1, approved ? REGISLEX_TASK_APPROVED : REGISLEX_TASK_REJECTED);
+        regislex_db_bind_text(stmt, 2, notes);
+        regislex_db_bind_datetime(stmt, 3, &now);
+        regislex_db_bind_datetime(stmt, 4, &now);
+        regislex_db_bind_uuid(stmt, 5, task_id);
+        regislex_db_bind_int(stmt, 6, REGISLEX_TASK_WAITING_APPROVAL);
+
+        err = regislex_db_step(stmt);
+        regislex_db_finalize(stmt);
+        if (err == REGISLEX_ERROR_NOT_FOUND) err = REGISLEX_OK;
+    }
+
+    bool decided = err == REGISLEX_OK && regislex_db_changes(db) > 0;
+
+    regislex_task_t* task = NULL;
+    if (err == REGISLEX_OK) {
+        err = regislex_task_get(ctx, task_id, &task);
+    }
+    if (err == REGISLEX_OK && !decided) {
+        err = REGISLEX_ERROR_INVALID_STATE;
+    }
+
+    if (err == REGISLEX_OK && task->workflow_run_id.value[0] != '\0') {
+        /* The run may have been cancelled or timed out meanwhile */
+        err = regislex_workflow_approval_resolve(ctx, &task->workflow_run_id, approved, notes);
+        if (err == REGISLEX_ERROR_NOT_FOUND || err == REGISLEX_ERROR_INVALID_STATE) {
+            err = REGISLEX_OK;
+        }
+    }
+    regislex_task_free(task);
+
+    if (err == REGISLEX_OK) {
+        err = task_sync(ctx, task_id, false);
+    }
+    if (err == REGISLEX_OK) {
+        err = regislex_db_commit(tx);
+    }
+    if (err != REGISLEX_OK) {
+        regislex_db_rollback(tx);
+        return err;
+    }
+    return REGISLEX_OK;
+}
+
+REGISLEX_API regislex_error_t regislex_task_approve(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* task_id,
+    const char* notes)
+{
+    return task_decide(ctx, task_id, true, notes);
+}
+
+REGISLEX_API regislex_error_t regislex_task_reject(
+    regislex_context_t* ctx,
+    const regislex_uuid_t* task_id,
+    const char* reason)
+{
+    return task_decide(ctx, task_id, false, reason);
 }
 
 REGISLEX_API void regislex_task_free(regislex_task_t* task) {
@@ -11,6 +11,8 @@
 #else
 #include <pthread.h>
 #include <unistd.h>
+#include <errno.h>
+#include <time.h>
 #endif
 
 /* Mutex implementation */
@@ -194,8 +196,20 @@ platform_error_t platform_cond_timedwait(platform_cond_t* cond, platform_mutex_t
         return PLATFORM_ERROR_TIMEOUT;
     }
 #else
-    (void)timeout_ms;
-    pthread_cond_wait(&cond->cond, &mutex->mutex);
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    if (timeout_ms > 0) {
+        deadline.tv_sec += timeout_ms / 1000;
+        deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+    }
+    int rc = pthread_cond_timedwait(&cond->cond, &mutex->mutex, &deadline);
+    if (rc == ETIMEDOUT) {
+        return PLATFORM_ERROR_TIMEOUT;
+    }
 #endif
     return PLATFORM_OK;
 }
@@ -0,0 +1,151 @@
+/**
+ * @file tzgen.c
+ * @brief Time Zone Table Generator
+ *
+ * Build-time tool that compiles the zones RegisLex knows about into a C
+ * header. For each zone the current rule is taken from the POSIX TZ string
+ * stored in the footer of its TZif file (RFC 8536), so the generated table
+ * follows whatever tzdata release the build machine has installed. Zones
+ * missing from the tzdata directory fall back to the rule listed below.
+ *
+ * Usage: regislex-tzgen <tzdata-dir> <output-header>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TZGEN_MAX_RULE  64
+
+typedef struct {
+    const char* name;
+    const char* fallback;
+} tzgen_zone_t;
+
+/* Kept sorted by name; the runtime looks zones up by binary search */
+static const tzgen_zone_t TZGEN_ZONES[] = {
+    {"America/Adak",                 "HST10HDT,M3.2.0,M11.1.0"},
+    {"America/Anchorage",            "AKST9AKDT,M3.2.0,M11.1.0"},
+    {"America/Boise",                "MST7MDT,M3.2.0,M11.1.0"},
+    {"America/Chicago",              "CST6CDT,M3.2.0,M11.1.0"},
+    {"America/Denver",               "MST7MDT,M3.2.0,M11.1.0"},
+    {"America/Detroit",              "EST5EDT,M3.2.0,M11.1.0"},
+    {"America/Halifax",              "AST4ADT,M3.2.0,M11.1.0"},
+    {"America/Indiana/Indianapolis", "EST5EDT,M3.2.0,M11.1.0"},
+    {"America/Kentucky/Louisville",  "EST5EDT,M3.2.0,M11.1.0"},
+    {"America/Los_Angeles",          "PST8PDT,M3.2.0,M11.1.0"},
+    {"America/Mexico_City",          "CST6"},
+    {"America/New_York",             "EST5EDT,M3.2.0,M11.1.0"},
+    {"America/Phoenix",              "MST7"},
+    {"America/Puerto_Rico",          "AST4"},
+    {"America/Sao_Paulo",            "<-03>3"},
+    {"America/St_Thomas",            "AST4"},
+    {"America/Toronto",              "EST5EDT,M3.2.0,M11.1.0"},
+    {"America/Vancouver",            "PST8PDT,M3.2.0,M11.1.0"},
+    {"Asia/Hong_Kong",               "HKT-8"},
+    {"Asia/Kolkata",                 "IST-5:30"},
+    {"Asia/Singapore",               "<+08>-8"},
+    {"Asia/Tokyo",                   "JST-9"},
+    {"Australia/Sydney",             "AEST-10AEDT,M10.1.0,M4.1.0/3"},
+    {"Europe/Berlin",                "CET-1CEST,M3.5.0,M10.5.0/3"},
+    {"Europe/Dublin",                "IST-1GMT0,M10.5.0,M3.5.0/1"},
+    {"Europe/London",                "GMT0BST,M3.5.0/1,M10.5.0"},
+    {"Europe/Paris",                 "CET-1CEST,M3.5.0,M10.5.0/3"},
+    {"Pacific/Auckland",             "NZST-12NZDT,M9.5.0,M4.1.0/3"},
+    {"Pacific/Guam",                 "ChST-10"},
+    {"Pacific/Honolulu",             "HST10"},
+    {"Pacific/Pago_Pago",            "SST11"},
+    {"Pacific/Saipan",               "ChST-10"},
+    {"UTC",                          "UTC0"},
+};
+
+#define TZGEN_ZONE_COUNT  (sizeof(TZGEN_ZONES) / sizeof(TZGEN_ZONES[0]))
+
+/*
+ * Read the POSIX TZ footer of a TZif file. Version 2+ files end with
+ * "\n<rule>\n"; version 1 files have no footer and are rejected.
+ */
+static int read_footer(const char* dir, const char* zone, char* rule, size_t size) {
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s", dir, zone);
+
+    FILE* f = fopen(path, "rb");
+    if (!f) return 0;
+
+    char tail[TZGEN_MAX_RULE + 2];
+    long length = 0;
+    if (fseek(f, 0, SEEK_END) == 0) length = ftell(f);
+
+    long want = length < (long)sizeof(tail) ? length : (long)sizeof(tail);
+    size_t got = 0;
+    char magic[4];
+    if (fseek(f, 0, SEEK_SET) == 0 && fread(magic, 1, 4, f) == 4 &&
+        memcmp(magic, "TZif", 4) == 0 && fseek(f, length - want, SEEK_SET) == 0) {
+        got = fread(tail, 1, (size_t)want, f);
+    }
+    fclose(f);
+
+    if (got < 2 || tail[got - 1] != '\n') return 0;
+
+    size_t end = got - 1;
+    size_t start = end;
+    while (start > 0 && tail[start - 1] != '\n') start--;
+    if (start == 0 || start == end || end - start >= size) return 0;
+
+    for (size_t i = start; i < end; i++) {
+        char c = tail[i];
+        if (c < 0x20 || c > 0x7e || c == '"' || c == '\\') return 0;
+    }
+
+    memcpy(rule, tail + start, end - start);
+    rule[end - start] = '\0';
+    return 1;
+}
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s <tzdata-dir> <output-header>\n", argv[0]);
+        return 2;
+    }
+
+    for (size_t i = 1; i < TZGEN_ZONE_COUNT; i++) {
+        if (strcmp(TZGEN_ZONES[i - 1].name, TZGEN_ZONES[i].name) >= 0) {
+            fprintf(stderr, "tzgen: zone list is not sorted at %s\n", TZGEN_ZONES[i].name);
+            return 1;
+        }
+    }
+
+    FILE* out = fopen(argv[2], "w");
+    if (!out) {
+        fprintf(stderr, "tzgen: cannot write %s\n", argv[2]);
+        return 1;
+    }
+
+    int from_tzdata = 0;
+    fprintf(out, "/* Generated by regislex-tzgen from %s. Do not edit. */\n\n", argv[1]);
+    fprintf(out, "#define REGISLEX_TZ_ZONE_COUNT %u\n\n", (unsigned)TZGEN_ZONE_COUNT);
+    fprintf(out, "static const char* const REGISLEX_TZ_NAMES[REGISLEX_TZ_ZONE_COUNT] = {\n");
+    for (size_t i = 0; i < TZGEN_ZONE_COUNT; i++) {
+        fprintf(out, "    \"%s\",\n", TZGEN_ZONES[i].name);
+    }
+    fprintf(out, "};\n\n");
+    fprintf(out, "static const char* const REGISLEX_TZ_RULES[REGISLEX_TZ_ZONE_COUNT] = {\n");
+    for (size_t i = 0; i < TZGEN_ZONE_COUNT; i++) {
+        char rule[TZGEN_MAX_RULE];
+        if (read_footer(argv[1], TZGEN_ZONES[i].name, rule, sizeof(rule))) {
+            from_tzdata++;
+        } else {
+            snprintf(rule, sizeof(rule), "%s", TZGEN_ZONES[i].fallback);
+        }
+        fprintf(out, "    \"%s\",\n", rule);
+    }
+    fprintf(out, "};\n");
+
+    if (fclose(out) != 0) {
+        fprintf(stderr, "tzgen: cannot write %s\n", argv[2]);
+        return 1;
+    }
+
+    printf("tzgen: %d of %u zones from %s\n", from_tzdata, (unsigned)TZGEN_ZONE_COUNT, argv[1]);
+    return 0;
+}
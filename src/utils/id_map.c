@@ -0,0 +1,104 @@
+/**
+ * @file id_map.c
+ * @brief Open-Addressed Id Map
+ */
+
+#include "utils/id_map.h"
+#include "platform/platform.h"
+#include <string.h>
+
+#define ID_MAP_INITIAL_CAPACITY 64
+
+static const char* item_key(const regislex_id_map_t* map, const void* item) {
+    return (const char*)item + map->key_offset;
+}
+
+static void slot_insert(const regislex_id_map_t* map, void** slots, int capacity, void* item) {
+    uint32_t mask = (uint32_t)capacity - 1;
+    uint32_t i = regislex_id_hash(item_key(map, item)) & mask;
+    while (slots[i]) {
+        i = (i + 1) & mask;
+    }
+    slots[i] = item;
+}
+
+uint32_t regislex_id_hash(const char* key) {
+    uint32_t hash = 2166136261u;
+    for (const char* p = key; *p; p++) {
+        hash ^= (uint8_t)*p;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+void regislex_id_map_init(regislex_id_map_t* map, size_t key_offset) {
+    memset(map, 0, sizeof(*map));
+    map->key_offset = key_offset;
+}
+
+void regislex_id_map_free(regislex_id_map_t* map) {
+    platform_free(map->slots);
+    map->slots = NULL;
+    map->capacity = 0;
+    map->used = 0;
+}
+
+int regislex_id_map_find(const regislex_id_map_t* map, const char* key) {
+    if (map->capacity == 0) return -1;
+
+    uint32_t mask = (uint32_t)map->capacity - 1;
+    uint32_t i = regislex_id_hash(key) & mask;
+    while (map->slots[i]) {
+        if (strcmp(item_key(map, map->slots[i]), key) == 0) return (int)i;
+        i = (i + 1) & mask;
+    }
+    return -1;
+}
+
+void* regislex_id_map_get(const regislex_id_map_t* map, const char* key) {
+    int index = regislex_id_map_find(map, key);
+    return index >= 0 ? map->slots[index] : NULL;
+}
+
+regislex_error_t regislex_id_map_insert(regislex_id_map_t* map, void* item) {
+    if ((map->used + 1) * 2 > map->capacity) {
+        int new_capacity = map->capacity ? map->capacity * 2 : ID_MAP_INITIAL_CAPACITY;
+        void** grown = (void**)platform_calloc((size_t)new_capacity, sizeof(void*));
+        if (!grown) return REGISLEX_ERROR_OUT_OF_MEMORY;
+
+        for (int i = 0; i < map->capacity; i++) {
+            if (map->slots[i]) slot_insert(map, grown, new_capacity, map->slots[i]);
+        }
+        platform_free(map->slots);
+        map->slots = grown;
+        map->capacity = new_capacity;
+    }
+
+    slot_insert(map, map->slots, map->capacity, item);
+    map->used++;
+    return REGISLEX_OK;
+}
+
+void regislex_id_map_remove_at(regislex_id_map_t* map, int index) {
+    map->slots[index] = NULL;
+    map->used--;
+
+    /* Re-seat the rest of the probe run so lookups stay correct */
+    uint32_t mask = (uint32_t)map->capacity - 1;
+    uint32_t i = ((uint32_t)index + 1) & mask;
+    while (map->slots[i]) {
+        void* moved = map->slots[i];
+        map->slots[i] = NULL;
+        slot_insert(map, map->slots, map->capacity, moved);
+        i = (i + 1) & mask;
+    }
+}
+
+void* regislex_id_map_remove(regislex_id_map_t* map, const char* key) {
+    int index = regislex_id_map_find(map, key);
+    if (index < 0) return NULL;
+
+    void* item = map->slots[index];
+    regislex_id_map_remove_at(map, index);
+    return item;
+}
@@ -11,6 +11,13 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "regislex/regislex.h"
+#include "regislex/modules/case_management/case.h"
+#include "regislex/modules/deadline_management/deadline.h"
+#include "regislex/modules/workflow/workflow.h"
+#include "database/database.h"
+#include "platform/platform.h"
+
 /* ============================================================================
  * Test Framework
  * ========================================================================== */
@@ -531,6 +538,2963 @@ static void test_string_utils(void) {
     TEST_SUITE_END();
 }
 
+/* ============================================================================
+ * Conflict Index Tests
+ * ========================================================================== */
+
+/* Open a context on a fresh database under the test data directory */
+static regislex_context_t* test_context_open(const char* name) {
+    regislex_config_t config;
+    regislex_context_t* ctx = NULL;
+    char path[REGISLEX_MAX_PATH_LENGTH + 32];
+
+    regislex_config_default(&config);
+    snprintf(config.data_dir, sizeof(config.data_dir), "%s/%s", REGISLEX_TEST_DATA_DIR, name);
+    config.database.database[0] = '\0';
+
+    static const char* db_files[] = { "regislex.db", "regislex.db-wal", "regislex.db-shm" };
+    for (size_t i = 0; i < sizeof(db_files) / sizeof(db_files[0]); i++) {
+        snprintf(path, sizeof(path), "%s/%s", config.data_dir, db_files[i]);
+        remove(path);
+    }
+
+    return regislex_init(&config, &ctx) == REGISLEX_OK ? ctx : NULL;
+}
+
+static int64_t db_count(regislex_context_t* ctx, const char* sql) {
+    regislex_db_stmt_t* stmt = NULL;
+    int64_t n = -1;
+    if (regislex_db_prepare(regislex_get_db(ctx), sql, &stmt) != REGISLEX_OK) return -1;
+    if (regislex_db_step(stmt) == REGISLEX_OK) n = regislex_db_column_int(stmt, 0);
+    regislex_db_finalize(stmt);
+    return n;
+}
+
+/* Store a case row directly, for tests that only need it as a reference */
+static void case_store(regislex_context_t* ctx, regislex_uuid_t* id, const char* number) {
+    char sql[384];
+    regislex_uuid_generate(id);
+    snprintf(sql, sizeof(sql),
+             "INSERT INTO cases (id, case_number, title, type, status, priority, created_at, updated_at) "
+             "VALUES ('%s', '%s', 'Matter %s', 0, %d, %d, '2026-01-01T00:00:00Z', '2026-01-01T00:00:00Z')",
+             id->value, number, number, REGISLEX_STATUS_ACTIVE, REGISLEX_PRIORITY_NORMAL);
+    regislex_db_exec(regislex_get_db(ctx), sql);
+}
+
+static regislex_error_t party_append(regislex_context_t* ctx, const regislex_uuid_t* case_id,
+                                     const char* name) {
+    regislex_party_t party;
+    regislex_party_t* added = NULL;
+
+    memset(&party, 0, sizeof(party));
+    strcpy(party.name, name);
+    party.role = REGISLEX_PARTY_DEFENDANT;
+    regislex_error_t err = regislex_party_add(ctx, case_id, &party, &added);
+    regislex_party_free(added);
+    return err;
+}
+
+/* Best conflict score for a name, or 0 with no match */
+static double conflict_best(regislex_context_t* ctx, const char* name, bool* phonetic) {
+    regislex_conflict_match_t* matches = NULL;
+    int count = 0;
+    double best = 0.0;
+
+    if (regislex_conflict_check(ctx, name, 10, 0.3, &matches, &count) != REGISLEX_OK) return -1.0;
+    if (count > 0) {
+        best = matches[0].score;
+        if (phonetic) *phonetic = matches[0].phonetic_match;
+    }
+    regislex_conflict_matches_free(matches);
+    return best;
+}
+
+/* Best conflict match for a name; false with no match */
+static bool conflict_top(regislex_context_t* ctx, const char* name, regislex_conflict_match_t* top) {
+    regislex_conflict_match_t* matches = NULL;
+    int count = 0;
+
+    if (regislex_conflict_check(ctx, name, 10, 0.3, &matches, &count) != REGISLEX_OK) return false;
+    if (count > 0) *top = matches[0];
+    regislex_conflict_matches_free(matches);
+    return count > 0;
+}
+
+static void test_conflict_index(void) {
+    TEST_SUITE_BEGIN("Conflict Index");
+
+    regislex_context_t* ctx = test_context_open("conflict_index");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_uuid_t matter;
+    case_store(ctx, &matter, "2026-CV-0100");
+
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, party_append(ctx, &matter, "Acme Holdings, Inc."),
+                          "Add corporate party");
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, party_append(ctx, &matter, "John Smith"),
+                          "Add individual party");
+
+    TEST_ASSERT(conflict_best(ctx, "ACME HOLDINGS LLC", NULL) == 1.0,
+                "Normalized name matches exactly");
+    bool phonetic = false;
+    double score = conflict_best(ctx, "Jon Smyth", &phonetic);
+    TEST_ASSERT(score >= 0.5 && phonetic, "Sound-alike name found by phonetic key");
+    TEST_ASSERT(conflict_best(ctx, "Acme Holdings Group", NULL) < 1.0 &&
+                conflict_best(ctx, "Jon Smyth", NULL) == score, "Repeated check scores the same");
+    TEST_ASSERT(conflict_best(ctx, "Zephyr Logistics", NULL) == 0.0, "Unrelated name has no match");
+    TEST_ASSERT_EQUAL_INT(2, (int)db_count(ctx, "SELECT count(DISTINCT party_id) FROM party_conflict_keys"),
+                          "Match keys stored with each party");
+
+    /* A party's attorney and firm are indexed apart from its own name */
+    regislex_party_t represented;
+    regislex_party_t* added = NULL;
+    memset(&represented, 0, sizeof(represented));
+    strcpy(represented.name, "Northwind Traders");
+    strcpy(represented.attorney_name, "Margaret Thornton");
+    strcpy(represented.attorney_firm, "Baker & Pryce LLP");
+    represented.role = REGISLEX_PARTY_PLAINTIFF;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_party_add(ctx, &matter, &represented, &added),
+                          "Add represented party");
+    regislex_party_free(added);
+
+    regislex_conflict_match_t top;
+    TEST_ASSERT(conflict_top(ctx, "Northwind Traders", &top) &&
+                top.field == REGISLEX_CONFLICT_FIELD_NAME, "Party found by its name");
+    TEST_ASSERT(conflict_top(ctx, "Margaret Thornton", &top) &&
+                top.field == REGISLEX_CONFLICT_FIELD_ATTORNEY_NAME &&
+                strcmp(top.party_name, "Northwind Traders") == 0 &&
+                strcmp(top.matched_name, "Margaret Thornton") == 0, "Party found by its attorney");
+    TEST_ASSERT(conflict_top(ctx, "Baker & Pryce", &top) &&
+                top.field == REGISLEX_CONFLICT_FIELD_ATTORNEY_FIRM && top.score == 1.0,
+                "Party found by its attorney's firm");
+    TEST_ASSERT_EQUAL_INT(1, (int)db_count(ctx, "SELECT count(*) FROM party_conflict_keys "
+                                                "WHERE attorney_normalized = 'margaret thornton' "
+                                                "AND firm_normalized = 'baker pryce'"),
+                          "Attorney and firm keys stored");
+
+    /* A party added inside a rolled-back transaction leaves no trace */
+    regislex_db_transaction_t* tx = NULL;
+    regislex_db_begin(regislex_get_db(ctx), &tx);
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, party_append(ctx, &matter, "Zephyr Logistics"),
+                          "Add party inside a transaction");
+    TEST_ASSERT(conflict_best(ctx, "Zephyr Logistics", NULL) == 0.0,
+                "Index unchanged before commit");
+    regislex_db_rollback(tx);
+    TEST_ASSERT(conflict_best(ctx, "Zephyr Logistics", NULL) == 0.0,
+                "Rolled-back party not indexed");
+    TEST_ASSERT_EQUAL_INT(0, (int)db_count(ctx, "SELECT count(*) FROM parties WHERE name = 'Zephyr Logistics'"),
+                          "Rolled-back party not stored");
+
+    /* An unknown case fails the insert and nothing is indexed */
+    regislex_uuid_t missing;
+    memset(&missing, 0, sizeof(missing));
+    strcpy(missing.value, "00000000-0000-4000-8000-000000000000");
+    party_append(ctx, &missing, "Orphan Party");
+    TEST_ASSERT(conflict_best(ctx, "Orphan Party", NULL) == 0.0, "Failed insert not indexed");
+
+    /* A rebuild reproduces the incrementally maintained index */
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_conflict_index_rebuild(ctx), "Rebuild index");
+    TEST_ASSERT(conflict_best(ctx, "Acme Holdings", NULL) == 1.0, "Rebuilt index finds the party");
+    TEST_ASSERT(conflict_top(ctx, "Margaret Thornton", &top) &&
+                top.field == REGISLEX_CONFLICT_FIELD_ATTORNEY_NAME, "Rebuilt index finds the attorney");
+
+    /* Keys stored before the attorney and firm columns are filled in by a rebuild */
+    regislex_db_exec(regislex_get_db(ctx), "UPDATE party_conflict_keys SET firm_normalized = NULL");
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_conflict_index_rebuild(ctx), "Rebuild with missing keys");
+    TEST_ASSERT(conflict_top(ctx, "Baker & Pryce", &top) &&
+                top.field == REGISLEX_CONFLICT_FIELD_ATTORNEY_FIRM, "Firm indexed from the party row");
+    TEST_ASSERT_EQUAL_INT(0, (int)db_count(ctx, "SELECT count(*) FROM party_conflict_keys "
+                                                "WHERE firm_normalized IS NULL"),
+                          "Missing keys written back");
+
+    /* A deleted case's parties leave the index once the delete commits */
+    regislex_uuid_t closed;
+    case_store(ctx, &closed, "2026-CV-0200");
+    party_append(ctx, &closed, "Orion Freight");
+    TEST_ASSERT(conflict_best(ctx, "Orion Freight", NULL) == 1.0, "Party of the second case indexed");
+
+    tx = NULL;
+    regislex_db_begin(regislex_get_db(ctx), &tx);
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_case_delete(ctx, &closed), "Delete case inside a transaction");
+    TEST_ASSERT(conflict_best(ctx, "Orion Freight", NULL) == 1.0, "Party indexed until the delete commits");
+    regislex_db_rollback(tx);
+    TEST_ASSERT(conflict_best(ctx, "Orion Freight", NULL) == 1.0, "Rolled-back delete keeps the party");
+
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_case_delete(ctx, &closed), "Delete case");
+    TEST_ASSERT(conflict_best(ctx, "Orion Freight", NULL) == 0.0, "Deleted case's party not found");
+    TEST_ASSERT(conflict_best(ctx, "ACME HOLDINGS LLC", NULL) == 1.0, "Other cases' parties still found");
+
+    /* Removing most of the index compacts it; later parties are found at their new positions */
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_case_delete(ctx, &matter), "Delete first case");
+    TEST_ASSERT(conflict_best(ctx, "Margaret Thornton", NULL) == 0.0, "Deleted case's attorney not found");
+    regislex_uuid_t reopened;
+    case_store(ctx, &reopened, "2026-CV-0300");
+    party_append(ctx, &reopened, "Acme Holdings");
+    TEST_ASSERT(conflict_top(ctx, "Acme Holdings", &top) && top.score == 1.0 &&
+                strcmp(top.case_id.value, reopened.value) == 0, "Party added after compaction found");
+
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Case Detail Tests
+ * ========================================================================== */
+
+/* Store a user row for assignment references */
+static void user_store(regislex_context_t* ctx, regislex_uuid_t* id, const char* username) {
+    char sql[256];
+    regislex_uuid_generate(id);
+    snprintf(sql, sizeof(sql),
+             "INSERT INTO users (id, username, email, password_hash, created_at) "
+             "VALUES ('%s', '%s', '%s@example.com', 'x', '2026-01-01T00:00:00Z')",
+             id->value, username, username);
+    regislex_db_exec(regislex_get_db(ctx), sql);
+}
+
+static regislex_error_t deadline_book(regislex_context_t* ctx, const regislex_uuid_t* case_id,
+                                      const regislex_uuid_t* assigned_to_id,
+                                      const regislex_datetime_t* start, regislex_uuid_t* out_id) {
+    regislex_deadline_t data;
+    regislex_deadline_t* created = NULL;
+
+    memset(&data, 0, sizeof(data));
+    data.case_id = *case_id;
+    strcpy(data.title, "Hearing");
+    data.due_date = *start;
+    data.start_date = *start;
+    data.duration_minutes = 60;
+    data.assigned_to_id = *assigned_to_id;
+    regislex_error_t err = regislex_deadline_create(ctx, &data, &created);
+    if (err == REGISLEX_OK) {
+        *out_id = created->id;
+        regislex_deadline_free(created);
+    }
+    return err;
+}
+
+static void test_case_detail(void) {
+    TEST_SUITE_BEGIN("Case Detail Loader");
+
+    regislex_context_t* ctx = test_context_open("case_detail");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_uuid_t attorney;
+    user_store(ctx, &attorney, "attorney");
+    regislex_uuid_t matter, empty;
+    case_store(ctx, &matter, "2026-CV-0300");
+    case_store(ctx, &empty, "2026-CV-0301");
+
+    regislex_party_t party;
+    regislex_party_t* added = NULL;
+    party_append(ctx, &matter, "Alpha Supply LLC");
+    memset(&party, 0, sizeof(party));
+    strcpy(party.name, "Zenith Freight Corp");
+    party.role = REGISLEX_PARTY_PLAINTIFF;
+    party.is_primary = true;
+    regislex_party_add(ctx, &matter, &party, &added);
+    regislex_party_free(added);
+
+    regislex_datetime_t later = {2030, 6, 2, 9, 0, 0, 0};
+    regislex_datetime_t sooner = {2030, 5, 1, 9, 0, 0, 0};
+    regislex_uuid_t later_id, sooner_id;
+    deadline_book(ctx, &matter, &attorney, &later, &later_id);
+    deadline_book(ctx, &matter, &attorney, &sooner, &sooner_id);
+
+    char sql[512];
+    snprintf(sql, sizeof(sql),
+             "INSERT INTO tasks (id, case_id, title, created_at, updated_at) "
+             "VALUES ('task-1', '%s', 'Draft answer', '2026-01-01T00:00:00Z', '2026-01-01T00:00:00Z')",
+             matter.value);
+    regislex_db_exec(regislex_get_db(ctx), sql);
+    snprintf(sql, sizeof(sql),
+             "INSERT INTO documents (id, case_id, name, type, file_name, storage_path, created_at, updated_at) "
+             "VALUES ('doc-1', '%s', 'Complaint', 0, 'complaint.pdf', 'store/doc-1', "
+             "'2026-01-01T00:00:00Z', '2026-01-01T00:00:00Z')", matter.value);
+    regislex_db_exec(regislex_get_db(ctx), sql);
+
+    regislex_case_t* full = NULL;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_case_get_full(ctx, &matter, &full), "Load full case");
+    if (full) {
+        TEST_ASSERT_EQUAL_STR("Matter 2026-CV-0300", full->title, "Case row loaded");
+        TEST_ASSERT_EQUAL_INT(2, full->party_count, "Parties loaded");
+        TEST_ASSERT(full->party_count == 2 && strcmp(full->parties[0]->name, "Zenith Freight Corp") == 0,
+                    "Primary party first");
+        TEST_ASSERT_EQUAL_INT(2, full->deadline_count, "Deadlines loaded");
+        TEST_ASSERT(full->deadline_count == 2 &&
+                    strcmp(full->deadlines[0]->id.value, sooner_id.value) == 0 &&
+                    strcmp(full->deadlines[1]->id.value, later_id.value) == 0,
+                    "Deadlines in due order");
+        TEST_ASSERT(full->task_count == 1 && strcmp(full->tasks[0]->title, "Draft answer") == 0,
+                    "Task loaded");
+        TEST_ASSERT(full->document_count == 1 && strcmp(full->documents[0]->name, "Complaint") == 0,
+                    "Document summary loaded");
+        regislex_case_free(full);
+    }
+
+    full = NULL;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_case_get_full(ctx, &empty, &full), "Load bare case");
+    if (full) {
+        TEST_ASSERT(full->party_count == 0 && full->deadline_count == 0 &&
+                    full->task_count == 0 && full->document_count == 0,
+                    "Bare case has no related records");
+        regislex_case_free(full);
+    }
+
+    regislex_uuid_t missing;
+    memset(&missing, 0, sizeof(missing));
+    strcpy(missing.value, "00000000-0000-4000-8000-000000000000");
+    full = NULL;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_ERROR_NOT_FOUND, regislex_case_get_full(ctx, &missing, &full),
+                          "Unknown case not found");
+
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Case Hierarchy Tests
+ * ========================================================================== */
+
+static regislex_case_t* case_open(regislex_context_t* ctx, const char* number,
+                                  const regislex_uuid_t* assigned_to_id) {
+    regislex_case_t data;
+    regislex_case_t* created = NULL;
+
+    memset(&data, 0, sizeof(data));
+    strcpy(data.case_number, number);
+    snprintf(data.title, sizeof(data.title), "Matter %s", number);
+    data.status = REGISLEX_STATUS_ACTIVE;
+    data.priority = REGISLEX_PRIORITY_NORMAL;
+    if (assigned_to_id) data.assigned_to_id = *assigned_to_id;
+    return regislex_case_create(ctx, &data, &created) == REGISLEX_OK ? created : NULL;
+}
+
+static regislex_error_t case_reparent(regislex_context_t* ctx, regislex_case_t* child,
+                                      const regislex_case_t* parent) {
+    child->parent_case_id = parent->id;
+    return regislex_case_update(ctx, child);
+}
+
+/* Case numbers of a list joined by spaces */
+static const char* case_numbers(const regislex_case_list_t* list, char* out, size_t size) {
+    out[0] = '\0';
+    for (int i = 0; list && i < list->count; i++) {
+        if (i > 0) strncat(out, " ", size - strlen(out) - 1);
+        strncat(out, list->cases[i]->case_number, size - strlen(out) - 1);
+    }
+    return out;
+}
+
+static void test_case_hierarchy(void) {
+    TEST_SUITE_BEGIN("Case Hierarchy");
+
+    regislex_context_t* ctx = test_context_open("case_hierarchy");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_case_t* root = case_open(ctx, "H-1", NULL);
+    regislex_case_t* left = case_open(ctx, "H-2", NULL);
+    regislex_case_t* leaf = case_open(ctx, "H-3", NULL);
+    regislex_case_t* right = case_open(ctx, "H-4", NULL);
+    TEST_ASSERT(root && left && leaf && right, "Cases created");
+    if (!root || !left || !leaf || !right) {
+        regislex_case_free(root);
+        regislex_case_free(left);
+        regislex_case_free(leaf);
+        regislex_case_free(right);
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+
+    TEST_ASSERT(case_reparent(ctx, left, root) == REGISLEX_OK &&
+                case_reparent(ctx, leaf, left) == REGISLEX_OK &&
+                case_reparent(ctx, right, root) == REGISLEX_OK,
+                "Hierarchy linked");
+
+    char numbers[128];
+    regislex_case_list_t* list = NULL;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_case_subtree(ctx, &root->id, 0, &list), "Subtree listed");
+    TEST_ASSERT_EQUAL_STR("H-2 H-4 H-3", case_numbers(list, numbers, sizeof(numbers)),
+                          "Descendants by depth then number");
+    regislex_case_list_free(list);
+
+    list = NULL;
+    regislex_case_subtree(ctx, &root->id, 1, &list);
+    TEST_ASSERT_EQUAL_STR("H-2 H-4", case_numbers(list, numbers, sizeof(numbers)),
+                          "Depth limit stops at children");
+    regislex_case_list_free(list);
+
+    list = NULL;
+    regislex_case_ancestors(ctx, &leaf->id, &list);
+    TEST_ASSERT_EQUAL_STR("H-1 H-2", case_numbers(list, numbers, sizeof(numbers)),
+                          "Ancestors from the top down");
+    regislex_case_list_free(list);
+
+    regislex_uuid_t attorney, deadline_id;
+    user_store(ctx, &attorney, "attorney");
+    regislex_datetime_t due = {2030, 1, 7, 9, 0, 0, 0};
+    deadline_book(ctx, &leaf->id, &attorney, &due, &deadline_id);
+
+    regislex_case_subtree_stats_t stats;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_case_subtree_stats(ctx, &root->id, &stats),
+                          "Subtree stats computed");
+    TEST_ASSERT(stats.case_count == 4 && stats.max_depth == 2, "Stats count the whole tree");
+    TEST_ASSERT(stats.deadline_count == 1 && stats.open_deadline_count == 1,
+                "Stats include descendant deadlines");
+
+    /* Moving a case carries its subtree */
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, case_reparent(ctx, left, right), "Move a case with children");
+    list = NULL;
+    regislex_case_ancestors(ctx, &leaf->id, &list);
+    TEST_ASSERT_EQUAL_STR("H-1 H-4 H-2", case_numbers(list, numbers, sizeof(numbers)),
+                          "Grandchild follows the move");
+    regislex_case_list_free(list);
+
+    list = NULL;
+    regislex_case_subtree(ctx, &right->id, 0, &list);
+    TEST_ASSERT_EQUAL_STR("H-2 H-3", case_numbers(list, numbers, sizeof(numbers)),
+                          "New parent owns the moved subtree");
+    regislex_case_list_free(list);
+
+    TEST_ASSERT_EQUAL_INT(REGISLEX_ERROR_VALIDATION, case_reparent(ctx, root, leaf),
+                          "Cycle rejected");
+    list = NULL;
+    regislex_case_ancestors(ctx, &root->id, &list);
+    TEST_ASSERT(list && list->count == 0, "Rejected move leaves the root on top");
+    regislex_case_list_free(list);
+
+    regislex_case_free(root);
+    regislex_case_free(left);
+    regislex_case_free(leaf);
+    regislex_case_free(right);
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Caseload Tests
+ * ========================================================================== */
+
+static int caseload_of(regislex_context_t* ctx, const regislex_uuid_t* user_id) {
+    int count = -1;
+    regislex_caseload_assignee_count(ctx, user_id, &count);
+    return count;
+}
+
+static void test_caseload_counters(void) {
+    TEST_SUITE_BEGIN("Caseload Counters");
+
+    regislex_context_t* ctx = test_context_open("caseload_counters");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_uuid_t alice, bob;
+    user_store(ctx, &alice, "alice");
+    user_store(ctx, &bob, "bob");
+
+    regislex_case_t* first = case_open(ctx, "L-1", &alice);
+    regislex_case_t* second = case_open(ctx, "L-2", &alice);
+    regislex_case_t* third = case_open(ctx, "L-3", NULL);
+    TEST_ASSERT(first && second && third, "Cases created");
+    if (!first || !second || !third) {
+        regislex_case_free(first);
+        regislex_case_free(second);
+        regislex_case_free(third);
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_caseload_summary_t summary;
+    regislex_caseload_summary(ctx, &summary);
+    TEST_ASSERT(summary.total == 3 && summary.open == 3 && summary.unassigned == 1,
+                "Created cases counted");
+    TEST_ASSERT_EQUAL_INT(3, summary.by_status[REGISLEX_STATUS_ACTIVE], "Counted by status");
+    TEST_ASSERT_EQUAL_INT(2, caseload_of(ctx, &alice), "Counted by assignee");
+
+    second->status = REGISLEX_STATUS_COMPLETED;
+    second->assigned_to_id = bob;
+    regislex_case_update(ctx, second);
+    regislex_caseload_summary(ctx, &summary);
+    TEST_ASSERT(summary.open == 2 && summary.by_status[REGISLEX_STATUS_COMPLETED] == 1,
+                "Status change moves the counters");
+    TEST_ASSERT(caseload_of(ctx, &alice) == 1 && caseload_of(ctx, &bob) == 1,
+                "Assignee change moves the counters");
+
+    /* A rolled-back update leaves the counters alone */
+    regislex_db_transaction_t* tx = NULL;
+    regislex_db_begin(regislex_get_db(ctx), &tx);
+    first->assigned_to_id = bob;
+    regislex_case_update(ctx, first);
+    regislex_db_rollback(tx);
+    TEST_ASSERT(caseload_of(ctx, &alice) == 1 && caseload_of(ctx, &bob) == 1,
+                "Rolled-back update not counted");
+
+    regislex_case_delete(ctx, &third->id);
+    regislex_caseload_summary(ctx, &summary);
+    TEST_ASSERT(summary.total == 2 && summary.unassigned == 0, "Deleted case uncounted");
+
+    regislex_caseload_assignee_t* assignees = NULL;
+    int count = 0;
+    regislex_caseload_by_assignee(ctx, &assignees, &count);
+    TEST_ASSERT_EQUAL_INT(2, count, "One entry per assignee");
+    regislex_caseload_assignees_free(assignees);
+
+    /* The mirror agrees with the trigger-maintained table */
+    regislex_caseload_refresh(ctx);
+    regislex_caseload_summary_t reloaded;
+    regislex_caseload_summary(ctx, &reloaded);
+    TEST_ASSERT(memcmp(&summary, &reloaded, sizeof(summary)) == 0, "Refresh reproduces the mirror");
+
+    regislex_case_free(first);
+    regislex_case_free(second);
+    regislex_case_free(third);
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Streaming Cursor Tests
+ * ========================================================================== */
+
+static regislex_error_t deadline_due(regislex_context_t* ctx, const regislex_uuid_t* case_id,
+                                     int days_from_now, const char* rrule) {
+    regislex_deadline_t data;
+    regislex_deadline_t* created = NULL;
+
+    memset(&data, 0, sizeof(data));
+    data.case_id = *case_id;
+    strcpy(data.title, rrule ? "Status report" : "Filing");
+    regislex_datetime_now(&data.due_date);
+    regislex_datetime_add_days(&data.due_date, days_from_now);
+    if (rrule) strcpy(data.rrule, rrule);
+    regislex_error_t err = regislex_deadline_create(ctx, &data, &created);
+    regislex_deadline_free(created);
+    return err;
+}
+
+static bool case_count_visitor(const regislex_case_t* case_item, void* user_data) {
+    (void)case_item;
+    return ++*(int*)user_data < 7;
+}
+
+static void test_streaming_cursors(void) {
+    TEST_SUITE_BEGIN("Streaming Cursors");
+
+    regislex_context_t* ctx = test_context_open("streaming_cursors");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_uuid_t alice;
+    user_store(ctx, &alice, "alice");
+
+    char number[32];
+    regislex_case_t* anchor = NULL;
+    regislex_db_transaction_t* tx = NULL;
+    regislex_db_begin(regislex_get_db(ctx), &tx);
+    for (int i = 0; i < 150; i++) {
+        snprintf(number, sizeof(number), "S-%03d", i);
+        regislex_case_t* created = case_open(ctx, number, i % 3 == 0 ? &alice : NULL);
+        if (i == 0) anchor = created;
+        else regislex_case_free(created);
+    }
+    regislex_db_commit(tx);
+    TEST_ASSERT_NOT_NULL(anchor, "Cases created");
+    if (!anchor) {
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+
+    /* No default page size: every row streams through */
+    regislex_case_cursor_t* cursor = NULL;
+    const regislex_case_t* row = NULL;
+    int rows = 0;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_case_cursor_open(ctx, NULL, &cursor), "Open case cursor");
+    while (regislex_case_cursor_next(cursor, &row) == REGISLEX_OK) rows++;
+    regislex_case_cursor_close(cursor);
+    TEST_ASSERT_EQUAL_INT(150, rows, "Cursor streams past one page");
+
+    regislex_case_filter_t filter;
+    memset(&filter, 0, sizeof(filter));
+    filter.assigned_to_id = &alice;
+    rows = 0;
+    regislex_case_cursor_open(ctx, &filter, &cursor);
+    bool all_match = true;
+    while (regislex_case_cursor_next(cursor, &row) == REGISLEX_OK) {
+        all_match = all_match && strcmp(row->assigned_to_id.value, alice.value) == 0;
+        rows++;
+    }
+    regislex_case_cursor_close(cursor);
+    TEST_ASSERT(rows == 50 && all_match, "Filter applied to the stream");
+
+    memset(&filter, 0, sizeof(filter));
+    filter.offset = 145;
+    filter.limit = 10;
+    rows = 0;
+    regislex_case_cursor_open(ctx, &filter, &cursor);
+    while (regislex_case_cursor_next(cursor, &row) == REGISLEX_OK) rows++;
+    regislex_case_cursor_close(cursor);
+    TEST_ASSERT_EQUAL_INT(5, rows, "Limit and offset honoured");
+
+    int visited = 0;
+    regislex_case_foreach(ctx, NULL, case_count_visitor, &visited);
+    TEST_ASSERT_EQUAL_INT(7, visited, "Visitor stops early");
+
+    /* Upcoming deadlines merge one-offs with series occurrences by due date */
+    deadline_due(ctx, &anchor->id, 5, NULL);
+    deadline_due(ctx, &anchor->id, 2, NULL);
+    deadline_due(ctx, &anchor->id, 40, NULL);
+    deadline_due(ctx, &anchor->id, 1, "FREQ=WEEKLY;COUNT=3");
+
+    regislex_deadline_cursor_t* deadlines = NULL;
+    const regislex_deadline_t* deadline = NULL;
+    regislex_datetime_t previous = {0};
+    bool ordered = true;
+    int series = 0;
+    rows = 0;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_deadline_upcoming_cursor(ctx, 30, &deadlines),
+                          "Open upcoming cursor");
+    while (regislex_deadline_cursor_next(deadlines, &deadline) == REGISLEX_OK) {
+        if (rows > 0 && regislex_datetime_compare(&previous, &deadline->due_date) > 0) ordered = false;
+        if (deadline->rrule[0] != '\0') series++;
+        previous = deadline->due_date;
+        rows++;
+    }
+    regislex_deadline_cursor_close(deadlines);
+    TEST_ASSERT_EQUAL_INT(5, rows, "Window holds two filings and three occurrences");
+    TEST_ASSERT_EQUAL_INT(3, series, "Series expanded inside the window");
+    TEST_ASSERT(ordered, "Rows in due-date order");
+
+    regislex_case_free(anchor);
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Typed Metadata Tests
+ * ========================================================================== */
+
+/* Numbers of the cases matching metadata filters, joined by spaces */
+static const char* cases_matching(regislex_context_t* ctx, const regislex_metadata_filter_t* filters,
+                                  int count, char* out, size_t size) {
+    regislex_case_filter_t filter;
+    regislex_case_list_t* list = NULL;
+
+    memset(&filter, 0, sizeof(filter));
+    filter.metadata = filters;
+    filter.metadata_count = count;
+    filter.order_by = "case_number";
+    out[0] = '\0';
+    if (regislex_case_list(ctx, &filter, &list) != REGISLEX_OK) return "error";
+    case_numbers(list, out, size);
+    regislex_case_list_free(list);
+    return out;
+}
+
+static void test_typed_metadata(void) {
+    TEST_SUITE_BEGIN("Typed Metadata");
+
+    regislex_context_t* ctx = test_context_open("typed_metadata");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_case_t* small = case_open(ctx, "M-1", NULL);
+    regislex_case_t* medium = case_open(ctx, "M-2", NULL);
+    regislex_case_t* large = case_open(ctx, "M-3", NULL);
+    TEST_ASSERT(small && medium && large, "Cases created");
+    if (!small || !medium || !large) {
+        regislex_case_free(small);
+        regislex_case_free(medium);
+        regislex_case_free(large);
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_case_metadata_set(ctx, &small->id, "claim_value", REGISLEX_METADATA_INTEGER, "500");
+    regislex_case_metadata_set(ctx, &medium->id, "claim_value", REGISLEX_METADATA_INTEGER, "1500");
+    regislex_case_metadata_set(ctx, &large->id, "claim_value", REGISLEX_METADATA_INTEGER, "25000");
+    regislex_case_metadata_set(ctx, &small->id, "incident", REGISLEX_METADATA_DATE, "2025-11-03");
+    regislex_case_metadata_set(ctx, &large->id, "incident", REGISLEX_METADATA_DATE, "2026-02-14");
+    regislex_case_metadata_set(ctx, &medium->id, "venue", REGISLEX_METADATA_TEXT, "Travis County");
+
+    char numbers[128];
+    regislex_metadata_filter_t filters[2];
+    memset(filters, 0, sizeof(filters));
+    filters[0] = (regislex_metadata_filter_t){ "claim_value", REGISLEX_METADATA_OP_GT,
+                                               REGISLEX_METADATA_INTEGER, "1000" };
+    TEST_ASSERT_EQUAL_STR("M-2 M-3", cases_matching(ctx, filters, 1, numbers, sizeof(numbers)),
+                          "Integers compare numerically");
+
+    filters[1] = (regislex_metadata_filter_t){ "incident", REGISLEX_METADATA_OP_GE,
+                                               REGISLEX_METADATA_DATE, "2026-01-01" };
+    TEST_ASSERT_EQUAL_STR("M-3", cases_matching(ctx, filters, 2, numbers, sizeof(numbers)),
+                          "Filters combine with AND");
+
+    filters[0] = (regislex_metadata_filter_t){ "venue", REGISLEX_METADATA_OP_EXISTS,
+                                               REGISLEX_METADATA_TEXT, NULL };
+    TEST_ASSERT_EQUAL_STR("M-2", cases_matching(ctx, filters, 1, numbers, sizeof(numbers)),
+                          "Existence filter");
+
+    TEST_ASSERT_EQUAL_INT(REGISLEX_ERROR_VALIDATION,
+                          regislex_case_metadata_set(ctx, &small->id, "claim_value",
+                                                     REGISLEX_METADATA_INTEGER, "lots"),
+                          "Unconvertible value rejected");
+
+    regislex_case_metadata_set(ctx, &small->id, "claim_value", REGISLEX_METADATA_INTEGER, "2000");
+    filters[0] = (regislex_metadata_filter_t){ "claim_value", REGISLEX_METADATA_OP_GT,
+                                               REGISLEX_METADATA_INTEGER, "1000" };
+    TEST_ASSERT_EQUAL_STR("M-1 M-2 M-3", cases_matching(ctx, filters, 1, numbers, sizeof(numbers)),
+                          "Setting a key replaces its value");
+
+    regislex_metadata_t* metadata = NULL;
+    int count = 0;
+    regislex_case_metadata_get(ctx, &small->id, &metadata, &count);
+    TEST_ASSERT_EQUAL_INT(2, count, "One entry per key");
+    regislex_metadata_free(metadata, count);
+
+    regislex_case_metadata_delete(ctx, &small->id, "claim_value");
+    TEST_ASSERT_EQUAL_STR("M-2 M-3", cases_matching(ctx, filters, 1, numbers, sizeof(numbers)),
+                          "Deleted key no longer matches");
+
+    /* Deadlines filter the same way */
+    deadline_due(ctx, &small->id, 3, NULL);
+    deadline_due(ctx, &small->id, 4, NULL);
+    regislex_deadline_list_t* deadlines = NULL;
+    regislex_deadline_filter_t deadline_filter;
+    memset(&deadline_filter, 0, sizeof(deadline_filter));
+    deadline_filter.case_id = &small->id;
+    regislex_deadline_list(ctx, &deadline_filter, &deadlines);
+    if (deadlines && deadlines->count == 2) {
+        regislex_deadline_metadata_set(ctx, &deadlines->deadlines[1]->id, "court_rule",
+                                       REGISLEX_METADATA_TEXT, "FRCP 12(a)");
+    }
+    regislex_deadline_list_free(deadlines);
+
+    filters[0] = (regislex_metadata_filter_t){ "court_rule", REGISLEX_METADATA_OP_EQ,
+                                               REGISLEX_METADATA_TEXT, "FRCP 12(a)" };
+    deadline_filter.metadata = filters;
+    deadline_filter.metadata_count = 1;
+    deadlines = NULL;
+    regislex_deadline_list(ctx, &deadline_filter, &deadlines);
+    TEST_ASSERT(deadlines && deadlines->count == 1, "Deadline metadata filter");
+    regislex_deadline_list_free(deadlines);
+
+    regislex_case_free(small);
+    regislex_case_free(medium);
+    regislex_case_free(large);
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Bulk Reassignment Tests
+ * ========================================================================== */
+
+static int agenda_size(regislex_context_t* ctx, const regislex_uuid_t* user_id) {
+    regislex_agenda_item_t items[16];
+    int count = -1;
+    regislex_agenda_next(ctx, user_id, NULL, items, 16, &count);
+    return count;
+}
+
+static void hours_from_now(int hours, regislex_datetime_t* out) {
+    regislex_datetime_t now;
+    regislex_datetime_now(&now);
+    regislex_datetime_from_seconds(regislex_datetime_to_seconds(&now) + (int64_t)hours * 3600, out);
+}
+
+static int booked_at(regislex_context_t* ctx, const regislex_uuid_t* user_id,
+                     const regislex_datetime_t* start) {
+    regislex_schedule_slot_t* slots = NULL;
+    int count = -1;
+    if (regislex_schedule_conflicts(ctx, user_id, start, 30, NULL, &slots, &count) != REGISLEX_OK) {
+        return -1;
+    }
+    regislex_schedule_slots_free(slots);
+    return count;
+}
+
+/* Progress callback that closes one still-unmoved case after the first batch */
+typedef struct {
+    regislex_context_t* ctx;
+    const regislex_uuid_t* departing;
+    regislex_case_t** cases;
+    int count;
+    bool closed;
+} reassign_race_t;
+
+static bool close_one_case(int done, int total, void* user_data) {
+    reassign_race_t* race = (reassign_race_t*)user_data;
+    (void)done;
+    (void)total;
+    for (int i = 0; i < race->count && !race->closed; i++) {
+        regislex_case_t* stored = NULL;
+        if (regislex_case_get(race->ctx, &race->cases[i]->id, &stored) != REGISLEX_OK) continue;
+        if (strcmp(stored->assigned_to_id.value, race->departing->value) == 0) {
+            stored->status = REGISLEX_STATUS_CLOSED;
+            race->closed = regislex_case_update(race->ctx, stored) == REGISLEX_OK;
+        }
+        regislex_case_free(stored);
+    }
+    return true;
+}
+
+static void test_bulk_reassign(void) {
+    TEST_SUITE_BEGIN("Bulk Reassignment");
+
+    regislex_context_t* ctx = test_context_open("bulk_reassign");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_uuid_t departing, first, second;
+    user_store(ctx, &departing, "departing");
+    user_store(ctx, &first, "first");
+    user_store(ctx, &second, "second");
+
+    regislex_case_t* cases[5] = {0};
+    char number[32];
+    for (int i = 0; i < 5; i++) {
+        snprintf(number, sizeof(number), "2026-CV-02%02d", i);
+        cases[i] = case_open(ctx, number, &departing);
+    }
+    TEST_ASSERT(cases[0] && cases[4], "Cases created");
+    if (!cases[0] || !cases[4]) {
+        for (int i = 0; i < 5; i++) regislex_case_free(cases[i]);
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_datetime_t hearing = {2030, 3, 4, 10, 0, 0, 0};
+    regislex_datetime_t motion = {2030, 3, 5, 14, 0, 0, 0};
+    regislex_uuid_t hearing_id, motion_id;
+    TEST_ASSERT(deadline_book(ctx, &cases[0]->id, &departing, &hearing, &hearing_id) == REGISLEX_OK &&
+                deadline_book(ctx, &cases[1]->id, &departing, &motion, &motion_id) == REGISLEX_OK,
+                "Deadlines booked");
+    TEST_ASSERT_EQUAL_INT(5, caseload_of(ctx, &departing), "Departing user holds every case");
+    TEST_ASSERT_EQUAL_INT(1, booked_at(ctx, &departing, &hearing), "Hearing on departing schedule");
+
+    regislex_reassign_target_t targets[2];
+    memset(targets, 0, sizeof(targets));
+    targets[0].user_id = first;
+    targets[1].user_id = second;
+    regislex_reassign_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.batch_size = 2;
+    options.follow_case = true;
+    regislex_reassign_result_t result;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK,
+                          regislex_reassign_open_work(ctx, &departing, targets, 2, &options, &result),
+                          "Reassign open work");
+    TEST_ASSERT(result.cases == 5 && result.deadlines == 2 && !result.stopped, "Every item moved");
+
+    TEST_ASSERT_EQUAL_INT(0, caseload_of(ctx, &departing), "Departing caseload emptied");
+    TEST_ASSERT_EQUAL_INT(3, caseload_of(ctx, &first), "Round robin gives the first user three");
+    TEST_ASSERT_EQUAL_INT(2, caseload_of(ctx, &second), "Round robin gives the second user two");
+
+    /* Deadlines follow their case: case 0 went first, case 1 second */
+    TEST_ASSERT_EQUAL_INT(0, booked_at(ctx, &departing, &hearing), "Departing schedule cleared");
+    TEST_ASSERT_EQUAL_INT(1, booked_at(ctx, &first, &hearing), "Hearing follows its case");
+    TEST_ASSERT_EQUAL_INT(1, booked_at(ctx, &second, &motion), "Motion follows its case");
+    TEST_ASSERT_EQUAL_INT(0, agenda_size(ctx, &departing), "Departing agenda emptied");
+    TEST_ASSERT_EQUAL_INT(1, agenda_size(ctx, &first), "Hearing on the new agenda");
+
+    /* The counters moved in memory agree with the trigger-maintained table */
+    regislex_caseload_refresh(ctx);
+    TEST_ASSERT(caseload_of(ctx, &first) == 3 && caseload_of(ctx, &second) == 2,
+                "Counters match the table");
+
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK,
+                          regislex_reassign_open_work(ctx, &departing, targets, 2, &options, &result),
+                          "Reassign with nothing left");
+    TEST_ASSERT_EQUAL_INT(0, result.cases + result.tasks + result.deadlines + result.reminders,
+                          "Nothing moved twice");
+
+    /* A case closed between collection and its batch stays where it is */
+    regislex_case_t* late[3] = {0};
+    for (int i = 0; i < 3; i++) {
+        snprintf(number, sizeof(number), "2026-CV-03%02d", i);
+        late[i] = case_open(ctx, number, &departing);
+    }
+    reassign_race_t race = {ctx, &departing, late, 3, false};
+    options.batch_size = 1;
+    options.progress = close_one_case;
+    options.user_data = &race;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK,
+                          regislex_reassign_open_work(ctx, &departing, targets, 2, &options, &result),
+                          "Reassign while a case closes");
+    TEST_ASSERT(race.closed && result.cases == 2, "Closed case not counted");
+    TEST_ASSERT_EQUAL_INT(1, caseload_of(ctx, &departing), "Closed case keeps its assignee");
+    int first_count = caseload_of(ctx, &first);
+    int second_count = caseload_of(ctx, &second);
+    regislex_caseload_refresh(ctx);
+    TEST_ASSERT(caseload_of(ctx, &departing) == 1 && caseload_of(ctx, &first) == first_count &&
+                caseload_of(ctx, &second) == second_count,
+                "Counters still match the table");
+
+    for (int i = 0; i < 3; i++) regislex_case_free(late[i]);
+    for (int i = 0; i < 5; i++) regislex_case_free(cases[i]);
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Court Day Tests
+ * ========================================================================== */
+
+static bool date_is(const regislex_datetime_t* dt, int year, int month, int day) {
+    return dt->year == year && dt->month == month && dt->day == day;
+}
+
+static void test_court_days(void) {
+    TEST_SUITE_BEGIN("Court Day Calculations");
+
+    regislex_datetime_t dt = {2026, 1, 9, 9, 0, 0, 0};     /* Friday */
+    regislex_datetime_add_business_days(&dt, 1);
+    TEST_ASSERT(date_is(&dt, 2026, 1, 12), "Weekday after Friday is Monday");
+    regislex_datetime_add_business_days(&dt, -1);
+    TEST_ASSERT(date_is(&dt, 2026, 1, 9), "Weekday before Monday is Friday");
+
+    dt = (regislex_datetime_t){2028, 2, 25, 9, 0, 0, 0};    /* Friday, leap year */
+    regislex_datetime_add_business_days(&dt, 2);
+    TEST_ASSERT(date_is(&dt, 2028, 2, 29), "Leap day counted");
+
+    regislex_context_t* ctx = test_context_open("court_days");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_holiday_t holiday;
+    memset(&holiday, 0, sizeof(holiday));
+    strcpy(holiday.name, "Independence Day (observed)");
+    strcpy(holiday.jurisdiction, "TEST");
+    holiday.date = (regislex_datetime_t){2026, 7, 3, 0, 0, 0, 0};
+    holiday.is_court_holiday = true;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_holiday_add(ctx, &holiday, NULL), "Add fixed holiday");
+
+    strcpy(holiday.name, "Thanksgiving");
+    memset(&holiday.date, 0, sizeof(holiday.date));
+    holiday.is_recurring = true;
+    holiday.recurrence_month = 11;
+    holiday.recurrence_week = 4;
+    holiday.recurrence_weekday = 4;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_holiday_add(ctx, &holiday, NULL), "Add floating holiday");
+
+    regislex_datetime_t start = {2026, 7, 2, 17, 0, 0, 0};  /* Thursday */
+    regislex_court_days_add(ctx, "TEST", &start, 1, &dt);
+    TEST_ASSERT(date_is(&dt, 2026, 7, 6), "Court holiday skipped");
+    TEST_ASSERT_EQUAL_INT(17, dt.hour, "Time of day preserved");
+    regislex_court_days_add(ctx, "OTHER", &start, 1, &dt);
+    TEST_ASSERT(date_is(&dt, 2026, 7, 3), "Holiday limited to its jurisdiction");
+
+    regislex_datetime_t end = {2026, 7, 9, 0, 0, 0, 0};
+    int count = 0;
+    regislex_court_days_between(ctx, "TEST", &start, &end, &count);
+    TEST_ASSERT_EQUAL_INT(4, count, "Court days between excludes holiday and weekend");
+    regislex_court_days_between(ctx, "TEST", &end, &start, &count);
+    TEST_ASSERT_EQUAL_INT(-4, count, "Reversed range counts negative");
+
+    start = (regislex_datetime_t){2027, 11, 24, 9, 0, 0, 0};
+    regislex_court_days_add(ctx, "TEST", &start, 1, &dt);
+    TEST_ASSERT(date_is(&dt, 2027, 11, 26), "Floating holiday recurs in later years");
+
+    start = (regislex_datetime_t){2026, 12, 30, 0, 0, 0, 0};
+    end = (regislex_datetime_t){2027, 1, 5, 0, 0, 0, 0};
+    regislex_court_days_between(ctx, "TEST", &start, &end, &count);
+    TEST_ASSERT_EQUAL_INT(4, count, "Count spans the year boundary");
+    regislex_court_days_add(ctx, "TEST", &start, 250, &dt);
+    regislex_court_days_between(ctx, "TEST", &start, &dt, &count);
+    TEST_ASSERT_EQUAL_INT(250, count, "Add and between agree");
+
+    start = (regislex_datetime_t){2026, 7, 2, 0, 0, 0, 0};
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_deadline_calculate(ctx, &start, 3, true, "TEST", &dt),
+                          "Calculate business-day deadline");
+    TEST_ASSERT(date_is(&dt, 2026, 7, 8), "Deadline counts court days");
+    regislex_deadline_calculate(ctx, &start, 3, false, "TEST", &dt);
+    TEST_ASSERT(date_is(&dt, 2026, 7, 5), "Calendar-day deadline counts every day");
+
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Court Rule Tests
+ * ========================================================================== */
+
+static regislex_court_rule_t court_rule(const char* code, const char* trigger_event,
+                                        const char* depends_on, int days, bool business) {
+    regislex_court_rule_t rule;
+    memset(&rule, 0, sizeof(rule));
+    strcpy(rule.code, code);
+    snprintf(rule.title, sizeof(rule.title), "%s due", code);
+    if (trigger_event) strcpy(rule.trigger_event, trigger_event);
+    if (depends_on) strcpy(rule.depends_on, depends_on);
+    rule.days = days;
+    rule.count_business_days = business;
+    rule.roll_forward = true;
+    rule.deadline_type = REGISLEX_DEADLINE_COURT_DATE;
+    return rule;
+}
+
+/* Due date of the case's deadline generated by a rule code */
+static bool rule_due(regislex_context_t* ctx, const regislex_uuid_t* case_id, const char* code,
+                     regislex_datetime_t* out) {
+    regislex_deadline_filter_t filter;
+    regislex_deadline_list_t* list = NULL;
+    char title[REGISLEX_MAX_NAME_LENGTH];
+    bool found = false;
+
+    snprintf(title, sizeof(title), "%s due", code);
+    memset(&filter, 0, sizeof(filter));
+    filter.case_id = (regislex_uuid_t*)case_id;
+    filter.include_completed = true;
+    if (regislex_deadline_list(ctx, &filter, &list) != REGISLEX_OK) return false;
+    for (int i = 0; i < list->count && !found; i++) {
+        if (strcmp(list->deadlines[i]->title, title) == 0) {
+            *out = list->deadlines[i]->due_date;
+            found = true;
+        }
+    }
+    regislex_deadline_list_free(list);
+    return found;
+}
+
+static bool rule_due_is(regislex_context_t* ctx, const regislex_uuid_t* case_id, const char* code,
+                        int year, int month, int day) {
+    regislex_datetime_t due;
+    return rule_due(ctx, case_id, code, &due) && date_is(&due, year, month, day);
+}
+
+static void test_court_rule_chains(void) {
+    TEST_SUITE_BEGIN("Court Rule Chains");
+
+    regislex_context_t* ctx = test_context_open("court_rule_chains");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_case_t* matter = case_open(ctx, "R-1", NULL);
+    regislex_case_t* weekend = case_open(ctx, "R-2", NULL);
+
+    regislex_court_rule_set_t set;
+    memset(&set, 0, sizeof(set));
+    strcpy(set.name, "Test civil rules");
+    strcpy(set.jurisdiction, "TEST");
+
+    regislex_court_rule_t cyclic[2] = {
+        court_rule("A", NULL, "B", 3, false),
+        court_rule("B", NULL, "A", 3, false)
+    };
+    regislex_court_rule_set_t* created = NULL;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_ERROR_VALIDATION,
+                          regislex_court_rule_set_create(ctx, &set, cyclic, 2, &created),
+                          "Circular dependency rejected");
+    regislex_court_rule_t dangling = court_rule("A", NULL, "MISSING", 3, false);
+    TEST_ASSERT_EQUAL_INT(REGISLEX_ERROR_VALIDATION,
+                          regislex_court_rule_set_create(ctx, &set, &dangling, 1, &created),
+                          "Unknown dependency rejected");
+
+    /* Listed out of order: the graph, not the array, decides the order */
+    regislex_court_rule_t rules[3] = {
+        court_rule("MSJ", NULL, "REPLY", 5, true),
+        court_rule("ANSWER", "service", NULL, 21, false),
+        court_rule("REPLY", NULL, "ANSWER", 14, false)
+    };
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_court_rule_set_create(ctx, &set, rules, 3, &created),
+                          "Rule set created");
+    if (!created || !matter || !weekend) {
+        regislex_court_rule_set_free(created);
+        regislex_case_free(matter);
+        regislex_case_free(weekend);
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_court_trigger_result_t result;
+    regislex_datetime_t served = {2026, 6, 1, 0, 0, 0, 0};     /* Monday */
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK,
+                          regislex_court_trigger_record(ctx, &matter->id, &created->id, "service",
+                                                        &served, &result),
+                          "Trigger recorded");
+    TEST_ASSERT_EQUAL_INT(3, result.created, "Whole chain generated");
+    TEST_ASSERT(rule_due_is(ctx, &matter->id, "ANSWER", 2026, 6, 22), "Answer 21 days after service");
+    TEST_ASSERT(rule_due_is(ctx, &matter->id, "REPLY", 2026, 7, 6), "Reply 14 days after answer");
+    TEST_ASSERT(rule_due_is(ctx, &matter->id, "MSJ", 2026, 7, 13), "Motion 5 court days after reply");
+
+    /* Moving the trigger recomputes the chain; a completed deadline keeps its date */
+    regislex_deadline_filter_t filter;
+    regislex_deadline_list_t* list = NULL;
+    memset(&filter, 0, sizeof(filter));
+    filter.case_id = &matter->id;
+    regislex_deadline_list(ctx, &filter, &list);
+    for (int i = 0; list && i < list->count; i++) {
+        if (strcmp(list->deadlines[i]->title, "ANSWER due") == 0) {
+            regislex_deadline_complete(ctx, &list->deadlines[i]->id, "Filed");
+        }
+    }
+    regislex_deadline_list_free(list);
+
+    served.day = 2;
+    regislex_court_trigger_record(ctx, &matter->id, &created->id, "service", &served, &result);
+    TEST_ASSERT(result.created == 0 && result.updated == 2 && result.unchanged == 1,
+                "Moved trigger updates the open deadlines");
+    TEST_ASSERT(rule_due_is(ctx, &matter->id, "ANSWER", 2026, 6, 22), "Completed deadline kept");
+    TEST_ASSERT(rule_due_is(ctx, &matter->id, "REPLY", 2026, 7, 7), "Dependent deadline moved");
+    TEST_ASSERT(rule_due_is(ctx, &matter->id, "MSJ", 2026, 7, 14), "Chain follows the move");
+
+    regislex_court_trigger_record(ctx, &matter->id, &created->id, "service", &served, &result);
+    TEST_ASSERT(result.created == 0 && result.updated == 0 && result.unchanged == 3,
+                "Recording the same date changes nothing");
+
+    /* A Saturday due date rolls forward to Monday */
+    regislex_datetime_t saturday_service = {2026, 6, 13, 0, 0, 0, 0};
+    regislex_court_trigger_record(ctx, &weekend->id, &created->id, "service", &saturday_service, &result);
+    TEST_ASSERT(rule_due_is(ctx, &weekend->id, "ANSWER", 2026, 7, 6), "Weekend due date rolls forward");
+
+    regislex_court_rule_set_free(created);
+    regislex_case_free(matter);
+    regislex_case_free(weekend);
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Reminder Dispatch Tests
+ * ========================================================================== */
+
+typedef struct {
+    platform_mutex_t* mutex;
+    char delivered[8][8];       /* Messages in delivery order */
+    int count;
+    int refusals;               /* Deliveries of "flaky" refused so far */
+} reminder_inbox_t;
+
+static regislex_error_t reminder_deliver(regislex_context_t* ctx, const regislex_reminder_t* reminder,
+                                         void* user_data) {
+    reminder_inbox_t* inbox = (reminder_inbox_t*)user_data;
+    regislex_error_t err = REGISLEX_OK;
+    (void)ctx;
+
+    platform_mutex_lock(inbox->mutex);
+    if (strcmp(reminder->message, "flaky") == 0 && inbox->refusals == 0) {
+        inbox->refusals++;
+        err = REGISLEX_ERROR_IO;
+    } else if (inbox->count < 8) {
+        strncpy(inbox->delivered[inbox->count++], reminder->message, 7);
+    }
+    platform_mutex_unlock(inbox->mutex);
+    return err;
+}
+
+static regislex_error_t reminder_at(regislex_context_t* ctx, const regislex_uuid_t* deadline_id,
+                                    const regislex_uuid_t* user_id, int seconds_from_now,
+                                    const char* message, regislex_uuid_t* out_id) {
+    regislex_reminder_t data;
+    regislex_reminder_t* created = NULL;
+    regislex_datetime_t now;
+
+    memset(&data, 0, sizeof(data));
+    data.user_id = *user_id;
+    regislex_datetime_now(&now);
+    regislex_datetime_from_seconds(regislex_datetime_to_seconds(&now) + seconds_from_now, &data.send_at);
+    strcpy(data.message, message);
+    data.is_active = true;
+    regislex_error_t err = regislex_reminder_add(ctx, deadline_id, &data, &created);
+    if (err == REGISLEX_OK && out_id) *out_id = created->id;
+    regislex_reminder_free(created);
+    return err;
+}
+
+static int inbox_count(reminder_inbox_t* inbox) {
+    platform_mutex_lock(inbox->mutex);
+    int count = inbox->count;
+    platform_mutex_unlock(inbox->mutex);
+    return count;
+}
+
+static bool inbox_has(reminder_inbox_t* inbox, const char* message) {
+    bool found = false;
+    platform_mutex_lock(inbox->mutex);
+    for (int i = 0; i < inbox->count; i++) {
+        if (strcmp(inbox->delivered[i], message) == 0) found = true;
+    }
+    platform_mutex_unlock(inbox->mutex);
+    return found;
+}
+
+static void test_reminder_dispatch(void) {
+    TEST_SUITE_BEGIN("Reminder Dispatch");
+
+    regislex_context_t* ctx = test_context_open("reminder_dispatch");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    reminder_inbox_t inbox;
+    memset(&inbox, 0, sizeof(inbox));
+    platform_mutex_create(&inbox.mutex);
+
+    regislex_uuid_t paralegal;
+    user_store(ctx, &paralegal, "paralegal");
+    regislex_case_t* matter = case_open(ctx, "D-1", NULL);
+    regislex_deadline_list_t* list = NULL;
+    regislex_deadline_filter_t filter;
+    regislex_uuid_t deadline_id, removed_id;
+    memset(&deadline_id, 0, sizeof(deadline_id));
+    if (matter) {
+        deadline_due(ctx, &matter->id, 1, NULL);
+        memset(&filter, 0, sizeof(filter));
+        filter.case_id = &matter->id;
+        regislex_deadline_list(ctx, &filter, &list);
+        if (list && list->count == 1) deadline_id = list->deadlines[0]->id;
+        regislex_deadline_list_free(list);
+    }
+    TEST_ASSERT(deadline_id.value[0] != '\0', "Deadline created");
+
+    reminder_at(ctx, &deadline_id, &paralegal, -60, "overdue", NULL);
+    reminder_at(ctx, &deadline_id, &paralegal, 1, "soon", NULL);
+    reminder_at(ctx, &deadline_id, &paralegal, 1, "flaky", NULL);
+    reminder_at(ctx, &deadline_id, &paralegal, 1, "removed", &removed_id);
+    reminder_at(ctx, &deadline_id, &paralegal, 86400, "later", NULL);
+
+    regislex_reminder_dispatcher_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.retry_seconds = 1;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK,
+                          regislex_reminder_dispatcher_start(ctx, reminder_deliver, &inbox, &options),
+                          "Dispatcher started");
+
+    regislex_reminder_remove(ctx, &removed_id);
+    reminder_at(ctx, &deadline_id, &paralegal, 2, "added", NULL);
+
+    for (int i = 0; i < 100 && inbox_count(&inbox) < 4; i++) platform_sleep_ms(50);
+    platform_sleep_ms(300);
+
+    TEST_ASSERT(inbox_count(&inbox) > 0 && strcmp(inbox.delivered[0], "overdue") == 0,
+                "Overdue reminder delivered first");
+    TEST_ASSERT(inbox_has(&inbox, "soon"), "Reminder delivered when due");
+    TEST_ASSERT(inbox_has(&inbox, "added"), "Reminder added while running delivered");
+    TEST_ASSERT(inbox.refusals == 1 && inbox_has(&inbox, "flaky"), "Refused delivery retried");
+    TEST_ASSERT(!inbox_has(&inbox, "removed"), "Removed reminder not delivered");
+    TEST_ASSERT(!inbox_has(&inbox, "later"), "Reminder beyond the horizon waits");
+    TEST_ASSERT_EQUAL_INT(4, inbox_count(&inbox), "Each reminder delivered once");
+
+    regislex_reminder_dispatcher_stop();
+    TEST_ASSERT_EQUAL_INT(4, (int)db_count(ctx, "SELECT count(*) FROM reminders WHERE is_sent = 1"),
+                          "Delivered reminders marked sent");
+
+    platform_mutex_destroy(inbox.mutex);
+    regislex_case_free(matter);
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Statute of Limitations Tests
+ * ========================================================================== */
+
+static regislex_statute_rule_t statute_rule(const char* claim_type, const char* jurisdiction,
+                                            int months, regislex_accrual_rule_t accrual) {
+    regislex_statute_rule_t rule;
+    memset(&rule, 0, sizeof(rule));
+    snprintf(rule.name, sizeof(rule.name), "%s (%s)", claim_type, jurisdiction);
+    strcpy(rule.claim_type, claim_type);
+    strcpy(rule.jurisdiction, jurisdiction);
+    rule.limitation_months = months;
+    rule.accrual = accrual;
+    rule.is_active = true;
+    return rule;
+}
+
+static regislex_error_t statute_store(regislex_context_t* ctx, const regislex_statute_rule_t* rule) {
+    regislex_statute_rule_t* created = NULL;
+    regislex_error_t err = regislex_statute_rule_create(ctx, rule, &created);
+    regislex_statute_rule_free(created);
+    return err;
+}
+
+static bool statute_expires(regislex_context_t* ctx, regislex_statute_claim_t* claim,
+                            int year, int month, int day) {
+    regislex_datetime_t expiration;
+    return regislex_statute_evaluate(ctx, claim, &expiration, NULL) == REGISLEX_OK &&
+           date_is(&expiration, year, month, day);
+}
+
+static void test_statute_index(void) {
+    TEST_SUITE_BEGIN("Statute of Limitations Index");
+
+    regislex_context_t* ctx = test_context_open("statute_index");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_statute_rule_t rule = statute_rule("negligence", "TX", 24, REGISLEX_ACCRUAL_INCIDENT);
+    rule.tolling_allowed = true;
+    rule.max_tolling_days = 60;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, statute_store(ctx, &rule), "Standard rule created");
+    rule = statute_rule("negligence", "TX", 12, REGISLEX_ACCRUAL_DISCOVERY);
+    rule.repose_months = 48;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, statute_store(ctx, &rule), "Discovery variant created");
+    rule = statute_rule("fraud", "federal", 36, REGISLEX_ACCRUAL_INCIDENT);
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, statute_store(ctx, &rule), "Fallback rule created");
+    rule = statute_rule("fraud", "federal", 0, REGISLEX_ACCRUAL_INCIDENT);
+    TEST_ASSERT_EQUAL_INT(REGISLEX_ERROR_VALIDATION, statute_store(ctx, &rule), "Empty period rejected");
+
+    regislex_statute_claim_t claim;
+    memset(&claim, 0, sizeof(claim));
+    strcpy(claim.claim_type, "negligence");
+    strcpy(claim.jurisdiction, "TX");
+    claim.accrual_date = (regislex_datetime_t){2024, 3, 15, 0, 0, 0, 0};
+    TEST_ASSERT(statute_expires(ctx, &claim, 2026, 3, 15), "Standard period from accrual");
+
+    claim.tolled_days = 30;
+    TEST_ASSERT(statute_expires(ctx, &claim, 2026, 4, 14), "Tolling extends the period");
+    claim.tolled_days = 90;
+    TEST_ASSERT(statute_expires(ctx, &claim, 2026, 5, 14), "Tolling capped");
+    claim.tolled_days = 0;
+
+    claim.discovery_date = (regislex_datetime_t){2025, 1, 10, 0, 0, 0, 0};
+    TEST_ASSERT(statute_expires(ctx, &claim, 2026, 1, 10), "Discovery variant runs from discovery");
+    claim.accrual_date = (regislex_datetime_t){2020, 1, 1, 0, 0, 0, 0};
+    claim.discovery_date = (regislex_datetime_t){2023, 9, 1, 0, 0, 0, 0};
+    TEST_ASSERT(statute_expires(ctx, &claim, 2024, 1, 1), "Repose caps a late discovery");
+
+    memset(&claim, 0, sizeof(claim));
+    strcpy(claim.claim_type, "fraud");
+    strcpy(claim.jurisdiction, "CA");
+    claim.accrual_date = (regislex_datetime_t){2024, 2, 29, 0, 0, 0, 0};
+    TEST_ASSERT(statute_expires(ctx, &claim, 2027, 2, 28), "Jurisdiction falls back to federal");
+
+    regislex_datetime_t expiration;
+    strcpy(claim.claim_type, "antitrust");
+    TEST_ASSERT_EQUAL_INT(REGISLEX_ERROR_NOT_FOUND, regislex_statute_evaluate(ctx, &claim, &expiration, NULL),
+                          "Claim without a rule not found");
+
+    /* A rule added inside a rolled-back transaction never reaches the index */
+    regislex_db_transaction_t* tx = NULL;
+    regislex_db_begin(regislex_get_db(ctx), &tx);
+    rule = statute_rule("antitrust", "federal", 48, REGISLEX_ACCRUAL_INCIDENT);
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, statute_store(ctx, &rule), "Rule created inside a transaction");
+    regislex_db_rollback(tx);
+    TEST_ASSERT_EQUAL_INT(REGISLEX_ERROR_NOT_FOUND, regislex_statute_evaluate(ctx, &claim, &expiration, NULL),
+                          "Rolled-back rule not indexed");
+
+    /* The index rebuilt from the table gives the same answers */
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_statute_reload(ctx), "Index reloaded");
+    strcpy(claim.claim_type, "fraud");
+    TEST_ASSERT(statute_expires(ctx, &claim, 2027, 2, 28), "Reloaded index finds the rule");
+
+    /* The sweep reports open, unfiled cases in expiration order */
+    regislex_case_t* soon = case_open(ctx, "SOL-1", NULL);
+    regislex_case_t* expired = case_open(ctx, "SOL-2", NULL);
+    regislex_case_t* distant = case_open(ctx, "SOL-3", NULL);
+    regislex_case_t* filed = case_open(ctx, "SOL-4", NULL);
+    TEST_ASSERT(soon && expired && distant && filed, "Cases created");
+    if (soon && expired && distant && filed) {
+        regislex_datetime_t now;
+        regislex_datetime_now(&now);
+
+        memset(&claim, 0, sizeof(claim));
+        strcpy(claim.claim_type, "fraud");
+        strcpy(claim.jurisdiction, "NY");
+        claim.case_id = soon->id;
+        claim.accrual_date = now;
+        regislex_datetime_add_months(&claim.accrual_date, -35);
+        regislex_statute_claim_set(ctx, &claim);
+
+        claim.case_id = expired->id;
+        claim.accrual_date = now;
+        regislex_datetime_add_months(&claim.accrual_date, -40);
+        regislex_statute_claim_set(ctx, &claim);
+
+        claim.case_id = distant->id;
+        claim.accrual_date = now;
+        regislex_statute_claim_set(ctx, &claim);
+
+        claim.case_id = filed->id;
+        claim.accrual_date = now;
+        regislex_datetime_add_months(&claim.accrual_date, -35);
+        regislex_statute_claim_set(ctx, &claim);
+        filed->filed_date = now;
+        regislex_case_update(ctx, filed);
+        TEST_ASSERT_EQUAL_INT(3, (int)db_count(ctx, "SELECT count(*) FROM cases WHERE filed_date IS NULL"),
+                              "Unfiled cases store no filing date");
+
+        regislex_statute_exposure_t* exposures = NULL;
+        int count = 0;
+        TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_statute_sweep(ctx, 90, &exposures, &count),
+                              "Portfolio swept");
+        TEST_ASSERT_EQUAL_INT(2, count, "Expiring and expired claims reported");
+        TEST_ASSERT(count == 2 && strcmp(exposures[0].case_id.value, expired->id.value) == 0 &&
+                    exposures[0].days_remaining < 0,
+                    "Expired claim first with negative days");
+        TEST_ASSERT(count == 2 && strcmp(exposures[1].case_id.value, soon->id.value) == 0 &&
+                    exposures[1].days_remaining > 0 && exposures[1].days_remaining <= 31,
+                    "Expiring claim second");
+        regislex_statute_exposures_free(exposures);
+    }
+
+    regislex_case_free(soon);
+    regislex_case_free(expired);
+    regislex_case_free(distant);
+    regislex_case_free(filed);
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Recurrence Rule Tests
+ * ========================================================================== */
+
+/* Expand a rule into "YYYY-MM-DD" dates; returns the occurrence count */
+static int rrule_expand(const char* text, const regislex_datetime_t* dtstart,
+                        const regislex_datetime_t* window_start,
+                        const regislex_datetime_t* window_end,
+                        char dates[][16], int max) {
+    regislex_rrule_t rule;
+    regislex_rrule_iter_t iter;
+    regislex_datetime_t occ;
+    int n = 0;
+
+    if (regislex_rrule_parse(text, &rule) != REGISLEX_OK) return -1;
+    if (regislex_rrule_iter_init(&iter, &rule, dtstart, window_start) != REGISLEX_OK) return -1;
+
+    while (n < max && regislex_rrule_iter_next(&iter, window_end, &occ) == REGISLEX_OK) {
+        snprintf(dates[n++], 16, "%04d-%02d-%02d", occ.year, occ.month, occ.day);
+    }
+    return n;
+}
+
+static void test_rrule_expansion(void) {
+    TEST_SUITE_BEGIN("Recurrence Rule Expansion");
+
+    char dates[16][16];
+    int n;
+    regislex_datetime_t start = {2026, 1, 5, 9, 0, 0, 0};   /* Monday */
+
+    n = rrule_expand("FREQ=WEEKLY;BYDAY=MO,WE;COUNT=5", &start, NULL, NULL, dates, 16);
+    TEST_ASSERT_EQUAL_INT(5, n, "COUNT bounds weekly series");
+    TEST_ASSERT_EQUAL_STR("2026-01-07", dates[1], "BYDAY adds Wednesday");
+    TEST_ASSERT_EQUAL_STR("2026-01-19", dates[4], "Fifth occurrence on third Monday");
+
+    regislex_datetime_t last_friday = {2026, 1, 30, 9, 0, 0, 0};
+    n = rrule_expand("RRULE:FREQ=MONTHLY;BYDAY=-1FR;COUNT=3", &last_friday, NULL, NULL, dates, 16);
+    TEST_ASSERT_EQUAL_INT(3, n, "Monthly ordinal weekday series");
+    TEST_ASSERT_EQUAL_STR("2026-02-27", dates[1], "Last Friday of February");
+    TEST_ASSERT_EQUAL_STR("2026-03-27", dates[2], "Last Friday of March");
+
+    regislex_datetime_t month_end = {2026, 1, 31, 17, 0, 0, 0};
+    n = rrule_expand("FREQ=MONTHLY;BYMONTHDAY=-1;COUNT=3", &month_end, NULL, NULL, dates, 16);
+    TEST_ASSERT_EQUAL_INT(3, n, "Month end series");
+    TEST_ASSERT_EQUAL_STR("2026-02-28", dates[1], "Negative BYMONTHDAY counts from month end");
+
+    regislex_datetime_t new_year = {2026, 1, 1, 9, 0, 0, 0};
+    regislex_datetime_t from = {2026, 1, 10, 0, 0, 0, 0};
+    regislex_datetime_t until = {2026, 1, 20, 0, 0, 0, 0};
+    n = rrule_expand("FREQ=DAILY;INTERVAL=3", &new_year, &from, &until, dates, 16);
+    TEST_ASSERT_EQUAL_INT(4, n, "Window bounds unbounded series");
+    TEST_ASSERT_EQUAL_STR("2026-01-10", dates[0], "Window start keeps the interval phase");
+    TEST_ASSERT_EQUAL_STR("2026-01-19", dates[3], "Last occurrence before the window end");
+
+    n = rrule_expand("FREQ=DAILY;INTERVAL=3;COUNT=4", &new_year, &from, NULL, dates, 16);
+    TEST_ASSERT_EQUAL_INT(1, n, "COUNT counts occurrences before the window");
+
+    /* Every twelfth month from April never has a 31st */
+    regislex_datetime_t april = {2025, 4, 10, 9, 0, 0, 0};
+    n = rrule_expand("FREQ=MONTHLY;INTERVAL=12;BYMONTHDAY=31;UNTIL=20300101", &april, NULL, NULL, dates, 16);
+    TEST_ASSERT_EQUAL_INT(0, n, "UNTIL ends an unbounded rule with no candidates");
+    n = rrule_expand("FREQ=MONTHLY;INTERVAL=12;BYMONTHDAY=31", &april, NULL, NULL, dates, 16);
+    TEST_ASSERT_EQUAL_INT(0, n, "Rule that never matches ends an unbounded expansion");
+
+    regislex_datetime_t leap_day = {2024, 2, 29, 9, 0, 0, 0};
+    n = rrule_expand("FREQ=YEARLY;UNTIL=20300101", &leap_day, NULL, NULL, dates, 16);
+    TEST_ASSERT_EQUAL_INT(2, n, "Leap day series skips common years up to UNTIL");
+    regislex_datetime_t century = {2096, 2, 29, 9, 0, 0, 0};
+    n = rrule_expand("FREQ=YEARLY;COUNT=2", &century, NULL, NULL, dates, 16);
+    TEST_ASSERT(n == 2 && strcmp(dates[1], "2104-02-29") == 0, "Leap day series skips the 2100 gap");
+
+    regislex_rrule_t rule;
+    char text[128];
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_rrule_parse("FREQ=WEEKLY;INTERVAL=2;BYDAY=MO,FR", &rule),
+                          "Parse weekly rule");
+    regislex_rrule_format(&rule, text, sizeof(text));
+    regislex_rrule_t reparsed;
+    TEST_ASSERT(regislex_rrule_parse(text, &reparsed) == REGISLEX_OK &&
+                reparsed.interval == 2 && reparsed.weekdays == rule.weekdays,
+                "Formatted rule parses back");
+    TEST_ASSERT(regislex_rrule_parse("FREQ=HOURLY", &rule) != REGISLEX_OK,
+                "Unsupported frequency rejected");
+
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Calendar Feed Tests
+ * ========================================================================== */
+
+static regislex_error_t deadline_retitle(regislex_context_t* ctx, const regislex_uuid_t* id,
+                                         const char* title, const regislex_uuid_t* assigned_to_id) {
+    regislex_deadline_t* dl = NULL;
+    regislex_error_t err = regislex_deadline_get(ctx, id, &dl);
+    if (err != REGISLEX_OK) return err;
+    if (title) strcpy(dl->title, title);
+    if (assigned_to_id) dl->assigned_to_id = *assigned_to_id;
+    err = regislex_deadline_update(ctx, dl);
+    regislex_deadline_free(dl);
+    return err;
+}
+
+static bool feed_has(const regislex_calendar_feed_t* feed, const char* text) {
+    return feed && feed->data && strstr(feed->data, text) != NULL;
+}
+
+static void test_calendar_feed_sync(void) {
+    TEST_SUITE_BEGIN("Calendar Feed Sync");
+
+    regislex_context_t* ctx = test_context_open("calendar_feed_sync");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_uuid_t alice, bob, first, second, other;
+    user_store(ctx, &alice, "alice");
+    user_store(ctx, &bob, "bob");
+    regislex_case_t* matter = case_open(ctx, "F-1", NULL);
+    if (!matter) {
+        TEST_ASSERT(false, "Case created");
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_datetime_t when = {2030, 9, 1, 15, 0, 0, 0};
+    deadline_book(ctx, &matter->id, &alice, &when, &first);
+    deadline_retitle(ctx, &first, "Status conference", NULL);
+    when.day = 2;
+    deadline_book(ctx, &matter->id, &alice, &when, &second);
+    deadline_retitle(ctx, &second, "Pretrial hearing", NULL);
+    deadline_book(ctx, &matter->id, &bob, &when, &other);
+
+    regislex_calendar_feed_t* feed = NULL;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_calendar_feed(ctx, &alice, NULL, NULL, &feed),
+                          "Full feed rendered");
+    if (!feed) {
+        regislex_case_free(matter);
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+    TEST_ASSERT(!feed->is_delta && feed->event_count == 2, "Full feed holds the user's deadlines");
+    TEST_ASSERT(feed_has(feed, "SUMMARY:Status conference") && feed_has(feed, "SUMMARY:Pretrial hearing"),
+                "Events rendered");
+    TEST_ASSERT(feed_has(feed, first.value) && !feed_has(feed, other.value),
+                "Other users' deadlines left out");
+
+    char etag[32], token[32];
+    strcpy(etag, feed->etag);
+    strcpy(token, feed->sync_token);
+    regislex_calendar_feed_free(feed);
+
+    feed = NULL;
+    regislex_calendar_feed(ctx, &alice, NULL, etag, &feed);
+    TEST_ASSERT(feed && feed->not_modified && !feed->data, "Matching ETag answers not modified");
+    regislex_calendar_feed_free(feed);
+
+    feed = NULL;
+    regislex_calendar_feed(ctx, &alice, token, NULL, &feed);
+    TEST_ASSERT(feed && feed->not_modified, "Current token answers not modified");
+    regislex_calendar_feed_free(feed);
+
+    /* A change yields a delta with just that event */
+    deadline_retitle(ctx, &first, "Status conference (moved)", NULL);
+    deadline_retitle(ctx, &other, "Bob's hearing", NULL);
+    feed = NULL;
+    regislex_calendar_feed(ctx, &alice, token, NULL, &feed);
+    TEST_ASSERT(feed && feed->is_delta && feed->event_count == 1 && feed->removed_count == 0,
+                "Delta holds one changed event");
+    TEST_ASSERT(feed_has(feed, "moved") && !feed_has(feed, "Pretrial hearing"),
+                "Unchanged events left out of the delta");
+    TEST_ASSERT(feed && strcmp(feed->etag, etag) != 0, "ETag changes with the content");
+    if (feed) strcpy(token, feed->sync_token);
+    regislex_calendar_feed_free(feed);
+
+    /* Deleting or reassigning cancels the event in the user's next delta */
+    regislex_deadline_delete(ctx, &second);
+    deadline_retitle(ctx, &first, NULL, &bob);
+    feed = NULL;
+    regislex_calendar_feed(ctx, &alice, token, NULL, &feed);
+    TEST_ASSERT(feed && feed->removed_count == 2 && feed->event_count == 0,
+                "Deleted and reassigned deadlines removed");
+    TEST_ASSERT(feed_has(feed, "STATUS:CANCELLED"), "Removal sent as a cancelled event");
+    regislex_calendar_feed_free(feed);
+
+    feed = NULL;
+    regislex_calendar_feed(ctx, &bob, NULL, NULL, &feed);
+    TEST_ASSERT(feed && feed->event_count == 2, "Reassigned deadline joins the new feed");
+    regislex_calendar_feed_free(feed);
+
+    feed = NULL;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_ERROR_VALIDATION,
+                          regislex_calendar_feed(ctx, &alice, "bogus", NULL, &feed),
+                          "Unknown token rejected");
+    regislex_calendar_feed_free(feed);
+
+    regislex_case_free(matter);
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Schedule Conflict Tests
+ * ========================================================================== */
+
+static void test_schedule_conflicts(void) {
+    TEST_SUITE_BEGIN("Schedule Conflicts");
+
+    regislex_context_t* ctx = test_context_open("schedule_conflicts");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_uuid_t alice, bob, carol;
+    user_store(ctx, &alice, "alice");
+    user_store(ctx, &bob, "bob");
+    user_store(ctx, &carol, "carol");
+    regislex_case_t* matter = case_open(ctx, "C-1", NULL);
+    if (!matter) {
+        TEST_ASSERT(false, "Case created");
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_uuid_t morning, overlapping, adjacent, unused;
+    regislex_datetime_t at = {2030, 4, 2, 10, 0, 0, 0};
+    deadline_book(ctx, &matter->id, &alice, &at, &morning);
+    deadline_book(ctx, &matter->id, &bob, &at, &unused);
+    at.minute = 30;
+    deadline_book(ctx, &matter->id, &alice, &at, &overlapping);
+    at.hour = 11;
+    deadline_book(ctx, &matter->id, &alice, &at, &adjacent);
+
+    regislex_schedule_slot_t* slots = NULL;
+    int count = 0;
+    regislex_datetime_t probe = {2030, 4, 2, 10, 45, 0, 0};
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK,
+                          regislex_schedule_conflicts(ctx, &alice, &probe, 30, NULL, &slots, &count),
+                          "Conflict query");
+    TEST_ASSERT(count == 2 && strcmp(slots[0].deadline_id.value, morning.value) == 0 &&
+                strcmp(slots[1].deadline_id.value, overlapping.value) == 0,
+                "Both overlapping bookings in start order");
+    regislex_schedule_slots_free(slots);
+
+    slots = NULL;
+    regislex_schedule_conflicts(ctx, &alice, &probe, 30, &morning, &slots, &count);
+    TEST_ASSERT(count == 1 && strcmp(slots[0].deadline_id.value, overlapping.value) == 0,
+                "Excluded booking ignored");
+    regislex_schedule_slots_free(slots);
+
+    probe.minute = 30;
+    probe.hour = 11;
+    TEST_ASSERT_EQUAL_INT(1, booked_at(ctx, &alice, &probe), "Slot ends are exclusive");
+    probe.hour = 10;
+    probe.minute = 0;
+    TEST_ASSERT_EQUAL_INT(1, booked_at(ctx, &bob, &probe), "Bookings kept per assignee");
+
+    regislex_schedule_conflict_t* conflicts = NULL;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_schedule_scan(ctx, &conflicts, &count), "Portfolio scan");
+    TEST_ASSERT(count == 1 && strcmp(conflicts[0].first_id.value, morning.value) == 0 &&
+                conflicts[0].overlap_start.hour == 10 && conflicts[0].overlap_start.minute == 30 &&
+                conflicts[0].overlap_end.hour == 11 && conflicts[0].overlap_end.minute == 0,
+                "Scan reports the overlap window");
+    regislex_schedule_conflicts_free(conflicts);
+
+    /* Moving or completing a deadline updates the trees */
+    regislex_deadline_t* dl = NULL;
+    regislex_deadline_get(ctx, &overlapping, &dl);
+    if (dl) {
+        dl->start_date.hour = 14;
+        dl->due_date.hour = 14;
+        regislex_deadline_update(ctx, dl);
+        regislex_deadline_free(dl);
+    }
+    conflicts = NULL;
+    regislex_schedule_scan(ctx, &conflicts, &count);
+    TEST_ASSERT_EQUAL_INT(0, count, "Moved booking no longer conflicts");
+    regislex_schedule_conflicts_free(conflicts);
+
+    regislex_deadline_complete(ctx, &adjacent, NULL);
+    probe.hour = 11;
+    probe.minute = 45;
+    TEST_ASSERT_EQUAL_INT(0, booked_at(ctx, &alice, &probe), "Completed deadline frees its slot");
+
+    /* A long calendar finds the one booking that overlaps */
+    regislex_db_transaction_t* tx = NULL;
+    regislex_db_begin(regislex_get_db(ctx), &tx);
+    for (int i = 0; i < 200; i++) {
+        regislex_datetime_t start = {2031, 1, 1, 9, 0, 0, 0};
+        regislex_datetime_add_days(&start, i);
+        deadline_book(ctx, &matter->id, &carol, &start, &unused);
+    }
+    regislex_db_commit(tx);
+    probe = (regislex_datetime_t){2031, 1, 1, 9, 30, 0, 0};
+    regislex_datetime_add_days(&probe, 150);
+    TEST_ASSERT_EQUAL_INT(1, booked_at(ctx, &carol, &probe), "One hit among many bookings");
+    probe.hour = 12;
+    TEST_ASSERT_EQUAL_INT(0, booked_at(ctx, &carol, &probe), "Free time between bookings");
+
+    /* Deleting a case frees the slots and agenda entries of its deadlines */
+    regislex_case_t* closing = case_open(ctx, "C-2", NULL);
+    TEST_ASSERT_NOT_NULL(closing, "Second case created");
+    if (closing) {
+        regislex_uuid_t booked, prep;
+        regislex_datetime_t soon;
+        int agenda_before = agenda_size(ctx, &bob);
+        hours_from_now(48, &soon);
+        deadline_book(ctx, &closing->id, &bob, &soon, &booked);
+        reminder_at(ctx, &booked, &bob, 3600, "Prep", &prep);
+        TEST_ASSERT_EQUAL_INT(1, booked_at(ctx, &bob, &soon), "Case deadline booked");
+        TEST_ASSERT_EQUAL_INT(agenda_before + 2, agenda_size(ctx, &bob),
+                              "Deadline and reminder on the agenda");
+
+        regislex_db_begin(regislex_get_db(ctx), &tx);
+        regislex_case_delete(ctx, &closing->id);
+        regislex_db_rollback(tx);
+        TEST_ASSERT_EQUAL_INT(1, booked_at(ctx, &bob, &soon), "Rolled-back delete keeps the slot");
+
+        TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_case_delete(ctx, &closing->id), "Case deleted");
+        TEST_ASSERT_EQUAL_INT(0, booked_at(ctx, &bob, &soon), "Deleted case frees its slot");
+        TEST_ASSERT_EQUAL_INT(agenda_before, agenda_size(ctx, &bob), "Deleted case leaves the agenda");
+        regislex_case_free(closing);
+    }
+
+    regislex_case_free(matter);
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Time Zone Tests
+ * ========================================================================== */
+
+static bool wall_is(const regislex_datetime_t* dt, int day, int hour, int minute, int offset) {
+    return dt->day == day && dt->hour == hour && dt->minute == minute && dt->timezone_offset == offset;
+}
+
+static void test_timezone_resolution(void) {
+    TEST_SUITE_BEGIN("Time Zone Resolution");
+
+    regislex_timezone_init();
+    const regislex_tz_t* new_york = regislex_tz_find("America/New_York");
+    const regislex_tz_t* sydney = regislex_tz_find("Australia/Sydney");
+    const regislex_tz_t* phoenix = regislex_tz_find("America/Phoenix");
+    TEST_ASSERT(new_york && sydney && phoenix, "Compiled zones found");
+    TEST_ASSERT_NULL(regislex_tz_find("Nowhere/Else"), "Unknown zone not found");
+    if (!new_york || !sydney || !phoenix) {
+        TEST_SUITE_END();
+        return;
+    }
+    TEST_ASSERT_EQUAL_STR("America/New_York", regislex_tz_name(new_york), "Zone keeps its name");
+
+    regislex_datetime_t local;
+    regislex_datetime_t instant = {2026, 7, 1, 16, 0, 0, 0};
+    regislex_datetime_to_zone(&instant, new_york, &local);
+    TEST_ASSERT(wall_is(&local, 1, 12, 0, -240), "Summer instant in daylight time");
+    instant = (regislex_datetime_t){2026, 1, 15, 17, 0, 0, 0};
+    regislex_datetime_to_zone(&instant, new_york, &local);
+    TEST_ASSERT(wall_is(&local, 15, 12, 0, -300), "Winter instant in standard time");
+    regislex_datetime_to_zone(&instant, sydney, &local);
+    TEST_ASSERT(wall_is(&local, 16, 4, 0, 660), "Southern summer in daylight time");
+    instant = (regislex_datetime_t){2026, 7, 1, 19, 0, 0, 0};
+    regislex_datetime_to_zone(&instant, phoenix, &local);
+    TEST_ASSERT(wall_is(&local, 1, 12, 0, -420), "Zone without daylight time");
+
+    /* Instants just either side of the spring-forward transition */
+    instant = (regislex_datetime_t){2026, 3, 8, 6, 59, 0, 0};
+    regislex_datetime_to_zone(&instant, new_york, &local);
+    TEST_ASSERT(wall_is(&local, 8, 1, 59, -300), "Minute before the transition");
+    instant.hour = 7;
+    instant.minute = 0;
+    regislex_datetime_to_zone(&instant, new_york, &local);
+    TEST_ASSERT(wall_is(&local, 8, 3, 0, -240), "Transition minute");
+
+    regislex_datetime_t wall = {2026, 3, 8, 2, 30, 0, 0};
+    regislex_datetime_from_zone(&wall, new_york, &local);
+    TEST_ASSERT(wall_is(&local, 8, 3, 30, -240), "Skipped wall time moves past the gap");
+    wall = (regislex_datetime_t){2026, 11, 1, 1, 30, 0, 0};
+    regislex_datetime_from_zone(&wall, new_york, &local);
+    TEST_ASSERT(wall_is(&local, 1, 1, 30, -240), "Repeated wall time takes the first occurrence");
+
+    regislex_datetime_t batch[3] = {
+        {2026, 1, 15, 17, 0, 0, 0},
+        {2026, 7, 1, 16, 0, 0, 0},
+        {2026, 7, 1, 12, 0, 0, -240}
+    };
+    regislex_datetime_to_zone_batch(batch, batch, 3, new_york);
+    TEST_ASSERT(wall_is(&batch[0], 15, 12, 0, -300) && wall_is(&batch[1], 1, 12, 0, -240) &&
+                wall_is(&batch[2], 1, 12, 0, -240),
+                "Batch conversion matches single conversions in place");
+
+    regislex_context_t* ctx = test_context_open("timezone_resolution");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    TEST_ASSERT(regislex_court_zone("TX") == regislex_tz_find("America/Chicago"), "Seeded state zone");
+    regislex_datetime_t date = {2026, 12, 1, 0, 0, 0, 0};
+    regislex_datetime_t cutoff;
+    regislex_court_cutoff(ctx, "CA", &date, 17, 0, &cutoff);
+    TEST_ASSERT(wall_is(&cutoff, 1, 17, 0, -480), "Winter cutoff in court-local standard time");
+    date.month = 7;
+    regislex_court_cutoff(ctx, "CA", &date, 17, 0, &cutoff);
+    TEST_ASSERT(wall_is(&cutoff, 1, 17, 0, -420), "Summer cutoff in court-local daylight time");
+
+    TEST_ASSERT_EQUAL_INT(REGISLEX_ERROR_VALIDATION, regislex_court_zone_set(ctx, "ZZ", "Nowhere/Else"),
+                          "Unknown zone rejected");
+    TEST_ASSERT_EQUAL_INT(REGISLEX_ERROR_NOT_FOUND, regislex_court_cutoff(ctx, "ZZ", &date, 17, 0, &cutoff),
+                          "Unmapped jurisdiction not found");
+    regislex_court_zone_set(ctx, "ZZ", "Asia/Tokyo");
+    regislex_court_cutoff(ctx, "ZZ", &date, 17, 0, &cutoff);
+    TEST_ASSERT(wall_is(&cutoff, 1, 17, 0, 540), "New mapping used");
+
+    /* Deadlines carry the court's offset on the date they land on */
+    regislex_datetime_t start = {2026, 10, 30, 9, 0, 0, 0};
+    regislex_datetime_t due;
+    regislex_deadline_calculate(ctx, &start, 5, false, "NY", &due);
+    TEST_ASSERT(date_is(&due, 2026, 11, 4) && due.timezone_offset == -300,
+                "Deadline after the change takes standard time");
+
+    /* The trigger instant is counted from the court's date, whatever its offset */
+    regislex_datetime_t late_utc = {2026, 10, 31, 2, 0, 0, 0};   /* Oct 30, 22:00 in New York */
+    regislex_deadline_calculate(ctx, &late_utc, 5, false, "NY", &due);
+    TEST_ASSERT(date_is(&due, 2026, 11, 4) && wall_is(&due, 4, 22, 0, -300),
+                "UTC trigger counted from the court date");
+    regislex_datetime_t late_local = {2026, 10, 30, 22, 0, 0, -240};
+    regislex_datetime_t same;
+    regislex_deadline_calculate(ctx, &late_local, 5, false, "NY", &same);
+    TEST_ASSERT(regislex_datetime_compare(&due, &same) == 0 && due.timezone_offset == same.timezone_offset,
+                "Same instant gives the same deadline in any offset");
+
+    /* Court rules count days the same way */
+    regislex_case_t* matter = case_open(ctx, "TZ-1", NULL);
+    regislex_court_rule_set_t set;
+    memset(&set, 0, sizeof(set));
+    strcpy(set.name, "New York rules");
+    strcpy(set.jurisdiction, "NY");
+    regislex_court_rule_t answer = court_rule("ANSWER", "service", NULL, 5, false);
+    regislex_court_rule_set_t* created = NULL;
+    regislex_court_rule_set_create(ctx, &set, &answer, 1, &created);
+    regislex_court_trigger_result_t result;
+    regislex_datetime_t ruled;
+    TEST_ASSERT(matter && created &&
+                regislex_court_trigger_record(ctx, &matter->id, &created->id, "service",
+                                              &late_utc, &result) == REGISLEX_OK &&
+                rule_due(ctx, &matter->id, "ANSWER", &ruled) && regislex_datetime_compare(&ruled, &due) == 0 &&
+                ruled.timezone_offset == due.timezone_offset,
+                "Court rule agrees with the deadline calculation");
+    regislex_court_rule_set_free(created);
+    regislex_case_free(matter);
+
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Agenda Tests
+ * ========================================================================== */
+
+static bool agenda_ordered(const regislex_agenda_item_t* items, int count) {
+    for (int i = 1; i < count; i++) {
+        if (regislex_datetime_compare(&items[i - 1].due, &items[i].due) > 0) return false;
+    }
+    return true;
+}
+
+static void test_agenda_merge(void) {
+    TEST_SUITE_BEGIN("Agenda Merge");
+
+    regislex_context_t* ctx = test_context_open("agenda_merge");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_uuid_t owner, other;
+    user_store(ctx, &owner, "owner");
+    user_store(ctx, &other, "other");
+    regislex_case_t* matter = case_open(ctx, "AG-1", NULL);
+    TEST_ASSERT_NOT_NULL(matter, "Case created");
+    if (!matter) {
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+
+    /* One deadline, task, reminder and weekly series interleaved in time */
+    regislex_datetime_t at;
+    regislex_uuid_t hearing, reminder, elsewhere;
+    hours_from_now(72, &at);
+    deadline_book(ctx, &matter->id, &owner, &at, &hearing);
+    hours_from_now(96, &at);
+    deadline_book(ctx, &matter->id, &other, &at, &elsewhere);
+    reminder_at(ctx, &hearing, &owner, 2 * 3600, "Prep", &reminder);
+
+    regislex_task_t task_data;
+    regislex_task_t* task = NULL;
+    memset(&task_data, 0, sizeof(task_data));
+    task_data.case_id = matter->id;
+    strcpy(task_data.title, "Draft brief");
+    task_data.assigned_to_id = owner;
+    hours_from_now(24, &task_data.due_date);
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_task_create(ctx, &task_data, &task), "Task created");
+
+    regislex_deadline_t series_data;
+    regislex_deadline_t* series = NULL;
+    memset(&series_data, 0, sizeof(series_data));
+    series_data.case_id = matter->id;
+    strcpy(series_data.title, "Status report");
+    strcpy(series_data.rrule, "FREQ=WEEKLY");
+    series_data.assigned_to_id = owner;
+    hours_from_now(48, &series_data.due_date);
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_deadline_create(ctx, &series_data, &series), "Series created");
+    if (!task || !series) {
+        regislex_task_free(task);
+        regislex_deadline_free(series);
+        regislex_case_free(matter);
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_agenda_item_t items[32];
+    int count = 0;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_agenda_next(ctx, &owner, NULL, items, 5, &count),
+                          "Agenda read");
+    TEST_ASSERT_EQUAL_INT(5, count, "Next five items");
+    TEST_ASSERT(count == 5 &&
+                items[0].kind == REGISLEX_AGENDA_REMINDER && strcmp(items[0].title, "Prep") == 0 &&
+                items[1].kind == REGISLEX_AGENDA_TASK && strcmp(items[1].id.value, task->id.value) == 0 &&
+                items[2].kind == REGISLEX_AGENDA_DEADLINE && strcmp(items[2].id.value, series->id.value) == 0 &&
+                items[3].kind == REGISLEX_AGENDA_DEADLINE && strcmp(items[3].id.value, hearing.value) == 0 &&
+                strcmp(items[4].id.value, series->id.value) == 0,
+                "Kinds merged in due order");
+    TEST_ASSERT(count == 5 && strcmp(items[0].deadline_id.value, hearing.value) == 0,
+                "Reminder points at its deadline");
+    TEST_ASSERT_EQUAL_INT(1, agenda_size(ctx, &other), "Other user's agenda kept apart");
+
+    /* The series contributes one entry per occurrence within its horizon */
+    regislex_agenda_next(ctx, &owner, NULL, items, 32, &count);
+    int occurrences = 0;
+    for (int i = 0; i < count; i++) {
+        if (strcmp(items[i].id.value, series->id.value) == 0) occurrences++;
+    }
+    TEST_ASSERT(occurrences >= 12 && occurrences <= 13, "Weekly series expanded over the horizon");
+    TEST_ASSERT(agenda_ordered(items, count), "Whole agenda in due order");
+
+    hours_from_now(60, &at);
+    regislex_agenda_next(ctx, &owner, &at, items, 1, &count);
+    TEST_ASSERT(count == 1 && strcmp(items[0].id.value, hearing.value) == 0, "Read from a start time");
+
+    /* Finished and deleted items leave the agenda */
+    regislex_task_complete(ctx, &task->id, "Filed", 30);
+    regislex_agenda_next(ctx, &owner, NULL, items, 2, &count);
+    TEST_ASSERT(count == 2 && items[0].kind == REGISLEX_AGENDA_REMINDER &&
+                strcmp(items[1].id.value, series->id.value) == 0,
+                "Completed task dropped");
+
+    regislex_deadline_delete(ctx, &hearing);
+    regislex_agenda_next(ctx, &owner, NULL, items, 32, &count);
+    bool stale = false;
+    for (int i = 0; i < count; i++) {
+        stale |= items[i].kind != REGISLEX_AGENDA_DEADLINE || strcmp(items[i].id.value, hearing.value) == 0;
+    }
+    TEST_ASSERT(!stale && count == occurrences, "Deleted deadline and its reminder dropped");
+
+    /* A rebuild from the tables matches the incrementally kept agenda */
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_agenda_roll(ctx), "Roll before the refresh point");
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_agenda_rebuild(ctx), "Agenda rebuilt");
+    regislex_agenda_item_t rebuilt[32];
+    int rebuilt_count = 0;
+    regislex_agenda_next(ctx, &owner, NULL, rebuilt, 32, &rebuilt_count);
+    bool same = rebuilt_count == count;
+    for (int i = 0; same && i < count; i++) {
+        same = strcmp(items[i].id.value, rebuilt[i].id.value) == 0 &&
+               regislex_datetime_compare(&items[i].due, &rebuilt[i].due) == 0;
+    }
+    TEST_ASSERT(same, "Rebuild matches incremental updates");
+
+    regislex_task_free(task);
+    regislex_deadline_free(series);
+    regislex_case_free(matter);
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Holiday Recompute Tests
+ * ========================================================================== */
+
+static regislex_holiday_t court_holiday(const char* name, const char* jurisdiction, int month, int day) {
+    regislex_holiday_t holiday;
+    memset(&holiday, 0, sizeof(holiday));
+    strcpy(holiday.name, name);
+    strcpy(holiday.jurisdiction, jurisdiction);
+    holiday.date = (regislex_datetime_t){2026, month, day, 0, 0, 0, 0};
+    holiday.is_court_holiday = true;
+    return holiday;
+}
+
+static void test_holiday_recompute(void) {
+    TEST_SUITE_BEGIN("Holiday Recompute");
+
+    regislex_context_t* ctx = test_context_open("holiday_recompute");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_case_t* matter = case_open(ctx, "H-1", NULL);
+    regislex_case_t* later = case_open(ctx, "H-2", NULL);
+
+    regislex_court_rule_set_t set;
+    memset(&set, 0, sizeof(set));
+    strcpy(set.name, "Holiday rules");
+    strcpy(set.jurisdiction, "TEST");
+    regislex_court_rule_t rules[2] = {
+        court_rule("ANSWER", "service", NULL, 10, true),
+        court_rule("REPLY", NULL, "ANSWER", 7, false)
+    };
+    regislex_court_rule_set_t* created = NULL;
+    regislex_court_rule_set_create(ctx, &set, rules, 2, &created);
+    TEST_ASSERT(created && matter && later, "Rule set and cases created");
+    if (!created || !matter || !later) {
+        regislex_court_rule_set_free(created);
+        regislex_case_free(matter);
+        regislex_case_free(later);
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_court_trigger_result_t result;
+    regislex_datetime_t served = {2026, 6, 1, 0, 0, 0, 0};     /* Monday */
+    regislex_court_trigger_record(ctx, &matter->id, &created->id, "service", &served, &result);
+    regislex_datetime_t served_later = {2026, 9, 1, 0, 0, 0, 0};
+    regislex_court_trigger_record(ctx, &later->id, &created->id, "service", &served_later, &result);
+    TEST_ASSERT(rule_due_is(ctx, &matter->id, "ANSWER", 2026, 6, 15) &&
+                rule_due_is(ctx, &matter->id, "REPLY", 2026, 6, 22),
+                "Chain computed without holidays");
+
+    /* A court holiday inside the window moves the chain and logs each move */
+    regislex_holiday_t closure = court_holiday("Court closure", "TEST", 6, 10);
+    regislex_holiday_t* added = NULL;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_holiday_add(ctx, &closure, &added), "Holiday added");
+    if (!added) {
+        regislex_court_rule_set_free(created);
+        regislex_case_free(matter);
+        regislex_case_free(later);
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+    TEST_ASSERT(rule_due_is(ctx, &matter->id, "ANSWER", 2026, 6, 16), "Court-day count skips the holiday");
+    TEST_ASSERT(rule_due_is(ctx, &matter->id, "REPLY", 2026, 6, 23), "Dependent deadline follows");
+    TEST_ASSERT(rule_due_is(ctx, &later->id, "ANSWER", 2026, 9, 15), "Deadline outside the window kept");
+
+    regislex_deadline_shift_t* shifts = NULL;
+    int count = 0;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK,
+                          regislex_deadline_shift_list(ctx, NULL, &added->id, &shifts, &count),
+                          "Shifts listed by holiday");
+    TEST_ASSERT_EQUAL_INT(2, count, "One shift per moved deadline");
+    bool audited = count == 2;
+    for (int i = 0; audited && i < count; i++) {
+        audited = strcmp(shifts[i].reason, "holiday added") == 0 &&
+                  strcmp(shifts[i].holiday_id.value, added->id.value) == 0 &&
+                  strcmp(shifts[i].case_id.value, matter->id.value) == 0 &&
+                  regislex_datetime_diff_days(&shifts[i].previous_due_date, &shifts[i].new_due_date) == 1;
+    }
+    TEST_ASSERT(audited, "Shift rows carry the holiday, reason and both dates");
+
+    regislex_uuid_t answer_id;
+    memset(&answer_id, 0, sizeof(answer_id));
+    for (int i = 0; i < count; i++) {
+        if (date_is(&shifts[i].new_due_date, 2026, 6, 16)) answer_id = shifts[i].deadline_id;
+    }
+    regislex_deadline_shift_list_free(shifts);
+
+    /* Holidays of another jurisdiction or outside court closures move nothing */
+    regislex_holiday_t elsewhere = court_holiday("Other closure", "OTHER", 6, 11);
+    regislex_holiday_t* other = NULL;
+    regislex_holiday_add(ctx, &elsewhere, &other);
+    TEST_ASSERT(rule_due_is(ctx, &matter->id, "ANSWER", 2026, 6, 16), "Other jurisdiction ignored");
+    regislex_holiday_t observance = court_holiday("Observance", "TEST", 6, 11);
+    observance.is_court_holiday = false;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_court_holiday_recompute(ctx, &observance, NULL, NULL, &result),
+                          "Recompute for a non-court holiday");
+    TEST_ASSERT_EQUAL_INT(0, result.created + result.updated + result.unchanged, "Nothing considered");
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_court_holiday_recompute(ctx, added, "audit", NULL, &result),
+                          "Recompute for the stored holiday");
+    TEST_ASSERT(result.updated == 0 && result.unchanged == 2, "Recompute is idempotent");
+
+    /* Removing the holiday moves the chain back and logs it too */
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_holiday_delete(ctx, &added->id), "Holiday removed");
+    TEST_ASSERT(rule_due_is(ctx, &matter->id, "ANSWER", 2026, 6, 15) &&
+                rule_due_is(ctx, &matter->id, "REPLY", 2026, 6, 22),
+                "Chain restored");
+
+    regislex_deadline_shift_list(ctx, &answer_id, NULL, &shifts, &count);
+    TEST_ASSERT(count == 2 && strcmp(shifts[0].reason, "holiday added") == 0 &&
+                strcmp(shifts[1].reason, "holiday removed") == 0 &&
+                date_is(&shifts[1].previous_due_date, 2026, 6, 16) &&
+                date_is(&shifts[1].new_due_date, 2026, 6, 15),
+                "Deadline history lists both moves oldest first");
+    regislex_deadline_shift_list_free(shifts);
+    TEST_ASSERT_EQUAL_INT(REGISLEX_ERROR_INVALID_ARGUMENT,
+                          regislex_deadline_shift_list(ctx, NULL, NULL, &shifts, &count),
+                          "Listing needs a deadline or holiday");
+
+    /* The shared calendar only takes a holiday once its write commits */
+    regislex_holiday_t pending = court_holiday("Pending closure", "TEST", 6, 11);
+    regislex_datetime_t pending_day = {2026, 6, 11, 0, 0, 0, 0};
+    bool closed = true;
+    regislex_db_transaction_t* tx = NULL;
+    regislex_db_begin(regislex_get_db(ctx), &tx);
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_holiday_add(ctx, &pending, NULL),
+                          "Holiday added in a transaction");
+    TEST_ASSERT(rule_due_is(ctx, &matter->id, "ANSWER", 2026, 6, 16), "Pending holiday moves the chain");
+    regislex_holiday_check(ctx, &pending_day, "TEST", &closed);
+    TEST_ASSERT(!closed, "Shared calendar unchanged before commit");
+    regislex_db_rollback(tx);
+    regislex_holiday_check(ctx, &pending_day, "TEST", &closed);
+    TEST_ASSERT(!closed, "Rolled-back holiday never reaches the shared calendar");
+    TEST_ASSERT(rule_due_is(ctx, &matter->id, "ANSWER", 2026, 6, 15), "Rolled-back move undone");
+
+    regislex_db_begin(regislex_get_db(ctx), &tx);
+    regislex_holiday_add(ctx, &pending, NULL);
+    regislex_db_commit(tx);
+    regislex_holiday_check(ctx, &pending_day, "TEST", &closed);
+    TEST_ASSERT(closed, "Committed holiday reaches the shared calendar");
+
+    regislex_holiday_free(added);
+    regislex_holiday_free(other);
+    regislex_court_rule_set_free(created);
+    regislex_case_free(matter);
+    regislex_case_free(later);
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Workflow Executor Tests
+ * ========================================================================== */
+
+static regislex_error_t action_append(regislex_context_t* ctx, const regislex_uuid_t* workflow_id,
+                                      regislex_action_type_t type, int order, const char* title) {
+    regislex_action_t action;
+    regislex_action_t* added = NULL;
+    regislex_action_param_t param;
+
+    memset(&action, 0, sizeof(action));
+    memset(&param, 0, sizeof(param));
+    strcpy(action.name, "step");
+    action.type = type;
+    action.sequence_order = order;
+    action.is_active = true;
+    if (type == REGISLEX_ACTION_DELAY) action.delay_minutes = 1;
+    if (title) {
+        strcpy(param.type, "title");
+        strcpy(param.value, title);
+        action.params = &param;
+        action.param_count = 1;
+    }
+    regislex_error_t err = regislex_action_add(ctx, workflow_id, &action, &added);
+    regislex_action_free(added);
+    return err;
+}
+
+/* Poll a run until it reaches a status; false on timeout */
+static bool run_wait(regislex_context_t* ctx, const regislex_uuid_t* run_id,
+                     regislex_workflow_status_t status) {
+    for (int i = 0; i < 500; i++) {
+        regislex_workflow_run_t* run = NULL;
+        if (regislex_workflow_run_get(ctx, run_id, &run) == REGISLEX_OK) {
+            bool reached = run->status == status;
+            regislex_workflow_run_free(run);
+            if (reached) return true;
+        }
+        platform_sleep_ms(10);
+    }
+    return false;
+}
+
+static void test_executor_resume(void) {
+    TEST_SUITE_BEGIN("Workflow Executor Resume");
+
+    regislex_context_t* ctx = test_context_open("executor");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_workflow_t def;
+    regislex_workflow_t* workflow = NULL;
+    memset(&def, 0, sizeof(def));
+    strcpy(def.name, "Resume");
+    def.allow_parallel = true;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_create(ctx, &def, &workflow), "Create workflow");
+    if (!workflow) {
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+    TEST_ASSERT(action_append(ctx, &workflow->id, REGISLEX_ACTION_CREATE_TASK, 1, "first") == REGISLEX_OK &&
+                action_append(ctx, &workflow->id, REGISLEX_ACTION_DELAY, 2, NULL) == REGISLEX_OK &&
+                action_append(ctx, &workflow->id, REGISLEX_ACTION_CREATE_TASK, 3, "second") == REGISLEX_OK,
+                "Add task, delay and task steps");
+    regislex_workflow_activate(ctx, &workflow->id);
+
+    regislex_workflow_executor_options_t options = { 2, 0, 0 };
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_executor_start(ctx, &options), "Start executor");
+
+    /* A run parks on its DELAY step, and the executor goes away with it */
+    regislex_uuid_t parked;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_submit(ctx, &workflow->id, NULL, NULL, &parked),
+                          "Submit run");
+    for (int i = 0; i < 500 && db_count(ctx, "SELECT count(*) FROM workflow_timers") < 1; i++) {
+        platform_sleep_ms(10);
+    }
+    TEST_ASSERT_EQUAL_INT(1, (int)db_count(ctx, "SELECT count(*) FROM workflow_timers"), "Run parked on a timer");
+    regislex_workflow_executor_stop();
+
+    /* The delay elapses while no executor runs */
+    regislex_db_exec(regislex_get_db(ctx), "UPDATE workflow_timers SET fire_ms = 0");
+
+    /* A crash after step 2 leaves a started run without a timer */
+    regislex_uuid_t crashed;
+    char sql[512];
+    regislex_uuid_generate(&crashed);
+    snprintf(sql, sizeof(sql),
+             "INSERT INTO workflow_runs (id, workflow_id, status, current_step, started_at, created_at, updated_at)"
+             " VALUES ('%s', '%s', %d, 2, '2026-01-01T00:00:00Z', '2026-01-01T00:00:00Z', '2026-01-01T00:00:00Z')",
+             crashed.value, workflow->id.value, REGISLEX_WORKFLOW_ACTIVE);
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_db_exec(regislex_get_db(ctx), sql), "Store crashed run");
+
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_executor_start(ctx, &options), "Restart executor");
+    TEST_ASSERT(run_wait(ctx, &parked, REGISLEX_WORKFLOW_COMPLETED), "Parked run completes after restart");
+    TEST_ASSERT(run_wait(ctx, &crashed, REGISLEX_WORKFLOW_COMPLETED), "Crashed run resumes and completes");
+    regislex_workflow_executor_stop();
+
+    TEST_ASSERT_EQUAL_INT(1, (int)db_count(ctx, "SELECT count(*) FROM tasks WHERE title = 'first'"),
+                          "Completed steps are not repeated");
+    TEST_ASSERT_EQUAL_INT(2, (int)db_count(ctx, "SELECT count(*) FROM tasks WHERE title = 'second'"),
+                          "Remaining steps run once per run");
+    TEST_ASSERT_EQUAL_INT(0, (int)db_count(ctx, "SELECT count(*) FROM workflow_timers"), "Timers cleared");
+
+    regislex_workflow_free(workflow);
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* Wait until a run parks on a timer, then return the action it parked on */
+static bool run_parked(regislex_context_t* ctx, const regislex_uuid_t* run_id, regislex_uuid_t* action_id) {
+    char sql[256];
+    snprintf(sql, sizeof(sql), "SELECT count(*) FROM workflow_timers WHERE run_id = '%s'", run_id->value);
+    for (int i = 0; i < 500 && db_count(ctx, sql) < 1; i++) {
+        platform_sleep_ms(10);
+    }
+    if (db_count(ctx, sql) < 1) return false;
+
+    regislex_workflow_run_t* run = NULL;
+    if (regislex_workflow_run_get(ctx, run_id, &run) != REGISLEX_OK) return false;
+    memcpy(action_id, &run->current_action_id, sizeof(regislex_uuid_t));
+    regislex_workflow_run_free(run);
+    return true;
+}
+
+static void test_executor_versions(void) {
+    TEST_SUITE_BEGIN("Workflow Executor Definition Versions");
+
+    regislex_context_t* ctx = test_context_open("executor_versions");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_workflow_t def;
+    regislex_workflow_t* workflow = NULL;
+    memset(&def, 0, sizeof(def));
+    strcpy(def.name, "Versions");
+    def.allow_parallel = true;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_create(ctx, &def, &workflow), "Create workflow");
+    if (!workflow) {
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+    TEST_ASSERT(action_append(ctx, &workflow->id, REGISLEX_ACTION_CREATE_TASK, 10, "a") == REGISLEX_OK &&
+                action_append(ctx, &workflow->id, REGISLEX_ACTION_APPROVAL, 20, "gate") == REGISLEX_OK &&
+                action_append(ctx, &workflow->id, REGISLEX_ACTION_CREATE_TASK, 30, "b") == REGISLEX_OK,
+                "Add task, approval and task steps");
+    regislex_workflow_activate(ctx, &workflow->id);
+
+    regislex_workflow_executor_options_t options = { 2, 0, 0 };
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_executor_start(ctx, &options), "Start executor");
+
+    /* A step inserted ahead of a parked run does not shift it */
+    regislex_uuid_t pinned, gate;
+    regislex_workflow_submit(ctx, &workflow->id, NULL, NULL, &pinned);
+    TEST_ASSERT(run_parked(ctx, &pinned, &gate), "Run parks on its approval");
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, action_append(ctx, &workflow->id, REGISLEX_ACTION_CREATE_TASK, 5, "x"),
+                          "Insert a step while the run waits");
+    regislex_workflow_approval_resolve(ctx, &pinned, true, NULL);
+    TEST_ASSERT(run_wait(ctx, &pinned, REGISLEX_WORKFLOW_COMPLETED), "Run completes on its own version");
+    TEST_ASSERT_EQUAL_INT(0, (int)db_count(ctx, "SELECT count(*) FROM tasks WHERE title = 'x'"),
+                          "Inserted step not run by the older run");
+    TEST_ASSERT_EQUAL_INT(1, (int)db_count(ctx, "SELECT count(*) FROM tasks WHERE title = 'b'"),
+                          "Step after the approval runs once");
+
+    /* Across a restart the superseded version is gone; the run continues after its action */
+    regislex_uuid_t rebased, removed;
+    regislex_workflow_submit(ctx, &workflow->id, NULL, NULL, &rebased);
+    TEST_ASSERT(run_parked(ctx, &rebased, &gate), "Second run parks on its approval");
+    regislex_workflow_submit(ctx, &workflow->id, NULL, NULL, &removed);
+    TEST_ASSERT(run_parked(ctx, &removed, &gate), "Third run parks on its approval");
+    regislex_workflow_executor_stop();
+
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, action_append(ctx, &workflow->id, REGISLEX_ACTION_CREATE_TASK, 1, "y"),
+                          "Insert another step while stopped");
+    regislex_workflow_approval_resolve(ctx, &rebased, true, NULL);
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_executor_start(ctx, &options), "Restart executor");
+    TEST_ASSERT(run_wait(ctx, &rebased, REGISLEX_WORKFLOW_COMPLETED), "Rebased run completes");
+    TEST_ASSERT_EQUAL_INT(0, (int)db_count(ctx, "SELECT count(*) FROM tasks WHERE title = 'y'"),
+                          "Rebased run skips steps inserted before its action");
+    TEST_ASSERT_EQUAL_INT(2, (int)db_count(ctx, "SELECT count(*) FROM tasks WHERE title = 'b'"),
+                          "Rebased run continues after its approval");
+    TEST_ASSERT_EQUAL_INT(3, (int)db_count(ctx, "SELECT count(*) FROM tasks WHERE title = 'a'"),
+                          "Completed steps are not repeated");
+    regislex_workflow_executor_stop();
+
+    /* A run whose action was removed cannot be placed, and fails */
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_action_remove(ctx, &gate), "Remove the approval step");
+    regislex_workflow_approval_resolve(ctx, &removed, true, NULL);
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_executor_start(ctx, &options), "Start executor again");
+    TEST_ASSERT(run_wait(ctx, &removed, REGISLEX_WORKFLOW_FAILED), "Run on a removed action fails");
+    TEST_ASSERT_EQUAL_INT(2, (int)db_count(ctx, "SELECT count(*) FROM tasks WHERE title = 'b'"),
+                          "Failed run runs no further steps");
+    regislex_workflow_executor_stop();
+
+    regislex_workflow_free(workflow);
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+static void test_executor_admission(void) {
+    TEST_SUITE_BEGIN("Workflow Executor Admission");
+
+    regislex_context_t* ctx = test_context_open("executor_admission");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_workflow_t def;
+    regislex_workflow_t* workflow = NULL;
+    memset(&def, 0, sizeof(def));
+    strcpy(def.name, "Exclusive");
+    def.allow_parallel = false;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_create(ctx, &def, &workflow), "Create workflow");
+    if (!workflow) {
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+    TEST_ASSERT(action_append(ctx, &workflow->id, REGISLEX_ACTION_APPROVAL, 1, "gate") == REGISLEX_OK,
+                "Add an approval step");
+    regislex_workflow_activate(ctx, &workflow->id);
+
+    regislex_workflow_executor_options_t options = { 2, 0, 0 };
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_executor_start(ctx, &options), "Start executor");
+
+    /* The second run waits for the first's slot, across the first's approval */
+    regislex_uuid_t first, second, gate;
+    regislex_workflow_submit(ctx, &workflow->id, NULL, NULL, &first);
+    TEST_ASSERT(run_parked(ctx, &first, &gate), "First run parks on its approval");
+    regislex_workflow_submit(ctx, &workflow->id, NULL, NULL, &second);
+    platform_sleep_ms(50);
+    TEST_ASSERT_EQUAL_INT(1, (int)db_count(ctx, "SELECT count(*) FROM workflow_runs WHERE started_at IS NOT NULL"),
+                          "Second run not admitted while the first holds the slot");
+
+    /* Rolled-back decisions neither resume the run nor free its slot */
+    regislex_db_transaction_t* tx = NULL;
+    regislex_db_begin(regislex_get_db(ctx), &tx);
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_approval_resolve(ctx, &first, true, NULL),
+                          "Approve inside a transaction");
+    regislex_db_rollback(tx);
+    regislex_db_begin(regislex_get_db(ctx), &tx);
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_run_cancel(ctx, &first),
+                          "Cancel inside a transaction");
+    regislex_db_rollback(tx);
+    platform_sleep_ms(100);
+    regislex_workflow_run_t* held = NULL;
+    regislex_workflow_run_get(ctx, &first, &held);
+    TEST_ASSERT(held && held->status == REGISLEX_WORKFLOW_ACTIVE && run_parked(ctx, &first, &gate),
+                "Rolled-back approval and cancel leave the run parked");
+    regislex_workflow_run_free(held);
+    TEST_ASSERT_EQUAL_INT(1, (int)db_count(ctx, "SELECT count(*) FROM workflow_runs WHERE started_at IS NOT NULL"),
+                          "Rolled-back cancel keeps the slot");
+
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_approval_resolve(ctx, &first, false, "no"),
+                          "Reject the first run");
+    TEST_ASSERT(run_wait(ctx, &first, REGISLEX_WORKFLOW_FAILED), "First run fails");
+    TEST_ASSERT(run_parked(ctx, &second, &gate), "Next run admitted after the failure");
+    regislex_workflow_approval_resolve(ctx, &second, true, NULL);
+    TEST_ASSERT(run_wait(ctx, &second, REGISLEX_WORKFLOW_COMPLETED), "Next run completes");
+    regislex_workflow_executor_stop();
+
+    regislex_workflow_free(workflow);
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+static void test_executor_invalidate_commit(void) {
+    TEST_SUITE_BEGIN("Workflow Executor Cache Invalidation");
+
+    regislex_context_t* ctx = test_context_open("executor_invalidate");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_workflow_t def;
+    regislex_workflow_t* workflow = NULL;
+    memset(&def, 0, sizeof(def));
+    strcpy(def.name, "Cached");
+    def.allow_parallel = true;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_create(ctx, &def, &workflow), "Create workflow");
+    if (!workflow) {
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+    action_append(ctx, &workflow->id, REGISLEX_ACTION_CREATE_TASK, 1, "cached");
+    regislex_workflow_activate(ctx, &workflow->id);
+
+    regislex_workflow_executor_options_t options = { 2, 0, 0 };
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_executor_start(ctx, &options), "Start executor");
+
+    /* The first run caches the definition */
+    regislex_uuid_t run_id;
+    regislex_workflow_submit(ctx, &workflow->id, NULL, NULL, &run_id);
+    TEST_ASSERT(run_wait(ctx, &run_id, REGISLEX_WORKFLOW_COMPLETED), "First run completes");
+
+    /* A pause that rolls back leaves the cached, active definition in place */
+    regislex_db_transaction_t* tx = NULL;
+    regislex_db_begin(regislex_get_db(ctx), &tx);
+    workflow->status = REGISLEX_WORKFLOW_PAUSED;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_update(ctx, workflow),
+                          "Pause the workflow inside a transaction");
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_submit(ctx, &workflow->id, NULL, NULL, &run_id),
+                          "Cached definition used before the commit");
+    regislex_db_rollback(tx);
+
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_submit(ctx, &workflow->id, NULL, NULL, &run_id),
+                          "Submit accepted after the rollback");
+    TEST_ASSERT(run_wait(ctx, &run_id, REGISLEX_WORKFLOW_COMPLETED), "Run completes after the rollback");
+
+    /* A committed pause takes effect */
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_update(ctx, workflow), "Pause the workflow");
+    TEST_ASSERT_EQUAL_INT(REGISLEX_ERROR_INVALID_STATE,
+                          regislex_workflow_submit(ctx, &workflow->id, NULL, NULL, &run_id),
+                          "Submit refused once the pause commits");
+    regislex_workflow_executor_stop();
+
+    regislex_workflow_free(workflow);
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Workflow Event Log Tests
+ * ========================================================================== */
+
+static regislex_run_event_list_t* run_events(regislex_context_t* ctx, regislex_uuid_t* run_id,
+                                             int64_t since_ms, int64_t until_ms, int limit) {
+    regislex_run_event_filter_t filter;
+    regislex_run_event_list_t* list = NULL;
+    memset(&filter, 0, sizeof(filter));
+    filter.run_id = run_id;
+    filter.since_ms = since_ms;
+    filter.until_ms = until_ms;
+    filter.limit = limit;
+    return regislex_workflow_run_events(ctx, &filter, &list) == REGISLEX_OK ? list : NULL;
+}
+
+static void test_run_event_log(void) {
+    TEST_SUITE_BEGIN("Workflow Run Event Log");
+
+    regislex_context_t* ctx = test_context_open("run_event_log");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    regislex_workflow_t def;
+    regislex_workflow_t* logged = NULL;
+    regislex_workflow_t* broken = NULL;
+    memset(&def, 0, sizeof(def));
+    def.allow_parallel = true;
+    strcpy(def.name, "Logged");
+    regislex_workflow_create(ctx, &def, &logged);
+    strcpy(def.name, "Broken");
+    regislex_workflow_create(ctx, &def, &broken);
+    TEST_ASSERT(logged && broken, "Workflows created");
+    if (!logged || !broken) {
+        regislex_workflow_free(logged);
+        regislex_workflow_free(broken);
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+    action_append(ctx, &logged->id, REGISLEX_ACTION_CREATE_TASK, 1, "logged");
+    action_append(ctx, &logged->id, REGISLEX_ACTION_DELAY, 2, NULL);
+    action_append(ctx, &logged->id, REGISLEX_ACTION_CREATE_TASK, 3, "after");
+    regislex_workflow_activate(ctx, &logged->id);
+    /* An action type from a newer definition this build cannot run */
+    action_append(ctx, &broken->id, (regislex_action_type_t)(REGISLEX_ACTION_CUSTOM_SCRIPT + 1), 1, NULL);
+    regislex_workflow_activate(ctx, &broken->id);
+
+    regislex_workflow_executor_options_t options = { 2, 0, 0 };
+    regislex_workflow_executor_start(ctx, &options);
+
+    regislex_uuid_t run_id, action_id;
+    regislex_workflow_submit(ctx, &logged->id, NULL, NULL, &run_id);
+    TEST_ASSERT(run_parked(ctx, &run_id, &action_id), "Run parked on its delay");
+
+    /* Inside a transaction buffered events are read from memory, so a rollback loses none */
+    regislex_db_transaction_t* tx = NULL;
+    regislex_db_begin(regislex_get_db(ctx), &tx);
+    regislex_run_event_list_t* list = run_events(ctx, &run_id, 0, 0, 0);
+    TEST_ASSERT(list && list->count >= 2 && list->events[0].type == REGISLEX_RUN_EVENT_STARTED,
+                "Buffered events listed inside a transaction");
+    regislex_run_event_list_free(list);
+    regislex_db_rollback(tx);
+
+    /* Buffered events are stored before the list is read; the wait is logged after the timer */
+    list = run_events(ctx, &run_id, 0, 0, 0);
+    for (int i = 0; i < 500 && list && list->count < 3; i++) {
+        regislex_run_event_list_free(list);
+        platform_sleep_ms(10);
+        list = run_events(ctx, &run_id, 0, 0, 0);
+    }
+    TEST_ASSERT(list && list->count == 3, "Three events before the delay");
+    TEST_ASSERT(list && list->count == 3 &&
+                list->events[0].type == REGISLEX_RUN_EVENT_STARTED &&
+                list->events[1].type == REGISLEX_RUN_EVENT_STEP_COMPLETED &&
+                list->events[1].step == 0 &&
+                list->events[1].action_type == REGISLEX_ACTION_CREATE_TASK &&
+                list->events[1].action_id.value[0] && list->events[1].duration_ms >= 0 &&
+                list->events[2].type == REGISLEX_RUN_EVENT_STEP_WAITING &&
+                list->events[2].step == 1 &&
+                strcmp(list->events[2].action_id.value, action_id.value) == 0,
+                "Start, step outcome and wait recorded with their actions");
+    regislex_run_event_list_free(list);
+
+    /* The delay elapses across a restart */
+    regislex_workflow_executor_stop();
+    regislex_db_exec(regislex_get_db(ctx), "UPDATE workflow_timers SET fire_ms = 0");
+    platform_sleep_ms(5);
+    regislex_workflow_executor_start(ctx, &options);
+    TEST_ASSERT(run_wait(ctx, &run_id, REGISLEX_WORKFLOW_COMPLETED), "Run completes after restart");
+
+    regislex_uuid_t failed_id;
+    regislex_workflow_submit(ctx, &broken->id, NULL, NULL, &failed_id);
+    TEST_ASSERT(run_wait(ctx, &failed_id, REGISLEX_WORKFLOW_FAILED), "Broken run fails");
+    regislex_workflow_executor_stop();
+
+    list = run_events(ctx, &run_id, 0, 0, 0);
+    TEST_ASSERT(list && list->count == 6, "Whole run logged");
+    bool ordered = list != NULL;
+    for (int i = 1; list && i < list->count; i++) {
+        ordered &= list->events[i].id > list->events[i - 1].id &&
+                   list->events[i].occurred_ms >= list->events[i - 1].occurred_ms &&
+                   strcmp(list->events[i].run_id.value, run_id.value) == 0;
+    }
+    TEST_ASSERT(ordered, "Events in append order");
+    TEST_ASSERT(list && list->count == 6 &&
+                list->events[3].type == REGISLEX_RUN_EVENT_RESUMED &&
+                list->events[4].type == REGISLEX_RUN_EVENT_STEP_COMPLETED &&
+                list->events[4].step == 2 &&
+                list->events[5].type == REGISLEX_RUN_EVENT_COMPLETED &&
+                !list->events[5].action_id.value[0],
+                "Resume, last step and completion appended");
+
+    /* Time range and limit queries */
+    int64_t resumed_ms = list && list->count == 6 ? list->events[3].occurred_ms : 0;
+    regislex_run_event_list_free(list);
+    list = run_events(ctx, &run_id, 0, resumed_ms, 0);
+    TEST_ASSERT(list && list->count == 3, "Events before the restart");
+    regislex_run_event_list_free(list);
+    list = run_events(ctx, &run_id, resumed_ms, 0, 0);
+    TEST_ASSERT(list && list->count == 3 && list->events[0].type == REGISLEX_RUN_EVENT_RESUMED,
+                "Events since the restart");
+    regislex_run_event_list_free(list);
+    list = run_events(ctx, &run_id, 0, 0, 2);
+    TEST_ASSERT(list && list->count == 2 && list->events[1].type == REGISLEX_RUN_EVENT_STEP_COMPLETED,
+                "Limit keeps the oldest events");
+    regislex_run_event_list_free(list);
+
+    list = run_events(ctx, &failed_id, 0, 0, 0);
+    TEST_ASSERT(list && list->count == 3 &&
+                list->events[1].type == REGISLEX_RUN_EVENT_STEP_FAILED &&
+                list->events[1].error == REGISLEX_ERROR_UNSUPPORTED &&
+                strstr(list->events[1].message, "failed") != NULL &&
+                list->events[2].type == REGISLEX_RUN_EVENT_FAILED,
+                "Failed step logged with its error");
+    regislex_run_event_list_free(list);
+
+    list = run_events(ctx, NULL, 0, 0, 0);
+    TEST_ASSERT(list && list->count == 9, "Both runs in the log");
+    regislex_run_event_list_free(list);
+    TEST_ASSERT_EQUAL_INT(9, (int)db_count(ctx, "SELECT count(*) FROM workflow_run_events"),
+                          "Events stored once");
+
+    regislex_workflow_free(logged);
+    regislex_workflow_free(broken);
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Event Bus Tests
+ * ========================================================================== */
+
+static regislex_error_t trigger_append(regislex_context_t* ctx, const regislex_uuid_t* workflow_id,
+                                       regislex_event_type_t event_type, const char* event_name) {
+    regislex_trigger_t trigger;
+    regislex_trigger_t* added = NULL;
+
+    memset(&trigger, 0, sizeof(trigger));
+    strcpy(trigger.name, "trigger");
+    trigger.type = REGISLEX_TRIGGER_EVENT;
+    trigger.event_type = event_type;
+    if (event_name) strcpy(trigger.event_name, event_name);
+    trigger.is_active = true;
+    regislex_error_t err = regislex_trigger_add(ctx, workflow_id, &trigger, &added);
+    regislex_trigger_free(added);
+    return err;
+}
+
+/* Approve the runs waiting on an approval */
+static void approve_waiting(regislex_context_t* ctx) {
+    regislex_uuid_t waiting[16];
+    int count = 0;
+    memset(waiting, 0, sizeof(waiting));
+    regislex_db_stmt_t* stmt = NULL;
+    if (regislex_db_prepare(regislex_get_db(ctx), "SELECT run_id FROM workflow_timers", &stmt) != REGISLEX_OK) {
+        return;
+    }
+    while (count < 16 && regislex_db_step(stmt) == REGISLEX_OK) {
+        regislex_db_column_uuid(stmt, 0, &waiting[count++]);
+    }
+    regislex_db_finalize(stmt);
+
+    for (int i = 0; i < count; i++) {
+        regislex_workflow_approval_resolve(ctx, &waiting[i], true, NULL);
+    }
+}
+
+static void test_event_bus_quota(void) {
+    TEST_SUITE_BEGIN("Event Bus Quota");
+
+    regislex_context_t* ctx = test_context_open("event_bus");
+    TEST_ASSERT_NOT_NULL(ctx, "Context opened");
+    if (!ctx) {
+        TEST_SUITE_END();
+        return;
+    }
+
+    /* One run at a time, each parked on an approval, backs events up into the bus */
+    regislex_workflow_t def;
+    regislex_workflow_t* workflow = NULL;
+    memset(&def, 0, sizeof(def));
+    strcpy(def.name, "Listener");
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_workflow_create(ctx, &def, &workflow), "Create workflow");
+    if (!workflow) {
+        regislex_shutdown(ctx);
+        TEST_SUITE_END();
+        return;
+    }
+    action_append(ctx, &workflow->id, REGISLEX_ACTION_APPROVAL, 1, "gate");
+    TEST_ASSERT(trigger_append(ctx, &workflow->id, REGISLEX_EVENT_CUSTOM, "quota.test") == REGISLEX_OK &&
+                trigger_append(ctx, &workflow->id, REGISLEX_EVENT_CUSTOM, "drain.test") == REGISLEX_OK &&
+                trigger_append(ctx, &workflow->id, REGISLEX_EVENT_DEADLINE_PASSED, NULL) == REGISLEX_OK,
+                "Add event triggers");
+    regislex_workflow_activate(ctx, &workflow->id);
+
+    /* The sweep starts from a stored position, before a deadline that fell due */
+    regislex_db_exec(regislex_get_db(ctx),
+                     "INSERT INTO deadline_sweep_state (id, swept_until) VALUES (1, '2020-01-01T00:00:00Z')");
+    regislex_deadline_t dl;
+    regislex_deadline_t* created = NULL;
+    regislex_datetime_t now;
+    memset(&dl, 0, sizeof(dl));
+    strcpy(dl.title, "Passed");
+    dl.status = REGISLEX_STATUS_PENDING;
+    regislex_datetime_now(&now);
+    regislex_datetime_from_seconds(regislex_datetime_to_seconds(&now) - 3600, &dl.due_date);
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_deadline_create(ctx, &dl, &created), "Create passed deadline");
+    regislex_deadline_free(created);
+
+    regislex_workflow_executor_options_t executor_options = { 1, 0, 1 };
+    regislex_event_bus_options_t bus_options = { 2 };
+    TEST_ASSERT(regislex_workflow_executor_start(ctx, &executor_options) == REGISLEX_OK &&
+                regislex_event_bus_start(ctx, &bus_options) == REGISLEX_OK, "Start executor and bus");
+
+    regislex_event_t event;
+    memset(&event, 0, sizeof(event));
+    event.type = REGISLEX_EVENT_CUSTOM;
+    strcpy(event.name, "quota.test");
+    /* Full once refused repeatedly, with the dispatcher blocked on the executor */
+    regislex_error_t err = REGISLEX_OK;
+    int accepted = 0;
+    int refused = 0;
+    for (int i = 0; i < 50 && refused < 3; i++) {
+        err = regislex_event_publish(ctx, &event);
+        if (err == REGISLEX_OK) {
+            accepted++;
+            refused = 0;
+        } else {
+            refused++;
+        }
+        platform_sleep_ms(50);
+    }
+    TEST_ASSERT_EQUAL_INT(REGISLEX_ERROR_QUOTA_EXCEEDED, err, "Publish refused once the queue is full");
+    TEST_ASSERT(accepted <= 5, "Queue holds no more than its limit");
+
+    regislex_db_transaction_t* tx = NULL;
+    regislex_db_begin(regislex_get_db(ctx), &tx);
+    TEST_ASSERT_EQUAL_INT(REGISLEX_ERROR_QUOTA_EXCEEDED, regislex_event_publish(ctx, &event),
+                          "Full queue reported inside a transaction");
+    regislex_db_rollback(tx);
+
+    int published = -1;
+    TEST_ASSERT_EQUAL_INT(REGISLEX_ERROR_QUOTA_EXCEEDED, regislex_deadline_sweep(ctx, &published),
+                          "Sweep stopped by the full queue");
+    TEST_ASSERT_EQUAL_INT(1, (int)db_count(ctx,
+                              "SELECT count(*) FROM deadline_sweep_state WHERE swept_until = '2020-01-01T00:00:00Z'"),
+                          "Sweep position not advanced past the unqueued event");
+
+    /* As runs finish the bus drains, and the next sweep queues the event */
+    for (int i = 0; i < 200; i++) {
+        approve_waiting(ctx);
+        err = regislex_deadline_sweep(ctx, &published);
+        if (err != REGISLEX_ERROR_QUOTA_EXCEEDED) break;
+        platform_sleep_ms(20);
+    }
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, err, "Sweep succeeds once the queue drains");
+    TEST_ASSERT_EQUAL_INT(1, published, "Passed deadline published once");
+    TEST_ASSERT_EQUAL_INT(0, (int)db_count(ctx,
+                              "SELECT count(*) FROM deadline_sweep_state WHERE swept_until < '2021'"),
+                          "Sweep position advanced");
+
+    /* Stopping hands every queued event to the executor */
+    strcpy(event.name, "drain.test");
+    accepted = 0;
+    for (int i = 0; i < 200 && accepted == 0; i++) {
+        approve_waiting(ctx);
+        if (regislex_event_publish(ctx, &event) == REGISLEX_OK) {
+            accepted++;
+        } else {
+            platform_sleep_ms(20);
+        }
+    }
+    for (int i = 0; i < 10; i++) {
+        if (regislex_event_publish(ctx, &event) == REGISLEX_OK) accepted++;
+    }
+    regislex_event_bus_stop();
+    TEST_ASSERT(accepted > 0, "Events queued before the stop");
+    TEST_ASSERT_EQUAL_INT(accepted, (int)db_count(ctx,
+                              "SELECT count(*) FROM workflow_runs WHERE trigger_data LIKE '%drain.test%'"),
+                          "Every queued event became a run");
+    TEST_ASSERT_EQUAL_INT(REGISLEX_ERROR_NOT_INITIALIZED, regislex_event_publish(ctx, &event),
+                          "Stopped bus refuses events");
+    regislex_workflow_executor_stop();
+    regislex_workflow_free(workflow);
+    regislex_shutdown(ctx);
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Cron Tests
+ * ========================================================================== */
+
+/* Unix time in milliseconds of a UTC wall time */
+static int64_t utc_ms(int year, int month, int day, int hour, int minute) {
+    int y = month <= 2 ? year - 1 : year;
+    int era = (y >= 0 ? y : y - 399) / 400;
+    int yoe = y - era * 400;
+    int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    int64_t days = (int64_t)era * 146097 + doe - 719468;
+    return ((days * 24 + hour) * 60 + minute) * 60000;
+}
+
+static void test_cron_next_dst(void) {
+    TEST_SUITE_BEGIN("Cron Next Fire Across DST");
+
+    regislex_cron_t cron;
+    int64_t next = 0;
+
+    regislex_timezone_init();
+
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_cron_compile("0 9 * * MON-FRI", &cron),
+                          "Compile UTC expression");
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK, regislex_cron_next(&cron, utc_ms(2026, 1, 2, 9, 0), &next),
+                          "Next fire found");
+    TEST_ASSERT(next == utc_ms(2026, 1, 5, 9, 0), "Weekend skipped to Monday");
+
+    /* America/New_York springs forward at 02:00 EST on 2026-03-08 */
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK,
+                          regislex_cron_compile("CRON_TZ=America/New_York 30 2 * * *", &cron),
+                          "Compile zoned expression");
+    regislex_cron_next(&cron, utc_ms(2026, 3, 8, 5, 0), &next);
+    TEST_ASSERT(next == utc_ms(2026, 3, 8, 7, 30), "Skipped wall time shifts forward by the gap");
+    regislex_cron_next(&cron, next, &next);
+    TEST_ASSERT(next == utc_ms(2026, 3, 9, 6, 30), "Next day fires at 02:30 EDT");
+
+    /* ...and falls back at 02:00 EDT on 2026-11-01 */
+    regislex_cron_compile("CRON_TZ=America/New_York 30 1 * * *", &cron);
+    regislex_cron_next(&cron, utc_ms(2026, 11, 1, 4, 0), &next);
+    TEST_ASSERT(next == utc_ms(2026, 11, 1, 5, 30), "Repeated wall time fires at first occurrence");
+    regislex_cron_next(&cron, next, &next);
+    TEST_ASSERT(next == utc_ms(2026, 11, 2, 6, 30), "Repeated wall time does not fire twice");
+
+    TEST_ASSERT(regislex_cron_compile("CRON_TZ=Nowhere/Else * * * * *", &cron) != REGISLEX_OK,
+                "Unknown zone rejected");
+    TEST_ASSERT(regislex_cron_compile("61 * * * *", &cron) != REGISLEX_OK,
+                "Out of range minute rejected");
+
+    TEST_SUITE_END();
+}
+
+/* ============================================================================
+ * Condition Expression Tests
+ * ========================================================================== */
+
+static void cond_set_number(regislex_cond_env_t* env, regislex_cond_field_t field, int64_t value) {
+    env->numbers[field] = value;
+    env->present |= 1u << field;
+}
+
+static void cond_set_text(regislex_cond_env_t* env, regislex_cond_field_t field, const char* value) {
+    env->texts[field] = value;
+    env->present |= 1u << field;
+}
+
+/* Compile and evaluate in one step; a compile failure evaluates false */
+static bool cond_holds(const char* source, const regislex_cond_env_t* env) {
+    regislex_cond_program_t program;
+    if (regislex_cond_compile(source, &program) != REGISLEX_OK) return false;
+    return regislex_cond_eval(&program, env);
+}
+
+static void test_condition_bytecode(void) {
+    TEST_SUITE_BEGIN("Condition Expressions");
+
+    regislex_cond_env_t env;
+    regislex_cond_program_t program;
+    memset(&env, 0, sizeof(env));
+    cond_set_number(&env, REGISLEX_COND_FIELD_CASE_PRIORITY, REGISLEX_PRIORITY_URGENT);
+    cond_set_number(&env, REGISLEX_COND_FIELD_DEADLINE_DAYS_LEFT, 3);
+    cond_set_text(&env, REGISLEX_COND_FIELD_CASE_NUMBER, "2026-CV-0042");
+
+    TEST_ASSERT_EQUAL_INT(REGISLEX_OK,
+                          regislex_cond_compile("case.priority >= HIGH && deadline.days_left < 7", &program),
+                          "Compile conjunction");
+    TEST_ASSERT(program.fields == ((1u << REGISLEX_COND_FIELD_CASE_PRIORITY) |
+                                   (1u << REGISLEX_COND_FIELD_DEADLINE_DAYS_LEFT)),
+                "Program records the fields it reads");
+    TEST_ASSERT(regislex_cond_eval(&program, &env), "Conjunction holds");
+
+    regislex_cond_program_t copy = program;
+    env.numbers[REGISLEX_COND_FIELD_DEADLINE_DAYS_LEFT] = 10;
+    TEST_ASSERT(!regislex_cond_eval(&copy, &env), "Copied program evaluates against new values");
+    env.numbers[REGISLEX_COND_FIELD_DEADLINE_DAYS_LEFT] = 3;
+
+    TEST_ASSERT(cond_holds("case.priority == LOW || deadline.days_left <= 3 && true", &env),
+                "&& binds tighter than ||");
+    TEST_ASSERT(!cond_holds("(case.priority == LOW || deadline.days_left <= 3) && false", &env),
+                "Parentheses group");
+    TEST_ASSERT(cond_holds("!(deadline.days_left > 5)", &env), "Negation");
+    TEST_ASSERT(cond_holds("case.number == \"2026-CV-0042\"", &env), "Text equality");
+    TEST_ASSERT(cond_holds("case.number != \"2026-CV-0043\"", &env), "Text inequality");
+    TEST_ASSERT(cond_holds("deadline.days_left > -1", &env), "Negative constant");
+
+    TEST_ASSERT(!cond_holds("deadline.priority >= LOW", &env), "Missing field compares false");
+    TEST_ASSERT(cond_holds("!(deadline.priority >= LOW)", &env), "Negated missing field holds");
+
+    TEST_ASSERT(regislex_cond_compile("case.priority >=", &program) != REGISLEX_OK,
+                "Truncated expression rejected");
+    TEST_ASSERT(regislex_cond_compile("case.colour == 1", &program) != REGISLEX_OK,
+                "Unknown field rejected");
+    TEST_ASSERT(regislex_cond_compile("case.number < \"X\"", &program) != REGISLEX_OK,
+                "Ordered text comparison rejected");
+    TEST_ASSERT(regislex_cond_compile("(case.priority == HIGH", &program) != REGISLEX_OK,
+                "Unbalanced parenthesis rejected");
+
+    TEST_SUITE_END();
+}
+
 /* ============================================================================
  * Main Test Runner
  * ========================================================================== */
@@ -557,6 +3521,31 @@ int main(int argc, char* argv[]) {
     test_path_matching();
     test_query_parsing();
     test_string_utils();
+    test_conflict_index();
+    test_case_detail();
+    test_case_hierarchy();
+    test_caseload_counters();
+    test_streaming_cursors();
+    test_typed_metadata();
+    test_bulk_reassign();
+    test_court_days();
+    test_court_rule_chains();
+    test_reminder_dispatch();
+    test_statute_index();
+    test_rrule_expansion();
+    test_calendar_feed_sync();
+    test_schedule_conflicts();
+    test_timezone_resolution();
+    test_agenda_merge();
+    test_holiday_recompute();
+    test_executor_resume();
+    test_executor_versions();
+    test_executor_admission();
+    test_executor_invalidate_commit();
+    test_run_event_log();
+    test_event_bus_quota();
+    test_cron_next_dst();
+    test_condition_bytecode();
 
     /* Print summary */
     printf("\n================================================================================\n");